@@ -18,18 +18,24 @@
 #include "utility.h"
 #include "contour_generator.h"
 #include "segment_merger.h"
+#include "segment_recorder.h"
 #include <algorithm>
 
 #include "gdal.h"
 #include "gdal_alg.h"
+#include "gdal_thread_pool.h"
 #include "cpl_conv.h"
 #include "cpl_string.h"
+#include "cpl_worker_thread_pool.h"
 #include "ogr_api.h"
 #include "ogr_srs_api.h"
 #include "ogr_geometry.h"
 
 #include <climits>
 #include <limits>
+#include <memory>
+#include <string>
+#include <vector>
 
 static CPLErr OGRPolygonContourWriter(double dfLevelMin, double dfLevelMax,
                                       const OGRMultiPolygon &multipoly,
@@ -272,6 +278,172 @@ CPLErr OGRContourWriter(double dfLevel, int nPoints, double *padfX,
     return eErr == OGRERR_NONE ? CE_None : CE_Failure;
 }
 
+/************************************************************************/
+/*                        ContourGenerateFromBand()                     */
+/************************************************************************/
+
+// Run the marching squares over hBand, feeding the segments to writer.
+// When nThreads > 1, the squares of horizontal strips of the raster are
+// computed in parallel, and the recorded segments are replayed into writer
+// in raster order. As the segment merging remains sequential, the output is
+// the same as with a single thread.
+template <typename Writer, typename LevelGenerator>
+static bool ContourGenerateFromBand(GDALRasterBandH hBand, bool useNoData,
+                                    double noDataValue, Writer &writer,
+                                    LevelGenerator &levels, int nThreads,
+                                    GDALProgressFunc pfnProgress,
+                                    void *pProgressArg)
+{
+    using namespace marching_squares;
+
+    const int nXSize = GDALGetRasterBandXSize(hBand);
+    const int nYSize = GDALGetRasterBandYSize(hBand);
+    CPLWorkerThreadPool *poPool =
+        nThreads > 1 && nYSize > 1 ? GDALGetGlobalThreadPool(nThreads)
+                                   : nullptr;
+    if (poPool == nullptr)
+    {
+        ContourGeneratorFromRaster<Writer, LevelGenerator> cg(
+            hBand, useNoData, noDataValue, writer, levels);
+        return cg.process(pfnProgress, pProgressArg);
+    }
+
+    // Strips of about 1 MB of input values, with at least one strip per
+    // thread.
+    constexpr int STRIP_SIZE_BYTES = 1024 * 1024;
+    const int nStripHeight = std::max(
+        1, std::min(nYSize / nThreads,
+                    std::max(16, static_cast<int>(STRIP_SIZE_BYTES /
+                                                  (sizeof(double) * nXSize)))));
+
+    struct Strip
+    {
+        explicit Strip(bool polygonize) : recorder(polygonize)
+        {
+        }
+
+        int nFirstLine = 0;
+        int nLines = 0;
+        // Values of line nFirstLine - 1 (if nFirstLine > 0), followed by
+        // the ones of the nLines lines of the strip.
+        std::vector<double> adfValues{};
+        SegmentRecorder recorder;
+        std::string osError{};
+    };
+
+    // Two batches of strips: one whose squares are being computed while
+    // the segments of the other one are merged.
+    std::vector<std::unique_ptr<Strip>> aapoBatches[2];
+    for (auto &apoBatch : aapoBatches)
+    {
+        for (int i = 0; i < nThreads; ++i)
+            apoBatch.push_back(std::make_unique<Strip>(writer.polygonize));
+    }
+    const auto ProcessStrip = [nXSize, nYSize, useNoData, noDataValue,
+                               &levels](Strip *poStrip)
+    {
+        try
+        {
+            SegmentRecorder &recorder = poStrip->recorder;
+            ContourGenerator<SegmentRecorder, LevelGenerator> cg(
+                nXSize, nYSize, useNoData, noDataValue, recorder, levels);
+            const double *padfLine = poStrip->adfValues.data();
+            if (poStrip->nFirstLine > 0)
+            {
+                cg.setStartLine(poStrip->nFirstLine, padfLine);
+                padfLine += nXSize;
+            }
+            for (int i = 0; i < poStrip->nLines; ++i, padfLine += nXSize)
+                cg.feedLine(padfLine);
+        }
+        catch (const std::exception &e)
+        {
+            poStrip->osError = e.what();
+        }
+    };
+
+    // Declared after the strips and ProcessStrip, so that pending jobs are
+    // completed before those are destroyed.
+    std::unique_ptr<CPLJobQueue> apoQueues[2] = {poPool->CreateJobQueue(),
+                                                 poPool->CreateJobQueue()};
+
+    // Read the values of the strips of a batch and submit their processing.
+    int nNextLine = 0;
+    const auto SubmitBatch = [&](int iBatch)
+    {
+        for (auto &poStrip : aapoBatches[iBatch])
+        {
+            poStrip->recorder.clear();
+            poStrip->nFirstLine = nNextLine;
+            poStrip->nLines = std::min(nStripHeight, nYSize - nNextLine);
+            if (poStrip->nLines == 0)
+                continue;
+            nNextLine += poStrip->nLines;
+
+            const int nReadFirstLine = std::max(0, poStrip->nFirstLine - 1);
+            const int nReadLines =
+                poStrip->nFirstLine + poStrip->nLines - nReadFirstLine;
+            try
+            {
+                poStrip->adfValues.resize(static_cast<size_t>(nReadLines) *
+                                          nXSize);
+            }
+            catch (const std::exception &)
+            {
+                CPLError(CE_Failure, CPLE_OutOfMemory,
+                         "Out of memory allocating contour buffer");
+                return false;
+            }
+            if (GDALRasterIO(hBand, GF_Read, 0, nReadFirstLine, nXSize,
+                             nReadLines, poStrip->adfValues.data(), nXSize,
+                             nReadLines, GDT_Float64, 0, 0) != CE_None)
+            {
+                CPLDebug("CONTOUR", "failed fetch %d %d", nReadFirstLine,
+                         nXSize);
+                return false;
+            }
+            Strip *poStripPtr = poStrip.get();
+            apoQueues[iBatch]->SubmitJob([&ProcessStrip, poStripPtr]()
+                                         { ProcessStrip(poStripPtr); });
+        }
+        return true;
+    };
+
+    if (!SubmitBatch(0))
+        return false;
+    for (int iCur = 0;; iCur = 1 - iCur)
+    {
+        apoQueues[iCur]->WaitCompletion();
+        if (aapoBatches[iCur][0]->nLines == 0)
+            break;
+        if (!SubmitBatch(1 - iCur))
+            return false;
+
+        for (const auto &poStrip : aapoBatches[iCur])
+        {
+            if (poStrip->nLines == 0)
+                break;
+            if (!poStrip->osError.empty())
+            {
+                CPLError(CE_Failure, CPLE_AppDefined, "%s",
+                         poStrip->osError.c_str());
+                return false;
+            }
+            if (!pfnProgress(static_cast<double>(poStrip->nFirstLine) /
+                                 nYSize,
+                             "Processing line", pProgressArg))
+            {
+                return false;
+            }
+            const SegmentRecorder &recorder = poStrip->recorder;
+            for (size_t i = 0; i < recorder.linesCount(); ++i)
+                recorder.replayLine(i, writer);
+        }
+    }
+
+    return pfnProgress(1.0, "", pProgressArg) != FALSE;
+}
+
 /************************************************************************/
 /*                        GDALContourGenerate()                         */
 /************************************************************************/
@@ -563,6 +735,14 @@ mode.
  * A negative value means a single transaction. The function takes care of
  * issuing the starting transaction and committing the final one.
  *
+ *   NUM_THREADS=num|ALL_CPUS
+ *
+ * (GDAL >= 3.12) Number of threads used to compute the contours. When
+ * greater than 1, horizontal strips of the raster are processed in parallel,
+ * while the contour segments are still assembled in raster order, so that
+ * the output does not depend on the number of threads. Defaults to the value
+ * of the GDAL_NUM_THREADS configuration option, or 1.
+ *
  * @return CE_None on success or CE_Failure if an error occurs.
  */
 CPLErr GDALContourGenerateEx(GDALRasterBandH hBand, void *hLayer,
@@ -680,6 +860,9 @@ CPLErr GDALContourGenerateEx(GDALRasterBandH hBand, void *hLayer,
 
     bool polygonize = CPLFetchBool(options, "POLYGONIZE", false);
 
+    const int nThreads =
+        GDALGetNumThreads(CSLFetchNameValue(options, "NUM_THREADS"));
+
     using namespace marching_squares;
 
     OGRContourWriterInfo oCWI;
@@ -854,10 +1037,9 @@ CPLErr GDALContourGenerateEx(GDALRasterBandH hBand, void *hLayer,
                 aoiSkipLevels.push_back(0);
                 aoiSkipLevels.push_back(static_cast<int>(levels.levelsCount()));
                 writer.setSkipLevels(aoiSkipLevels);
-                ContourGeneratorFromRaster<decltype(writer),
-                                           FixedLevelRangeIterator>
-                    cg(hBand, useNoData, noDataValue, writer, levels);
-                ok = cg.process(pfnProgress, pProgressArg);
+                ok = ContourGenerateFromBand(hBand, useNoData, noDataValue,
+                                             writer, levels, nThreads,
+                                             pfnProgress, pProgressArg);
             }
         }
         else
@@ -897,10 +1079,9 @@ CPLErr GDALContourGenerateEx(GDALRasterBandH hBand, void *hLayer,
                     &fixedLevels[0], fixedLevels.size(), dfMinimum, dfMaximum);
                 SegmentMerger<GDALRingAppender, FixedLevelRangeIterator> writer(
                     appender, levels, /* polygonize */ false);
-                ContourGeneratorFromRaster<decltype(writer),
-                                           FixedLevelRangeIterator>
-                    cg(hBand, useNoData, noDataValue, writer, levels);
-                ok = cg.process(pfnProgress, pProgressArg);
+                ok = ContourGenerateFromBand(hBand, useNoData, noDataValue,
+                                             writer, levels, nThreads,
+                                             pfnProgress, pProgressArg);
             }
         }
     }
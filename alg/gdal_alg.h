@@ -242,6 +242,18 @@ int CPL_DLL GDALApproxTransform(void *pTransformArg, int bDstToSrc,
                                 int nPointCount, double *x, double *y,
                                 double *z, int *panSuccess);
 
+/* Coordinate grid transformer */
+void CPL_DLL *
+GDALCreateCoordGridTransformer(GDALTransformerFunc pfnBaseTransformer,
+                               void *pBaseTransformArg, double dfMaxError,
+                               CSLConstList papszOptions);
+void CPL_DLL GDALCoordGridTransformerOwnsSubtransformer(void *pCBData,
+                                                        int bOwnFlag);
+void CPL_DLL GDALDestroyCoordGridTransformer(void *pTransformArg);
+int CPL_DLL GDALCoordGridTransform(void *pTransformArg, int bDstToSrc,
+                                   int nPointCount, double *x, double *y,
+                                   double *z, int *panSuccess);
+
 int CPL_DLL CPL_STDCALL GDALSimpleImageWarp(
     GDALDatasetH hSrcDS, GDALDatasetH hDstDS, int nBandCount, int *panBandList,
     GDALTransformerFunc pfnTransform, void *pTransformArg,
@@ -19,8 +19,12 @@
 #ifndef DOXYGEN_SKIP
 
 #include <cstdint>
+#include <cstring>
 
+#include <functional>
+#include <memory>
 #include <set>
+#include <vector>
 
 #include "gdal_alg.h"
 #include "ogr_spatialref.h"
@@ -152,6 +156,69 @@ struct IntEqualityTest
 typedef GDALRasterPolygonEnumeratorT<std::int64_t, IntEqualityTest>
     GDALRasterPolygonEnumerator;
 
+/************************************************************************/
+/*                  GDALRasterPolygonStripEnumeratorT                   */
+/************************************************************************/
+
+// Polygon enumeration of a raster split into horizontal strips, so that it
+// can be done by several threads. Each strip is enumerated independently
+// with EnumerateStrip(). The strips must then be registered in order with
+// AddStrip(), which merges polygons across strip boundaries. After
+// CompleteMerges(), each polygon is identified by the smallest global id of
+// its fragments, and GetFinalIds() returns the final polygon ids of the
+// pixels of a strip. EnumerateStrip() and GetFinalIds() are thread-safe, do
+// not emit errors, and return false on memory allocation failure.
+
+template <class DataType, class EqualityTest>
+class GDALRasterPolygonStripEnumeratorT
+{
+  public:
+    struct Strip
+    {
+        // Local polygon id to smallest local id of the same polygon.
+        std::vector<GInt32> anIdMap{};
+        std::vector<DataType> anPolyValue{};
+        // Number of pixels of each local polygon id, if requested.
+        std::vector<int> anPolySize{};
+        // Polygon ids of the first and last lines of the strip. Local ids
+        // after EnumerateStrip(), global ids after AddStrip().
+        std::vector<GInt32> anFirstLineId{};
+        std::vector<GInt32> anLastLineId{};
+        std::vector<GInt32> anWorkLineId{};
+    };
+
+  private:
+    int nConnectedness = 0;
+    int nXSize = 0;
+    std::vector<GInt32> anStripFirstId{};
+
+    GInt32 FindRoot(GInt32 nId);
+    void Union(GInt32 nId1, GInt32 nId2);
+
+    CPL_DISALLOW_COPY_ASSIGN(GDALRasterPolygonStripEnumeratorT)
+
+  public:  // these are intended to be readonly.
+    // Global polygon id to final polygon id, once merges are completed.
+    std::vector<GInt32> anPolyIdMap{};
+    std::vector<DataType> anPolyValue{};
+
+  public:
+    GDALRasterPolygonStripEnumeratorT(int nConnectedness, int nXSize);
+
+    static int GetStripHeight(int nXSize);
+
+    bool EnumerateStrip(Strip &oStrip, DataType *panVal, int nLines,
+                        bool bComputeSizes) const;
+
+    bool AddStrip(Strip &oStrip, DataType *panFirstLineVal,
+                  const DataType *panPrevLineVal, const GInt32 *panPrevLineId);
+
+    void CompleteMerges();
+
+    bool GetFinalIds(int iStrip, Strip &oStrip, DataType *panVal, int nLines,
+                     GInt32 *panIds) const;
+};
+
 constexpr const char *GDAL_APPROX_TRANSFORMER_CLASS_NAME =
     "GDALApproxTransformer";
 constexpr const char *GDAL_GEN_IMG_TRANSFORMER_CLASS_NAME =
@@ -159,6 +226,8 @@ constexpr const char *GDAL_GEN_IMG_TRANSFORMER_CLASS_NAME =
 constexpr const char *GDAL_RPC_TRANSFORMER_CLASS_NAME = "GDALRPCTransformer";
 constexpr const char *GDAL_REPROJECTION_TRANSFORMER_CLASS_NAME =
     "GDALReprojectionTransformer";
+constexpr const char *GDAL_COORD_GRID_TRANSFORMER_CLASS_NAME =
+    "GDALCoordGridTransformer";
 
 bool GDALIsTransformer(void *hTransformerArg, const char *pszClassName);
 
@@ -180,11 +249,15 @@ void CPL_DLL *GDALCloneTransformer(void *pTransformerArg);
 
 void GDALRefreshGenImgProjTransformer(void *hTransformArg);
 void GDALRefreshApproxTransformer(void *hTransformArg);
+void GDALRefreshCoordGridTransformer(void *hTransformArg);
+void GDALResetCoordGridTransformerGrid(void *hTransformArg);
 
 int GDALTransformLonLatToDestGenImgProjTransformer(void *hTransformArg,
                                                    double *pdfX, double *pdfY);
 int GDALTransformLonLatToDestApproxTransformer(void *hTransformArg,
                                                double *pdfX, double *pdfY);
+int GDALTransformLonLatToDestCoordGridTransformer(void *hTransformArg,
+                                                  double *pdfX, double *pdfY);
 
 bool GDALTransformIsTranslationOnPixelBoundaries(
     GDALTransformerFunc pfnTransformer, void *pTransformerArg);
@@ -301,6 +374,40 @@ struct GDALApproxTransformInfo
     operator=(const GDALApproxTransformInfo &) = delete;
 };
 
+/************************************************************************/
+/* ==================================================================== */
+/*      Coordinate grid transformer.                                    */
+/* ==================================================================== */
+/************************************************************************/
+
+class GDALCoordGrid;
+
+struct GDALCoordGridTransformInfo
+{
+    GDALTransformerInfo sTI;
+
+    GDALTransformerFunc pfnBaseTransformer = nullptr;
+    void *pBaseCBData = nullptr;
+
+    int bOwnSubtransformer = 0;
+
+    // Set when the base transformer does not behave as when the grid was
+    // computed (CHECK_WITH_INVERT_PROJ), in which case the grid is ignored.
+    bool bBypassGrid = false;
+
+    // Shared with clones
+    std::shared_ptr<GDALCoordGrid> poGrid{};
+
+    GDALCoordGridTransformInfo() : sTI()
+    {
+        memset(&sTI, 0, sizeof(sTI));
+    }
+
+    GDALCoordGridTransformInfo(const GDALCoordGridTransformInfo &) = delete;
+    GDALCoordGridTransformInfo &
+    operator=(const GDALCoordGridTransformInfo &) = delete;
+};
+
 /************************************************************************/
 /* ==================================================================== */
 /*                       GDALGenImgProjTransformer                      */
@@ -410,6 +517,44 @@ void *GDALCreateGeoLocTransformerEx(GDALDatasetH hBaseDS,
                                     int bReversed, const char *pszSourceDataset,
                                     CSLConstList papszTransformOptions);
 
+class CPLWorkerThreadPool;
+
+// Run fnJob(iJob) for iJob in [0, nJobs[, on the thread pool if not null,
+// and wait for their completion.
+void GDALRunJobs(CPLWorkerThreadPool *poPool, int nJobs,
+                 const std::function<void(int)> &fnJob);
+
+// Read nLines lines of hSrcBand starting at iYStart into panVal, as eDT,
+// and optionally their unmasked values into panUnmaskedVal. Pixels for which
+// hMaskBand (if not null) is zero are set to GP_NODATA_MARKER in panVal.
+// pabyMaskLine is a working buffer of nXSize bytes.
+template <class DataType>
+CPLErr GDALReadStripBatch(GDALRasterBandH hSrcBand, GDALRasterBandH hMaskBand,
+                          GByte *pabyMaskLine, int iYStart, int nLines,
+                          int nXSize, GDALDataType eDT, DataType *panVal,
+                          DataType *panUnmaskedVal = nullptr)
+{
+    CPLErr eErr = GDALRasterIO(hSrcBand, GF_Read, 0, iYStart, nXSize, nLines,
+                               panVal, nXSize, nLines, eDT, 0, 0);
+    if (eErr == CE_None && panUnmaskedVal)
+        memcpy(panUnmaskedVal, panVal,
+               static_cast<size_t>(nLines) * nXSize * sizeof(DataType));
+    for (int iLine = 0; eErr == CE_None && hMaskBand != nullptr &&
+                        iLine < nLines;
+         ++iLine)
+    {
+        eErr = GDALRasterIO(hMaskBand, GF_Read, 0, iYStart + iLine, nXSize, 1,
+                            pabyMaskLine, nXSize, 1, GDT_Byte, 0, 0);
+        DataType *panLineVal = panVal + static_cast<size_t>(iLine) * nXSize;
+        for (int i = 0; eErr == CE_None && i < nXSize; i++)
+        {
+            if (pabyMaskLine[i] == 0)
+                panLineVal[i] = GP_NODATA_MARKER;
+        }
+    }
+    return eErr;
+}
+
 #endif /* #ifndef DOXYGEN_SKIP */
 
 #endif /* ndef GDAL_ALG_PRIV_H_INCLUDED */
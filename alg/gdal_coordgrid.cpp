@@ -0,0 +1,880 @@
+/******************************************************************************
+ *
+ * Project:  Coordinate Grid Transformer
+ * Purpose:  Transformer that interpolates destination to source coordinates
+ *           from a lazily computed, optionally persisted, lookup grid.
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "cpl_port.h"
+#include "gdal_alg.h"
+#include "gdal_alg_priv.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "cpl_conv.h"
+#include "cpl_error.h"
+#include "cpl_mem_cache.h"
+#include "cpl_minixml.h"
+#include "cpl_multiproc.h"
+#include "cpl_sha256.h"
+#include "cpl_string.h"
+#include "cpl_vsi.h"
+#include "cpl_vsi_virtual.h"
+
+CPL_C_START
+void *GDALDeserializeCoordGridTransformer(CPLXMLNode *psTree);
+CPL_C_END
+
+// Number of grid cells along each side of a block of the grid
+constexpr int CELLS_PER_BLOCK = 32;
+constexpr int NODES_PER_BLOCK_LINE = CELLS_PER_BLOCK + 1;
+constexpr int NODE_COUNT = NODES_PER_BLOCK_LINE * NODES_PER_BLOCK_LINE;
+constexpr int CELL_COUNT = CELLS_PER_BLOCK * CELLS_PER_BLOCK;
+
+constexpr int DEFAULT_STEP = 16;
+
+// Maximum number of blocks kept in memory (about 18 MB), which covers
+// 16384 x 16384 destination pixels with the default step.
+constexpr size_t MAX_CACHED_BLOCKS = 1024;
+
+// Beyond that, destination coordinates are transformed with the base
+// transformer, so that block indices cannot overflow.
+constexpr double MAX_ABS_CELL_INDEX = 1e9;
+
+constexpr const char COORD_GRID_MAGIC[] = "GDALCGRD";
+constexpr uint32_t COORD_GRID_VERSION = 2;
+
+/************************************************************************/
+/*                            GDALCoordGrid                             */
+/************************************************************************/
+
+/** Grid of source pixel/line coordinates, indexed by destination pixel/line
+ * coordinates, and computed block by block on demand.
+ *
+ * It is shared between a coordinate grid transformer and its clones, and
+ * when a cache directory is set, it is loaded from it at creation and saved
+ * back to it at destruction if new blocks have been computed. At most
+ * MAX_CACHED_BLOCKS blocks, the most recently used ones, are kept in memory
+ * and saved.
+ *
+ * Cache files use the native byte order: a file written on a host of a
+ * different endianness is rejected by the version check, and recomputed.
+ */
+class GDALCoordGrid
+{
+  public:
+    struct Block
+    {
+        // Source coordinates of the nodes of the block, by row.
+        std::vector<double> adfX{};
+        std::vector<double> adfY{};
+        // Whether bilinear interpolation is accurate enough in each cell.
+        std::vector<GByte> abyValidCell{};
+    };
+
+    GDALCoordGrid(int nStep, double dfMaxError, const std::string &osCacheDir,
+                  const std::string &osFilename);
+    ~GDALCoordGrid();
+
+    int GetStep() const
+    {
+        return m_nStep;
+    }
+
+    double GetMaxError() const
+    {
+        return m_dfMaxError;
+    }
+
+    const std::string &GetCacheDir() const
+    {
+        return m_osCacheDir;
+    }
+
+    std::shared_ptr<const Block> GetBlock(GDALTransformerFunc pfnBase,
+                                          void *pBaseCBData, int nBlockX,
+                                          int nBlockY);
+
+  private:
+    const int m_nStep;
+    const double m_dfMaxError;
+    const std::string m_osCacheDir;
+    const std::string m_osFilename;
+
+    std::mutex m_oMutex{};
+    // Key is (nBlockY << 32) | nBlockX
+    lru11::Cache<uint64_t, std::shared_ptr<const Block>> m_oCacheBlocks{
+        MAX_CACHED_BLOCKS, 0};
+    bool m_bDirty = false;
+
+    static uint64_t GetKey(int nBlockX, int nBlockY)
+    {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(nBlockY)) << 32) |
+               static_cast<uint32_t>(nBlockX);
+    }
+
+    void Load();
+    void Save() const;
+
+    CPL_DISALLOW_COPY_ASSIGN(GDALCoordGrid)
+};
+
+/************************************************************************/
+/*                           GDALCoordGrid()                            */
+/************************************************************************/
+
+GDALCoordGrid::GDALCoordGrid(int nStep, double dfMaxError,
+                             const std::string &osCacheDir,
+                             const std::string &osFilename)
+    : m_nStep(nStep), m_dfMaxError(dfMaxError), m_osCacheDir(osCacheDir),
+      m_osFilename(osFilename)
+{
+    if (!m_osFilename.empty())
+        Load();
+}
+
+/************************************************************************/
+/*                           ~GDALCoordGrid()                           */
+/************************************************************************/
+
+GDALCoordGrid::~GDALCoordGrid()
+{
+    if (m_bDirty && !m_osFilename.empty())
+        Save();
+}
+
+/************************************************************************/
+/*                               Load()                                 */
+/************************************************************************/
+
+void GDALCoordGrid::Load()
+{
+    VSIVirtualHandleUniquePtr fp(VSIFOpenL(m_osFilename.c_str(), "rb"));
+    if (!fp)
+        return;
+
+    char szMagic[sizeof(COORD_GRID_MAGIC) - 1] = {};
+    uint32_t nVersion = 0;
+    int32_t nStep = 0;
+    int32_t nCellsPerBlock = 0;
+    double dfMaxError = 0;
+    uint64_t nBlocks = 0;
+    if (fp->Read(szMagic, sizeof(szMagic), 1) != 1 ||
+        memcmp(szMagic, COORD_GRID_MAGIC, sizeof(szMagic)) != 0 ||
+        fp->Read(&nVersion, sizeof(nVersion), 1) != 1 ||
+        nVersion != COORD_GRID_VERSION ||
+        fp->Read(&nStep, sizeof(nStep), 1) != 1 || nStep != m_nStep ||
+        fp->Read(&nCellsPerBlock, sizeof(nCellsPerBlock), 1) != 1 ||
+        nCellsPerBlock != CELLS_PER_BLOCK ||
+        fp->Read(&dfMaxError, sizeof(dfMaxError), 1) != 1 ||
+        dfMaxError != m_dfMaxError ||
+        fp->Read(&nBlocks, sizeof(nBlocks), 1) != 1)
+    {
+        CPLDebug("COORDGRID", "Ignoring incompatible cache file %s",
+                 m_osFilename.c_str());
+        return;
+    }
+
+    for (uint64_t i = 0; i < nBlocks; ++i)
+    {
+        int32_t anBlockXY[2] = {0, 0};
+        auto poBlock = std::make_shared<Block>();
+        poBlock->adfX.resize(NODE_COUNT);
+        poBlock->adfY.resize(NODE_COUNT);
+        poBlock->abyValidCell.resize(CELL_COUNT);
+        if (fp->Read(anBlockXY, sizeof(anBlockXY), 1) != 1 ||
+            fp->Read(poBlock->adfX.data(), sizeof(double), NODE_COUNT) !=
+                NODE_COUNT ||
+            fp->Read(poBlock->adfY.data(), sizeof(double), NODE_COUNT) !=
+                NODE_COUNT ||
+            fp->Read(poBlock->abyValidCell.data(), 1, CELL_COUNT) !=
+                CELL_COUNT)
+        {
+            CPLDebug("COORDGRID", "Ignoring truncated cache file %s",
+                     m_osFilename.c_str());
+            m_oCacheBlocks.clear();
+            return;
+        }
+        m_oCacheBlocks.insert(GetKey(anBlockXY[0], anBlockXY[1]),
+                              std::move(poBlock));
+    }
+
+    CPLDebug("COORDGRID", "Loaded %d blocks from %s",
+             static_cast<int>(m_oCacheBlocks.size()), m_osFilename.c_str());
+}
+
+/************************************************************************/
+/*                               Save()                                 */
+/************************************************************************/
+
+void GDALCoordGrid::Save() const
+{
+    // Write to a temporary file and rename it, so that concurrent processes
+    // sharing the cache directory never see a partially written file.
+    const std::string osTmpFilename =
+        CPLSPrintf("%s.%d." CPL_FRMT_GIB ".tmp", m_osFilename.c_str(),
+                   CPLGetCurrentProcessID(), CPLGetPID());
+    VSIVirtualHandleUniquePtr fp(VSIFOpenL(osTmpFilename.c_str(), "wb"));
+    if (!fp)
+    {
+        VSIMkdirRecursive(m_osCacheDir.c_str(), 0755);
+        fp.reset(VSIFOpenL(osTmpFilename.c_str(), "wb"));
+        if (!fp)
+        {
+            CPLDebug("COORDGRID", "Cannot create %s", osTmpFilename.c_str());
+            return;
+        }
+    }
+
+    // Write the least recently used blocks first, so that their recency
+    // order is preserved once reloaded.
+    std::vector<std::pair<uint64_t, std::shared_ptr<const Block>>> aoBlocks;
+    const auto CollectBlock =
+        [&aoBlocks](const lru11::KeyValuePair<
+                    uint64_t, std::shared_ptr<const Block>> &oKeyValue)
+    { aoBlocks.emplace_back(oKeyValue.key, oKeyValue.value); };
+    m_oCacheBlocks.cwalk(CollectBlock);
+    std::reverse(aoBlocks.begin(), aoBlocks.end());
+
+    const int32_t nStep = m_nStep;
+    const int32_t nCellsPerBlock = CELLS_PER_BLOCK;
+    const uint64_t nBlocks = aoBlocks.size();
+    bool bOK =
+        fp->Write(COORD_GRID_MAGIC, sizeof(COORD_GRID_MAGIC) - 1, 1) == 1 &&
+        fp->Write(&COORD_GRID_VERSION, sizeof(COORD_GRID_VERSION), 1) == 1 &&
+        fp->Write(&nStep, sizeof(nStep), 1) == 1 &&
+        fp->Write(&nCellsPerBlock, sizeof(nCellsPerBlock), 1) == 1 &&
+        fp->Write(&m_dfMaxError, sizeof(m_dfMaxError), 1) == 1 &&
+        fp->Write(&nBlocks, sizeof(nBlocks), 1) == 1;
+    for (const auto &[nKey, poBlock] : aoBlocks)
+    {
+        if (!bOK)
+            break;
+        const int32_t anBlockXY[2] = {
+            static_cast<int32_t>(static_cast<uint32_t>(nKey)),
+            static_cast<int32_t>(static_cast<uint32_t>(nKey >> 32))};
+        bOK = fp->Write(anBlockXY, sizeof(anBlockXY), 1) == 1 &&
+              fp->Write(poBlock->adfX.data(), sizeof(double), NODE_COUNT) ==
+                  NODE_COUNT &&
+              fp->Write(poBlock->adfY.data(), sizeof(double), NODE_COUNT) ==
+                  NODE_COUNT &&
+              fp->Write(poBlock->abyValidCell.data(), 1, CELL_COUNT) ==
+                  CELL_COUNT;
+    }
+    bOK = fp->Close() == 0 && bOK;
+    fp.reset();
+
+    if (!bOK || VSIRename(osTmpFilename.c_str(), m_osFilename.c_str()) != 0)
+    {
+        CPLDebug("COORDGRID", "Cannot write %s", m_osFilename.c_str());
+        VSIUnlink(osTmpFilename.c_str());
+        return;
+    }
+
+    CPLDebug("COORDGRID", "Saved %d blocks to %s", static_cast<int>(nBlocks),
+             m_osFilename.c_str());
+}
+
+/************************************************************************/
+/*                             GetBlock()                               */
+/************************************************************************/
+
+std::shared_ptr<const GDALCoordGrid::Block>
+GDALCoordGrid::GetBlock(GDALTransformerFunc pfnBase, void *pBaseCBData,
+                        int nBlockX, int nBlockY)
+{
+    const uint64_t nKey = GetKey(nBlockX, nBlockY);
+    {
+        std::lock_guard oLock(m_oMutex);
+        std::shared_ptr<const Block> poBlock;
+        if (m_oCacheBlocks.tryGet(nKey, poBlock))
+            return poBlock;
+    }
+
+    // Transform the nodes of the block, followed by the centers of its cells
+    // that are used to check the accuracy of the interpolation. This is done
+    // without holding the mutex: if another thread computes the same block
+    // concurrently, the first inserted one wins.
+    // Only X and Y are used by the interpolation.
+    std::vector<double> adfX(NODE_COUNT + CELL_COUNT);
+    std::vector<double> adfY(NODE_COUNT + CELL_COUNT);
+    std::vector<double> adfZ(NODE_COUNT + CELL_COUNT);
+    std::vector<int> abSuccess(NODE_COUNT + CELL_COUNT);
+    const double dfX0 =
+        static_cast<double>(nBlockX) * CELLS_PER_BLOCK * m_nStep;
+    const double dfY0 =
+        static_cast<double>(nBlockY) * CELLS_PER_BLOCK * m_nStep;
+    for (int j = 0; j < NODES_PER_BLOCK_LINE; ++j)
+    {
+        for (int i = 0; i < NODES_PER_BLOCK_LINE; ++i)
+        {
+            adfX[j * NODES_PER_BLOCK_LINE + i] = dfX0 + i * m_nStep;
+            adfY[j * NODES_PER_BLOCK_LINE + i] = dfY0 + j * m_nStep;
+        }
+    }
+    for (int j = 0; j < CELLS_PER_BLOCK; ++j)
+    {
+        for (int i = 0; i < CELLS_PER_BLOCK; ++i)
+        {
+            adfX[NODE_COUNT + j * CELLS_PER_BLOCK + i] =
+                dfX0 + (i + 0.5) * m_nStep;
+            adfY[NODE_COUNT + j * CELLS_PER_BLOCK + i] =
+                dfY0 + (j + 0.5) * m_nStep;
+        }
+    }
+    pfnBase(pBaseCBData, TRUE, NODE_COUNT + CELL_COUNT, adfX.data(),
+            adfY.data(), adfZ.data(), abSuccess.data());
+
+    auto poBlock = std::make_shared<Block>();
+    poBlock->adfX.assign(adfX.begin(), adfX.begin() + NODE_COUNT);
+    poBlock->adfY.assign(adfY.begin(), adfY.begin() + NODE_COUNT);
+    poBlock->abyValidCell.resize(CELL_COUNT);
+    for (int j = 0; j < CELLS_PER_BLOCK; ++j)
+    {
+        for (int i = 0; i < CELLS_PER_BLOCK; ++i)
+        {
+            const int i00 = j * NODES_PER_BLOCK_LINE + i;
+            const int i01 = i00 + NODES_PER_BLOCK_LINE;
+            const int iCenter = NODE_COUNT + j * CELLS_PER_BLOCK + i;
+            if (!abSuccess[i00] || !abSuccess[i00 + 1] || !abSuccess[i01] ||
+                !abSuccess[i01 + 1] || !abSuccess[iCenter])
+            {
+                continue;
+            }
+            // Manhattan distance between the exact and interpolated
+            // centers, as in the approximate transformer. NaN values
+            // make the cell invalid.
+            const double dfError =
+                std::fabs((adfX[i00] + adfX[i00 + 1] + adfX[i01] +
+                           adfX[i01 + 1]) *
+                              0.25 -
+                          adfX[iCenter]) +
+                std::fabs((adfY[i00] + adfY[i00 + 1] + adfY[i01] +
+                           adfY[i01 + 1]) *
+                              0.25 -
+                          adfY[iCenter]);
+            poBlock->abyValidCell[j * CELLS_PER_BLOCK + i] =
+                dfError <= m_dfMaxError;
+        }
+    }
+
+    std::lock_guard oLock(m_oMutex);
+    std::shared_ptr<const Block> poExistingBlock;
+    if (m_oCacheBlocks.tryGet(nKey, poExistingBlock))
+        return poExistingBlock;
+    m_oCacheBlocks.insert(nKey, poBlock);
+    m_bDirty = true;
+    return poBlock;
+}
+
+/************************************************************************/
+/*                       GetCacheFilename()                             */
+/************************************************************************/
+
+static std::string GetCacheFilename(GDALTransformerFunc pfnBaseTransformer,
+                                    void *pBaseTransformArg, int nStep,
+                                    double dfMaxError,
+                                    const std::string &osCacheDir)
+{
+    // The serialized base transformer captures the source and target CRS,
+    // the coordinate operation and the source and target geotransforms (or
+    // GCPs, RPCs, etc.), that is everything the grid depends on.
+    CPLXMLNode *psTree =
+        GDALSerializeTransformer(pfnBaseTransformer, pBaseTransformArg);
+    if (psTree == nullptr)
+    {
+        CPLDebug("COORDGRID", "Base transformer cannot be serialized. "
+                              "Disabling disk cache");
+        return std::string();
+    }
+    char *pszXML = CPLSerializeXMLTree(psTree);
+    CPLDestroyXMLNode(psTree);
+    std::string osKey(pszXML ? pszXML : "");
+    CPLFree(pszXML);
+    osKey += CPLSPrintf("\nversion=%u\nstep=%d\nmax_error=%.17g",
+                        COORD_GRID_VERSION, nStep, dfMaxError);
+
+    GByte abyHash[CPL_SHA256_HASH_SIZE];
+    CPL_SHA256(osKey.data(), osKey.size(), abyHash);
+    char *pszHex = CPLBinaryToHex(CPL_SHA256_HASH_SIZE, abyHash);
+    const std::string osBasename = std::string(pszHex) + ".cgrid";
+    CPLFree(pszHex);
+    return CPLFormFilenameSafe(osCacheDir.c_str(), osBasename.c_str(),
+                               nullptr);
+}
+
+/************************************************************************/
+/*                 GDALCreateCoordGridTransformerInternal()             */
+/************************************************************************/
+
+static void *GDALCreateSimilarCoordGridTransformer(void *hTransformArg,
+                                                   double dfSrcRatioX,
+                                                   double dfSrcRatioY);
+static CPLXMLNode *GDALSerializeCoordGridTransformer(void *pTransformArg);
+
+static void *
+GDALCreateCoordGridTransformerInternal(GDALTransformerFunc pfnBaseTransformer,
+                                       void *pBaseTransformArg,
+                                       std::shared_ptr<GDALCoordGrid> poGrid)
+{
+    GDALCoordGridTransformInfo *psInfo = new GDALCoordGridTransformInfo;
+    psInfo->pfnBaseTransformer = pfnBaseTransformer;
+    psInfo->pBaseCBData = pBaseTransformArg;
+    psInfo->bOwnSubtransformer = FALSE;
+    psInfo->poGrid = std::move(poGrid);
+
+    memcpy(psInfo->sTI.abySignature, GDAL_GTI2_SIGNATURE,
+           strlen(GDAL_GTI2_SIGNATURE));
+    psInfo->sTI.pszClassName = GDAL_COORD_GRID_TRANSFORMER_CLASS_NAME;
+    psInfo->sTI.pfnTransform = GDALCoordGridTransform;
+    psInfo->sTI.pfnCleanup = GDALDestroyCoordGridTransformer;
+    psInfo->sTI.pfnSerialize = GDALSerializeCoordGridTransformer;
+    psInfo->sTI.pfnCreateSimilar = GDALCreateSimilarCoordGridTransformer;
+
+    return psInfo;
+}
+
+/************************************************************************/
+/*                   GDALCreateCoordGridTransformer()                   */
+/************************************************************************/
+
+/**
+ * Create a coordinate grid transformer.
+ *
+ * This transformer is an alternative to the approximate transformer of
+ * GDALCreateApproxTransformer() for the destination to source direction, when
+ * the same destination grid is warped repeatedly.
+ *
+ * The destination pixel/line space is divided in square cells of STEP x STEP
+ * pixels. The source coordinates of the corners and center of cells are
+ * computed with the base transformer, by blocks of 32 x 32 cells, the first
+ * time a point falls into a block. Points of a cell are then bilinearly
+ * interpolated from its corners, provided that the interpolation of its center
+ * is within dfMaxError of the exact value, and that all of them could be
+ * transformed. The Z of interpolated points is left unchanged. Other points,
+ * points with a non-zero input Z, and the source to destination direction,
+ * use the base transformer. At most 1024 blocks, the most recently used ones,
+ * are kept in memory.
+ *
+ * The grid is shared between the transformer and the clones returned by
+ * GDALCloneTransformer(), which makes it usable by multithreaded warping.
+ *
+ * If the CACHE_DIR option is set, the grid is loaded from a file in that
+ * directory whose name is a hash of the serialized base transformer (hence of
+ * the source and target CRS, geotransforms, etc.), the step and the maximum
+ * error. When the last transformer using the grid is destroyed, the blocks in
+ * memory are saved back to that file if new blocks have been computed. Note
+ * that the content of files referenced by the base transformer, such as a RPC
+ * DEM or geolocation arrays, is not part of the key.
+ *
+ * Supported options:
+ * <ul>
+ * <li>STEP=integer: size in destination pixels of a cell of the grid.
+ * Defaults to 16.</li>
+ * <li>CACHE_DIR=directory: directory where the grid is persisted.</li>
+ * </ul>
+ *
+ * @param pfnBaseTransformer the high precision transformer which should be
+ * approximated.
+ * @param pBaseTransformArg the callback argument for the high precision
+ * transformer.
+ * @param dfMaxError the maximum Manhattan distance, in source pixels, between
+ * the interpolated and exact center of a cell for the cell to be used.
+ * @param papszOptions NULL terminated list of options, or NULL.
+ *
+ * @return callback pointer suitable for use with GDALCoordGridTransform().  It
+ * should be deallocated with GDALDestroyCoordGridTransformer().
+ *
+ * @since GDAL 3.12
+ */
+
+void *GDALCreateCoordGridTransformer(GDALTransformerFunc pfnBaseTransformer,
+                                     void *pBaseTransformArg, double dfMaxError,
+                                     CSLConstList papszOptions)
+{
+    const int nStep = atoi(CSLFetchNameValueDef(
+        papszOptions, "STEP", CPLSPrintf("%d", DEFAULT_STEP)));
+    if (nStep <= 0 || nStep > 1024 * 1024)
+    {
+        CPLError(CE_Failure, CPLE_IllegalArg, "Invalid value for STEP: %d",
+                 nStep);
+        return nullptr;
+    }
+
+    const std::string osCacheDir =
+        CSLFetchNameValueDef(papszOptions, "CACHE_DIR", "");
+    const std::string osFilename =
+        osCacheDir.empty()
+            ? std::string()
+            : GetCacheFilename(pfnBaseTransformer, pBaseTransformArg, nStep,
+                               dfMaxError, osCacheDir);
+
+    return GDALCreateCoordGridTransformerInternal(
+        pfnBaseTransformer, pBaseTransformArg,
+        std::make_shared<GDALCoordGrid>(nStep, dfMaxError, osCacheDir,
+                                        osFilename));
+}
+
+/************************************************************************/
+/*                GDALCreateSimilarCoordGridTransformer()               */
+/************************************************************************/
+
+static void *GDALCreateSimilarCoordGridTransformer(void *hTransformArg,
+                                                   double dfSrcRatioX,
+                                                   double dfSrcRatioY)
+{
+    VALIDATE_POINTER1(hTransformArg, "GDALCreateSimilarCoordGridTransformer",
+                      nullptr);
+
+    GDALCoordGridTransformInfo *psInfo =
+        static_cast<GDALCoordGridTransformInfo *>(hTransformArg);
+
+    void *pBaseCBData = GDALCreateSimilarTransformer(psInfo->pBaseCBData,
+                                                     dfSrcRatioX, dfSrcRatioY);
+    if (pBaseCBData == nullptr)
+    {
+        return nullptr;
+    }
+
+    void *pClonedInfo;
+    if (dfSrcRatioX == 1.0 && dfSrcRatioY == 1.0)
+    {
+        // Same mapping: share the grid with the original transformer.
+        pClonedInfo = GDALCreateCoordGridTransformerInternal(
+            psInfo->pfnBaseTransformer, pBaseCBData, psInfo->poGrid);
+    }
+    else
+    {
+        const GDALCoordGrid *poGrid = psInfo->poGrid.get();
+        CPLStringList aosOptions;
+        aosOptions.SetNameValue("STEP", CPLSPrintf("%d", poGrid->GetStep()));
+        if (!poGrid->GetCacheDir().empty())
+            aosOptions.SetNameValue("CACHE_DIR", poGrid->GetCacheDir().c_str());
+        pClonedInfo = GDALCreateCoordGridTransformer(
+            psInfo->pfnBaseTransformer, pBaseCBData, poGrid->GetMaxError(),
+            aosOptions.List());
+    }
+    GDALCoordGridTransformerOwnsSubtransformer(pClonedInfo, TRUE);
+
+    return pClonedInfo;
+}
+
+/************************************************************************/
+/*               GDALCoordGridTransformerOwnsSubtransformer()           */
+/************************************************************************/
+
+/** Set bOwnSubtransformer flag */
+void GDALCoordGridTransformerOwnsSubtransformer(void *pCBData, int bOwnFlag)
+
+{
+    GDALCoordGridTransformInfo *psInfo =
+        static_cast<GDALCoordGridTransformInfo *>(pCBData);
+
+    psInfo->bOwnSubtransformer = bOwnFlag;
+}
+
+/************************************************************************/
+/*                   GDALDestroyCoordGridTransformer()                  */
+/************************************************************************/
+
+/**
+ * Cleanup coordinate grid transformer.
+ *
+ * Deallocates the resources allocated by GDALCreateCoordGridTransformer(),
+ * and saves the grid to the cache directory if this was the last transformer
+ * using it.
+ *
+ * @param pCBData callback data originally returned by
+ * GDALCreateCoordGridTransformer().
+ *
+ * @since GDAL 3.12
+ */
+
+void GDALDestroyCoordGridTransformer(void *pCBData)
+
+{
+    if (pCBData == nullptr)
+        return;
+
+    GDALCoordGridTransformInfo *psInfo =
+        static_cast<GDALCoordGridTransformInfo *>(pCBData);
+
+    if (psInfo->bOwnSubtransformer)
+        GDALDestroyTransformer(psInfo->pBaseCBData);
+
+    delete psInfo;
+}
+
+/************************************************************************/
+/*                  GDALResetCoordGridTransformerGrid()                 */
+/************************************************************************/
+
+/** Detach the transformer from its current grid, and attach it to a new one
+ * matching the current state of the base transformer. To be called after the
+ * base transformer has been modified, e.g. its destination geotransform. */
+void GDALResetCoordGridTransformerGrid(void *hTransformArg)
+{
+    GDALCoordGridTransformInfo *psInfo =
+        static_cast<GDALCoordGridTransformInfo *>(hTransformArg);
+    const GDALCoordGrid *poGrid = psInfo->poGrid.get();
+
+    const int nStep = poGrid->GetStep();
+    const double dfMaxError = poGrid->GetMaxError();
+    const std::string osCacheDir = poGrid->GetCacheDir();
+    const std::string osFilename =
+        osCacheDir.empty()
+            ? std::string()
+            : GetCacheFilename(psInfo->pfnBaseTransformer, psInfo->pBaseCBData,
+                               nStep, dfMaxError, osCacheDir);
+    psInfo->poGrid = std::make_shared<GDALCoordGrid>(nStep, dfMaxError,
+                                                     osCacheDir, osFilename);
+}
+
+/************************************************************************/
+/*                  GDALRefreshCoordGridTransformer()                   */
+/************************************************************************/
+
+void GDALRefreshCoordGridTransformer(void *hTransformArg)
+{
+    GDALCoordGridTransformInfo *psInfo =
+        static_cast<GDALCoordGridTransformInfo *>(hTransformArg);
+
+    if (GDALIsTransformer(psInfo->pBaseCBData,
+                          GDAL_GEN_IMG_TRANSFORMER_CLASS_NAME))
+    {
+        GDALRefreshGenImgProjTransformer(psInfo->pBaseCBData);
+    }
+
+    // The grid must neither serve nor store results of a base transformer
+    // that checks with the inverse projection, as it is not part of the key.
+    psInfo->bBypassGrid =
+        CPLTestBool(CPLGetConfigOption("CHECK_WITH_INVERT_PROJ", "NO"));
+}
+
+/************************************************************************/
+/*             GDALTransformLonLatToDestCoordGridTransformer()          */
+/************************************************************************/
+
+int GDALTransformLonLatToDestCoordGridTransformer(void *hTransformArg,
+                                                  double *pdfX, double *pdfY)
+{
+    GDALCoordGridTransformInfo *psInfo =
+        static_cast<GDALCoordGridTransformInfo *>(hTransformArg);
+
+    if (GDALIsTransformer(psInfo->pBaseCBData,
+                          GDAL_GEN_IMG_TRANSFORMER_CLASS_NAME))
+    {
+        return GDALTransformLonLatToDestGenImgProjTransformer(
+            psInfo->pBaseCBData, pdfX, pdfY);
+    }
+    return false;
+}
+
+/************************************************************************/
+/*                       GDALCoordGridTransform()                       */
+/************************************************************************/
+
+/**
+ * Perform coordinate grid transformation.
+ *
+ * Actually performs the transformation described in
+ * GDALCreateCoordGridTransformer().  This function matches the
+ * GDALTransformerFunc() signature.  Details of the arguments are described
+ * there.
+ *
+ * @since GDAL 3.12
+ */
+
+int GDALCoordGridTransform(void *pTransformArg, int bDstToSrc, int nPointCount,
+                           double *x, double *y, double *z, int *panSuccess)
+{
+    GDALCoordGridTransformInfo *psInfo =
+        static_cast<GDALCoordGridTransformInfo *>(pTransformArg);
+
+    if (!bDstToSrc || psInfo->bBypassGrid)
+    {
+        return psInfo->pfnBaseTransformer(psInfo->pBaseCBData, bDstToSrc,
+                                          nPointCount, x, y, z, panSuccess);
+    }
+
+    GDALCoordGrid *poGrid = psInfo->poGrid.get();
+    const double dfInvStep = 1.0 / poGrid->GetStep();
+
+    // Points are generally passed by scanline segments, so that consecutive
+    // points fall in the same block most of the time.
+    std::shared_ptr<const GDALCoordGrid::Block> poBlock;
+    int nCurBlockX = 0;
+    int nCurBlockY = 0;
+    std::vector<int> anFallbackIdx;
+    for (int i = 0; i < nPointCount; ++i)
+    {
+        const double dfCellX = x[i] * dfInvStep;
+        const double dfCellY = y[i] * dfInvStep;
+        if (z[i] != 0 || !(std::fabs(dfCellX) < MAX_ABS_CELL_INDEX) ||
+            !(std::fabs(dfCellY) < MAX_ABS_CELL_INDEX))
+        {
+            anFallbackIdx.push_back(i);
+            continue;
+        }
+
+        const double dfFloorX = std::floor(dfCellX);
+        const double dfFloorY = std::floor(dfCellY);
+        const int nBlockX =
+            static_cast<int>(std::floor(dfFloorX / CELLS_PER_BLOCK));
+        const int nBlockY =
+            static_cast<int>(std::floor(dfFloorY / CELLS_PER_BLOCK));
+        if (!poBlock || nBlockX != nCurBlockX || nBlockY != nCurBlockY)
+        {
+            poBlock = poGrid->GetBlock(psInfo->pfnBaseTransformer,
+                                       psInfo->pBaseCBData, nBlockX, nBlockY);
+            nCurBlockX = nBlockX;
+            nCurBlockY = nBlockY;
+        }
+
+        const int iCellX =
+            static_cast<int>(dfFloorX) - nBlockX * CELLS_PER_BLOCK;
+        const int iCellY =
+            static_cast<int>(dfFloorY) - nBlockY * CELLS_PER_BLOCK;
+        if (!poBlock->abyValidCell[iCellY * CELLS_PER_BLOCK + iCellX])
+        {
+            anFallbackIdx.push_back(i);
+            continue;
+        }
+
+        const double dfFracX = dfCellX - dfFloorX;
+        const double dfFracY = dfCellY - dfFloorY;
+        const int i00 = iCellY * NODES_PER_BLOCK_LINE + iCellX;
+        const int i01 = i00 + NODES_PER_BLOCK_LINE;
+        const auto Interpolate = [dfFracX, dfFracY, i00,
+                                  i01](const std::vector<double> &adfVal)
+        {
+            const double dfTop =
+                adfVal[i00] + dfFracX * (adfVal[i00 + 1] - adfVal[i00]);
+            const double dfBottom =
+                adfVal[i01] + dfFracX * (adfVal[i01 + 1] - adfVal[i01]);
+            return dfTop + dfFracY * (dfBottom - dfTop);
+        };
+        x[i] = Interpolate(poBlock->adfX);
+        y[i] = Interpolate(poBlock->adfY);
+        panSuccess[i] = TRUE;
+    }
+
+    if (anFallbackIdx.empty())
+        return TRUE;
+
+    const int nFallback = static_cast<int>(anFallbackIdx.size());
+    std::vector<double> adfX(nFallback);
+    std::vector<double> adfY(nFallback);
+    std::vector<double> adfZ(nFallback);
+    std::vector<int> abSuccess(nFallback);
+    for (int i = 0; i < nFallback; ++i)
+    {
+        adfX[i] = x[anFallbackIdx[i]];
+        adfY[i] = y[anFallbackIdx[i]];
+        adfZ[i] = z[anFallbackIdx[i]];
+    }
+    const int bRet = psInfo->pfnBaseTransformer(
+        psInfo->pBaseCBData, bDstToSrc, nFallback, adfX.data(), adfY.data(),
+        adfZ.data(), abSuccess.data());
+    for (int i = 0; i < nFallback; ++i)
+    {
+        x[anFallbackIdx[i]] = adfX[i];
+        y[anFallbackIdx[i]] = adfY[i];
+        z[anFallbackIdx[i]] = adfZ[i];
+        panSuccess[anFallbackIdx[i]] = abSuccess[i];
+    }
+
+    return bRet || nFallback < nPointCount;
+}
+
+/************************************************************************/
+/*                 GDALSerializeCoordGridTransformer()                  */
+/************************************************************************/
+
+static CPLXMLNode *GDALSerializeCoordGridTransformer(void *pTransformArg)
+
+{
+    GDALCoordGridTransformInfo *psInfo =
+        static_cast<GDALCoordGridTransformInfo *>(pTransformArg);
+    const GDALCoordGrid *poGrid = psInfo->poGrid.get();
+
+    CPLXMLNode *psTree =
+        CPLCreateXMLNode(nullptr, CXT_Element, "CoordGridTransformer");
+
+    CPLCreateXMLElementAndValue(psTree, "Step",
+                                CPLSPrintf("%d", poGrid->GetStep()));
+    CPLCreateXMLElementAndValue(psTree, "MaxError",
+                                CPLSPrintf("%.17g", poGrid->GetMaxError()));
+    if (!poGrid->GetCacheDir().empty())
+        CPLCreateXMLElementAndValue(psTree, "CacheDir",
+                                    poGrid->GetCacheDir().c_str());
+
+    CPLXMLNode *psTransformerContainer =
+        CPLCreateXMLNode(psTree, CXT_Element, "BaseTransformer");
+
+    CPLXMLNode *psTransformer = GDALSerializeTransformer(
+        psInfo->pfnBaseTransformer, psInfo->pBaseCBData);
+    if (psTransformer != nullptr)
+        CPLAddXMLChild(psTransformerContainer, psTransformer);
+
+    return psTree;
+}
+
+/************************************************************************/
+/*                GDALDeserializeCoordGridTransformer()                 */
+/************************************************************************/
+
+void *GDALDeserializeCoordGridTransformer(CPLXMLNode *psTree)
+
+{
+    GDALTransformerFunc pfnBaseTransform = nullptr;
+    void *pBaseCBData = nullptr;
+
+    CPLXMLNode *psContainer = CPLGetXMLNode(psTree, "BaseTransformer");
+
+    if (psContainer != nullptr && psContainer->psChild != nullptr)
+    {
+        GDALDeserializeTransformer(psContainer->psChild, &pfnBaseTransform,
+                                   &pBaseCBData);
+    }
+
+    if (pfnBaseTransform == nullptr)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Cannot get base transform for coordinate grid transformer.");
+        return nullptr;
+    }
+
+    CPLStringList aosOptions;
+    aosOptions.SetNameValue(
+        "STEP", CPLGetXMLValue(psTree, "Step", CPLSPrintf("%d", DEFAULT_STEP)));
+    const char *pszCacheDir = CPLGetXMLValue(psTree, "CacheDir", nullptr);
+    if (pszCacheDir)
+        aosOptions.SetNameValue("CACHE_DIR", pszCacheDir);
+
+    void *pCBData = GDALCreateCoordGridTransformer(
+        pfnBaseTransform, pBaseCBData,
+        CPLAtof(CPLGetXMLValue(psTree, "MaxError", "0.125")),
+        aosOptions.List());
+    if (pCBData == nullptr)
+    {
+        GDALDestroyTransformer(pBaseCBData);
+        return nullptr;
+    }
+    GDALCoordGridTransformerOwnsSubtransformer(pCBData, TRUE);
+
+    return pCBData;
+}
@@ -18,6 +18,9 @@
 #include <cstdlib>
 
 #include <algorithm>
+#include <functional>
+#include <limits>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
@@ -25,6 +28,8 @@
 #include "cpl_string.h"
 #include "cpl_vsi.h"
 #include "gdal.h"
+#include "gdal_alg_priv.h"
+#include "gdal_thread_pool.h"
 
 static CPLErr ProcessProximityLine(GInt32 *panSrcScanline, int *panNearX,
                                    int *panNearY, int bForward, int iLine,
@@ -33,6 +38,29 @@ static CPLErr ProcessProximityLine(GInt32 *panSrcScanline, int *panNearX,
                                    double *pdfSrcNoDataValue, int nTargetValues,
                                    int *panTargetValues);
 
+namespace
+{
+struct GDALProximityEDTOptions
+{
+    double dfMaxDist = 0;
+    double dfDistMult = 1;
+    const double *pdfSrcNoData = nullptr;
+    float fNoDataValue = 0;
+    bool bFixedBufVal = false;
+    double dfFixedBufVal = 0;
+    int nTargetValues = 0;
+    const int *panTargetValues = nullptr;
+    int nThreads = 1;
+};
+}  // namespace
+
+static CPLErr GDALComputeProximityEDT(GDALRasterBandH hSrcBand,
+                                      GDALRasterBandH hWorkProximityBand,
+                                      GDALRasterBandH hProximityBand,
+                                      const GDALProximityEDTOptions &sOptions,
+                                      GDALProgressFunc pfnProgress,
+                                      void *pProgressArg);
+
 /************************************************************************/
 /*                        GDALComputeProximity()                        */
 /************************************************************************/
@@ -89,6 +117,21 @@ the proximity output.
 
 If this option is set, all pixels within the MAXDIST threshold are
 set to this fixed value instead of to a proximity distance.
+
+  ALGORITHM=[SCANLINE]/EDT
+
+Starting with GDAL 3.12, selects the algorithm used to compute distances.
+SCANLINE is the historical single-threaded two-pass propagation of the nearest
+target, which is fast but may occasionally overestimate the distance.
+EDT computes an exact Euclidean distance transform, separable in rows and
+columns (Felzenszwalb & Huttenlocher / Meijster et al.), whose passes are run
+on several threads (see NUM_THREADS). The raster is processed by chunks of
+lines, so memory use is bounded independently of the raster height.
+
+  NUM_THREADS=n/ALL_CPUS
+
+Starting with GDAL 3.12, number of worker threads used by ALGORITHM=EDT.
+Defaults to the value of the GDAL_NUM_THREADS configuration option, or 1.
 */
 
 CPLErr CPL_STDCALL GDALComputeProximity(GDALRasterBandH hSrcBand,
@@ -225,6 +268,27 @@ CPLErr CPL_STDCALL GDALComputeProximity(GDALRasterBandH hSrcBand,
         CSLDestroy(papszValuesTokens);
     }
 
+    /* -------------------------------------------------------------------- */
+    /*      Which algorithm should be used?                                 */
+    /* -------------------------------------------------------------------- */
+    bool bEDT = false;
+    pszOpt = CSLFetchNameValueDef(papszOptions, "ALGORITHM", "SCANLINE");
+    if (EQUAL(pszOpt, "EDT"))
+    {
+        bEDT = true;
+    }
+    else if (!EQUAL(pszOpt, "SCANLINE"))
+    {
+        CPLError(
+            CE_Failure, CPLE_AppDefined,
+            "Unrecognized ALGORITHM value '%s', should be SCANLINE or EDT.",
+            pszOpt);
+        CPLFree(panTargetValues);
+        return CE_Failure;
+    }
+    const int nThreads =
+        GDALGetNumThreads(CSLFetchNameValue(papszOptions, "NUM_THREADS"));
+
     /* -------------------------------------------------------------------- */
     /*      Initialize progress counter.                                    */
     /* -------------------------------------------------------------------- */
@@ -239,6 +303,8 @@ CPLErr CPL_STDCALL GDALComputeProximity(GDALRasterBandH hSrcBand,
     /*      We need a signed type for the working proximity values kept     */
     /*      on disk.  If our proximity band is not signed, then create a    */
     /*      temporary file for this purpose.                                */
+    /*      The EDT algorithm stores intermediate distances as floating     */
+    /*      point values, so it also needs one for integer proximity bands. */
     /* -------------------------------------------------------------------- */
     GDALRasterBandH hWorkProximityBand = hProximityBand;
     GDALDatasetH hWorkProximityDS = nullptr;
@@ -253,7 +319,8 @@ CPLErr CPL_STDCALL GDALComputeProximity(GDALRasterBandH hSrcBand,
     bool bTempFileAlreadyDeleted = false;
 
     if (eProxType == GDT_Byte || eProxType == GDT_UInt16 ||
-        eProxType == GDT_UInt32)
+        eProxType == GDT_UInt32 ||
+        (bEDT && eProxType != GDT_Float32 && eProxType != GDT_Float64))
     {
         GDALDriverH hDriver = GDALGetDriverByName("GTiff");
         if (hDriver == nullptr)
@@ -278,6 +345,24 @@ CPLErr CPL_STDCALL GDALComputeProximity(GDALRasterBandH hSrcBand,
         hWorkProximityBand = GDALGetRasterBand(hWorkProximityDS, 1);
     }
 
+    if (bEDT)
+    {
+        GDALProximityEDTOptions sOptions;
+        sOptions.dfMaxDist = dfMaxDist;
+        sOptions.dfDistMult = dfDistMult;
+        sOptions.pdfSrcNoData = pdfSrcNoData;
+        sOptions.fNoDataValue = fNoDataValue;
+        sOptions.bFixedBufVal = bFixedBufVal;
+        sOptions.dfFixedBufVal = dfFixedBufVal;
+        sOptions.nTargetValues = nTargetValues;
+        sOptions.panTargetValues = panTargetValues;
+        sOptions.nThreads = nThreads;
+        eErr = GDALComputeProximityEDT(hSrcBand, hWorkProximityBand,
+                                       hProximityBand, sOptions, pfnProgress,
+                                       pProgressArg);
+        goto end;
+    }
+
     /* -------------------------------------------------------------------- */
     /*      Allocate buffer for two scanlines of distances as floats        */
     /*      (the current and last line).                                    */
@@ -573,3 +658,312 @@ static CPLErr ProcessProximityLine(GInt32 *panSrcScanline, int *panNearX,
 
     return CE_None;
 }
+
+/************************************************************************/
+/*                      GDALProximityIsTarget()                         */
+/************************************************************************/
+
+static inline bool GDALProximityIsTarget(GInt32 nValue, int nTargetValues,
+                                         const int *panTargetValues)
+{
+    if (nTargetValues == 0)
+        return nValue != 0;
+    for (int i = 0; i < nTargetValues; i++)
+    {
+        if (nValue == panTargetValues[i])
+            return true;
+    }
+    return false;
+}
+
+/************************************************************************/
+/*                       GDALProximityEDTRow()                          */
+/************************************************************************/
+
+// One dimensional squared Euclidean distance transform of a row, following
+// "Distance Transforms of Sampled Functions", Felzenszwalb & Huttenlocher.
+// pafG[] contains, for each pixel of the row, the vertical distance to the
+// nearest target in its column, or a negative value if there is none within
+// reach. padfDistSq[] receives the squared distance to the nearest target.
+// panV, padfZ and padfF are working buffers of nXSize, nXSize + 1 and nXSize
+// elements.
+static void GDALProximityEDTRow(const float *pafG, int nXSize,
+                                double *padfDistSq, int *panV, double *padfZ,
+                                double *padfF)
+{
+    constexpr double INF = std::numeric_limits<double>::infinity();
+
+    int k = -1;
+    for (int q = 0; q < nXSize; ++q)
+    {
+        if (pafG[q] < 0)
+            continue;
+        padfF[q] = static_cast<double>(pafG[q]) * pafG[q];
+        double s = -INF;
+        while (k >= 0)
+        {
+            const int p = panV[k];
+            s = ((padfF[q] + static_cast<double>(q) * q) -
+                 (padfF[p] + static_cast<double>(p) * p)) /
+                (2.0 * (q - p));
+            if (s <= padfZ[k])
+                --k;
+            else
+                break;
+        }
+        ++k;
+        panV[k] = q;
+        padfZ[k] = k == 0 ? -INF : s;
+    }
+
+    if (k < 0)
+    {
+        for (int q = 0; q < nXSize; ++q)
+            padfDistSq[q] = INF;
+        return;
+    }
+
+    padfZ[k + 1] = INF;
+    int j = 0;
+    for (int q = 0; q < nXSize; ++q)
+    {
+        while (padfZ[j + 1] < q)
+            ++j;
+        const double dfDX = static_cast<double>(q - panV[j]);
+        padfDistSq[q] = dfDX * dfDX + padfF[panV[j]];
+    }
+}
+
+/************************************************************************/
+/*                      GDALComputeProximityEDT()                       */
+/************************************************************************/
+
+// Exact Euclidean distance transform, computed as a column pass followed by
+// a row pass. The column pass is split in a top-down sweep, whose result
+// (vertical distance to the nearest target above) is stored in
+// hWorkProximityBand, and a bottom-up sweep that combines it with the
+// distance to the nearest target below, immediately followed by the row
+// pass. Both sweeps process the raster by chunks of lines, and within a
+// chunk, columns (resp. rows) are dispatched to the worker threads.
+
+static CPLErr GDALComputeProximityEDT(GDALRasterBandH hSrcBand,
+                                      GDALRasterBandH hWorkProximityBand,
+                                      GDALRasterBandH hProximityBand,
+                                      const GDALProximityEDTOptions &sOptions,
+                                      GDALProgressFunc pfnProgress,
+                                      void *pProgressArg)
+{
+    const int nXSize = GDALGetRasterBandXSize(hSrcBand);
+    const int nYSize = GDALGetRasterBandYSize(hSrcBand);
+    const double dfMaxDist = sOptions.dfMaxDist;
+    const double dfMaxDistSq = dfMaxDist * dfMaxDist;
+
+    // Limit the working buffers of a chunk to about 64 MB.
+    // Only configurable for debug / testing
+    const GIntBig nChunkBytes = std::max<GIntBig>(
+        1, CPLAtoGIntBig(CPLGetConfigOption("GDAL_PROXIMITY_CHUNK_MAX_SIZE",
+                                            "67108864")));
+    const size_t nBytesPerLine =
+        static_cast<size_t>(nXSize) * (sizeof(GInt32) + sizeof(float));
+    const int nChunkLines = static_cast<int>(std::max<size_t>(
+        1, std::min<size_t>(nYSize, static_cast<size_t>(nChunkBytes) /
+                                        nBytesPerLine)));
+
+    const int nThreads = std::max(1, sOptions.nThreads);
+    CPLWorkerThreadPool *poPool =
+        nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+    const int nColJobs = poPool ? std::min(nThreads, nXSize) : 1;
+    const int nRowJobs = poPool ? std::min(nThreads, nChunkLines) : 1;
+
+    std::vector<GInt32> anSrc;
+    std::vector<float> afG;
+    std::vector<int> anNearestY;
+    std::vector<std::vector<int>> aanV;
+    std::vector<std::vector<double>> aadfZ;
+    std::vector<std::vector<double>> aadfF;
+    std::vector<std::vector<double>> aadfDistSq;
+    try
+    {
+        anSrc.resize(static_cast<size_t>(nXSize) * nChunkLines);
+        afG.resize(static_cast<size_t>(nXSize) * nChunkLines);
+        anNearestY.resize(nXSize);
+        aanV.resize(nRowJobs, std::vector<int>(nXSize));
+        aadfZ.resize(nRowJobs, std::vector<double>(nXSize + 1));
+        aadfF.resize(nRowJobs, std::vector<double>(nXSize));
+        aadfDistSq.resize(nRowJobs, std::vector<double>(nXSize));
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate working buffers for proximity computation");
+        return CE_Failure;
+    }
+
+    const auto IsTarget = [&sOptions](GInt32 nValue)
+    {
+        return GDALProximityIsTarget(nValue, sOptions.nTargetValues,
+                                     sOptions.panTargetValues);
+    };
+
+    /* -------------------------------------------------------------------- */
+    /*      Top-down sweep: vertical distance to the nearest target above.  */
+    /* -------------------------------------------------------------------- */
+    std::fill(anNearestY.begin(), anNearestY.end(), -1);
+
+    for (int iYOff = 0; iYOff < nYSize; iYOff += nChunkLines)
+    {
+        const int nLines = std::min(nChunkLines, nYSize - iYOff);
+        CPLErr eErr = GDALRasterIO(hSrcBand, GF_Read, 0, iYOff, nXSize, nLines,
+                                   anSrc.data(), nXSize, nLines, GDT_Int32, 0,
+                                   0);
+        if (eErr != CE_None)
+            return eErr;
+
+        GDALRunJobs(
+            poPool, nColJobs,
+            [&](int iJob)
+            {
+                const int iXStart = static_cast<int>(
+                    static_cast<GIntBig>(nXSize) * iJob / nColJobs);
+                const int iXEnd = static_cast<int>(
+                    static_cast<GIntBig>(nXSize) * (iJob + 1) / nColJobs);
+                for (int iLine = 0; iLine < nLines; ++iLine)
+                {
+                    const int iY = iYOff + iLine;
+                    const size_t nOffset = static_cast<size_t>(iLine) * nXSize;
+                    for (int iX = iXStart; iX < iXEnd; ++iX)
+                    {
+                        if (IsTarget(anSrc[nOffset + iX]))
+                            anNearestY[iX] = iY;
+                        const int iNearestY = anNearestY[iX];
+                        afG[nOffset + iX] =
+                            (iNearestY >= 0 && iY - iNearestY <= dfMaxDist)
+                                ? static_cast<float>(iY - iNearestY)
+                                : -1.0f;
+                    }
+                }
+            });
+
+        eErr = GDALRasterIO(hWorkProximityBand, GF_Write, 0, iYOff, nXSize,
+                            nLines, afG.data(), nXSize, nLines, GDT_Float32, 0,
+                            0);
+        if (eErr != CE_None)
+            return eErr;
+
+        if (!pfnProgress(0.5 * (iYOff + nLines) / static_cast<double>(nYSize),
+                         "", pProgressArg))
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+            return CE_Failure;
+        }
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Bottom-up sweep, combined with the row pass.                    */
+    /* -------------------------------------------------------------------- */
+    std::fill(anNearestY.begin(), anNearestY.end(), -1);
+
+    for (int iYEnd = nYSize; iYEnd > 0; iYEnd -= nChunkLines)
+    {
+        const int nLines = std::min(nChunkLines, iYEnd);
+        const int iYOff = iYEnd - nLines;
+        CPLErr eErr = GDALRasterIO(hWorkProximityBand, GF_Read, 0, iYOff,
+                                   nXSize, nLines, afG.data(), nXSize, nLines,
+                                   GDT_Float32, 0, 0);
+        if (eErr == CE_None)
+            eErr = GDALRasterIO(hSrcBand, GF_Read, 0, iYOff, nXSize, nLines,
+                                anSrc.data(), nXSize, nLines, GDT_Int32, 0, 0);
+        if (eErr != CE_None)
+            return eErr;
+
+        GDALRunJobs(
+            poPool, nColJobs,
+            [&](int iJob)
+            {
+                const int iXStart = static_cast<int>(
+                    static_cast<GIntBig>(nXSize) * iJob / nColJobs);
+                const int iXEnd = static_cast<int>(
+                    static_cast<GIntBig>(nXSize) * (iJob + 1) / nColJobs);
+                for (int iLine = nLines - 1; iLine >= 0; --iLine)
+                {
+                    const int iY = iYOff + iLine;
+                    const size_t nOffset = static_cast<size_t>(iLine) * nXSize;
+                    for (int iX = iXStart; iX < iXEnd; ++iX)
+                    {
+                        if (IsTarget(anSrc[nOffset + iX]))
+                            anNearestY[iX] = iY;
+                        const int iNearestY = anNearestY[iX];
+                        if (iNearestY >= 0 && iNearestY - iY <= dfMaxDist)
+                        {
+                            const float fDown =
+                                static_cast<float>(iNearestY - iY);
+                            float &fG = afG[nOffset + iX];
+                            if (fG < 0 || fDown < fG)
+                                fG = fDown;
+                        }
+                    }
+                }
+            });
+
+        GDALRunJobs(
+            poPool, nRowJobs,
+            [&](int iJob)
+            {
+                const int iLineStart = nLines * iJob / nRowJobs;
+                const int iLineEnd = nLines * (iJob + 1) / nRowJobs;
+                double *padfDistSq = aadfDistSq[iJob].data();
+                for (int iLine = iLineStart; iLine < iLineEnd; ++iLine)
+                {
+                    const size_t nOffset = static_cast<size_t>(iLine) * nXSize;
+                    float *pafLine = afG.data() + nOffset;
+                    const GInt32 *panSrcLine = anSrc.data() + nOffset;
+                    GDALProximityEDTRow(pafLine, nXSize, padfDistSq,
+                                        aanV[iJob].data(), aadfZ[iJob].data(),
+                                        aadfF[iJob].data());
+
+                    // Final post processing of distances, consistent with
+                    // the SCANLINE algorithm.
+                    for (int iX = 0; iX < nXSize; ++iX)
+                    {
+                        const double dfDistSq = padfDistSq[iX];
+                        if (dfDistSq == 0)
+                        {
+                            pafLine[iX] = 0.0f;
+                        }
+                        else if (dfDistSq > dfMaxDistSq ||
+                                 (sOptions.pdfSrcNoData &&
+                                  panSrcLine[iX] == *sOptions.pdfSrcNoData))
+                        {
+                            pafLine[iX] = sOptions.fNoDataValue;
+                        }
+                        else if (sOptions.bFixedBufVal)
+                        {
+                            pafLine[iX] =
+                                static_cast<float>(sOptions.dfFixedBufVal);
+                        }
+                        else
+                        {
+                            pafLine[iX] = static_cast<float>(
+                                static_cast<float>(sqrt(dfDistSq)) *
+                                sOptions.dfDistMult);
+                        }
+                    }
+                }
+            });
+
+        eErr = GDALRasterIO(hProximityBand, GF_Write, 0, iYOff, nXSize, nLines,
+                            afG.data(), nXSize, nLines, GDT_Float32, 0, 0);
+        if (eErr != CE_None)
+            return eErr;
+
+        if (!pfnProgress(0.5 + 0.5 * (nYSize - iYOff) /
+                                   static_cast<double>(nYSize),
+                         "", pProgressArg))
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+            return CE_Failure;
+        }
+    }
+
+    return CE_None;
+}
@@ -15,23 +15,28 @@
 #include "gdal_alg.h"
 #include "gdal_alg_priv.h"
 
+#include <atomic>
 #include <climits>
+#include <cmath>
 #include <cstddef>
 #include <cstdlib>
 #include <cstring>
 #include <cfloat>
 #include <limits>
+#include <memory>
 #include <vector>
 #include <algorithm>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
 #include "cpl_progress.h"
+#include "cpl_quad_tree.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
 #include "gdal.h"
 #include "gdal_priv.h"
 #include "gdal_priv_templates.hpp"
+#include "gdal_thread_pool.h"
 #include "ogr_api.h"
 #include "ogr_core.h"
 #include "ogr_feature.h"
@@ -537,8 +542,94 @@ static void GDALCollectRingsFromGeometry(const OGRGeometry *poShape,
     }
 }
 
+/************************************************************************/
+/*                      GDALRasterizePreparedShape                      */
+/************************************************************************/
+
+namespace
+{
+// Rings or components of a geometry, or of a part of it, transformed to
+// pixel/line coordinates, and ready to be burnt.
+struct GDALRasterizePreparedShape
+{
+    OGRwkbGeometryType eGeomType = wkbUnknown;  // flattened
+    std::vector<double> aPointX{};  // coordinate X values of all rings
+    std::vector<double> aPointY{};  // coordinate Y values of all rings
+    std::vector<double> aPointVariant{};  // coordinate Z values
+    std::vector<int> aPartSize{};  // number of X/Y/(Z) values of each ring
+};
+}  // namespace
+
+/************************************************************************/
+/*                       gv_prepare_one_shape()                         */
+/*                                                                      */
+/*      Collect the rings of a geometry and transform them to           */
+/*      pixel/line coordinates. In replace mode, parts of collections   */
+/*      are prepared, and thus transformed, separately, as they are     */
+/*      burnt separately.                                               */
+/************************************************************************/
+
+static void
+gv_prepare_one_shape(const OGRGeometry *poShape,
+                     GDALBurnValueSrc eBurnValueSrc,
+                     GDALRasterMergeAlg eMergeAlg,
+                     GDALTransformerFunc pfnTransformer, void *pTransformArg,
+                     std::vector<GDALRasterizePreparedShape> &aoPreparedShapes)
+{
+    if (poShape == nullptr || poShape->IsEmpty())
+        return;
+    const auto eGeomType = wkbFlatten(poShape->getGeometryType());
+
+    if ((eGeomType == wkbMultiLineString || eGeomType == wkbMultiPolygon ||
+         eGeomType == wkbGeometryCollection) &&
+        eMergeAlg == GRMA_Replace)
+    {
+        // Speed optimization: in replace mode, we can rasterize each part of
+        // a geometry collection separately.
+        const auto poGC = poShape->toGeometryCollection();
+        for (const auto poPart : *poGC)
+        {
+            gv_prepare_one_shape(poPart, eBurnValueSrc, eMergeAlg,
+                                 pfnTransformer, pTransformArg,
+                                 aoPreparedShapes);
+        }
+        return;
+    }
+
+    aoPreparedShapes.emplace_back();
+    auto &oShape = aoPreparedShapes.back();
+    oShape.eGeomType = eGeomType;
+
+    /* -------------------------------------------------------------------- */
+    /*      Transform polygon geometries into a set of rings and a part     */
+    /*      size list.                                                      */
+    /* -------------------------------------------------------------------- */
+    GDALCollectRingsFromGeometry(poShape, oShape.aPointX, oShape.aPointY,
+                                 oShape.aPointVariant, oShape.aPartSize,
+                                 eBurnValueSrc);
+
+    /* -------------------------------------------------------------------- */
+    /*      Transform points if needed.                                     */
+    /* -------------------------------------------------------------------- */
+    if (pfnTransformer != nullptr)
+    {
+        int *panSuccess =
+            static_cast<int *>(CPLCalloc(sizeof(int), oShape.aPointX.size()));
+
+        // TODO: We need to add all appropriate error checking at some point.
+        pfnTransformer(pTransformArg, FALSE,
+                       static_cast<int>(oShape.aPointX.size()),
+                       oShape.aPointX.data(), oShape.aPointY.data(), nullptr,
+                       panSuccess);
+        CPLFree(panSuccess);
+    }
+}
+
 /************************************************************************
- *                       gv_rasterize_one_shape()
+ *                    gv_rasterize_prepared_shape()
+ *
+ * Burn a shape prepared by gv_prepare_one_shape(). Its point arrays are
+ * modified.
  *
  * @param pabyChunkBuf buffer to which values will be burned
  * @param nXOff chunk column offset from left edge of raster
@@ -554,50 +645,24 @@ static void GDALCollectRingsFromGeometry(const OGRGeometry *poShape,
  * @param nBandSpace number of bytes between adjacent bands in chunk
  *                   (0 to calculate automatically)
  * @param bAllTouched burn value to all touched pixels?
- * @param poShape geometry to rasterize, in original coordinates
+ * @param oShape shape to rasterize, in pixel/line coordinates of the raster
  * @param eBurnValueType type of value to be burned (must be Float64 or Int64)
  * @param padfBurnValues array of nBands values to burn (Float64), or nullptr
  * @param panBurnValues array of nBands values to burn (Int64), or nullptr
  * @param eBurnValueSrc whether to burn values from padfBurnValues /
- *                      panBurnValues, or from the Z or M values of poShape
+ *                      panBurnValues, or from the Z or M values of the shape
  * @param eMergeAlg whether the burn value should replace or be added to the
  *                  existing values
- * @param pfnTransformer transformer from CRS of geometry to pixel/line
- *                       coordinates of raster
- * @param pTransformArg arguments to pass to pfnTransformer
  ************************************************************************/
-static void gv_rasterize_one_shape(
+static void gv_rasterize_prepared_shape(
     unsigned char *pabyChunkBuf, int nXOff, int nYOff, int nXSize, int nYSize,
     int nBands, GDALDataType eType, int nPixelSpace, GSpacing nLineSpace,
-    GSpacing nBandSpace, int bAllTouched, const OGRGeometry *poShape,
+    GSpacing nBandSpace, int bAllTouched, GDALRasterizePreparedShape &oShape,
     GDALDataType eBurnValueType, const double *padfBurnValues,
     const int64_t *panBurnValues, GDALBurnValueSrc eBurnValueSrc,
-    GDALRasterMergeAlg eMergeAlg, GDALTransformerFunc pfnTransformer,
-    void *pTransformArg)
+    GDALRasterMergeAlg eMergeAlg)
 
 {
-    if (poShape == nullptr || poShape->IsEmpty())
-        return;
-    const auto eGeomType = wkbFlatten(poShape->getGeometryType());
-
-    if ((eGeomType == wkbMultiLineString || eGeomType == wkbMultiPolygon ||
-         eGeomType == wkbGeometryCollection) &&
-        eMergeAlg == GRMA_Replace)
-    {
-        // Speed optimization: in replace mode, we can rasterize each part of
-        // a geometry collection separately.
-        const auto poGC = poShape->toGeometryCollection();
-        for (const auto poPart : *poGC)
-        {
-            gv_rasterize_one_shape(
-                pabyChunkBuf, nXOff, nYOff, nXSize, nYSize, nBands, eType,
-                nPixelSpace, nLineSpace, nBandSpace, bAllTouched, poPart,
-                eBurnValueType, padfBurnValues, panBurnValues, eBurnValueSrc,
-                eMergeAlg, pfnTransformer, pTransformArg);
-        }
-        return;
-    }
-
     if (nPixelSpace == 0)
     {
         nPixelSpace = GDALGetDataTypeSizeBytes(eType);
@@ -634,34 +699,10 @@ static void gv_rasterize_one_shape(
     sInfo.bFillSetVisitedPoints = false;
     sInfo.poSetVisitedPoints = nullptr;
 
-    /* -------------------------------------------------------------------- */
-    /*      Transform polygon geometries into a set of rings and a part     */
-    /*      size list.                                                      */
-    /* -------------------------------------------------------------------- */
-    std::vector<double>
-        aPointX;  // coordinate X values from all rings/components
-    std::vector<double>
-        aPointY;  // coordinate Y values from all rings/components
-    std::vector<double> aPointVariant;  // coordinate Z values
-    std::vector<int> aPartSize;  // number of X/Y/(Z) values associated with
-                                 // each ring/component
-
-    GDALCollectRingsFromGeometry(poShape, aPointX, aPointY, aPointVariant,
-                                 aPartSize, eBurnValueSrc);
-
-    /* -------------------------------------------------------------------- */
-    /*      Transform points if needed.                                     */
-    /* -------------------------------------------------------------------- */
-    if (pfnTransformer != nullptr)
-    {
-        int *panSuccess =
-            static_cast<int *>(CPLCalloc(sizeof(int), aPointX.size()));
-
-        // TODO: We need to add all appropriate error checking at some point.
-        pfnTransformer(pTransformArg, FALSE, static_cast<int>(aPointX.size()),
-                       aPointX.data(), aPointY.data(), nullptr, panSuccess);
-        CPLFree(panSuccess);
-    }
+    std::vector<double> &aPointX = oShape.aPointX;
+    std::vector<double> &aPointY = oShape.aPointY;
+    std::vector<double> &aPointVariant = oShape.aPointVariant;
+    const std::vector<int> &aPartSize = oShape.aPartSize;
 
     /* -------------------------------------------------------------------- */
     /*      Shift to account for the buffer offset of this buffer.          */
@@ -677,7 +718,7 @@ static void gv_rasterize_one_shape(
     /*      stored in continuous memory block.                              */
     /* -------------------------------------------------------------------- */
 
-    switch (eGeomType)
+    switch (oShape.eGeomType)
     {
         case wkbPoint:
         case wkbMultiPoint:
@@ -764,6 +805,58 @@ static void gv_rasterize_one_shape(
     delete sInfo.poSetVisitedPoints;
 }
 
+/************************************************************************
+ *                       gv_rasterize_one_shape()
+ *
+ * @param pabyChunkBuf buffer to which values will be burned
+ * @param nXOff chunk column offset from left edge of raster
+ * @param nYOff chunk scanline offset from top of raster
+ * @param nXSize number of columns in chunk
+ * @param nYSize number of rows in chunk
+ * @param nBands number of bands in chunk
+ * @param eType data type of pabyChunkBuf
+ * @param nPixelSpace number of bytes between adjacent pixels in chunk
+ *                    (0 to calculate automatically)
+ * @param nLineSpace number of bytes between adjacent scanlines in chunk
+ *                   (0 to calculate automatically)
+ * @param nBandSpace number of bytes between adjacent bands in chunk
+ *                   (0 to calculate automatically)
+ * @param bAllTouched burn value to all touched pixels?
+ * @param poShape geometry to rasterize, in original coordinates
+ * @param eBurnValueType type of value to be burned (must be Float64 or Int64)
+ * @param padfBurnValues array of nBands values to burn (Float64), or nullptr
+ * @param panBurnValues array of nBands values to burn (Int64), or nullptr
+ * @param eBurnValueSrc whether to burn values from padfBurnValues /
+ *                      panBurnValues, or from the Z or M values of poShape
+ * @param eMergeAlg whether the burn value should replace or be added to the
+ *                  existing values
+ * @param pfnTransformer transformer from CRS of geometry to pixel/line
+ *                       coordinates of raster
+ * @param pTransformArg arguments to pass to pfnTransformer
+ ************************************************************************/
+static void gv_rasterize_one_shape(
+    unsigned char *pabyChunkBuf, int nXOff, int nYOff, int nXSize, int nYSize,
+    int nBands, GDALDataType eType, int nPixelSpace, GSpacing nLineSpace,
+    GSpacing nBandSpace, int bAllTouched, const OGRGeometry *poShape,
+    GDALDataType eBurnValueType, const double *padfBurnValues,
+    const int64_t *panBurnValues, GDALBurnValueSrc eBurnValueSrc,
+    GDALRasterMergeAlg eMergeAlg, GDALTransformerFunc pfnTransformer,
+    void *pTransformArg)
+
+{
+    std::vector<GDALRasterizePreparedShape> aoPreparedShapes;
+    gv_prepare_one_shape(poShape, eBurnValueSrc, eMergeAlg, pfnTransformer,
+                         pTransformArg, aoPreparedShapes);
+    for (auto &oShape : aoPreparedShapes)
+    {
+        gv_rasterize_prepared_shape(
+            pabyChunkBuf, nXOff, nYOff, nXSize, nYSize, nBands, eType,
+            nPixelSpace, nLineSpace, nBandSpace, bAllTouched, oShape,
+            eBurnValueType, padfBurnValues, panBurnValues, eBurnValueSrc,
+            eMergeAlg);
+    }
+}
+
 /************************************************************************/
 /*                        GDALRasterizeOptions()                        */
 /*                                                                      */
@@ -857,6 +950,308 @@ static CPLErr GDALRasterizeOptions(CSLConstList papszOptions, int *pbAllTouched,
     return CE_None;
 }
 
+/************************************************************************/
+/*                GDALRasterizeGeometriesMultiThreaded()                */
+/************************************************************************/
+
+// Burn geometries by horizontal swaths of nYChunkSize lines, each swath
+// being split into tiles of at most RASTERIZE_TILE_SIZE x RASTERIZE_TILE_SIZE
+// pixels that are burnt in parallel. Geometries are transformed to pixel/line
+// coordinates once, in parallel, exactly as gv_rasterize_one_shape() does,
+// and binned by the envelope of their transformed vertices into a quad tree,
+// so that each tile only burns, without any transformer call, the geometries
+// that may intersect it. As vertices are joined by straight segments in
+// pixel/line space, that envelope is valid whatever the transformer.
+// Within a tile, geometries are burnt in their original order, and tiles
+// cover disjoint parts of the buffer, so the result does not depend on the
+// number of threads and is identical to the one of the single-threaded code
+// path, including for MERGE_ALG=ADD and ALL_TOUCHED.
+// Each worker transforms geometries with its own clone of the transformer,
+// as transformers are not thread-safe.
+
+static CPLErr GDALRasterizeGeometriesMultiThreaded(
+    GDALDataset *poDS, int nBandCount, const int *panBandList,
+    GDALDataType eType, int nYChunkSize, int nGeomCount,
+    const OGRGeometryH *pahGeometries, GDALTransformerFunc pfnTransformer,
+    void *pTransformArg, GDALDataType eBurnValueType,
+    const double *padfGeomBurnValues, const int64_t *panGeomBurnValues,
+    int bAllTouched, GDALBurnValueSrc eBurnValueSource,
+    GDALRasterMergeAlg eMergeAlg, int nThreads, GDALProgressFunc pfnProgress,
+    void *pProgressArg)
+{
+    constexpr int RASTERIZE_TILE_SIZE = 256;
+
+    const int nXSize = poDS->GetRasterXSize();
+    const int nYSize = poDS->GetRasterYSize();
+    const int nDTSize = GDALGetDataTypeSizeBytes(eType);
+
+    /* -------------------------------------------------------------------- */
+    /*      Create one transformer per thread.                              */
+    /* -------------------------------------------------------------------- */
+    std::vector<void *> apTransformArgs;
+    apTransformArgs.push_back(pTransformArg);
+    if (pfnTransformer != nullptr)
+    {
+        CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+        while (static_cast<int>(apTransformArgs.size()) < nThreads)
+        {
+            void *pClonedTransformArg = GDALCloneTransformer(pTransformArg);
+            if (pClonedTransformArg == nullptr)
+                break;
+            apTransformArgs.push_back(pClonedTransformArg);
+        }
+    }
+    else
+    {
+        apTransformArgs.resize(nThreads, nullptr);
+    }
+    const int nTransformWorkers = static_cast<int>(apTransformArgs.size());
+    if (nTransformWorkers < nThreads)
+    {
+        CPLDebug("GDAL",
+                 "Cannot clone transformer: transforming geometries with %d "
+                 "thread(s)",
+                 nTransformWorkers);
+    }
+    const auto DestroyClonedTransformers = [&apTransformArgs, pfnTransformer]()
+    {
+        if (pfnTransformer != nullptr)
+        {
+            for (size_t i = 1; i < apTransformArgs.size(); ++i)
+                GDALDestroyTransformer(apTransformArgs[i]);
+        }
+    };
+
+    CPLWorkerThreadPool *poPool =
+        nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+
+    /* -------------------------------------------------------------------- */
+    /*      Transform geometries to pixel/line coordinates.                 */
+    /* -------------------------------------------------------------------- */
+    std::vector<std::vector<GDALRasterizePreparedShape>> aaoPreparedShapes(
+        nGeomCount);
+    {
+        std::atomic<int> nNextShape{0};
+        const auto PrepareShapes = [&](void *pThreadTransformArg)
+        {
+            for (int iShape = nNextShape++; iShape < nGeomCount;
+                 iShape = nNextShape++)
+            {
+                gv_prepare_one_shape(
+                    OGRGeometry::FromHandle(pahGeometries[iShape]),
+                    eBurnValueSource, eMergeAlg, pfnTransformer,
+                    pThreadTransformArg, aaoPreparedShapes[iShape]);
+            }
+        };
+        if (poPool && nTransformWorkers > 1)
+        {
+            auto poQueue = poPool->CreateJobQueue();
+            for (int i = 0; i < std::min(nTransformWorkers, nGeomCount); ++i)
+            {
+                void *pThreadTransformArg = apTransformArgs[i];
+                poQueue->SubmitJob([&PrepareShapes, pThreadTransformArg]()
+                                   { PrepareShapes(pThreadTransformArg); });
+            }
+            poQueue->WaitCompletion();
+        }
+        else
+        {
+            PrepareShapes(pTransformArg);
+        }
+    }
+    DestroyClonedTransformers();
+
+    /* -------------------------------------------------------------------- */
+    /*      Bin geometries by the envelope of their transformed vertices.   */
+    /* -------------------------------------------------------------------- */
+    CPLRectObj sGlobalBounds;
+    sGlobalBounds.minx = 0;
+    sGlobalBounds.miny = 0;
+    sGlobalBounds.maxx = nXSize;
+    sGlobalBounds.maxy = nYSize;
+    CPLQuadTree *hQuadTree = CPLQuadTreeCreate(&sGlobalBounds, nullptr);
+    CPLQuadTreeSetMaxDepth(hQuadTree,
+                           CPLQuadTreeGetAdvisedMaxDepth(nGeomCount));
+
+    for (int iShape = 0; iShape < nGeomCount; iShape++)
+    {
+        const auto &aoPreparedShapes = aaoPreparedShapes[iShape];
+        if (aoPreparedShapes.empty())
+            continue;
+
+        double dfMinX = std::numeric_limits<double>::infinity();
+        double dfMinY = std::numeric_limits<double>::infinity();
+        double dfMaxX = -std::numeric_limits<double>::infinity();
+        double dfMaxY = -std::numeric_limits<double>::infinity();
+        bool bAllFinite = true;
+        for (const auto &oShape : aoPreparedShapes)
+        {
+            for (const double dfX : oShape.aPointX)
+            {
+                bAllFinite = bAllFinite && std::isfinite(dfX);
+                dfMinX = std::min(dfMinX, dfX);
+                dfMaxX = std::max(dfMaxX, dfX);
+            }
+            for (const double dfY : oShape.aPointY)
+            {
+                bAllFinite = bAllFinite && std::isfinite(dfY);
+                dfMinY = std::min(dfMinY, dfY);
+                dfMaxY = std::max(dfMaxY, dfY);
+            }
+        }
+
+        CPLRectObj sRect = sGlobalBounds;
+        if (bAllFinite)
+        {
+            // Add a margin for ALL_TOUCHED and pixel center rounding
+            constexpr double MARGIN = 1.0;
+            sRect.minx = dfMinX - MARGIN;
+            sRect.maxx = dfMaxX + MARGIN;
+            sRect.miny = dfMinY - MARGIN;
+            sRect.maxy = dfMaxY + MARGIN;
+        }
+        // else be conservative and consider that the geometry may
+        // intersect any tile.
+        if (!(sRect.minx < nXSize && sRect.maxx > 0 && sRect.miny < nYSize &&
+              sRect.maxy > 0))
+        {
+            continue;
+        }
+        CPLQuadTreeInsertWithBounds(
+            hQuadTree, reinterpret_cast<void *>(static_cast<uintptr_t>(iShape)),
+            &sRect);
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Allocate swath buffer.                                          */
+    /* -------------------------------------------------------------------- */
+    const GSpacing nPixelSpace = nDTSize;
+    const GSpacing nLineSpace = nPixelSpace * nXSize;
+    unsigned char *pabyChunkBuf =
+        static_cast<unsigned char *>(VSI_MALLOC3_VERBOSE(
+            nYChunkSize, nBandCount, static_cast<size_t>(nLineSpace)));
+    if (pabyChunkBuf == nullptr)
+    {
+        CPLQuadTreeDestroy(hQuadTree);
+        return CE_Failure;
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Loop over swaths.                                               */
+    /* -------------------------------------------------------------------- */
+    CPLErr eErr = CE_None;
+    pfnProgress(0.0, nullptr, pProgressArg);
+
+    for (int iY = 0; iY < nYSize && eErr == CE_None; iY += nYChunkSize)
+    {
+        const int nThisYChunkSize = std::min(nYChunkSize, nYSize - iY);
+        const GSpacing nBandSpace = nLineSpace * nThisYChunkSize;
+
+        eErr = poDS->RasterIO(GF_Read, 0, iY, nXSize, nThisYChunkSize,
+                              pabyChunkBuf, nXSize, nThisYChunkSize, eType,
+                              nBandCount, panBandList, nPixelSpace, nLineSpace,
+                              nBandSpace, nullptr);
+        if (eErr != CE_None)
+            break;
+
+        const int nTileYSize = std::min(RASTERIZE_TILE_SIZE, nThisYChunkSize);
+        const int nTilesX = DIV_ROUND_UP(nXSize, RASTERIZE_TILE_SIZE);
+        const int nTilesY = DIV_ROUND_UP(nThisYChunkSize, nTileYSize);
+        const int nTiles = nTilesX * nTilesY;
+        std::atomic<int> nNextTile{0};
+
+        const auto BurnTiles = [&, iY]()
+        {
+            // Burning shifts the coordinates of the shape, so work on a copy
+            GDALRasterizePreparedShape oTileShape;
+            for (int iTile = nNextTile++; iTile < nTiles; iTile = nNextTile++)
+            {
+                const int nTileXOff = (iTile % nTilesX) * RASTERIZE_TILE_SIZE;
+                const int nTileYOff = (iTile / nTilesX) * nTileYSize;
+                const int nTileXSize =
+                    std::min(RASTERIZE_TILE_SIZE, nXSize - nTileXOff);
+                const int nThisTileYSize =
+                    std::min(nTileYSize, nThisYChunkSize - nTileYOff);
+
+                CPLRectObj sAoi;
+                sAoi.minx = nTileXOff;
+                sAoi.maxx = nTileXOff + nTileXSize;
+                sAoi.miny = iY + nTileYOff;
+                sAoi.maxy = iY + nTileYOff + nThisTileYSize;
+                int nFeatureCount = 0;
+                void **ppFeatures =
+                    CPLQuadTreeSearch(hQuadTree, &sAoi, &nFeatureCount);
+                // Burn in the original order of geometries
+                std::sort(ppFeatures, ppFeatures + nFeatureCount,
+                          [](const void *a, const void *b)
+                          {
+                              return reinterpret_cast<uintptr_t>(a) <
+                                     reinterpret_cast<uintptr_t>(b);
+                          });
+
+                for (int i = 0; i < nFeatureCount; ++i)
+                {
+                    const size_t iShape = static_cast<size_t>(
+                        reinterpret_cast<uintptr_t>(ppFeatures[i]));
+                    for (const auto &oShape : aaoPreparedShapes[iShape])
+                    {
+                        oTileShape.eGeomType = oShape.eGeomType;
+                        oTileShape.aPointX = oShape.aPointX;
+                        oTileShape.aPointY = oShape.aPointY;
+                        oTileShape.aPointVariant = oShape.aPointVariant;
+                        oTileShape.aPartSize = oShape.aPartSize;
+                        gv_rasterize_prepared_shape(
+                            pabyChunkBuf + nTileYOff * nLineSpace +
+                                nTileXOff * nPixelSpace,
+                            nTileXOff, iY + nTileYOff, nTileXSize,
+                            nThisTileYSize, nBandCount, eType,
+                            static_cast<int>(nPixelSpace), nLineSpace,
+                            nBandSpace, bAllTouched, oTileShape,
+                            eBurnValueType,
+                            padfGeomBurnValues
+                                ? padfGeomBurnValues + iShape * nBandCount
+                                : nullptr,
+                            panGeomBurnValues
+                                ? panGeomBurnValues + iShape * nBandCount
+                                : nullptr,
+                            eBurnValueSource, eMergeAlg);
+                    }
+                }
+                CPLFree(ppFeatures);
+            }
+        };
+
+        if (poPool)
+        {
+            auto poQueue = poPool->CreateJobQueue();
+            for (int i = 0; i < std::min(nThreads, nTiles); ++i)
+                poQueue->SubmitJob(BurnTiles);
+            poQueue->WaitCompletion();
+        }
+        else
+        {
+            BurnTiles();
+        }
+
+        eErr = poDS->RasterIO(GF_Write, 0, iY, nXSize, nThisYChunkSize,
+                              pabyChunkBuf, nXSize, nThisYChunkSize, eType,
+                              nBandCount, panBandList, nPixelSpace, nLineSpace,
+                              nBandSpace, nullptr);
+
+        if (!pfnProgress((iY + nThisYChunkSize) / static_cast<double>(nYSize),
+                         "", pProgressArg))
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+            eErr = CE_Failure;
+        }
+    }
+
+    VSIFree(pabyChunkBuf);
+    CPLQuadTreeDestroy(hQuadTree);
+
+    return eErr;
+}
+
 /************************************************************************/
 /*                      GDALRasterizeGeometries()                       */
 /************************************************************************/
@@ -925,6 +1320,14 @@ static CPLErr GDALRasterizeGeometriesInternal(
  * with tiled images to be efficient. The auto mode (the default) will chose
  * the algorithm based on input and output properties.
  * </li>
+ * <li>"NUM_THREADS": (GDAL >= 3.12) Number of threads, or "ALL_CPUS", used
+ * by the raster mode. Defaults to the value of the GDAL_NUM_THREADS
+ * configuration option, or 1. When greater than 1, geometries are first
+ * binned by the envelope of their footprint into tiles of the output chunk,
+ * which are then burnt in parallel. The result does not depend on the number
+ * of threads. This requires the transformer to be cloneable with
+ * GDALCloneTransformer(), otherwise a single thread is used.
+ * </li>
  * </ul>
  * @param pfnProgress the progress function to report completion.
  * @param pProgressArg callback data for progress function.
@@ -1071,6 +1474,8 @@ static CPLErr GDALRasterizeGeometriesInternal(
     {
         return CE_Failure;
     }
+    const int nThreads =
+        GDALGetNumThreads(CSLFetchNameValue(papszOptions, "NUM_THREADS"));
 
     /* -------------------------------------------------------------------- */
     /*      If we have no transformer, assume the geometries are in file    */
@@ -1120,7 +1525,9 @@ static CPLErr GDALRasterizeGeometriesInternal(
         eOptim = GRO_Raster;
         // TODO make more tests with various inputs/outputs to adjust the
         // parameters
-        if (nYBlockSize > 1 && nGeomCount > 10000 &&
+        // The multi-threaded variant of the raster mode bins geometries per
+        // tile, so it is also appropriate for large number of features.
+        if (nThreads == 1 && nYBlockSize > 1 && nGeomCount > 10000 &&
             (poBand->GetXSize() * static_cast<long long>(poBand->GetYSize()) /
                  nGeomCount >
              50))
@@ -1184,6 +1591,19 @@ static CPLErr GDALRasterizeGeometriesInternal(
                  DIV_ROUND_UP(poDS->GetRasterYSize(), nYChunkSize),
                  nYChunkSize);
 
+        if (nThreads > 1)
+        {
+            eErr = GDALRasterizeGeometriesMultiThreaded(
+                poDS, nBandCount, panBandList, eType, nYChunkSize, nGeomCount,
+                pahGeometries, pfnTransformer, pTransformArg, eBurnValueType,
+                padfGeomBurnValues, panGeomBurnValues, bAllTouched,
+                eBurnValueSource, eMergeAlg, nThreads, pfnProgress,
+                pProgressArg);
+            if (bNeedToFreeTransformer)
+                GDALDestroyTransformer(pTransformArg);
+            return eErr;
+        }
+
         pabyChunkBuf = static_cast<unsigned char *>(VSI_MALLOC2_VERBOSE(
             nYChunkSize, static_cast<size_t>(nScanlineBytes)));
         if (pabyChunkBuf == nullptr)
@@ -1516,6 +1936,13 @@ static CPLErr GDALRasterizeGeometriesInternal(
  * <li>"MERGE_ALG": May be REPLACE (the default) or ADD.  REPLACE results in
  * overwriting of value, while ADD adds the new value to the existing raster,
  * suitable for heatmaps for instance.</li>
+ * <li>"NUM_THREADS": (GDAL >= 3.12) Number of threads, or "ALL_CPUS".
+ * Defaults to 1: contrary to GDALRasterizeGeometries(), the GDAL_NUM_THREADS
+ * configuration option is not taken into account, as, when greater than 1,
+ * the geometries of each layer are loaded in memory. They are then binned by
+ * the envelope of their footprint into tiles of the output chunk, which are
+ * burnt in parallel, as in GDALRasterizeGeometries().
+ * The result does not depend on the number of threads.</li>
  * </ul>
  * @param pfnProgress the progress function to report completion.
  * @param pProgressArg callback data for progress function.
@@ -1560,6 +1987,10 @@ CPLErr GDALRasterizeLayers(GDALDatasetH hDS, int nBandCount, int *panBandList,
     {
         return CE_Failure;
     }
+    // Multi-threading is opt-in here, and not enabled by GDAL_NUM_THREADS,
+    // as it requires loading the geometries of each layer in memory.
+    const char *pszNumThreads = CSLFetchNameValue(papszOptions, "NUM_THREADS");
+    const int nThreads = pszNumThreads ? GDALGetNumThreads(pszNumThreads) : 1;
 
     /* -------------------------------------------------------------------- */
     /*      Establish a chunksize to operate on.  The larger the chunk      */
@@ -1588,18 +2019,24 @@ CPLErr GDALRasterizeLayers(GDALDatasetH hDS, int nBandCount, int *panBandList,
 
     CPLDebug("GDAL", "Rasterizer operating on %d swaths of %d scanlines.",
              DIV_ROUND_UP(poDS->GetRasterYSize(), nYChunkSize), nYChunkSize);
-    unsigned char *pabyChunkBuf = static_cast<unsigned char *>(
-        VSI_MALLOC2_VERBOSE(nYChunkSize, nScanlineBytes));
-    if (pabyChunkBuf == nullptr)
+
+    // The multi-threaded code path allocates its own buffer.
+    unsigned char *pabyChunkBuf = nullptr;
+    if (nThreads == 1)
     {
-        return CE_Failure;
+        pabyChunkBuf = static_cast<unsigned char *>(
+            VSI_MALLOC2_VERBOSE(nYChunkSize, nScanlineBytes));
+        if (pabyChunkBuf == nullptr)
+        {
+            return CE_Failure;
+        }
     }
 
     /* -------------------------------------------------------------------- */
     /*      Read the image once for all layers if user requested to render  */
     /*      the whole raster in single chunk.                               */
     /* -------------------------------------------------------------------- */
-    if (nYChunkSize == poDS->GetRasterYSize())
+    if (nThreads == 1 && nYChunkSize == poDS->GetRasterYSize())
     {
         if (poDS->RasterIO(GF_Read, 0, 0, poDS->GetRasterXSize(), nYChunkSize,
                            pabyChunkBuf, poDS->GetRasterXSize(), nYChunkSize,
@@ -1722,18 +2159,61 @@ CPLErr GDALRasterizeLayers(GDALDatasetH hDS, int nBandCount, int *panBandList,
 
         poLayer->ResetReading();
 
+        /* --------------------------------------------------------------------
+         */
+        /*      In multi-threaded mode, load the geometries of the layer in */
+        /*      memory and burn them by tiles. */
+        /* --------------------------------------------------------------------
+         */
+        if (nThreads > 1 && eErr == CE_None)
+        {
+            std::vector<std::unique_ptr<OGRGeometry>> apoGeoms;
+            std::vector<OGRGeometryH> ahGeoms;
+            std::vector<double> adfGeomBurnValues;
+            for (auto &poFeat : poLayer)
+            {
+                apoGeoms.emplace_back(poFeat->StealGeometry());
+                ahGeoms.push_back(OGRGeometry::ToHandle(apoGeoms.back().get()));
+                for (int iBand = 0; iBand < nBandCount; iBand++)
+                {
+                    adfGeomBurnValues.push_back(
+                        pszBurnAttribute ? poFeat->GetFieldAsDouble(iBurnField)
+                                         : padfBurnValues[iBand]);
+                }
+            }
+            poLayer->ResetReading();
+
+            void *pScaledProgress = GDALCreateScaledProgress(
+                static_cast<double>(iLayer) / nLayerCount,
+                static_cast<double>(iLayer + 1) / nLayerCount, pfnProgress,
+                pProgressArg);
+            eErr = GDALRasterizeGeometriesMultiThreaded(
+                poDS, nBandCount, panBandList, eType, nYChunkSize,
+                static_cast<int>(ahGeoms.size()), ahGeoms.data(),
+                pfnTransformer, pTransformArg, GDT_Float64,
+                adfGeomBurnValues.data(), nullptr, bAllTouched,
+                eBurnValueSource, eMergeAlg, nThreads, GDALScaledProgress,
+                pScaledProgress);
+            GDALDestroyScaledProgress(pScaledProgress);
+        }
+
         /* --------------------------------------------------------------------
          */
         /*      Loop over image in designated chunks. */
         /* --------------------------------------------------------------------
          */
 
-        double *padfAttrValues = static_cast<double *>(
-            VSI_MALLOC_VERBOSE(sizeof(double) * nBandCount));
-        if (padfAttrValues == nullptr)
-            eErr = CE_Failure;
+        double *padfAttrValues = nullptr;
+        if (nThreads == 1)
+        {
+            padfAttrValues = static_cast<double *>(
+                VSI_MALLOC_VERBOSE(sizeof(double) * nBandCount));
+            if (padfAttrValues == nullptr)
+                eErr = CE_Failure;
+        }
 
-        for (int iY = 0; iY < poDS->GetRasterYSize() && eErr == CE_None;
+        for (int iY = 0;
+             nThreads == 1 && iY < poDS->GetRasterYSize() && eErr == CE_None;
              iY += nYChunkSize)
         {
             int nThisYChunkSize = nYChunkSize;
@@ -1806,7 +2286,8 @@ CPLErr GDALRasterizeLayers(GDALDatasetH hDS, int nBandCount, int *panBandList,
     /*      Write out the image once for all layers if user requested       */
     /*      to render the whole raster in single chunk.                     */
     /* -------------------------------------------------------------------- */
-    if (eErr == CE_None && nYChunkSize == poDS->GetRasterYSize())
+    if (eErr == CE_None && nThreads == 1 &&
+        nYChunkSize == poDS->GetRasterYSize())
     {
         eErr =
             poDS->RasterIO(GF_Write, 0, 0, poDS->GetRasterXSize(), nYChunkSize,
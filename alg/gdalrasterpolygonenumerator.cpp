@@ -14,8 +14,10 @@
 #include "cpl_port.h"
 #include "gdal_alg_priv.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <limits>
+#include <new>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
@@ -316,8 +318,303 @@ bool GDALRasterPolygonEnumeratorT<DataType, EqualityTest>::ProcessLine(
     return true;
 }
 
+/************************************************************************/
+/*                 GDALRasterPolygonStripEnumeratorT()                  */
+/************************************************************************/
+
+template <class DataType, class EqualityTest>
+GDALRasterPolygonStripEnumeratorT<DataType, EqualityTest>::
+    GDALRasterPolygonStripEnumeratorT(int nConnectednessIn, int nXSizeIn)
+    : nConnectedness(nConnectednessIn), nXSize(nXSizeIn)
+
+{
+    CPLAssert(nConnectedness == 4 || nConnectedness == 8);
+}
+
+/************************************************************************/
+/*                          GetStripHeight()                            */
+/************************************************************************/
+
+// The strip height only depends on the raster width, so that polygon ids do
+// not depend on the number of threads.
+
+template <class DataType, class EqualityTest>
+int GDALRasterPolygonStripEnumeratorT<DataType, EqualityTest>::GetStripHeight(
+    int nXSizeIn)
+
+{
+    constexpr GIntBig STRIP_SIZE_BYTES = 16 * 1024 * 1024;
+    return static_cast<int>(std::clamp<GIntBig>(
+        STRIP_SIZE_BYTES /
+            (std::max<GIntBig>(1, nXSizeIn) *
+             static_cast<GIntBig>(sizeof(DataType))),
+        16, 1024));
+}
+
+/************************************************************************/
+/*                          EnumerateStrip()                            */
+/************************************************************************/
+
+template <class DataType, class EqualityTest>
+bool GDALRasterPolygonStripEnumeratorT<DataType, EqualityTest>::EnumerateStrip(
+    Strip &oStrip, DataType *panVal, int nLines, bool bComputeSizes) const
+
+{
+    GDALRasterPolygonEnumeratorT<DataType, EqualityTest> oEnum(nConnectedness);
+    try
+    {
+        oStrip.anFirstLineId.resize(nXSize);
+        oStrip.anLastLineId.resize(nXSize);
+        oStrip.anWorkLineId.resize(2 * static_cast<size_t>(nXSize));
+        oStrip.anPolySize.clear();
+
+        GInt32 *panLastLineId = nullptr;
+        GInt32 *panThisLineId = oStrip.anWorkLineId.data();
+        for (int iLine = 0; iLine < nLines; ++iLine)
+        {
+            DataType *panThisLineVal =
+                panVal + static_cast<size_t>(iLine) * nXSize;
+            if (!oEnum.ProcessLine(iLine == 0 ? nullptr
+                                              : panThisLineVal - nXSize,
+                                   panThisLineVal, panLastLineId,
+                                   panThisLineId, nXSize))
+            {
+                return false;
+            }
+
+            if (bComputeSizes)
+            {
+                if (oEnum.nNextPolygonId >
+                    static_cast<int>(oStrip.anPolySize.size()))
+                    oStrip.anPolySize.resize(oEnum.nNextPolygonId);
+                for (int iX = 0; iX < nXSize; iX++)
+                {
+                    const int iPoly = panThisLineId[iX];
+                    if (iPoly >= 0 && oStrip.anPolySize[iPoly] <
+                                          std::numeric_limits<int>::max())
+                        oStrip.anPolySize[iPoly] += 1;
+                }
+            }
+
+            if (iLine == 0)
+                std::copy_n(panThisLineId, nXSize,
+                            oStrip.anFirstLineId.begin());
+            panLastLineId = panThisLineId;
+            panThisLineId = panThisLineId == oStrip.anWorkLineId.data()
+                                ? panThisLineId + nXSize
+                                : oStrip.anWorkLineId.data();
+        }
+        if (panLastLineId)
+            std::copy_n(panLastLineId, nXSize, oStrip.anLastLineId.begin());
+
+        oEnum.CompleteMerges();
+
+        // Polygon ids are allocated in increasing order, so the first id met
+        // for a final id is the smallest one.
+        oStrip.anIdMap.assign(oEnum.nNextPolygonId, -1);
+        oStrip.anPolyValue.resize(oEnum.nNextPolygonId);
+        for (int iPoly = 0; iPoly < oEnum.nNextPolygonId; iPoly++)
+        {
+            const GInt32 nFinalId = oEnum.panPolyIdMap[iPoly];
+            if (oStrip.anIdMap[nFinalId] < 0)
+                oStrip.anIdMap[nFinalId] = iPoly;
+            oStrip.anIdMap[iPoly] = oStrip.anIdMap[nFinalId];
+            oStrip.anPolyValue[iPoly] = oEnum.panPolyValue[iPoly];
+        }
+        oStrip.anPolySize.resize(bComputeSizes ? oEnum.nNextPolygonId : 0);
+    }
+    catch (const std::bad_alloc &)
+    {
+        return false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                             FindRoot()                               */
+/************************************************************************/
+
+template <class DataType, class EqualityTest>
+GInt32
+GDALRasterPolygonStripEnumeratorT<DataType, EqualityTest>::FindRoot(GInt32 nId)
+
+{
+    while (anPolyIdMap[nId] != nId)
+    {
+        anPolyIdMap[nId] = anPolyIdMap[anPolyIdMap[nId]];
+        nId = anPolyIdMap[nId];
+    }
+    return nId;
+}
+
+/************************************************************************/
+/*                               Union()                                */
+/*                                                                      */
+/*      Merge the polygons of two ids, keeping the smallest id as the   */
+/*      root.                                                           */
+/************************************************************************/
+
+template <class DataType, class EqualityTest>
+void GDALRasterPolygonStripEnumeratorT<DataType, EqualityTest>::Union(
+    GInt32 nId1, GInt32 nId2)
+
+{
+    nId1 = FindRoot(nId1);
+    nId2 = FindRoot(nId2);
+    if (nId1 < nId2)
+        anPolyIdMap[nId2] = nId1;
+    else if (nId2 < nId1)
+        anPolyIdMap[nId1] = nId2;
+}
+
+/************************************************************************/
+/*                             AddStrip()                               */
+/************************************************************************/
+
+template <class DataType, class EqualityTest>
+bool GDALRasterPolygonStripEnumeratorT<DataType, EqualityTest>::AddStrip(
+    Strip &oStrip, DataType *panFirstLineVal, const DataType *panPrevLineVal,
+    const GInt32 *panPrevLineId)
+
+{
+    const size_t nFirstId = anPolyIdMap.size();
+    if (oStrip.anIdMap.size() >
+        static_cast<size_t>(std::numeric_limits<GInt32>::max() - 1) - nFirstId)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "GDALRasterPolygonStripEnumerator: Too many polygons");
+        return false;
+    }
+    const GInt32 nFirstGlobalId = static_cast<GInt32>(nFirstId);
+    try
+    {
+        anStripFirstId.push_back(nFirstGlobalId);
+        for (const GInt32 nId : oStrip.anIdMap)
+            anPolyIdMap.push_back(nFirstGlobalId + nId);
+        anPolyValue.insert(anPolyValue.end(), oStrip.anPolyValue.begin(),
+                           oStrip.anPolyValue.end());
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "GDALRasterPolygonStripEnumerator: Out of memory");
+        return false;
+    }
+    oStrip.anIdMap.clear();
+    oStrip.anPolyValue.clear();
+
+    for (int i = 0; i < nXSize; i++)
+    {
+        if (oStrip.anFirstLineId[i] >= 0)
+            oStrip.anFirstLineId[i] += nFirstGlobalId;
+        if (oStrip.anLastLineId[i] >= 0)
+            oStrip.anLastLineId[i] += nFirstGlobalId;
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Merge the polygons touching the boundary with the previous      */
+    /*      strip.                                                          */
+    /* -------------------------------------------------------------------- */
+    if (panPrevLineVal == nullptr)
+        return true;
+
+    EqualityTest eq;
+    const GInt32 *panThisLineId = oStrip.anFirstLineId.data();
+    for (int i = 0; i < nXSize; i++)
+    {
+        if (panThisLineId[i] < 0)
+            continue;
+
+        if (panPrevLineId[i] >= 0 &&
+            eq.operator()(panPrevLineVal[i], panFirstLineVal[i]))
+            Union(panPrevLineId[i], panThisLineId[i]);
+
+        if (nConnectedness == 8)
+        {
+            if (i > 0 && panPrevLineId[i - 1] >= 0 &&
+                eq.operator()(panPrevLineVal[i - 1], panFirstLineVal[i]))
+                Union(panPrevLineId[i - 1], panThisLineId[i]);
+
+            if (i < nXSize - 1 && panPrevLineId[i + 1] >= 0 &&
+                eq.operator()(panPrevLineVal[i + 1], panFirstLineVal[i]))
+                Union(panPrevLineId[i + 1], panThisLineId[i]);
+        }
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                          CompleteMerges()                            */
+/************************************************************************/
+
+template <class DataType, class EqualityTest>
+void GDALRasterPolygonStripEnumeratorT<DataType, EqualityTest>::CompleteMerges()
+
+{
+    for (GInt32 nId = 0; nId < static_cast<GInt32>(anPolyIdMap.size()); ++nId)
+    {
+        anPolyIdMap[nId] = FindRoot(nId);
+    }
+}
+
+/************************************************************************/
+/*                           GetFinalIds()                              */
+/************************************************************************/
+
+template <class DataType, class EqualityTest>
+bool GDALRasterPolygonStripEnumeratorT<DataType, EqualityTest>::GetFinalIds(
+    int iStrip, Strip &oStrip, DataType *panVal, int nLines,
+    GInt32 *panIds) const
+
+{
+    const GInt32 nFirstGlobalId = anStripFirstId[iStrip];
+
+    // Redo the same enumeration as in EnumerateStrip().
+    GDALRasterPolygonEnumeratorT<DataType, EqualityTest> oEnum(nConnectedness);
+    try
+    {
+        oStrip.anWorkLineId.resize(2 * static_cast<size_t>(nXSize));
+    }
+    catch (const std::bad_alloc &)
+    {
+        return false;
+    }
+    GInt32 *panLastLineId = nullptr;
+    GInt32 *panThisLineId = oStrip.anWorkLineId.data();
+    for (int iLine = 0; iLine < nLines; ++iLine)
+    {
+        DataType *panThisLineVal = panVal + static_cast<size_t>(iLine) * nXSize;
+        if (!oEnum.ProcessLine(iLine == 0 ? nullptr : panThisLineVal - nXSize,
+                               panThisLineVal, panLastLineId, panThisLineId,
+                               nXSize))
+        {
+            return false;
+        }
+
+        GInt32 *panFinalId = panIds + static_cast<size_t>(iLine) * nXSize;
+        for (int iX = 0; iX < nXSize; iX++)
+        {
+            panFinalId[iX] =
+                panThisLineId[iX] < 0
+                    ? -1
+                    : anPolyIdMap[nFirstGlobalId + panThisLineId[iX]];
+        }
+
+        panLastLineId = panThisLineId;
+        panThisLineId = panThisLineId == oStrip.anWorkLineId.data()
+                            ? panThisLineId + nXSize
+                            : oStrip.anWorkLineId.data();
+    }
+    return true;
+}
+
 template class GDALRasterPolygonEnumeratorT<std::int64_t, IntEqualityTest>;
 
 template class GDALRasterPolygonEnumeratorT<float, FloatEqualityTest>;
 
+template class GDALRasterPolygonStripEnumeratorT<std::int64_t,
+                                                 IntEqualityTest>;
+
+template class GDALRasterPolygonStripEnumeratorT<float, FloatEqualityTest>;
+
 /*! @endcond */
@@ -17,16 +17,20 @@
 #include <cstring>
 
 #include <algorithm>
+#include <functional>
 #include <set>
+#include <unordered_map>
 #include <vector>
 #include <utility>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
 #include "cpl_progress.h"
+#include "cpl_string.h"
 #include "cpl_vsi.h"
 #include "gdal.h"
 #include "gdal_alg_priv.h"
+#include "gdal_thread_pool.h"
 
 #define MY_MAX_INT 2147483647
 
@@ -125,6 +129,515 @@ static inline void CompareNeighbour(int nPolyId1, int nPolyId2,
         anBigNeighbour[nPolyId2] = nPolyId1;
 }
 
+/************************************************************************/
+/*                          FindMergeTargets()                          */
+/*                                                                      */
+/*      If our biggest neighbour is still smaller than the              */
+/*      threshold, then try tracking to that polygons biggest           */
+/*      neighbour, and so forth. On return, anBigNeighbour[] contains   */
+/*      for each polygon to merge the polygon it must be merged into,   */
+/*      or -1.                                                          */
+/************************************************************************/
+
+static void FindMergeTargets(const GInt32 *panPolyIdMap,
+                             const std::int64_t *panPolyValue,
+                             int nSizeThreshold,
+                             const std::vector<int> &anPolySizes,
+                             std::vector<int> &anBigNeighbour)
+{
+    int nFailedMerges = 0;
+    int nIsolatedSmall = 0;
+    int nSieveTargets = 0;
+
+    for (int iPoly = 0; iPoly < static_cast<int>(anPolySizes.size()); iPoly++)
+    {
+        if (panPolyIdMap[iPoly] != iPoly)
+            continue;
+
+        // Ignore nodata polygons.
+        if (panPolyValue[iPoly] == GP_NODATA_MARKER)
+            continue;
+
+        // Don't try to merge polygons larger than the threshold.
+        if (anPolySizes[iPoly] >= nSizeThreshold)
+        {
+            anBigNeighbour[iPoly] = -1;
+            continue;
+        }
+
+        nSieveTargets++;
+
+        // if we have no neighbours but we are small, what shall we do?
+        if (anBigNeighbour[iPoly] == -1)
+        {
+            nIsolatedSmall++;
+            continue;
+        }
+
+        std::set<int> oSetVisitedPoly;
+        oSetVisitedPoly.insert(iPoly);
+
+        // Walk through our neighbours until we find a polygon large enough.
+        int iFinalId = iPoly;
+        bool bFoundBigEnoughPoly = false;
+        while (true)
+        {
+            iFinalId = anBigNeighbour[iFinalId];
+            if (iFinalId < 0)
+            {
+                break;
+            }
+            // If the biggest neighbour is larger than the threshold
+            // then we are golden.
+            if (anPolySizes[iFinalId] >= nSizeThreshold)
+            {
+                bFoundBigEnoughPoly = true;
+                break;
+            }
+            // Check that we don't cycle on an already visited polygon.
+            if (oSetVisitedPoly.find(iFinalId) != oSetVisitedPoly.end())
+                break;
+            oSetVisitedPoly.insert(iFinalId);
+        }
+
+        if (!bFoundBigEnoughPoly)
+        {
+            nFailedMerges++;
+            anBigNeighbour[iPoly] = -1;
+            continue;
+        }
+
+        // Map the whole intermediate chain to it.
+        int iPolyCur = iPoly;
+        while (anBigNeighbour[iPolyCur] != iFinalId)
+        {
+            int iNextPoly = anBigNeighbour[iPolyCur];
+            anBigNeighbour[iPolyCur] = iFinalId;
+            iPolyCur = iNextPoly;
+        }
+    }
+
+    CPLDebug("GDALSieveFilter",
+             "Small Polygons: %d, Isolated: %d, Unmergable: %d", nSieveTargets,
+             nIsolatedSmall, nFailedMerges);
+}
+
+/************************************************************************/
+/*                   GDALSieveFilterMultiThreaded()                     */
+/*                                                                      */
+/*      Multi-threaded variant of GDALSieveFilter(). The polygons are   */
+/*      enumerated by strips of lines, in parallel (see                 */
+/*      GDALRasterPolygonStripEnumeratorT). The largest neighbour of    */
+/*      each polygon is collected per strip, and the strip results are  */
+/*      combined in raster order, so that ties between neighbours of    */
+/*      the same size are resolved as in the single-threaded            */
+/*      algorithm, and the output is identical.                         */
+/************************************************************************/
+
+static CPLErr GDALSieveFilterMultiThreaded(
+    GDALRasterBandH hSrcBand, GDALRasterBandH hMaskBand,
+    GDALRasterBandH hDstBand, int nSizeThreshold, int nConnectedness,
+    int nThreads, GDALProgressFunc pfnProgress, void *pProgressArg)
+{
+    using EnumeratorType =
+        GDALRasterPolygonStripEnumeratorT<std::int64_t, IntEqualityTest>;
+
+    const int nXSize = GDALGetRasterBandXSize(hSrcBand);
+    const int nYSize = GDALGetRasterBandYSize(hSrcBand);
+
+    const int nStripHeight = EnumeratorType::GetStripHeight(nXSize);
+    const int nStrips = (nYSize + nStripHeight - 1) / nStripHeight;
+    const int nBatchStrips = std::min(nThreads, nStrips);
+    const int nBatchLines = std::min(nYSize, nBatchStrips * nStripHeight);
+
+    CPLWorkerThreadPool *poPool = GDALGetGlobalThreadPool(nThreads);
+
+    EnumeratorType oEnum(nConnectedness, nXSize);
+    std::vector<EnumeratorType::Strip> aoStrips;
+    std::vector<std::int64_t> anVal;
+    std::vector<std::int64_t> anWriteVal;
+    std::vector<GInt32> anBatchId;
+    std::vector<std::int64_t> anPrevLastLineVal;
+    std::vector<GInt32> anPrevLastLineId;
+    std::vector<GByte> abyMaskLine;
+    std::vector<int> anPolySizes;
+    std::vector<int> anBigNeighbour;
+    try
+    {
+        aoStrips.resize(nBatchStrips);
+        anVal.resize(static_cast<size_t>(nBatchLines) * nXSize);
+        anBatchId.resize(static_cast<size_t>(nBatchLines) * nXSize);
+        anPrevLastLineVal.resize(nXSize);
+        anPrevLastLineId.resize(nXSize);
+        abyMaskLine.resize(nXSize);
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory, "%s: Out of memory",
+                 __FUNCTION__);
+        return CE_Failure;
+    }
+
+    const auto ReportOutOfMemory = [](const std::vector<int> &abOK)
+    {
+        if (std::find(abOK.begin(), abOK.end(), false) == abOK.end())
+            return false;
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "GDALSieveFilterMultiThreaded: Out of memory");
+        return true;
+    };
+
+    /* -------------------------------------------------------------------- */
+    /*      First pass: enumerate the polygons of each strip and            */
+    /*      accumulate their sizes.                                         */
+    /* -------------------------------------------------------------------- */
+    CPLErr eErr = CE_None;
+    for (int iFirstStrip = 0; eErr == CE_None && iFirstStrip < nStrips;
+         iFirstStrip += nBatchStrips)
+    {
+        const int nStripsInBatch =
+            std::min(nBatchStrips, nStrips - iFirstStrip);
+        const int iYStart = iFirstStrip * nStripHeight;
+        const int nLines = std::min(nBatchLines, nYSize - iYStart);
+        eErr = GDALReadStripBatch(hSrcBand, hMaskBand, abyMaskLine.data(),
+                                  iYStart, nLines, nXSize, GDT_Int64,
+                                  anVal.data());
+        if (eErr != CE_None)
+            break;
+
+        std::vector<int> abOK(nStripsInBatch, true);
+        GDALRunJobs(poPool, nStripsInBatch,
+                    [&](int iJob)
+                    {
+                        const int iLine = iJob * nStripHeight;
+                        abOK[iJob] = oEnum.EnumerateStrip(
+                            aoStrips[iJob],
+                            anVal.data() + static_cast<size_t>(iLine) * nXSize,
+                            std::min(nStripHeight, nLines - iLine), true);
+                    });
+        if (ReportOutOfMemory(abOK))
+        {
+            eErr = CE_Failure;
+            break;
+        }
+
+        for (int iJob = 0; iJob < nStripsInBatch; ++iJob)
+        {
+            std::int64_t *panFirstLineVal =
+                anVal.data() +
+                static_cast<size_t>(iJob) * nStripHeight * nXSize;
+            const bool bFirstStrip = iFirstStrip == 0 && iJob == 0;
+            if (!oEnum.AddStrip(
+                    aoStrips[iJob], panFirstLineVal,
+                    bFirstStrip ? nullptr
+                    : iJob > 0  ? panFirstLineVal - nXSize
+                                : anPrevLastLineVal.data(),
+                    iJob > 0 ? aoStrips[iJob - 1].anLastLineId.data()
+                             : anPrevLastLineId.data()))
+            {
+                eErr = CE_Failure;
+                break;
+            }
+            try
+            {
+                anPolySizes.insert(anPolySizes.end(),
+                                   aoStrips[iJob].anPolySize.begin(),
+                                   aoStrips[iJob].anPolySize.end());
+            }
+            catch (const std::exception &)
+            {
+                CPLError(CE_Failure, CPLE_OutOfMemory, "%s: Out of memory",
+                         __FUNCTION__);
+                eErr = CE_Failure;
+                break;
+            }
+            aoStrips[iJob].anPolySize.clear();
+        }
+        if (eErr != CE_None)
+            break;
+
+        std::copy_n(anVal.data() + static_cast<size_t>(nLines - 1) * nXSize,
+                    nXSize, anPrevLastLineVal.begin());
+        anPrevLastLineId.swap(aoStrips[nStripsInBatch - 1].anLastLineId);
+
+        if (!pfnProgress(0.25 * (iYStart + nLines) / nYSize, "",
+                         pProgressArg))
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+            eErr = CE_Failure;
+        }
+    }
+    if (eErr != CE_None)
+        return eErr;
+
+    oEnum.CompleteMerges();
+
+    /* -------------------------------------------------------------------- */
+    /*      Check if there are polygons                                     */
+    /* -------------------------------------------------------------------- */
+    if (oEnum.anPolyIdMap.empty())
+    {
+        // Can happen if all pixels are masked
+        if (hSrcBand == hDstBand)
+        {
+            pfnProgress(1.0, "", pProgressArg);
+            return CE_None;
+        }
+        else
+        {
+            return GDALRasterBandCopyWholeRaster(hSrcBand, hDstBand, nullptr,
+                                                 pfnProgress, pProgressArg);
+        }
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Push the sizes of merged polygon fragments into the             */
+    /*      merged polygon id's count.                                      */
+    /* -------------------------------------------------------------------- */
+    const GInt32 *panPolyIdMap = oEnum.anPolyIdMap.data();
+    for (int iPoly = 0; iPoly < static_cast<int>(anPolySizes.size()); iPoly++)
+    {
+        if (panPolyIdMap[iPoly] != iPoly)
+        {
+            GIntBig nSize = anPolySizes[panPolyIdMap[iPoly]];
+
+            nSize += anPolySizes[iPoly];
+
+            if (nSize > MY_MAX_INT)
+                nSize = MY_MAX_INT;
+
+            anPolySizes[panPolyIdMap[iPoly]] = static_cast<int>(nSize);
+            anPolySizes[iPoly] = 0;
+        }
+    }
+
+    try
+    {
+        anBigNeighbour.resize(anPolySizes.size(), -1);
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory, "%s: Out of memory",
+                 __FUNCTION__);
+        return CE_Failure;
+    }
+
+    /* ==================================================================== */
+    /*      Second pass ... identify the largest neighbour for each         */
+    /*      polygon. Each strip keeps, for each polygon, the first of its   */
+    /*      largest neighbours met in raster order.                         */
+    /* ==================================================================== */
+    std::vector<std::unordered_map<int, int>> aoStripBigNeighbour(
+        nBatchStrips);
+    for (int iFirstStrip = 0; eErr == CE_None && iFirstStrip < nStrips;
+         iFirstStrip += nBatchStrips)
+    {
+        const int nStripsInBatch =
+            std::min(nBatchStrips, nStrips - iFirstStrip);
+        const int iYStart = iFirstStrip * nStripHeight;
+        const int nLines = std::min(nBatchLines, nYSize - iYStart);
+        eErr = GDALReadStripBatch(hSrcBand, hMaskBand, abyMaskLine.data(),
+                                  iYStart, nLines, nXSize, GDT_Int64,
+                                  anVal.data());
+        if (eErr != CE_None)
+            break;
+
+        std::vector<int> abOK(nStripsInBatch, true);
+        GDALRunJobs(
+            poPool, nStripsInBatch,
+            [&](int iJob)
+            {
+                const int iLineStart = iJob * nStripHeight;
+                const int iLineEnd =
+                    std::min(nLines, iLineStart + nStripHeight);
+                GInt32 *panIds =
+                    anBatchId.data() + static_cast<size_t>(iLineStart) * nXSize;
+                if (!oEnum.GetFinalIds(
+                        iFirstStrip + iJob, aoStrips[iJob],
+                        anVal.data() +
+                            static_cast<size_t>(iLineStart) * nXSize,
+                        iLineEnd - iLineStart, panIds))
+                {
+                    abOK[iJob] = false;
+                    return;
+                }
+
+                auto &oBigNeighbour = aoStripBigNeighbour[iJob];
+                oBigNeighbour.clear();
+                const auto Compare = [&anPolySizes, &oBigNeighbour](int nId1,
+                                                                    int nId2)
+                {
+                    if (nId1 < 0 || nId2 < 0 || nId1 == nId2)
+                        return;
+                    auto oIter = oBigNeighbour.find(nId1);
+                    if (oIter == oBigNeighbour.end())
+                        oBigNeighbour[nId1] = nId2;
+                    else if (anPolySizes[oIter->second] < anPolySizes[nId2])
+                        oIter->second = nId2;
+                    oIter = oBigNeighbour.find(nId2);
+                    if (oIter == oBigNeighbour.end())
+                        oBigNeighbour[nId2] = nId1;
+                    else if (anPolySizes[oIter->second] < anPolySizes[nId1])
+                        oIter->second = nId1;
+                };
+
+                try
+                {
+                    for (int iLine = iLineStart; iLine < iLineEnd; ++iLine)
+                    {
+                        const int iY = iYStart + iLine;
+                        const GInt32 *panThisLineId =
+                            anBatchId.data() +
+                            static_cast<size_t>(iLine) * nXSize;
+                        const GInt32 *panLastLineId =
+                            iLine > 0 ? panThisLineId - nXSize
+                                      : anPrevLastLineId.data();
+                        for (int iX = 0; iX < nXSize; iX++)
+                        {
+                            if (iY > 0)
+                            {
+                                Compare(panThisLineId[iX], panLastLineId[iX]);
+
+                                if (iX > 0 && nConnectedness == 8)
+                                    Compare(panThisLineId[iX],
+                                            panLastLineId[iX - 1]);
+
+                                if (iX < nXSize - 1 && nConnectedness == 8)
+                                    Compare(panThisLineId[iX],
+                                            panLastLineId[iX + 1]);
+                            }
+
+                            if (iX > 0)
+                                Compare(panThisLineId[iX],
+                                        panThisLineId[iX - 1]);
+                        }
+                    }
+                }
+                catch (const std::exception &)
+                {
+                    abOK[iJob] = false;
+                }
+            });
+        if (ReportOutOfMemory(abOK))
+        {
+            eErr = CE_Failure;
+            break;
+        }
+
+        // Combine strip results in raster order.
+        for (int iJob = 0; iJob < nStripsInBatch; ++iJob)
+        {
+            for (const auto &oIter : aoStripBigNeighbour[iJob])
+            {
+                int &nBigNeighbour = anBigNeighbour[oIter.first];
+                if (nBigNeighbour == -1 ||
+                    anPolySizes[nBigNeighbour] < anPolySizes[oIter.second])
+                    nBigNeighbour = oIter.second;
+            }
+            aoStripBigNeighbour[iJob].clear();
+        }
+
+        std::copy_n(anBatchId.data() + static_cast<size_t>(nLines - 1) * nXSize,
+                    nXSize, anPrevLastLineId.begin());
+
+        if (!pfnProgress(0.25 + 0.25 * (iYStart + nLines) / nYSize, "",
+                         pProgressArg))
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+            eErr = CE_Failure;
+        }
+    }
+    if (eErr != CE_None)
+        return eErr;
+
+    /* -------------------------------------------------------------------- */
+    /*      If our biggest neighbour is still smaller than the              */
+    /*      threshold, then try tracking to that polygons biggest           */
+    /*      neighbour, and so forth.                                        */
+    /* -------------------------------------------------------------------- */
+    FindMergeTargets(panPolyIdMap, oEnum.anPolyValue.data(), nSizeThreshold,
+                     anPolySizes, anBigNeighbour);
+
+    /* ==================================================================== */
+    /*      Make a third pass over the image, actually applying the         */
+    /*      merges.                                                         */
+    /* ==================================================================== */
+    try
+    {
+        anWriteVal.resize(static_cast<size_t>(nBatchLines) * nXSize);
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory, "%s: Out of memory",
+                 __FUNCTION__);
+        return CE_Failure;
+    }
+
+    for (int iFirstStrip = 0; eErr == CE_None && iFirstStrip < nStrips;
+         iFirstStrip += nBatchStrips)
+    {
+        const int nStripsInBatch =
+            std::min(nBatchStrips, nStrips - iFirstStrip);
+        const int iYStart = iFirstStrip * nStripHeight;
+        const int nLines = std::min(nBatchLines, nYSize - iYStart);
+        eErr = GDALReadStripBatch(hSrcBand, hMaskBand, abyMaskLine.data(),
+                                  iYStart, nLines, nXSize, GDT_Int64,
+                                  anVal.data(), anWriteVal.data());
+        if (eErr != CE_None)
+            break;
+
+        std::vector<int> abOK(nStripsInBatch, true);
+        GDALRunJobs(
+            poPool, nStripsInBatch,
+            [&](int iJob)
+            {
+                const int iLineStart = iJob * nStripHeight;
+                const int nStripLines =
+                    std::min(nStripHeight, nLines - iLineStart);
+                const size_t nOffset =
+                    static_cast<size_t>(iLineStart) * nXSize;
+                if (!oEnum.GetFinalIds(iFirstStrip + iJob, aoStrips[iJob],
+                                       anVal.data() + nOffset, nStripLines,
+                                       anBatchId.data() + nOffset))
+                {
+                    abOK[iJob] = false;
+                    return;
+                }
+
+                // Reprocess the actual pixel values according to the
+                // polygon merging.
+                const size_t nCount = static_cast<size_t>(nStripLines) * nXSize;
+                for (size_t i = nOffset; i < nOffset + nCount; ++i)
+                {
+                    const int iThisPoly = anBatchId[i];
+                    if (iThisPoly >= 0 && anBigNeighbour[iThisPoly] != -1)
+                    {
+                        anWriteVal[i] =
+                            oEnum.anPolyValue[anBigNeighbour[iThisPoly]];
+                    }
+                }
+            });
+        if (ReportOutOfMemory(abOK))
+        {
+            eErr = CE_Failure;
+            break;
+        }
+
+        eErr = GDALRasterIO(hDstBand, GF_Write, 0, iYStart, nXSize, nLines,
+                            anWriteVal.data(), nXSize, nLines, GDT_Int64, 0, 0);
+
+        if (eErr == CE_None &&
+            !pfnProgress(0.5 + 0.5 * (iYStart + nLines) / nYSize, "",
+                         pProgressArg))
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+            eErr = CE_Failure;
+        }
+    }
+
+    return eErr;
+}
+
 /************************************************************************/
 /*                          GDALSieveFilter()                           */
 /************************************************************************/
@@ -166,8 +679,13 @@ static inline void CompareNeighbour(int nPolyId1, int nPolyId2,
  * @param nConnectedness either 4 indicating that diagonal pixels are not
  * considered directly adjacent for polygon membership purposes or 8
  * indicating they are.
- * @param papszOptions algorithm options in name=value list form.  None
- * currently supported.
+ * @param papszOptions algorithm options in name=value list form.
+ * <ul>
+ * <li>NUM_THREADS=number_of_threads or ALL_CPUS: (GDAL >= 3.12) Number of
+ * threads used to process the raster by strips of lines. Defaults to the
+ * value of the GDAL_NUM_THREADS configuration option, or 1. The output does
+ * not depend on the number of threads.</li>
+ * </ul>
  * @param pfnProgress callback for reporting algorithm progress matching the
  * GDALProgressFunc() semantics.  May be NULL.
  * @param pProgressArg callback argument passed to pfnProgress.
@@ -178,8 +696,7 @@ static inline void CompareNeighbour(int nPolyId1, int nPolyId2,
 CPLErr CPL_STDCALL GDALSieveFilter(GDALRasterBandH hSrcBand,
                                    GDALRasterBandH hMaskBand,
                                    GDALRasterBandH hDstBand, int nSizeThreshold,
-                                   int nConnectedness,
-                                   CPL_UNUSED char **papszOptions,
+                                   int nConnectedness, char **papszOptions,
                                    GDALProgressFunc pfnProgress,
                                    void *pProgressArg)
 {
@@ -189,6 +706,17 @@ CPLErr CPL_STDCALL GDALSieveFilter(GDALRasterBandH hSrcBand,
     if (pfnProgress == nullptr)
         pfnProgress = GDALDummyProgress;
 
+    const int nThreads =
+        GDALGetNumThreads(CSLFetchNameValue(papszOptions, "NUM_THREADS"));
+    if (nThreads > 1 && GDALGetRasterBandXSize(hSrcBand) > 0 &&
+        GDALGetRasterBandYSize(hSrcBand) > 0)
+    {
+        return GDALSieveFilterMultiThreaded(hSrcBand, hMaskBand, hDstBand,
+                                            nSizeThreshold, nConnectedness,
+                                            nThreads, pfnProgress,
+                                            pProgressArg);
+    }
+
     /* -------------------------------------------------------------------- */
     /*      Allocate working buffers.                                       */
     /* -------------------------------------------------------------------- */
@@ -468,81 +996,8 @@ CPLErr CPL_STDCALL GDALSieveFilter(GDALRasterBandH hSrcBand,
     /*      threshold, then try tracking to that polygons biggest           */
     /*      neighbour, and so forth.                                        */
     /* -------------------------------------------------------------------- */
-    int nFailedMerges = 0;
-    int nIsolatedSmall = 0;
-    int nSieveTargets = 0;
-
-    for (int iPoly = 0; iPoly < static_cast<int>(anPolySizes.size()); iPoly++)
-    {
-        if (oFirstEnum.panPolyIdMap[iPoly] != iPoly)
-            continue;
-
-        // Ignore nodata polygons.
-        if (oFirstEnum.panPolyValue[iPoly] == GP_NODATA_MARKER)
-            continue;
-
-        // Don't try to merge polygons larger than the threshold.
-        if (anPolySizes[iPoly] >= nSizeThreshold)
-        {
-            anBigNeighbour[iPoly] = -1;
-            continue;
-        }
-
-        nSieveTargets++;
-
-        // if we have no neighbours but we are small, what shall we do?
-        if (anBigNeighbour[iPoly] == -1)
-        {
-            nIsolatedSmall++;
-            continue;
-        }
-
-        std::set<int> oSetVisitedPoly;
-        oSetVisitedPoly.insert(iPoly);
-
-        // Walk through our neighbours until we find a polygon large enough.
-        int iFinalId = iPoly;
-        bool bFoundBigEnoughPoly = false;
-        while (true)
-        {
-            iFinalId = anBigNeighbour[iFinalId];
-            if (iFinalId < 0)
-            {
-                break;
-            }
-            // If the biggest neighbour is larger than the threshold
-            // then we are golden.
-            if (anPolySizes[iFinalId] >= nSizeThreshold)
-            {
-                bFoundBigEnoughPoly = true;
-                break;
-            }
-            // Check that we don't cycle on an already visited polygon.
-            if (oSetVisitedPoly.find(iFinalId) != oSetVisitedPoly.end())
-                break;
-            oSetVisitedPoly.insert(iFinalId);
-        }
-
-        if (!bFoundBigEnoughPoly)
-        {
-            nFailedMerges++;
-            anBigNeighbour[iPoly] = -1;
-            continue;
-        }
-
-        // Map the whole intermediate chain to it.
-        int iPolyCur = iPoly;
-        while (anBigNeighbour[iPolyCur] != iFinalId)
-        {
-            int iNextPoly = anBigNeighbour[iPolyCur];
-            anBigNeighbour[iPolyCur] = iFinalId;
-            iPolyCur = iNextPoly;
-        }
-    }
-
-    CPLDebug("GDALSieveFilter",
-             "Small Polygons: %d, Isolated: %d, Unmergable: %d", nSieveTargets,
-             nIsolatedSmall, nFailedMerges);
+    FindMergeTargets(oFirstEnum.panPolyIdMap, oFirstEnum.panPolyValue,
+                     nSizeThreshold, anPolySizes, anBigNeighbour);
 
     /* ==================================================================== */
     /*      Make a third pass over the image, actually applying the         */
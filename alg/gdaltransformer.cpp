@@ -47,6 +47,7 @@ void *GDALDeserializeTPSTransformer(CPLXMLNode *psTree);
 void *GDALDeserializeGeoLocTransformer(CPLXMLNode *psTree);
 void *GDALDeserializeRPCTransformer(CPLXMLNode *psTree);
 void *GDALDeserializeHomographyTransformer(CPLXMLNode *psTree);
+void *GDALDeserializeCoordGridTransformer(CPLXMLNode *psTree);
 CPL_C_END
 
 static CPLXMLNode *GDALSerializeReprojectionTransformer(void *pTransformArg);
@@ -1908,6 +1909,16 @@ const char *GDALGetGenImgProjTranformerOptionList(void)
            "Must be used together with "
            "REPROJECTION_APPROX_ERROR_IN_SRC_SRS_UNIT to be taken into "
            "account.'/>"
+           "<Option name='COORD_GRID' type='boolean' description='"
+           "Only used by gdalwarp. Whether to use a grid of source "
+           "coordinates instead of the approximate transformer.' "
+           "default='NO'/>"
+           "<Option name='COORD_GRID_STEP' type='int' min='1' description='"
+           "Only used by gdalwarp. Size in target pixels of a cell of the "
+           "grid of source coordinates.' default='16'/>"
+           "<Option name='COORD_GRID_CACHE_DIR' type='string' description='"
+           "Only used by gdalwarp. Directory where the grid of source "
+           "coordinates is saved and reloaded from. Implies COORD_GRID=YES.'/>"
            "<Option name='AREA_OF_INTEREST' type='string' "
            "description='"
            "Area of interest, as "
@@ -2125,6 +2136,17 @@ const char *GDALGetGenImgProjTranformerOptionList(void)
  * reprojection. Must be used together with
  * REPROJECTION_APPROX_ERROR_IN_SRC_SRS_UNIT to be taken into account.
  * </li>
+ * <li>COORD_GRID=YES/NO. (GDAL &gt;= 3.12) Only used by gdalwarp. Whether to
+ * wrap the transformer with GDALCreateCoordGridTransformer() instead of
+ * GDALCreateApproxTransformer(), when the error threshold is not zero.
+ * </li>
+ * <li>COORD_GRID_STEP=integer. (GDAL &gt;= 3.12) Only used by gdalwarp. STEP
+ * option of GDALCreateCoordGridTransformer(). Defaults to 16.
+ * </li>
+ * <li>COORD_GRID_CACHE_DIR=directory. (GDAL &gt;= 3.12) Only used by gdalwarp.
+ * CACHE_DIR option of GDALCreateCoordGridTransformer(). Implies
+ * COORD_GRID=YES.
+ * </li>
  * <li>
  * AREA_OF_INTEREST=west_lon_deg,south_lat_deg,east_lon_deg,north_lat_deg. (GDAL
  * &gt;= 3.0) Area of interest, used to compute the best coordinate operation
@@ -4722,6 +4744,11 @@ CPLErr GDALDeserializeTransformer(CPLXMLNode *psTree,
         *ppfnFunc = GDALHomographyTransform;
         *ppTransformArg = GDALDeserializeHomographyTransformer(psTree);
     }
+    else if (EQUAL(psTree->pszValue, "CoordGridTransformer"))
+    {
+        *ppfnFunc = GDALCoordGridTransform;
+        *ppTransformArg = GDALDeserializeCoordGridTransformer(psTree);
+    }
     else
     {
         GDALTransformDeserializeFunc pfnDeserializeFunc = nullptr;
@@ -4897,11 +4924,19 @@ static GDALTransformerInfo *GetGenImgProjTransformInfo(const char *pszFunc,
         return nullptr;
     }
 
-    if (EQUAL(psInfo->pszClassName, GDAL_APPROX_TRANSFORMER_CLASS_NAME))
+    const bool bIsApprox =
+        EQUAL(psInfo->pszClassName, GDAL_APPROX_TRANSFORMER_CLASS_NAME);
+    const bool bIsCoordGrid =
+        EQUAL(psInfo->pszClassName, GDAL_COORD_GRID_TRANSFORMER_CLASS_NAME);
+    if (bIsApprox || bIsCoordGrid)
     {
-        GDALApproxTransformInfo *psATInfo =
-            static_cast<GDALApproxTransformInfo *>(pTransformArg);
-        psInfo = static_cast<GDALTransformerInfo *>(psATInfo->pBaseCBData);
+        void *pBaseCBData =
+            bIsApprox
+                ? static_cast<GDALApproxTransformInfo *>(pTransformArg)
+                      ->pBaseCBData
+                : static_cast<GDALCoordGridTransformInfo *>(pTransformArg)
+                      ->pBaseCBData;
+        psInfo = static_cast<GDALTransformerInfo *>(pBaseCBData);
 
         if (psInfo == nullptr ||
             memcmp(psInfo->abySignature, GDAL_GTI2_SIGNATURE,
@@ -4928,7 +4963,8 @@ static GDALTransformerInfo *GetGenImgProjTransformInfo(const char *pszFunc,
 /************************************************************************/
 
 /**
- * Set ApproxTransformer or GenImgProj output geotransform.
+ * Set ApproxTransformer, CoordGridTransformer or GenImgProj output
+ * geotransform.
  *
  * This is a layer above GDALSetGenImgProjTransformerDstGeoTransform() that
  * checks that the passed hTransformArg is compatible.
@@ -4956,6 +4992,12 @@ void GDALSetTransformerDstGeoTransform(void *pTransformArg,
     if (psInfo)
     {
         GDALSetGenImgProjTransformerDstGeoTransform(psInfo, padfGeoTransform);
+        // The grid of source coordinates is no longer valid
+        if (GDALIsTransformer(pTransformArg,
+                              GDAL_COORD_GRID_TRANSFORMER_CLASS_NAME))
+        {
+            GDALResetCoordGridTransformerGrid(pTransformArg);
+        }
     }
 }
 
@@ -4964,7 +5006,8 @@ void GDALSetTransformerDstGeoTransform(void *pTransformArg,
 /************************************************************************/
 
 /**
- * Get ApproxTransformer or GenImgProj output geotransform.
+ * Get ApproxTransformer, CoordGridTransformer or GenImgProj output
+ * geotransform.
  *
  * @param pTransformArg transformer handle.
  * @param padfGeoTransform (output) the destination geotransform to return (six
@@ -5001,6 +5044,13 @@ bool GDALTransformIsTranslationOnPixelBoundaries(GDALTransformerFunc,
             static_cast<const GDALApproxTransformInfo *>(pTransformerArg);
         pTransformerArg = pApproxInfo->pBaseCBData;
     }
+    else if (GDALIsTransformer(pTransformerArg,
+                               GDAL_COORD_GRID_TRANSFORMER_CLASS_NAME))
+    {
+        const auto *pCoordGridInfo =
+            static_cast<const GDALCoordGridTransformInfo *>(pTransformerArg);
+        pTransformerArg = pCoordGridInfo->pBaseCBData;
+    }
     if (GDALIsTransformer(pTransformerArg, GDAL_GEN_IMG_TRANSFORMER_CLASS_NAME))
     {
         const auto *pGenImgpProjInfo =
@@ -5049,6 +5099,13 @@ bool GDALTransformIsAffineNoRotation(GDALTransformerFunc, void *pTransformerArg)
             static_cast<const GDALApproxTransformInfo *>(pTransformerArg);
         pTransformerArg = pApproxInfo->pBaseCBData;
     }
+    else if (GDALIsTransformer(pTransformerArg,
+                               GDAL_COORD_GRID_TRANSFORMER_CLASS_NAME))
+    {
+        const auto *pCoordGridInfo =
+            static_cast<const GDALCoordGridTransformInfo *>(pTransformerArg);
+        pTransformerArg = pCoordGridInfo->pBaseCBData;
+    }
     if (GDALIsTransformer(pTransformerArg, GDAL_GEN_IMG_TRANSFORMER_CLASS_NAME))
     {
         const auto *pGenImgpProjInfo =
@@ -5081,6 +5138,14 @@ bool GDALTransformHasFastClone(void *pTransformerArg)
         pTransformerArg = pApproxInfo->pBaseCBData;
         // Fallback to next lines
     }
+    else if (GDALIsTransformer(pTransformerArg,
+                               GDAL_COORD_GRID_TRANSFORMER_CLASS_NAME))
+    {
+        const auto *pCoordGridInfo =
+            static_cast<const GDALCoordGridTransformInfo *>(pTransformerArg);
+        pTransformerArg = pCoordGridInfo->pBaseCBData;
+        // Fallback to next lines
+    }
 
     if (GDALIsTransformer(pTransformerArg, GDAL_GEN_IMG_TRANSFORMER_CLASS_NAME))
     {
@@ -1163,6 +1163,14 @@ const char *GDALWarpGetOptionList(void)
            "Can be set to a numeric value or ALL_CPUS to set the number of "
            "threads to use to parallelize the computation part of the warping. "
            "If not set, computation will be done in a single thread..'/>"
+           "<Option name='MAX_CHUNKS_IN_FLIGHT' type='int' min='1' max='8' "
+           "description='"
+           "Maximum number of chunks processed simultaneously by the "
+           "multithreaded warping implementation. Values greater than 2 are "
+           "only used when the source dataset can be read from several "
+           "threads. In that case, the region is split in smaller chunks so "
+           "that the chunks in flight use at most twice the warp memory "
+           "limit.'/>"
            "<Option name='STREAMABLE_OUTPUT' type='boolean' description='"
            "This defaults to FALSE, but may be set to TRUE typically when "
            "writing to a streamed file. The gdalwarp utility automatically "
@@ -1399,6 +1407,19 @@ const char *GDALWarpGetOptionList(void)
  * set the number of threads to use to parallelize the computation part of the
  * warping. If not set, computation will be done in a single thread.</li>
  *
+ * <li>MAX_CHUNKS_IN_FLIGHT: (GDAL >= 3.12) Maximum number of chunks processed
+ * simultaneously by GDALWarpOperation::ChunkAndWarpMulti(). When the source
+ * dataset can be read from several threads (that is it is thread-safe, or it
+ * is opened in read-only mode and can be re-opened, see
+ * GDALGetThreadSafeDataset()), the default is the value of NUM_THREADS,
+ * clamped between 2 and 8, the maximum is 8, and source reads of different
+ * chunks run concurrently. Otherwise, the default and the maximum are 2.
+ * With up to 2 chunks in flight, each of them may use up to the warp memory
+ * limit, as in previous versions. With N > 2 chunks in flight, the region is
+ * split in chunks that use up to 2 / N times the warp memory limit, so that
+ * the total memory used by the chunks in flight remains bounded by twice the
+ * warp memory limit.</li>
+ *
  * <li>STREAMABLE_OUTPUT: (GDAL >= 2.0) This defaults to FALSE, but may
  * be set to TRUE typically when writing to a streamed file. The
  * gdalwarp utility automatically sets this option when writing to
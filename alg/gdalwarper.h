@@ -498,6 +498,7 @@ void GWKThreadsEnd(void *psThreadDataIn);
 
 /*! @cond Doxygen_Suppress */
 typedef struct _GDALWarpChunk GDALWarpChunk;
+struct GDALWarpPipeline;
 
 struct GDALTransformerUniquePtrReleaser
 {
@@ -543,6 +544,8 @@ class CPL_DLL GDALWarpOperation final
 
     CPLMutex *hIOMutex = nullptr;
     CPLMutex *hWarpMutex = nullptr;
+    // Scheduling state of ChunkAndWarpMulti(), only set during its execution
+    GDALWarpPipeline *m_poPipeline = nullptr;
 
     int nChunkListCount = 0;
     int nChunkListMax = 0;
@@ -566,6 +569,23 @@ class CPL_DLL GDALWarpOperation final
                           int nDstYSize);
     void ReportTiming(const char *);
 
+    friend struct GDALWarpPipeline;
+    CPLErr WarpRegionInternal(int nDstXOff, int nDstYOff, int nDstXSize,
+                              int nDstYSize, int nSrcXOff, int nSrcYOff,
+                              int nSrcXSize, int nSrcYSize,
+                              double dfSrcXExtraSize, double dfSrcYExtraSize,
+                              double dfProgressBase, double dfProgressScale,
+                              int iChunk);
+    CPLErr WarpRegionToBufferInternal(
+        int nDstXOff, int nDstYOff, int nDstXSize, int nDstYSize,
+        void *pDataBuf, GDALDataType eBufDataType, int nSrcXOff, int nSrcYOff,
+        int nSrcXSize, int nSrcYSize, double dfSrcXExtraSize,
+        double dfSrcYExtraSize, double dfProgressBase, double dfProgressScale,
+        int iChunk, bool *pbHoldsWriteAccess);
+    bool AcquireIOMutex();
+    bool AcquireWriteAccess(int iChunk);
+    void ReleaseWriteAccess(int iChunk);
+
   public:
     GDALWarpOperation();
     ~GDALWarpOperation();
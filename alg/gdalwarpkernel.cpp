@@ -194,6 +194,14 @@ static CPLErr GWKSumPreserving(GDALWarpKernel *);
 static CPLErr GWKCubicNoMasksOrDstDensityOnlyUShort(GDALWarpKernel *);
 static CPLErr GWKCubicSplineNoMasksOrDstDensityOnlyUShort(GDALWarpKernel *);
 static CPLErr GWKBilinearNoMasksOrDstDensityOnlyUShort(GDALWarpKernel *);
+static CPLErr GWKBilinearMasksByte(GDALWarpKernel *);
+static CPLErr GWKBilinearMasksShort(GDALWarpKernel *);
+static CPLErr GWKBilinearMasksUShort(GDALWarpKernel *);
+static CPLErr GWKBilinearMasksFloat(GDALWarpKernel *);
+static CPLErr GWKCubicMasksByte(GDALWarpKernel *);
+static CPLErr GWKCubicMasksShort(GDALWarpKernel *);
+static CPLErr GWKCubicMasksUShort(GDALWarpKernel *);
+static CPLErr GWKCubicMasksFloat(GDALWarpKernel *);
 
 /************************************************************************/
 /*                           GWKJobStruct                               */
@@ -1283,6 +1291,37 @@ CPLErr GDALWarpKernel::PerformWarp()
         return GWKCubicNoMasksOrDstDensityOnlyDouble(this);
 #endif
 
+    // Validity masks (nodata, cutline, destination mask) and/or source
+    // density (alpha band). The USE_MASKS_FAST_PATH=NO internal option
+    // selects GWKRealCase() instead, for testing.
+    const bool bMasksFastPath =
+        !bNoMasksOrDstDensityOnly && !bApplyVerticalShift &&
+        CPLFetchBool(papszWarpOptions, "USE_MASKS_FAST_PATH", true);
+
+    if (bMasksFastPath && eResample == GRA_Bilinear)
+    {
+        if (eWorkingDataType == GDT_Byte)
+            return GWKBilinearMasksByte(this);
+        if (eWorkingDataType == GDT_Int16)
+            return GWKBilinearMasksShort(this);
+        if (eWorkingDataType == GDT_UInt16)
+            return GWKBilinearMasksUShort(this);
+        if (eWorkingDataType == GDT_Float32)
+            return GWKBilinearMasksFloat(this);
+    }
+
+    if (bMasksFastPath && eResample == GRA_Cubic)
+    {
+        if (eWorkingDataType == GDT_Byte)
+            return GWKCubicMasksByte(this);
+        if (eWorkingDataType == GDT_Int16)
+            return GWKCubicMasksShort(this);
+        if (eWorkingDataType == GDT_UInt16)
+            return GWKCubicMasksUShort(this);
+        if (eWorkingDataType == GDT_Float32)
+            return GWKCubicMasksFloat(this);
+    }
+
     if (eResample == GRA_Average)
         return GWKAverageOrMode(this);
 
@@ -6492,6 +6531,490 @@ static CPLErr GWKNearestFloat(GDALWarpKernel *poWK)
     return GWKRun(poWK, "GWKNearestFloat", GWKNearestThread<float>);
 }
 
+/************************************************************************/
+/*                         GWKMaskRectIsValid()                         */
+/*                                                                      */
+/*      Return whether all the bits of the nSize x nSize window at      */
+/*      (iSrcX, iSrcY) of a validity mask are set. Each row is tested   */
+/*      with one or two 32-bit word operations rather than bit by bit.  */
+/************************************************************************/
+
+static CPL_INLINE bool GWKMaskRectIsValid(const GUInt32 *panMask,
+                                          int nSrcXSize, int iSrcX,
+                                          int iSrcY, int nSize)
+{
+    for (int iY = 0; iY < nSize; ++iY)
+    {
+        const GPtrDiff_t iBit =
+            iSrcX + static_cast<GPtrDiff_t>(iSrcY + iY) * nSrcXSize;
+        const GPtrDiff_t iWord = iBit >> 5;
+        const int nShift = static_cast<int>(iBit & 31);
+        // nSize <= 4, so the window spans at most two words.
+        GUInt64 nBits = panMask[iWord] >> nShift;
+        if (nShift + nSize > 32)
+            nBits |= static_cast<GUInt64>(panMask[iWord + 1]) << (32 - nShift);
+        const GUInt64 nWanted = (static_cast<GUInt64>(1) << nSize) - 1;
+        if ((nBits & nWanted) != nWanted)
+            return false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                       GWKDensityRectIsOpaque()                       */
+/*                                                                      */
+/*      Return whether all the pixels of the nSize x nSize window at    */
+/*      (iSrcX, iSrcY) of a density mask have a density of 1.           */
+/************************************************************************/
+
+static CPL_INLINE bool GWKDensityRectIsOpaque(const float *pafDensity,
+                                              int nSrcXSize, int iSrcX,
+                                              int iSrcY, int nSize)
+{
+    for (int iY = 0; iY < nSize; ++iY)
+    {
+        const float *pafRow = pafDensity + iSrcX +
+                              static_cast<GPtrDiff_t>(iSrcY + iY) * nSrcXSize;
+        for (int iX = 0; iX < nSize; ++iX)
+        {
+            if (pafRow[iX] != 1.0f)
+                return false;
+        }
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                 GWKBilinearResampleAllValid4SampleT()                */
+/*                                                                      */
+/*      Same computation as GWKBilinearResample4Sample() when the 2x2   */
+/*      kernel is inside the source window and all its pixels are       */
+/*      valid, with typed access to the source buffer.                  */
+/************************************************************************/
+
+template <class T>
+static CPL_INLINE double GWKBilinearResampleAllValid4SampleT(
+    const GDALWarpKernel *poWK, int iBand, double dfSrcX, double dfSrcY)
+{
+    const int iSrcX = static_cast<int>(floor(dfSrcX - 0.5));
+    const int iSrcY = static_cast<int>(floor(dfSrcY - 0.5));
+    const GPtrDiff_t iSrcOffset =
+        iSrcX + static_cast<GPtrDiff_t>(iSrcY) * poWK->nSrcXSize;
+    const double dfRatioX = 1.5 - (dfSrcX - iSrcX);
+    const double dfRatioY = 1.5 - (dfSrcY - iSrcY);
+
+    const T *const pSrc =
+        reinterpret_cast<const T *>(poWK->papabySrcImage[iBand]) + iSrcOffset;
+    const T *const pSrcNextLine = pSrc + poWK->nSrcXSize;
+
+    // Keep the order of the accumulations of GWKBilinearResample4Sample()
+    // so that results are identical.
+    const double dfMult1 = dfRatioX * dfRatioY;
+    const double dfMult2 = (1.0 - dfRatioX) * dfRatioY;
+    const double dfMult3 = dfRatioX * (1.0 - dfRatioY);
+    const double dfMult4 = (1.0 - dfRatioX) * (1.0 - dfRatioY);
+
+    const double dfAccumulatorDivisor = dfMult1 + dfMult2 + dfMult3 + dfMult4;
+    const double dfAccumulator =
+        static_cast<double>(pSrc[0]) * dfMult1 +
+        static_cast<double>(pSrc[1]) * dfMult2 +
+        static_cast<double>(pSrcNextLine[0]) * dfMult3 +
+        static_cast<double>(pSrcNextLine[1]) * dfMult4;
+
+    if (dfAccumulatorDivisor == 1.0)
+        return dfAccumulator;
+    return dfAccumulator / dfAccumulatorDivisor;
+}
+
+/************************************************************************/
+/*                   GWKCubicResampleAllValid4SampleT()                 */
+/*                                                                      */
+/*      Same computation as GWKCubicResample4Sample() when the 4x4      */
+/*      kernel is inside the source window and all its pixels are       */
+/*      valid, with typed access to the source buffer.                  */
+/************************************************************************/
+
+template <class T>
+static CPL_INLINE double
+GWKCubicResampleAllValid4SampleT(const GDALWarpKernel *poWK, int iBand,
+                                 double dfSrcX, double dfSrcY)
+{
+    const int iSrcX = static_cast<int>(dfSrcX - 0.5);
+    const int iSrcY = static_cast<int>(dfSrcY - 0.5);
+    const GPtrDiff_t iSrcOffset =
+        iSrcX + static_cast<GPtrDiff_t>(iSrcY) * poWK->nSrcXSize;
+    const double dfDeltaX = dfSrcX - 0.5 - iSrcX;
+    const double dfDeltaY = dfSrcY - 0.5 - iSrcY;
+
+    double adfCoeffsX[4] = {};
+    GWKCubicComputeWeights(dfDeltaX, adfCoeffsX);
+
+    const T *const pSrc =
+        reinterpret_cast<const T *>(poWK->papabySrcImage[iBand]);
+    double adfValueReal[4] = {};
+    for (GPtrDiff_t i = -1; i < 3; i++)
+    {
+        const T *const pRow = pSrc + iSrcOffset + i * poWK->nSrcXSize - 1;
+        const double adfRow[4] = {
+            static_cast<double>(pRow[0]), static_cast<double>(pRow[1]),
+            static_cast<double>(pRow[2]), static_cast<double>(pRow[3])};
+        adfValueReal[i + 1] = CONVOL4(adfCoeffsX, adfRow);
+    }
+
+    double adfCoeffsY[4] = {};
+    GWKCubicComputeWeights(dfDeltaY, adfCoeffsY);
+
+    return CONVOL4(adfCoeffsY, adfValueReal);
+}
+
+/************************************************************************/
+/*                    GWKResampleMasks4SampleThread()                   */
+/*                                                                      */
+/*      Bilinear or cubic resampling with source validity masks (as     */
+/*      set from nodata values or a cutline), a source density mask     */
+/*      (as set from an alpha band or a blended cutline) and/or a       */
+/*      destination validity mask. Produces the same result as          */
+/*      GWKRealCase(), but pixels whose whole kernel is valid and       */
+/*      opaque, which is the vast majority of them in practice, are     */
+/*      resampled directly from the typed source buffer. Only pixels    */
+/*      near invalid or partially transparent areas go through the      */
+/*      generic resampling functions.                                   */
+/************************************************************************/
+
+template <class T, GDALResampleAlg eResample>
+static void GWKResampleMasks4SampleThreadInternal(void *pData)
+
+{
+    static_assert(eResample == GRA_Bilinear || eResample == GRA_Cubic);
+    constexpr int nKernelSize = eResample == GRA_Bilinear ? 2 : 4;
+
+    GWKJobStruct *psJob = static_cast<GWKJobStruct *>(pData);
+    GDALWarpKernel *poWK = psJob->poWK;
+    const int iYMin = psJob->iYMin;
+    const int iYMax = psJob->iYMax;
+
+    const int nDstXSize = poWK->nDstXSize;
+    const int nSrcXSize = poWK->nSrcXSize;
+    const int nSrcYSize = poWK->nSrcYSize;
+    const GUInt32 *const panUnifiedSrcValid = poWK->panUnifiedSrcValid;
+    const float *const pafUnifiedSrcDensity = poWK->pafUnifiedSrcDensity;
+
+    // Same selection of the cubic resampling function as GWKRealCase()
+    const bool bSrcMaskIsDensity = panUnifiedSrcValid == nullptr &&
+                                   poWK->papanBandSrcValid == nullptr &&
+                                   pafUnifiedSrcDensity != nullptr;
+
+    /* -------------------------------------------------------------------- */
+    /*      Allocate x,y,z coordinate arrays for transformation ... one     */
+    /*      scanlines worth of positions.                                   */
+    /* -------------------------------------------------------------------- */
+
+    // For x, 2 *, because we cache the precomputed values at the end.
+    double *padfX =
+        static_cast<double *>(CPLMalloc(2 * sizeof(double) * nDstXSize));
+    double *padfY =
+        static_cast<double *>(CPLMalloc(sizeof(double) * nDstXSize));
+    double *padfZ =
+        static_cast<double *>(CPLMalloc(sizeof(double) * nDstXSize));
+    int *pabSuccess = static_cast<int *>(CPLMalloc(sizeof(int) * nDstXSize));
+
+    const double dfSrcCoordPrecision = CPLAtof(CSLFetchNameValueDef(
+        poWK->papszWarpOptions, "SRC_COORD_PRECISION", "0"));
+    const double dfErrorThreshold = CPLAtof(
+        CSLFetchNameValueDef(poWK->papszWarpOptions, "ERROR_THRESHOLD", "0"));
+
+    const bool bOneSourceCornerFailsToReproject =
+        GWKOneSourceCornerFailsToReproject(psJob);
+
+    // Precompute values.
+    for (int iDstX = 0; iDstX < nDstXSize; iDstX++)
+        padfX[nDstXSize + iDstX] = iDstX + 0.5 + poWK->nDstXOff;
+
+    /* ==================================================================== */
+    /*      Loop over output lines.                                         */
+    /* ==================================================================== */
+    for (int iDstY = iYMin; iDstY < iYMax; iDstY++)
+    {
+        /* --------------------------------------------------------------------
+         */
+        /*      Setup points to transform to source image space. */
+        /* --------------------------------------------------------------------
+         */
+        memcpy(padfX, padfX + nDstXSize, sizeof(double) * nDstXSize);
+        const double dfY = iDstY + 0.5 + poWK->nDstYOff;
+        for (int iDstX = 0; iDstX < nDstXSize; iDstX++)
+            padfY[iDstX] = dfY;
+        memset(padfZ, 0, sizeof(double) * nDstXSize);
+
+        /* --------------------------------------------------------------------
+         */
+        /*      Transform the points from destination pixel/line coordinates */
+        /*      to source pixel/line coordinates. */
+        /* --------------------------------------------------------------------
+         */
+        poWK->pfnTransformer(psJob->pTransformerArg, TRUE, nDstXSize, padfX,
+                             padfY, padfZ, pabSuccess);
+        if (dfSrcCoordPrecision > 0.0)
+        {
+            GWKRoundSourceCoordinates(
+                nDstXSize, padfX, padfY, padfZ, pabSuccess, dfSrcCoordPrecision,
+                dfErrorThreshold, poWK->pfnTransformer, psJob->pTransformerArg,
+                0.5 + poWK->nDstXOff, iDstY + 0.5 + poWK->nDstYOff);
+        }
+
+        /* ====================================================================
+         */
+        /*      Loop over pixels in output scanline. */
+        /* ====================================================================
+         */
+        for (int iDstX = 0; iDstX < nDstXSize; iDstX++)
+        {
+            GPtrDiff_t iSrcOffset = 0;
+            if (!GWKCheckAndComputeSrcOffsets(psJob, pabSuccess, iDstX, iDstY,
+                                              padfX, padfY, nSrcXSize,
+                                              nSrcYSize, iSrcOffset))
+                continue;
+
+            double dfDensity = 1.0;
+
+            if (pafUnifiedSrcDensity != nullptr)
+            {
+                dfDensity = pafUnifiedSrcDensity[iSrcOffset];
+                if (dfDensity < SRC_DENSITY_THRESHOLD)
+                {
+                    if (!bOneSourceCornerFailsToReproject)
+                    {
+                        continue;
+                    }
+                    else if (GWKAdjustSrcOffsetOnEdgeUnifiedSrcDensity(
+                                 psJob, iSrcOffset))
+                    {
+                        dfDensity = pafUnifiedSrcDensity[iSrcOffset];
+                    }
+                    else
+                    {
+                        continue;
+                    }
+                }
+            }
+
+            if (panUnifiedSrcValid != nullptr &&
+                !CPLMaskGet(poWK->panUnifiedSrcValid, iSrcOffset))
+            {
+                if (!bOneSourceCornerFailsToReproject)
+                {
+                    continue;
+                }
+                else if (!GWKAdjustSrcOffsetOnEdge(psJob, iSrcOffset))
+                {
+                    continue;
+                }
+            }
+
+            const double dfSrcX = padfX[iDstX] - poWK->nSrcXOff;
+            const double dfSrcY = padfY[iDstX] - poWK->nSrcYOff;
+
+            // Top-left corner of the kernel, computed as in
+            // GWKBilinearResample4Sample() and GWKCubicResample4Sample().
+            int iKernelX;
+            int iKernelY;
+            if constexpr (eResample == GRA_Bilinear)
+            {
+                iKernelX = static_cast<int>(floor(dfSrcX - 0.5));
+                iKernelY = static_cast<int>(floor(dfSrcY - 0.5));
+            }
+            else
+            {
+                iKernelX = static_cast<int>(dfSrcX - 0.5) - 1;
+                iKernelY = static_cast<int>(dfSrcY - 0.5) - 1;
+            }
+            const bool bKernelValid =
+                iKernelX >= 0 && iKernelY >= 0 &&
+                iKernelX + nKernelSize <= nSrcXSize &&
+                iKernelY + nKernelSize <= nSrcYSize &&
+                (panUnifiedSrcValid == nullptr ||
+                 GWKMaskRectIsValid(panUnifiedSrcValid, nSrcXSize, iKernelX,
+                                    iKernelY, nKernelSize)) &&
+                (pafUnifiedSrcDensity == nullptr ||
+                 GWKDensityRectIsOpaque(pafUnifiedSrcDensity, nSrcXSize,
+                                        iKernelX, iKernelY, nKernelSize));
+
+            /* ====================================================================
+             */
+            /*      Loop processing each band. */
+            /* ====================================================================
+             */
+            bool bHasFoundDensity = false;
+
+            const GPtrDiff_t iDstOffset =
+                iDstX + static_cast<GPtrDiff_t>(iDstY) * nDstXSize;
+            for (int iBand = 0; iBand < poWK->nBands; iBand++)
+            {
+                const GUInt32 *panBandSrcValid =
+                    poWK->papanBandSrcValid ? poWK->papanBandSrcValid[iBand]
+                                            : nullptr;
+                if (bKernelValid &&
+                    (panBandSrcValid == nullptr ||
+                     GWKMaskRectIsValid(panBandSrcValid, nSrcXSize, iKernelX,
+                                        iKernelY, nKernelSize)))
+                {
+                    double dfValue;
+                    if constexpr (eResample == GRA_Bilinear)
+                        dfValue = GWKBilinearResampleAllValid4SampleT<T>(
+                            poWK, iBand, dfSrcX, dfSrcY);
+                    else
+                        dfValue = GWKCubicResampleAllValid4SampleT<T>(
+                            poWK, iBand, dfSrcX, dfSrcY);
+
+                    // The resulting density is 1, so no blending with the
+                    // existing destination value.
+                    ClampRoundAndAvoidNoData<T>(poWK, iBand, iDstOffset,
+                                                dfValue);
+                    bHasFoundDensity = true;
+                    continue;
+                }
+
+                double dfBandDensity = 0.0;
+                double dfValueReal = 0.0;
+                double dfValueImagIgnored = 0.0;
+                if constexpr (eResample == GRA_Bilinear)
+                {
+                    GWKBilinearResample4Sample(poWK, iBand, dfSrcX, dfSrcY,
+                                               &dfBandDensity, &dfValueReal,
+                                               &dfValueImagIgnored);
+                }
+                else if (!bSrcMaskIsDensity)
+                {
+                    GWKCubicResample4Sample(poWK, iBand, dfSrcX, dfSrcY,
+                                            &dfBandDensity, &dfValueReal,
+                                            &dfValueImagIgnored);
+                }
+                else if constexpr (std::is_same<T, GByte>::value ||
+                                   std::is_same<T, GUInt16>::value)
+                {
+                    GWKCubicResampleSrcMaskIsDensity4SampleRealT<T>(
+                        poWK, iBand, dfSrcX, dfSrcY, &dfBandDensity,
+                        &dfValueReal);
+                }
+                else
+                {
+                    GWKCubicResampleSrcMaskIsDensity4SampleReal(
+                        poWK, iBand, dfSrcX, dfSrcY, &dfBandDensity,
+                        &dfValueReal);
+                }
+
+                // If we didn't find any valid inputs skip to next band.
+                if (dfBandDensity < BAND_DENSITY_THRESHOLD)
+                    continue;
+
+                bHasFoundDensity = true;
+
+                GWKSetPixelValueReal(poWK, iBand, iDstOffset, dfBandDensity,
+                                     dfValueReal);
+            }
+
+            if (!bHasFoundDensity)
+                continue;
+
+            /* --------------------------------------------------------------------
+             */
+            /*      Update destination density/validity masks. */
+            /* --------------------------------------------------------------------
+             */
+            GWKOverlayDensity(poWK, iDstOffset, dfDensity);
+
+            if (poWK->panDstValid != nullptr)
+            {
+                CPLMaskSet(poWK->panDstValid, iDstOffset);
+            }
+        }  // Next iDstX.
+
+        /* --------------------------------------------------------------------
+         */
+        /*      Report progress to the user, and optionally cancel out. */
+        /* --------------------------------------------------------------------
+         */
+        if (psJob->pfnProgress && psJob->pfnProgress(psJob))
+            break;
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Cleanup and return.                                             */
+    /* -------------------------------------------------------------------- */
+    CPLFree(padfX);
+    CPLFree(padfY);
+    CPLFree(padfZ);
+    CPLFree(pabSuccess);
+}
+
+template <class T, GDALResampleAlg eResample>
+static void GWKResampleMasks4SampleThread(void *pData)
+
+{
+    GWKJobStruct *psJob = static_cast<GWKJobStruct *>(pData);
+    GDALWarpKernel *poWK = psJob->poWK;
+    // The 4 sample formulas are only used when not downsampling, and
+    // GWKRealCase() uses nearest neighbour on 1-pixel wide sources.
+    if (poWK->dfXScale >= 0.95 && poWK->dfYScale >= 0.95 &&
+        poWK->nSrcXSize > 1 && poWK->nSrcYSize > 1)
+    {
+        GWKResampleMasks4SampleThreadInternal<T, eResample>(pData);
+    }
+    else
+    {
+        GWKRealCaseThread(pData);
+    }
+}
+
+static CPLErr GWKBilinearMasksByte(GDALWarpKernel *poWK)
+{
+    return GWKRun(poWK, "GWKBilinearMasksByte",
+                  GWKResampleMasks4SampleThread<GByte, GRA_Bilinear>);
+}
+
+static CPLErr GWKBilinearMasksShort(GDALWarpKernel *poWK)
+{
+    return GWKRun(poWK, "GWKBilinearMasksShort",
+                  GWKResampleMasks4SampleThread<GInt16, GRA_Bilinear>);
+}
+
+static CPLErr GWKBilinearMasksUShort(GDALWarpKernel *poWK)
+{
+    return GWKRun(
+        poWK, "GWKBilinearMasksUShort",
+        GWKResampleMasks4SampleThread<GUInt16, GRA_Bilinear>);
+}
+
+static CPLErr GWKBilinearMasksFloat(GDALWarpKernel *poWK)
+{
+    return GWKRun(poWK, "GWKBilinearMasksFloat",
+                  GWKResampleMasks4SampleThread<float, GRA_Bilinear>);
+}
+
+static CPLErr GWKCubicMasksByte(GDALWarpKernel *poWK)
+{
+    return GWKRun(poWK, "GWKCubicMasksByte",
+                  GWKResampleMasks4SampleThread<GByte, GRA_Cubic>);
+}
+
+static CPLErr GWKCubicMasksShort(GDALWarpKernel *poWK)
+{
+    return GWKRun(poWK, "GWKCubicMasksShort",
+                  GWKResampleMasks4SampleThread<GInt16, GRA_Cubic>);
+}
+
+static CPLErr GWKCubicMasksUShort(GDALWarpKernel *poWK)
+{
+    return GWKRun(poWK, "GWKCubicMasksUShort",
+                  GWKResampleMasks4SampleThread<GUInt16, GRA_Cubic>);
+}
+
+static CPLErr GWKCubicMasksFloat(GDALWarpKernel *poWK)
+{
+    return GWKRun(poWK, "GWKCubicMasksFloat",
+                  GWKResampleMasks4SampleThread<float, GRA_Cubic>);
+}
+
 /************************************************************************/
 /*                           GWKAverageOrMode()                         */
 /*                                                                      */
@@ -22,10 +22,13 @@
 #include <cstring>
 
 #include <algorithm>
+#include <chrono>
+#include <condition_variable>
 #include <limits>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <vector>
 
 #include "cpl_config.h"
 #include "cpl_conv.h"
@@ -375,6 +378,7 @@ int GDALWarpOperation::ValidateOptions()
         // A few internal/undocumented options
         aosWO.SetNameValue("EXTRA_ELTS", nullptr);
         aosWO.SetNameValue("USE_GENERAL_CASE", nullptr);
+        aosWO.SetNameValue("USE_MASKS_FAST_PATH", nullptr);
         aosWO.SetNameValue("ERROR_THRESHOLD", nullptr);
         aosWO.SetNameValue("ERROR_OUT_IF_EMPTY_SOURCE_WINDOW", nullptr);
         aosWO.SetNameValue("MULT_FACTOR_VERTICAL_SHIFT_PIPELINE", nullptr);
@@ -689,6 +693,10 @@ GDALWarpOperation::Initialize(const GDALWarpOptions *psNewOptions,
                                    GDAL_APPROX_TRANSFORMER_CLASS_NAME) &&
                  GDALTransformLonLatToDestApproxTransformer(
                      psOptions->pTransformerArg, &dfX, &dfY)) ||
+                (GDALIsTransformer(psOptions->pTransformerArg,
+                                   GDAL_COORD_GRID_TRANSFORMER_CLASS_NAME) &&
+                 GDALTransformLonLatToDestCoordGridTransformer(
+                     psOptions->pTransformerArg, &dfX, &dfY)) ||
                 (GDALIsTransformer(psOptions->pTransformerArg,
                                    GDAL_GEN_IMG_TRANSFORMER_CLASS_NAME) &&
                  GDALTransformLonLatToDestGenImgProjTransformer(
@@ -1093,71 +1101,233 @@ CPLErr GDALChunkAndWarpImage(GDALWarpOperationH hOperation, int nDstXOff,
 }
 
 /************************************************************************/
-/*                          ChunkThreadMain()                           */
+/*                          GDALWarpPipeline                            */
 /************************************************************************/
 
-struct ChunkThreadData
+/** Scheduling state of ChunkAndWarpMulti().
+ *
+ * Each chunk goes through the following stages: reading of the destination
+ * buffer (if not initialized), reading of the source buffer and computation
+ * of the masks, warping, and writing of the destination buffer. Several
+ * threads each take the next chunk of the list and run it through those
+ * stages, so that up to nSlots chunks are in flight.
+ *
+ * - Destination I/O is serialized with hIOMutex. Source I/O also is, unless
+ *   the source dataset is thread-safe, in which case sources of different
+ *   chunks are read concurrently.
+ * - Warping is serialized with hWarpMutex, as the warp kernel uses its own
+ *   pool of threads, and shares the transformer.
+ * - Chunks are written in the order of the chunk list.
+ */
+struct GDALWarpPipeline
 {
+    enum Stage
+    {
+        STAGE_DST_READ,
+        STAGE_SRC_READ,
+        STAGE_WARP_WAIT,
+        STAGE_WARP,
+        STAGE_WRITE_WAIT,
+        STAGE_WRITE,
+        STAGE_COUNT
+    };
+
     GDALWarpOperation *poOperation = nullptr;
-    GDALWarpChunk *pasChunkInfo = nullptr;
-    CPLJoinableThread *hThreadHandle = nullptr;
+    CPLErrorAccumulator *poErrorAccumulator = nullptr;
+    bool bConcurrentSourceIO = false;
+    double dfTotalPixels = 0;
+
+    // Progress function of the user, to which monotonic progress is forwarded
+    GDALProgressFunc pfnProgress = nullptr;
+    void *pProgressArg = nullptr;
+
+    std::mutex oMutex{};
+    std::condition_variable oCV{};
+    // Below members are protected by oMutex
+    int iNextChunk = 0;
+    int iNextChunkToWrite = 0;
+    double dfPixelsClaimed = 0;
+    double dfMaxProgress = 0;
+    bool bStop = false;
     CPLErr eErr = CE_None;
-    double dfProgressBase = 0;
-    double dfProgressScale = 0;
-    CPLMutex *hIOMutex = nullptr;
+    double adfStageDuration[STAGE_COUNT] = {};
+    int nSrcReadsInFlight = 0;
+    int nMaxSrcReadsInFlight = 0;
 
-    CPLMutex *hCondMutex = nullptr;
-    volatile int bIOMutexTaken = 0;
-    CPLCond *hCond = nullptr;
+    void AddDuration(Stage eStage,
+                     std::chrono::steady_clock::time_point oStartTime)
+    {
+        const double dfDuration = std::chrono::duration<double>(
+                                      std::chrono::steady_clock::now() -
+                                      oStartTime)
+                                      .count();
+        std::lock_guard<std::mutex> oLock(oMutex);
+        adfStageDuration[eStage] += dfDuration;
+    }
 
-    CPLErrorAccumulator *poErrorAccumulator = nullptr;
+    void BeginSourceRead()
+    {
+        std::lock_guard<std::mutex> oLock(oMutex);
+        ++nSrcReadsInFlight;
+        nMaxSrcReadsInFlight =
+            std::max(nMaxSrcReadsInFlight, nSrcReadsInFlight);
+    }
+
+    void EndSourceRead()
+    {
+        std::lock_guard<std::mutex> oLock(oMutex);
+        --nSrcReadsInFlight;
+    }
+
+    void Stop(CPLErr eErrIn)
+    {
+        {
+            std::lock_guard<std::mutex> oLock(oMutex);
+            bStop = true;
+            if (eErr == CE_None)
+                eErr = eErrIn;
+        }
+        oCV.notify_all();
+    }
+
+    static int CPL_STDCALL ProgressFunc(double dfComplete,
+                                        const char *pszMessage,
+                                        void *pProgressArg);
+    static void ThreadMain(void *pThreadData);
 };
 
-static void ChunkThreadMain(void *pThreadData)
+/************************************************************************/
+/*                   GDALWarpPipeline::ProgressFunc()                   */
+/************************************************************************/
 
+// As chunks may be warped out of order, only forward progress that is
+// beyond the maximum progress already reported.
+int CPL_STDCALL GDALWarpPipeline::ProgressFunc(double dfComplete,
+                                               const char *pszMessage,
+                                               void *pProgressArg)
 {
-    volatile ChunkThreadData *psData =
-        static_cast<volatile ChunkThreadData *>(pThreadData);
+    auto poPipeline = static_cast<GDALWarpPipeline *>(pProgressArg);
+    std::lock_guard<std::mutex> oLock(poPipeline->oMutex);
+    if (poPipeline->bStop)
+        return FALSE;
+    if (dfComplete <= poPipeline->dfMaxProgress)
+        return TRUE;
+    poPipeline->dfMaxProgress = dfComplete;
+    return poPipeline->pfnProgress(dfComplete, pszMessage,
+                                   poPipeline->pProgressArg);
+}
 
-    GDALWarpChunk *pasChunkInfo = psData->pasChunkInfo;
+/************************************************************************/
+/*                    GDALWarpPipeline::ThreadMain()                    */
+/************************************************************************/
 
-    /* -------------------------------------------------------------------- */
-    /*      Acquire IO mutex.                                               */
-    /* -------------------------------------------------------------------- */
-    if (!CPLAcquireMutex(psData->hIOMutex, 600.0))
-    {
-        CPLError(CE_Failure, CPLE_AppDefined,
-                 "Failed to acquire IOMutex in WarpRegion().");
-        psData->eErr = CE_Failure;
-    }
-    else
+void GDALWarpPipeline::ThreadMain(void *pThreadData)
+{
+    auto poPipeline = static_cast<GDALWarpPipeline *>(pThreadData);
+    GDALWarpOperation *poOperation = poPipeline->poOperation;
+
+    auto oAccumulator =
+        poPipeline->poErrorAccumulator->InstallForCurrentScope();
+    CPL_IGNORE_RET_VAL(oAccumulator);
+
+    while (true)
     {
-        if (psData->hCond != nullptr)
+        int iChunk;
+        double dfProgressBase;
         {
-            CPLAcquireMutex(psData->hCondMutex, 1.0);
-            psData->bIOMutexTaken = TRUE;
-            CPLCondSignal(psData->hCond);
-            CPLReleaseMutex(psData->hCondMutex);
+            std::lock_guard<std::mutex> oLock(poPipeline->oMutex);
+            if (poPipeline->bStop ||
+                poPipeline->iNextChunk == poOperation->nChunkListCount)
+            {
+                break;
+            }
+            iChunk = poPipeline->iNextChunk++;
+            dfProgressBase =
+                poPipeline->dfPixelsClaimed / poPipeline->dfTotalPixels;
+            const GDALWarpChunk *pasThisChunk =
+                poOperation->pasChunkList + iChunk;
+            poPipeline->dfPixelsClaimed +=
+                pasThisChunk->dsx * static_cast<double>(pasThisChunk->dsy);
         }
 
-        auto oAccumulator =
-            psData->poErrorAccumulator->InstallForCurrentScope();
-        CPL_IGNORE_RET_VAL(oAccumulator);
+        const GDALWarpChunk *pasChunkInfo = poOperation->pasChunkList + iChunk;
+        const double dfProgressScale =
+            pasChunkInfo->dsx * static_cast<double>(pasChunkInfo->dsy) /
+            poPipeline->dfTotalPixels;
 
-        psData->eErr = psData->poOperation->WarpRegion(
+        CPLDebug("GDAL", "Start chunk %d / %d.", iChunk,
+                 poOperation->nChunkListCount);
+        const CPLErr eErr = poOperation->WarpRegionInternal(
             pasChunkInfo->dx, pasChunkInfo->dy, pasChunkInfo->dsx,
             pasChunkInfo->dsy, pasChunkInfo->sx, pasChunkInfo->sy,
             pasChunkInfo->ssx, pasChunkInfo->ssy, pasChunkInfo->sExtraSx,
-            pasChunkInfo->sExtraSy, psData->dfProgressBase,
-            psData->dfProgressScale);
+            pasChunkInfo->sExtraSy, dfProgressBase, dfProgressScale, iChunk);
+        if (eErr != CE_None)
+        {
+            poPipeline->Stop(eErr);
+            break;
+        }
+        CPLDebug("GDAL", "Finished chunk %d / %d.", iChunk,
+                 poOperation->nChunkListCount);
+    }
+}
 
-        /* --------------------------------------------------------------------
-         */
-        /*      Release the IO mutex. */
-        /* --------------------------------------------------------------------
-         */
-        CPLReleaseMutex(psData->hIOMutex);
+/************************************************************************/
+/*                          AcquireIOMutex()                            */
+/************************************************************************/
+
+bool GDALWarpOperation::AcquireIOMutex()
+{
+    if (!CPLAcquireMutex(hIOMutex, 600.0))
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Failed to acquire IOMutex in WarpRegion().");
+        return false;
     }
+    return true;
+}
+
+/************************************************************************/
+/*                        AcquireWriteAccess()                          */
+/************************************************************************/
+
+/** Wait for the previous chunks to be written, and acquire the IO mutex.
+ *
+ * Returns false if the pipeline has been stopped in the meantime.
+ */
+bool GDALWarpOperation::AcquireWriteAccess(int iChunk)
+{
+    const auto oStartTime = std::chrono::steady_clock::now();
+    {
+        std::unique_lock<std::mutex> oLock(m_poPipeline->oMutex);
+        m_poPipeline->oCV.wait(
+            oLock,
+            [this, iChunk]()
+            {
+                return m_poPipeline->bStop ||
+                       m_poPipeline->iNextChunkToWrite == iChunk;
+            });
+        if (m_poPipeline->bStop)
+            return false;
+    }
+    const bool bRet = AcquireIOMutex();
+    m_poPipeline->AddDuration(GDALWarpPipeline::STAGE_WRITE_WAIT,
+                              oStartTime);
+    return bRet;
+}
+
+/************************************************************************/
+/*                        ReleaseWriteAccess()                          */
+/************************************************************************/
+
+void GDALWarpOperation::ReleaseWriteAccess(int iChunk)
+{
+    CPLReleaseMutex(hIOMutex);
+    {
+        std::lock_guard<std::mutex> oLock(m_poPipeline->oMutex);
+        m_poPipeline->iNextChunkToWrite = iChunk + 1;
+    }
+    m_poPipeline->oCV.notify_all();
 }
 
 /************************************************************************/
@@ -1174,7 +1344,18 @@ static void ChunkThreadMain(void *pThreadData)
  *
  * Externally this method operates the same as ChunkAndWarpImage(), but
  * internally this method uses multiple threads to interleave input/output
- * for one region while the processing is being done for another.
+ * for several regions while the processing is being done for another.
+ *
+ * The number of regions (chunks) in flight is set by the
+ * MAX_CHUNKS_IN_FLIGHT warp option, capped to 8. Sources of different chunks
+ * are read concurrently if the source dataset is thread-safe, or can be made
+ * thread-safe with GDALGetThreadSafeDataset(). Otherwise, at most 2 chunks
+ * are in flight. Chunks are written in order.
+ *
+ * With up to 2 chunks in flight, each of them may use up to the warp memory
+ * limit. With more chunks in flight, the region is split in smaller chunks,
+ * so that all of them together do not use more than twice the warp memory
+ * limit.
  *
  * @param nDstXOff X offset to window of destination data to be produced.
  * @param nDstYOff Y offset to window of destination data to be produced.
@@ -1188,141 +1369,150 @@ CPLErr GDALWarpOperation::ChunkAndWarpMulti(int nDstXOff, int nDstYOff,
                                             int nDstXSize, int nDstYSize)
 
 {
-    hIOMutex = CPLCreateMutex();
-    hWarpMutex = CPLCreateMutex();
-
-    CPLReleaseMutex(hIOMutex);
-    CPLReleaseMutex(hWarpMutex);
-
-    CPLCond *hCond = CPLCreateCond();
-    CPLMutex *hCondMutex = CPLCreateMutex();
-    CPLReleaseMutex(hCondMutex);
+    if (hIOMutex == nullptr)
+    {
+        hIOMutex = CPLCreateMutex();
+        hWarpMutex = CPLCreateMutex();
 
-    /* -------------------------------------------------------------------- */
-    /*      Collect the list of chunks to operate on.                       */
-    /* -------------------------------------------------------------------- */
-    CollectChunkList(nDstXOff, nDstYOff, nDstXSize, nDstYSize);
+        CPLReleaseMutex(hIOMutex);
+        CPLReleaseMutex(hWarpMutex);
+    }
 
     /* -------------------------------------------------------------------- */
-    /*      Process them one at a time, updating the progress               */
-    /*      information for each region.                                    */
+    /*      Determine how many chunks can be in flight, and whether the     */
+    /*      source can be read concurrently.                                */
     /* -------------------------------------------------------------------- */
-    ChunkThreadData volatile asThreadData[2] = {};
+    GDALWarpPipeline oPipeline;
     CPLErrorAccumulator oErrorAccumulator;
-    for (int i = 0; i < 2; ++i)
-    {
-        asThreadData[i].poOperation = this;
-        asThreadData[i].hIOMutex = hIOMutex;
-        asThreadData[i].poErrorAccumulator = &oErrorAccumulator;
-    }
-
-    double dfPixelsProcessed = 0.0;
-    double dfTotalPixels = static_cast<double>(nDstXSize) * nDstYSize;
-
-    CPLErr eErr = CE_None;
-    for (int iChunk = 0; iChunk < nChunkListCount + 1; iChunk++)
-    {
-        int iThread = iChunk % 2;
-
-        /* --------------------------------------------------------------------
-         */
-        /*      Launch thread for this chunk. */
-        /* --------------------------------------------------------------------
-         */
-        if (pasChunkList != nullptr && iChunk < nChunkListCount)
-        {
-            GDALWarpChunk *pasThisChunk = pasChunkList + iChunk;
-            const double dfChunkPixels =
-                pasThisChunk->dsx * static_cast<double>(pasThisChunk->dsy);
-
-            asThreadData[iThread].dfProgressBase =
-                dfPixelsProcessed / dfTotalPixels;
-            asThreadData[iThread].dfProgressScale =
-                dfChunkPixels / dfTotalPixels;
-
-            dfPixelsProcessed += dfChunkPixels;
-
-            asThreadData[iThread].pasChunkInfo = pasThisChunk;
-
-            if (iChunk == 0)
-            {
-                asThreadData[iThread].hCond = hCond;
-                asThreadData[iThread].hCondMutex = hCondMutex;
-            }
-            else
-            {
-                asThreadData[iThread].hCond = nullptr;
-                asThreadData[iThread].hCondMutex = nullptr;
-            }
-            asThreadData[iThread].bIOMutexTaken = FALSE;
-
-            CPLDebug("GDAL", "Start chunk %d / %d.", iChunk, nChunkListCount);
-            asThreadData[iThread].hThreadHandle = CPLCreateJoinableThread(
-                ChunkThreadMain,
-                const_cast<ChunkThreadData *>(&asThreadData[iThread]));
-            if (asThreadData[iThread].hThreadHandle == nullptr)
-            {
-                CPLError(
-                    CE_Failure, CPLE_AppDefined,
-                    "CPLCreateJoinableThread() failed in ChunkAndWarpMulti()");
-                eErr = CE_Failure;
-                break;
-            }
-
-            // Wait that the first thread has acquired the IO mutex before
-            // proceeding.  This will ensure that the first thread will run
-            // before the second one.
-            if (iChunk == 0)
-            {
-                CPLAcquireMutex(hCondMutex, 1.0);
-                while (asThreadData[iThread].bIOMutexTaken == FALSE)
-                    CPLCondWait(hCond, hCondMutex);
-                CPLReleaseMutex(hCondMutex);
-            }
+    oPipeline.poOperation = this;
+    oPipeline.poErrorAccumulator = &oErrorAccumulator;
+    oPipeline.dfTotalPixels = static_cast<double>(nDstXSize) * nDstYSize;
+
+    const GDALDatasetH hSrcDSOri = psOptions->hSrcDS;
+    GDALDataset *poThreadSafeSrcDS = nullptr;
+    int nSlots = 2;
+    const char *pszMaxChunks =
+        CSLFetchNameValue(psOptions->papszWarpOptions, "MAX_CHUNKS_IN_FLIGHT");
+    // Beyond that, the memory limit of each chunk, and thus the number of
+    // chunks, would be the bottleneck.
+    constexpr int MAX_CHUNKS_IN_FLIGHT = 8;
+    GDALDataset *poSrcDS = GDALDataset::FromHandle(psOptions->hSrcDS);
+    if ((pszMaxChunks == nullptr || atoi(pszMaxChunks) > 2) &&
+        (poSrcDS->IsThreadSafe(GDAL_OF_RASTER) ||
+         poSrcDS->GetAccess() == GA_ReadOnly))
+    {
+        // Only worth it if the warp memory limit requires more than 2 chunks.
+        // Errors are reported when collecting the final list of chunks.
+        CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+        WipeChunkList();
+        CPL_IGNORE_RET_VAL(CollectChunkListInternal(nDstXOff, nDstYOff,
+                                                    nDstXSize, nDstYSize));
+        if (nChunkListCount > 2)
+            poThreadSafeSrcDS =
+                GDALGetThreadSafeDataset(poSrcDS, GDAL_OF_RASTER);
+    }
+    if (poThreadSafeSrcDS)
+    {
+        oPipeline.bConcurrentSourceIO = true;
+        psOptions->hSrcDS = GDALDataset::ToHandle(poThreadSafeSrcDS);
+        if (pszMaxChunks)
+        {
+            nSlots = std::clamp(atoi(pszMaxChunks), 1, MAX_CHUNKS_IN_FLIGHT);
         }
-
-        /* --------------------------------------------------------------------
-         */
-        /*      Wait for previous chunks thread to complete. */
-        /* --------------------------------------------------------------------
-         */
-        if (iChunk > 0)
+        else
         {
-            iThread = (iChunk - 1) % 2;
-
-            // Wait for thread to finish.
-            CPLJoinThread(asThreadData[iThread].hThreadHandle);
-            asThreadData[iThread].hThreadHandle = nullptr;
-
-            CPLDebug("GDAL", "Finished chunk %d / %d.", iChunk - 1,
-                     nChunkListCount);
-
-            eErr = asThreadData[iThread].eErr;
-
-            if (eErr != CE_None)
-                break;
+            // As many chunks as warp threads, so that source reads of
+            // (remote) sources keep them busy
+            const char *pszWarpThreads =
+                CSLFetchNameValue(psOptions->papszWarpOptions, "NUM_THREADS");
+            if (pszWarpThreads == nullptr)
+                pszWarpThreads = CPLGetConfigOption("GDAL_NUM_THREADS", "1");
+            const int nWarpThreads = EQUAL(pszWarpThreads, "ALL_CPUS")
+                                         ? CPLGetNumCPUs()
+                                         : atoi(pszWarpThreads);
+            nSlots = std::clamp(nWarpThreads, 2, MAX_CHUNKS_IN_FLIGHT);
         }
     }
+    else if (pszMaxChunks)
+    {
+        nSlots = std::max(1, std::min(2, atoi(pszMaxChunks)));
+    }
 
     /* -------------------------------------------------------------------- */
-    /*      Wait for all threads to complete.                               */
+    /*      Collect the list of chunks to operate on. Beyond 2 chunks in    */
+    /*      flight, they share the memory that 2 chunks of the warp memory  */
+    /*      limit would use, so as to bound the total memory consumption.   */
     /* -------------------------------------------------------------------- */
-    for (int iThread = 0; iThread < 2; iThread++)
-    {
-        if (asThreadData[iThread].hThreadHandle)
-            CPLJoinThread(asThreadData[iThread].hThreadHandle);
-    }
+    const double dfWarpMemoryLimit = psOptions->dfWarpMemoryLimit;
+    if (nSlots > 2)
+        psOptions->dfWarpMemoryLimit = 2 * dfWarpMemoryLimit / nSlots;
+    CollectChunkList(nDstXOff, nDstYOff, nDstXSize, nDstYSize);
+    psOptions->dfWarpMemoryLimit = dfWarpMemoryLimit;
+    nSlots = std::max(1, std::min(nSlots, nChunkListCount));
+
+    oPipeline.pfnProgress = psOptions->pfnProgress;
+    oPipeline.pProgressArg = psOptions->pProgressArg;
+    psOptions->pfnProgress = GDALWarpPipeline::ProgressFunc;
+    psOptions->pProgressArg = &oPipeline;
+    m_poPipeline = &oPipeline;
 
-    CPLDestroyCond(hCond);
-    CPLDestroyMutex(hCondMutex);
+    /* -------------------------------------------------------------------- */
+    /*      Process the chunks.                                             */
+    /* -------------------------------------------------------------------- */
+    const auto oStartTime = std::chrono::steady_clock::now();
+    std::vector<CPLJoinableThread *> ahThreads;
+    for (int i = 0; i < nSlots; ++i)
+    {
+        CPLJoinableThread *hThread =
+            CPLCreateJoinableThread(GDALWarpPipeline::ThreadMain, &oPipeline);
+        if (hThread == nullptr)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "CPLCreateJoinableThread() failed in ChunkAndWarpMulti()");
+            oPipeline.Stop(CE_Failure);
+            break;
+        }
+        ahThreads.push_back(hThread);
+    }
+    for (CPLJoinableThread *hThread : ahThreads)
+        CPLJoinThread(hThread);
+
+    m_poPipeline = nullptr;
+    psOptions->pfnProgress = oPipeline.pfnProgress;
+    psOptions->pProgressArg = oPipeline.pProgressArg;
+    psOptions->hSrcDS = hSrcDSOri;
+    if (poThreadSafeSrcDS)
+        poThreadSafeSrcDS->ReleaseRef();
+
+    const double dfTotalDuration =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                      oStartTime)
+            .count();
+    const double *padfDuration = oPipeline.adfStageDuration;
+    CPLDebug("WARP",
+             "ChunkAndWarpMulti(): %d chunks, %d in flight, %s source "
+             "reads (at most %d at once), %.3f s. Cumulated time of stages: "
+             "destination read %.3f s, source read %.3f s, "
+             "wait for warp %.3f s, warp %.3f s, "
+             "wait for write %.3f s, write %.3f s",
+             nChunkListCount, nSlots,
+             oPipeline.bConcurrentSourceIO ? "concurrent" : "serialized",
+             oPipeline.nMaxSrcReadsInFlight, dfTotalDuration,
+             padfDuration[GDALWarpPipeline::STAGE_DST_READ],
+             padfDuration[GDALWarpPipeline::STAGE_SRC_READ],
+             padfDuration[GDALWarpPipeline::STAGE_WARP_WAIT],
+             padfDuration[GDALWarpPipeline::STAGE_WARP],
+             padfDuration[GDALWarpPipeline::STAGE_WRITE_WAIT],
+             padfDuration[GDALWarpPipeline::STAGE_WRITE]);
 
     WipeChunkList();
 
     oErrorAccumulator.ReplayErrors();
 
-    psOptions->pfnProgress(1.0, "", psOptions->pProgressArg);
+    if (oPipeline.eErr == CE_None)
+        psOptions->pfnProgress(1.0, "", psOptions->pProgressArg);
 
-    return eErr;
+    return oPipeline.eErr;
 }
 
 /************************************************************************/
@@ -1703,6 +1893,25 @@ CPLErr GDALWarpOperation::WarpRegion(
     int nSrcYOff, int nSrcXSize, int nSrcYSize, double dfSrcXExtraSize,
     double dfSrcYExtraSize, double dfProgressBase, double dfProgressScale)
 
+{
+    return WarpRegionInternal(nDstXOff, nDstYOff, nDstXSize, nDstYSize,
+                              nSrcXOff, nSrcYOff, nSrcXSize, nSrcYSize,
+                              dfSrcXExtraSize, dfSrcYExtraSize, dfProgressBase,
+                              dfProgressScale, -1);
+}
+
+/************************************************************************/
+/*                        WarpRegionInternal()                          */
+/************************************************************************/
+
+// iChunk is the index of the chunk in pasChunkList when called from
+// ChunkAndWarpMulti() (m_poPipeline != nullptr), or -1 otherwise.
+CPLErr GDALWarpOperation::WarpRegionInternal(
+    int nDstXOff, int nDstYOff, int nDstXSize, int nDstYSize, int nSrcXOff,
+    int nSrcYOff, int nSrcXSize, int nSrcYSize, double dfSrcXExtraSize,
+    double dfSrcYExtraSize, double dfProgressBase, double dfProgressScale,
+    int iChunk)
+
 {
     ReportTiming(nullptr);
 
@@ -1724,6 +1933,13 @@ CPLErr GDALWarpOperation::WarpRegion(
     GDALDataset *poDstDS = GDALDataset::FromHandle(psOptions->hDstDS);
     if (!bDstBufferInitialized)
     {
+        const auto oStartTime = std::chrono::steady_clock::now();
+        if (m_poPipeline && !AcquireIOMutex())
+        {
+            DestroyDestinationBuffer(pDstBuffer);
+            return CE_Failure;
+        }
+
         CPLErr eErr = CE_None;
         if (psOptions->nBandCount == 1)
         {
@@ -1743,6 +1959,13 @@ CPLErr GDALWarpOperation::WarpRegion(
                                      psOptions->panDstBands, 0, 0, 0, nullptr);
         }
 
+        if (m_poPipeline)
+        {
+            CPLReleaseMutex(hIOMutex);
+            m_poPipeline->AddDuration(GDALWarpPipeline::STAGE_DST_READ,
+                                      oStartTime);
+        }
+
         if (eErr != CE_None)
         {
             DestroyDestinationBuffer(pDstBuffer);
@@ -1755,19 +1978,30 @@ CPLErr GDALWarpOperation::WarpRegion(
     /* -------------------------------------------------------------------- */
     /*      Perform the warp.                                               */
     /* -------------------------------------------------------------------- */
+    bool bHoldsWriteAccess = false;
     CPLErr eErr = nSrcXSize == 0
                       ? CE_None
-                      : WarpRegionToBuffer(
+                      : WarpRegionToBufferInternal(
                             nDstXOff, nDstYOff, nDstXSize, nDstYSize,
                             pDstBuffer, psOptions->eWorkingDataType, nSrcXOff,
                             nSrcYOff, nSrcXSize, nSrcYSize, dfSrcXExtraSize,
-                            dfSrcYExtraSize, dfProgressBase, dfProgressScale);
+                            dfSrcYExtraSize, dfProgressBase, dfProgressScale,
+                            iChunk, &bHoldsWriteAccess);
 
     /* -------------------------------------------------------------------- */
     /*      Write the output data back to disk if all went well.            */
+    /*      Within ChunkAndWarpMulti(), chunks are written in order.        */
     /* -------------------------------------------------------------------- */
+    if (eErr == CE_None && m_poPipeline && !bHoldsWriteAccess)
+    {
+        if (AcquireWriteAccess(iChunk))
+            bHoldsWriteAccess = true;
+        else
+            eErr = CE_Failure;
+    }
     if (eErr == CE_None)
     {
+        const auto oStartTime = std::chrono::steady_clock::now();
         if (psOptions->nBandCount == 1)
         {
             // Particular case to simplify the stack a bit.
@@ -1797,7 +2031,12 @@ CPLErr GDALWarpOperation::WarpRegion(
                 eErr = CE_Failure;
         }
         ReportTiming("Output buffer write");
+        if (m_poPipeline)
+            m_poPipeline->AddDuration(GDALWarpPipeline::STAGE_WRITE,
+                                      oStartTime);
     }
+    if (bHoldsWriteAccess)
+        ReleaseWriteAccess(iChunk);
 
     /* -------------------------------------------------------------------- */
     /*      Cleanup and return.                                             */
@@ -1903,11 +2142,33 @@ CPLErr GDALWarpOperation::WarpRegionToBuffer(
  */
 
 CPLErr GDALWarpOperation::WarpRegionToBuffer(
+    int nDstXOff, int nDstYOff, int nDstXSize, int nDstYSize, void *pDataBuf,
+    GDALDataType eBufDataType, int nSrcXOff, int nSrcYOff, int nSrcXSize,
+    int nSrcYSize, double dfSrcXExtraSize, double dfSrcYExtraSize,
+    double dfProgressBase, double dfProgressScale)
+
+{
+    return WarpRegionToBufferInternal(
+        nDstXOff, nDstYOff, nDstXSize, nDstYSize, pDataBuf, eBufDataType,
+        nSrcXOff, nSrcYOff, nSrcXSize, nSrcYSize, dfSrcXExtraSize,
+        dfSrcYExtraSize, dfProgressBase, dfProgressScale, -1, nullptr);
+}
+
+/************************************************************************/
+/*                     WarpRegionToBufferInternal()                     */
+/************************************************************************/
+
+// When called from ChunkAndWarpMulti() (m_poPipeline != nullptr), this is
+// entered without any mutex held. If the destination alpha band must be
+// written, *pbHoldsWriteAccess is set to true on return, and the caller must
+// call ReleaseWriteAccess(iChunk) after writing the destination buffer.
+CPLErr GDALWarpOperation::WarpRegionToBufferInternal(
     int nDstXOff, int nDstYOff, int nDstXSize, int nDstYSize, void *pDataBuf,
     // Only in a CPLAssert.
     CPL_UNUSED GDALDataType eBufDataType, int nSrcXOff, int nSrcYOff,
     int nSrcXSize, int nSrcYSize, double dfSrcXExtraSize,
-    double dfSrcYExtraSize, double dfProgressBase, double dfProgressScale)
+    double dfSrcYExtraSize, double dfProgressBase, double dfProgressScale,
+    int iChunk, bool *pbHoldsWriteAccess)
 
 {
     const int nWordSize = GDALGetDataTypeSizeBytes(psOptions->eWorkingDataType);
@@ -2014,6 +2275,21 @@ CPLErr GDALWarpOperation::WarpRegionToBuffer(
                  WARP_EXTRA_ELTS) *
                 i;
 
+    // Unless the source dataset is thread-safe, source reads (including
+    // masks) are serialized with destination I/O.
+    const auto oSrcReadStartTime = std::chrono::steady_clock::now();
+    bool bHoldsIOMutex = false;
+    if (eErr == CE_None && m_poPipeline && !m_poPipeline->bConcurrentSourceIO)
+    {
+        if (AcquireIOMutex())
+            bHoldsIOMutex = true;
+        else
+            eErr = CE_Failure;
+    }
+    const bool bInSourceRead = eErr == CE_None && m_poPipeline != nullptr;
+    if (bInSourceRead)
+        m_poPipeline->BeginSourceRead();
+
     if (eErr == CE_None && nSrcXSize > 0 && nSrcYSize > 0)
     {
         GDALDataset *poSrcDS = GDALDataset::FromHandle(psOptions->hSrcDS);
@@ -2144,11 +2420,19 @@ CPLErr GDALWarpOperation::WarpRegionToBuffer(
 
         eErr = CreateKernelMask(&oWK, 0 /* not used */, "DstDensity");
 
+        const bool bLockDstRead = m_poPipeline != nullptr && !bHoldsIOMutex;
+        if (eErr == CE_None && bLockDstRead && !AcquireIOMutex())
+            eErr = CE_Failure;
+
         if (eErr == CE_None)
+        {
             eErr = GDALWarpDstAlphaMasker(
                 psOptions, psOptions->nBandCount, psOptions->eWorkingDataType,
                 oWK.nDstXOff, oWK.nDstYOff, oWK.nDstXSize, oWK.nDstYSize,
                 oWK.papabyDstImage, TRUE, oWK.pafDstDensity);
+            if (bLockDstRead)
+                CPLReleaseMutex(hIOMutex);
+        }
     }
 
     /* -------------------------------------------------------------------- */
@@ -2357,15 +2641,34 @@ CPLErr GDALWarpOperation::WarpRegionToBuffer(
     /* -------------------------------------------------------------------- */
     /*      Release IO Mutex, and acquire warper mutex.                     */
     /* -------------------------------------------------------------------- */
-    if (hIOMutex != nullptr)
+    bool bHoldsWarpMutex = false;
+    auto oWarpStartTime = std::chrono::steady_clock::now();
+    if (m_poPipeline)
     {
-        CPLReleaseMutex(hIOMutex);
-        if (!CPLAcquireMutex(hWarpMutex, 600.0))
+        if (bInSourceRead)
+            m_poPipeline->EndSourceRead();
+        if (bHoldsIOMutex)
+            CPLReleaseMutex(hIOMutex);
+        m_poPipeline->AddDuration(GDALWarpPipeline::STAGE_SRC_READ,
+                                  oSrcReadStartTime);
+
+        const auto oWaitStartTime = std::chrono::steady_clock::now();
+        if (eErr == CE_None)
         {
-            CPLError(CE_Failure, CPLE_AppDefined,
-                     "Failed to acquire WarpMutex in WarpRegion().");
-            return CE_Failure;
+            if (CPLAcquireMutex(hWarpMutex, 600.0))
+            {
+                bHoldsWarpMutex = true;
+            }
+            else
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Failed to acquire WarpMutex in WarpRegion().");
+                eErr = CE_Failure;
+            }
         }
+        m_poPipeline->AddDuration(GDALWarpPipeline::STAGE_WARP_WAIT,
+                                  oWaitStartTime);
+        oWarpStartTime = std::chrono::steady_clock::now();
     }
 
     /* -------------------------------------------------------------------- */
@@ -2392,17 +2695,20 @@ CPLErr GDALWarpOperation::WarpRegionToBuffer(
             &oWK, psOptions->pPostWarpProcessorArg);
 
     /* -------------------------------------------------------------------- */
-    /*      Release Warp Mutex, and acquire io mutex.                       */
+    /*      Release Warp Mutex, and wait for our turn to write.             */
     /* -------------------------------------------------------------------- */
-    if (hIOMutex != nullptr)
+    if (bHoldsWarpMutex)
     {
         CPLReleaseMutex(hWarpMutex);
-        if (!CPLAcquireMutex(hIOMutex, 600.0))
-        {
-            CPLError(CE_Failure, CPLE_AppDefined,
-                     "Failed to acquire IOMutex in WarpRegion().");
-            return CE_Failure;
-        }
+        m_poPipeline->AddDuration(GDALWarpPipeline::STAGE_WARP,
+                                  oWarpStartTime);
+    }
+    if (m_poPipeline && eErr == CE_None && psOptions->nDstAlphaBand > 0)
+    {
+        if (AcquireWriteAccess(iChunk))
+            *pbHoldsWriteAccess = true;
+        else
+            eErr = CE_Failure;
     }
 
     /* -------------------------------------------------------------------- */
@@ -2904,6 +3210,11 @@ bool GDALWarpOperation::ComputeSourceWindowTransformPoints(
         {
             GDALRefreshApproxTransformer(psOptions->pTransformerArg);
         }
+        else if (GDALIsTransformer(psOptions->pTransformerArg,
+                                   GDAL_COORD_GRID_TRANSFORMER_CLASS_NAME))
+        {
+            GDALRefreshCoordGridTransformer(psOptions->pTransformerArg);
+        }
     };
 
     if (bTryWithCheckWithInvertProj)
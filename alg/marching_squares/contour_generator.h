@@ -54,6 +54,19 @@ class ContourGenerator
         return CE_None;
     }
 
+    // Start the generation at line lineIdx instead of the first line.
+    // previousLine must contain the values of line lineIdx - 1.
+    // This allows to process horizontal strips of a raster independently.
+    void setStartLine(size_t lineIdx, const double *previousLine)
+    {
+        lineIdx_ = lineIdx;
+        if (previousLine != nullptr)
+            std::copy(previousLine, previousLine + width_,
+                      previousLine_.begin());
+        else
+            std::fill(previousLine_.begin(), previousLine_.end(), NaN);
+    }
+
   private:
     size_t width_;
     size_t height_;
@@ -0,0 +1,96 @@
+/******************************************************************************
+ *
+ * Project:  Marching square algorithm
+ * Purpose:  Recording of the segments of a contour generator.
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+#ifndef MARCHING_SQUARES_SEGMENT_RECORDER_H
+#define MARCHING_SQUARES_SEGMENT_RECORDER_H
+
+#include "point.h"
+
+#include <vector>
+
+namespace marching_squares
+{
+
+// SegmentRecorder: store the segments emitted by a ContourGenerator, line by
+// line, so that they can be replayed later into another writer (typically a
+// SegmentMerger).
+// This allows to run the marching squares on several strips of a raster in
+// parallel, while feeding the segments to the merger in the same order as if
+// the raster had been processed sequentially.
+struct SegmentRecorder
+{
+    explicit SegmentRecorder(bool polygonize_) : polygonize(polygonize_)
+    {
+    }
+
+    void addSegment(int levelIdx, const Point &start, const Point &end)
+    {
+        segments_.push_back(Segment{levelIdx, false, start, end});
+    }
+
+    void addBorderSegment(int levelIdx, const Point &start, const Point &end)
+    {
+        segments_.push_back(Segment{levelIdx, true, start, end});
+    }
+
+    void beginningOfLine()
+    {
+    }
+
+    void endOfLine()
+    {
+        lineEnds_.push_back(segments_.size());
+    }
+
+    // Number of lines recorded
+    size_t linesCount() const
+    {
+        return lineEnds_.size();
+    }
+
+    // Feed the segments of the idx-th recorded line to writer
+    template <typename Writer> void replayLine(size_t idx, Writer &writer) const
+    {
+        writer.beginningOfLine();
+        const size_t start = idx == 0 ? 0 : lineEnds_[idx - 1];
+        for (size_t i = start; i < lineEnds_[idx]; ++i)
+        {
+            const Segment &s = segments_[i];
+            if (s.border)
+                writer.addBorderSegment(s.levelIdx, s.start, s.end);
+            else
+                writer.addSegment(s.levelIdx, s.start, s.end);
+        }
+        writer.endOfLine();
+    }
+
+    void clear()
+    {
+        segments_.clear();
+        lineEnds_.clear();
+    }
+
+    const bool polygonize;
+
+  private:
+    struct Segment
+    {
+        int levelIdx;
+        bool border;
+        Point start;
+        Point end;
+    };
+
+    std::vector<Segment> segments_{};
+    std::vector<size_t> lineEnds_{};
+};
+
+}  // namespace marching_squares
+#endif
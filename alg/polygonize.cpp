@@ -19,6 +19,7 @@
 #include <string.h>
 
 #include <algorithm>
+#include <functional>
 #include <limits>
 #include <map>
 #include <memory>
@@ -34,6 +35,7 @@
 #include "cpl_progress.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
+#include "gdal_thread_pool.h"
 
 #include "polygonize_polygonizer.h"
 
@@ -65,6 +67,270 @@ static CPLErr GPMaskImageData(GDALRasterBandH hMaskBand, GByte *pabyMaskLine,
     return CE_None;
 }
 
+/************************************************************************/
+/*                            GDALRunJobs()                             */
+/************************************************************************/
+
+// Run fnJob(iJob) for iJob in [0, nJobs[, on the thread pool if available.
+void GDALRunJobs(CPLWorkerThreadPool *poPool, int nJobs,
+                 const std::function<void(int)> &fnJob)
+{
+    if (poPool == nullptr || nJobs <= 1)
+    {
+        for (int iJob = 0; iJob < nJobs; ++iJob)
+            fnJob(iJob);
+        return;
+    }
+    auto poQueue = poPool->CreateJobQueue();
+    for (int iJob = 0; iJob < nJobs; ++iJob)
+    {
+        poQueue->SubmitJob([&fnJob, iJob]() { fnJob(iJob); });
+    }
+    poQueue->WaitCompletion();
+}
+
+/************************************************************************/
+/*                    GDALPolygonizeMultiThreadedT()                    */
+/************************************************************************/
+
+// Multi-threaded variant of GDALPolygonizeT(). The raster is split into
+// horizontal strips whose pixels are enumerated independently by worker
+// threads (see GDALRasterPolygonStripEnumeratorT). The edge tracing itself
+// is unchanged and sequential, so the polygons are the same as the ones of
+// the single-threaded algorithm; only the order in which polygons completed
+// on the same line are written may differ.
+
+template <class DataType, class EqualityTest>
+static CPLErr GDALPolygonizeMultiThreadedT(
+    GDALRasterBandH hSrcBand, GDALRasterBandH hMaskBand, OGRLayerH hOutLayer,
+    int iPixValField, double *padfGeoTransform, int nConnectedness,
+    int nThreads, GDALProgressFunc pfnProgress, void *pProgressArg,
+    GDALDataType eDT)
+{
+    using EnumeratorType =
+        GDALRasterPolygonStripEnumeratorT<DataType, EqualityTest>;
+
+    const int nXSize = GDALGetRasterBandXSize(hSrcBand);
+    const int nYSize = GDALGetRasterBandYSize(hSrcBand);
+
+    const int nStripHeight = EnumeratorType::GetStripHeight(nXSize);
+    const int nStrips = DIV_ROUND_UP(nYSize, nStripHeight);
+    const int nBatchStrips = std::min(nThreads, nStrips);
+    const int nBatchLines = std::min(nYSize, nBatchStrips * nStripHeight);
+
+    CPLWorkerThreadPool *poPool = GDALGetGlobalThreadPool(nThreads);
+
+    EnumeratorType oEnum(nConnectedness, nXSize);
+    std::vector<typename EnumeratorType::Strip> aoStrips;
+    std::vector<DataType> anVal;
+    std::vector<GInt32> anBatchId;
+    std::vector<DataType> anPrevLastLineVal;
+    std::vector<GInt32> anPrevLastLineId;
+    std::vector<GByte> abyMaskLine;
+    try
+    {
+        aoStrips.resize(nBatchStrips);
+        anVal.resize(static_cast<size_t>(nBatchLines) * nXSize);
+        anPrevLastLineVal.resize(nXSize);
+        anPrevLastLineId.resize(nXSize);
+        abyMaskLine.resize(nXSize);
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Out of memory in GDALPolygonize()");
+        return CE_Failure;
+    }
+
+    CPLErr eErr = CE_None;
+
+    /* -------------------------------------------------------------------- */
+    /*      First pass: enumerate the polygons of each strip in parallel,   */
+    /*      and merge them across strip boundaries.                         */
+    /* -------------------------------------------------------------------- */
+    for (int iFirstStrip = 0; eErr == CE_None && iFirstStrip < nStrips;
+         iFirstStrip += nBatchStrips)
+    {
+        const int nStripsInBatch =
+            std::min(nBatchStrips, nStrips - iFirstStrip);
+        const int iYStart = iFirstStrip * nStripHeight;
+        const int nLines = std::min(nBatchLines, nYSize - iYStart);
+        eErr = GDALReadStripBatch(hSrcBand, hMaskBand, abyMaskLine.data(),
+                                  iYStart, nLines, nXSize, eDT, anVal.data());
+        if (eErr != CE_None)
+            break;
+
+        std::vector<int> abOK(nStripsInBatch, true);
+        GDALRunJobs(poPool, nStripsInBatch,
+                    [&](int iJob)
+                    {
+                        const int iLine = iJob * nStripHeight;
+                        abOK[iJob] = oEnum.EnumerateStrip(
+                            aoStrips[iJob],
+                            anVal.data() + static_cast<size_t>(iLine) * nXSize,
+                            std::min(nStripHeight, nLines - iLine), false);
+                    });
+
+        for (int iJob = 0; iJob < nStripsInBatch; ++iJob)
+        {
+            if (!abOK[iJob])
+            {
+                CPLError(CE_Failure, CPLE_OutOfMemory,
+                         "Out of memory in GDALPolygonize()");
+                eErr = CE_Failure;
+                break;
+            }
+            DataType *panFirstLineVal =
+                anVal.data() +
+                static_cast<size_t>(iJob) * nStripHeight * nXSize;
+            const bool bFirstStrip = iFirstStrip == 0 && iJob == 0;
+            if (!oEnum.AddStrip(
+                    aoStrips[iJob], panFirstLineVal,
+                    bFirstStrip ? nullptr
+                    : iJob > 0  ? panFirstLineVal - nXSize
+                                : anPrevLastLineVal.data(),
+                    iJob > 0 ? aoStrips[iJob - 1].anLastLineId.data()
+                             : anPrevLastLineId.data()))
+            {
+                eErr = CE_Failure;
+                break;
+            }
+        }
+        if (eErr != CE_None)
+            break;
+
+        std::copy_n(anVal.data() + static_cast<size_t>(nLines - 1) * nXSize,
+                    nXSize, anPrevLastLineVal.begin());
+        anPrevLastLineId.swap(aoStrips[nStripsInBatch - 1].anLastLineId);
+
+        if (!pfnProgress(0.10 * (iYStart + nLines) / nYSize, "",
+                         pProgressArg))
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+            eErr = CE_Failure;
+        }
+    }
+    if (eErr != CE_None)
+        return eErr;
+
+    oEnum.CompleteMerges();
+
+    /* -------------------------------------------------------------------- */
+    /*      Second pass: enumerate again the polygons of each strip in      */
+    /*      parallel to get their final ids, and trace the polygon edges.   */
+    /* -------------------------------------------------------------------- */
+    OGRPolygonWriter<DataType> oPolygonWriter{hOutLayer, iPixValField,
+                                              padfGeoTransform};
+    Polygonizer<GInt32, DataType> oPolygonizer{-1, &oPolygonWriter};
+    std::vector<TwoArm> aoLastLineArm;
+    std::vector<TwoArm> aoThisLineArm;
+    try
+    {
+        anBatchId.resize(static_cast<size_t>(nBatchLines) * nXSize);
+        aoLastLineArm.resize(static_cast<size_t>(nXSize) + 2);
+        aoThisLineArm.resize(static_cast<size_t>(nXSize) + 2);
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Out of memory in GDALPolygonize()");
+        return CE_Failure;
+    }
+    for (auto &oArm : aoLastLineArm)
+        oArm.poPolyInside = oPolygonizer.getTheOuterPolygon();
+
+    for (int iFirstStrip = 0; eErr == CE_None && iFirstStrip < nStrips;
+         iFirstStrip += nBatchStrips)
+    {
+        const int nStripsInBatch =
+            std::min(nBatchStrips, nStrips - iFirstStrip);
+        const int iYStart = iFirstStrip * nStripHeight;
+        const int nLines = std::min(nBatchLines, nYSize - iYStart);
+        eErr = GDALReadStripBatch(hSrcBand, hMaskBand, abyMaskLine.data(),
+                                  iYStart, nLines, nXSize, eDT, anVal.data());
+        if (eErr != CE_None)
+            break;
+
+        std::vector<int> abOK(nStripsInBatch, true);
+        GDALRunJobs(poPool, nStripsInBatch,
+                    [&](int iJob)
+                    {
+                        const size_t nOffset =
+                            static_cast<size_t>(iJob) * nStripHeight * nXSize;
+                        abOK[iJob] = oEnum.GetFinalIds(
+                            iFirstStrip + iJob, aoStrips[iJob],
+                            anVal.data() + nOffset,
+                            std::min(nStripHeight,
+                                     nLines - iJob * nStripHeight),
+                            anBatchId.data() + nOffset);
+                    });
+        if (std::find(abOK.begin(), abOK.end(), false) != abOK.end())
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory,
+                     "Out of memory in GDALPolygonize()");
+            eErr = CE_Failure;
+        }
+
+        for (int iLine = 0; eErr == CE_None && iLine < nLines; ++iLine)
+        {
+            const DataType *panLastLineVal =
+                iLine == 0 ? anPrevLastLineVal.data()
+                           : anVal.data() +
+                                 static_cast<size_t>(iLine - 1) * nXSize;
+            if (!oPolygonizer.processLine(
+                    anBatchId.data() + static_cast<size_t>(iLine) * nXSize,
+                    panLastLineVal, aoThisLineArm.data(), aoLastLineArm.data(),
+                    iYStart + iLine, nXSize))
+            {
+                eErr = CE_Failure;
+            }
+            else
+            {
+                eErr = oPolygonWriter.getErr();
+            }
+            std::swap(aoThisLineArm, aoLastLineArm);
+
+            if (eErr == CE_None &&
+                !pfnProgress(0.10 + 0.90 * (iYStart + iLine + 1) / nYSize, "",
+                             pProgressArg))
+            {
+                CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+                eErr = CE_Failure;
+            }
+        }
+        std::copy_n(anVal.data() + static_cast<size_t>(nLines - 1) * nXSize,
+                    nXSize, anPrevLastLineVal.begin());
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Close the remaining polygons with the outer polygon.            */
+    /* -------------------------------------------------------------------- */
+    if (eErr == CE_None)
+    {
+        std::fill_n(anBatchId.begin(), nXSize,
+                    decltype(oPolygonizer)::THE_OUTER_POLYGON_ID);
+        if (!oPolygonizer.processLine(anBatchId.data(),
+                                      anPrevLastLineVal.data(),
+                                      aoThisLineArm.data(),
+                                      aoLastLineArm.data(), nYSize, nXSize))
+        {
+            eErr = CE_Failure;
+        }
+        else
+        {
+            eErr = oPolygonWriter.getErr();
+        }
+    }
+
+    if (eErr == CE_None && !pfnProgress(1.0, "", pProgressArg))
+    {
+        CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+        eErr = CE_Failure;
+    }
+
+    return eErr;
+}
+
 /************************************************************************/
 /*                           GDALPolygonizeT()                          */
 /************************************************************************/
@@ -166,6 +432,23 @@ static CPLErr GDALPolygonizeT(GDALRasterBandH hSrcBand,
         adfGeoTransform[5] = 1;
     }
 
+    /* -------------------------------------------------------------------- */
+    /*      Use the multi-threaded implementation if requested.             */
+    /* -------------------------------------------------------------------- */
+    const int nThreads = GDALGetNumThreads(
+        CSLFetchNameValueDef(papszOptions, "NUM_THREADS", "1"));
+    if (nThreads > 1 && nXSize > 0 && nYSize > 0)
+    {
+        CPLFree(panThisLineId);
+        CPLFree(panLastLineId);
+        CPLFree(panThisLineVal);
+        CPLFree(panLastLineVal);
+        CPLFree(pabyMaskLine);
+        return GDALPolygonizeMultiThreadedT<DataType, EqualityTest>(
+            hSrcBand, hMaskBand, hOutLayer, iPixValField, adfGeoTransform,
+            nConnectedness, nThreads, pfnProgress, pProgressArg, eDT);
+    }
+
     /* -------------------------------------------------------------------- */
     /*      The first pass over the raster is only used to build up the     */
     /*      polygon id map so we will know in advance what polygons are     */
@@ -489,6 +772,11 @@ GBool GDALFloatEquals(float A, float B)
  * <li>DATASET_FOR_GEOREF=dataset_name: Name of a dataset from which to read
  * the geotransform. This useful if hSrcBand has no related dataset, which is
  * typical for mask bands.</li>
+ * <li>NUM_THREADS=number_of_threads or ALL_CPUS: (GDAL >= 3.12) Number of
+ * threads used to enumerate the polygons. Defaults to 1. When greater than 1,
+ * the raster is split into strips that are enumerated in parallel, and
+ * polygons crossing strip boundaries are merged. The polygons are the same as
+ * with a single thread, but the order of the output features may differ.</li>
  * </ul>
  * @param pfnProgress callback for reporting algorithm progress matching the
  * GDALProgressFunc() semantics.  May be NULL.
@@ -563,6 +851,11 @@ CPLErr CPL_STDCALL GDALPolygonize(GDALRasterBandH hSrcBand,
  * <li>DATASET_FOR_GEOREF=dataset_name: Name of a dataset from which to read
  * the geotransform. This useful if hSrcBand has no related dataset, which is
  * typical for mask bands.</li>
+ * <li>NUM_THREADS=number_of_threads or ALL_CPUS: (GDAL >= 3.12) Number of
+ * threads used to enumerate the polygons. Defaults to 1. When greater than 1,
+ * the raster is split into strips that are enumerated in parallel, and
+ * polygons crossing strip boundaries are merged. The polygons are the same as
+ * with a single thread, but the order of the output features may differ.</li>
  * </ul>
  * @param pfnProgress callback for reporting algorithm progress matching the
  * GDALProgressFunc() semantics.  May be NULL.
@@ -29,6 +29,7 @@
 #include "cpl_vsi.h"
 #include "gdal.h"
 #include "gdal_priv.h"
+#include "gdal_thread_pool.h"
 
 /************************************************************************/
 /*                           GDALFilterLine()                           */
@@ -316,6 +317,265 @@ static CPLErr GDALMultiFilter(GDALRasterBandH hTargetBand,
     return eErr;
 }
 
+/************************************************************************/
+/*                   GDALMultiFilterMultiThreaded()                     */
+/*                                                                      */
+/*      Same as GDALMultiFilter(), but the band is processed by         */
+/*      batches of horizontal strips which are filtered in parallel.    */
+/*      Iteration i of a line only depends on iteration i-1 of the      */
+/*      line and its two neighbours, so a strip can be processed        */
+/*      independently of the other ones provided that nIterations       */
+/*      lines above and below it are loaded too. The result is thus     */
+/*      identical to the one of GDALMultiFilter().                      */
+/************************************************************************/
+
+static CPLErr GDALMultiFilterMultiThreaded(
+    GDALRasterBandH hTargetBand, GDALRasterBandH hTargetMaskBand,
+    GDALRasterBandH hFiltMaskBand, int nIterations, int nThreads,
+    GDALProgressFunc pfnProgress, void *pProgressArg)
+
+{
+    const int nXSize = GDALGetRasterBandXSize(hTargetBand);
+    const int nYSize = GDALGetRasterBandYSize(hTargetBand);
+
+    /* -------------------------------------------------------------------- */
+    /*      Report starting progress value.                                 */
+    /* -------------------------------------------------------------------- */
+    if (!pfnProgress(0.0, "Smoothing Filter...", pProgressArg))
+    {
+        CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+        return CE_Failure;
+    }
+
+    // Strips must be large enough compared to their halo of nIterations
+    // lines on each side.
+    const int nStripHeight = static_cast<int>(std::min<GIntBig>(
+        nYSize, std::max<GIntBig>(64, 4 * static_cast<GIntBig>(nIterations))));
+    const int nStrips = (nYSize + nStripHeight - 1) / nStripHeight;
+    // Bytes per pixel of the batch and work buffers of a strip.
+    constexpr int STRIP_PIXEL_SIZE = 1 + 1 + 4 * sizeof(float);
+    // Only configurable for debug / testing
+    const GIntBig nBatchSizeBytes = CPLAtoGIntBig(
+        CPLGetConfigOption("GDAL_FILLNODATA_BATCH_MAX_SIZE", "268435456"));
+    const int nStripsPerBatch = static_cast<int>(std::max<GIntBig>(
+        1, std::min<GIntBig>(std::min(nStrips, nThreads),
+                             nBatchSizeBytes /
+                                 (static_cast<GIntBig>(nXSize) *
+                                  STRIP_PIXEL_SIZE *
+                                  (nStripHeight + 2 * static_cast<GIntBig>(
+                                                          nIterations))))));
+    const int nMaxBatchLines = static_cast<int>(std::min<GIntBig>(
+        nYSize, static_cast<GIntBig>(nStripsPerBatch) * nStripHeight +
+                    2 * static_cast<GIntBig>(nIterations)));
+    const int nMaxStripLines = static_cast<int>(std::min<GIntBig>(
+        nYSize, nStripHeight + 2 * static_cast<GIntBig>(nIterations)));
+
+    /* -------------------------------------------------------------------- */
+    /*      Allocate the batch buffers and the per strip double buffers.    */
+    /* -------------------------------------------------------------------- */
+    GByte *pabyTMaskBuf =
+        static_cast<GByte *>(VSI_MALLOC2_VERBOSE(nXSize, nMaxBatchLines));
+    GByte *pabyFMaskBuf =
+        static_cast<GByte *>(VSI_MALLOC2_VERBOSE(nXSize, nMaxBatchLines));
+    float *pafInBuf = static_cast<float *>(
+        VSI_MALLOC3_VERBOSE(nXSize, nMaxBatchLines, sizeof(float)));
+    float *pafOutBuf = static_cast<float *>(
+        VSI_MALLOC3_VERBOSE(nXSize, nMaxBatchLines, sizeof(float)));
+    float *pafWorkBuf = static_cast<float *>(VSI_MALLOC3_VERBOSE(
+        nXSize, static_cast<size_t>(nMaxStripLines) * nStripsPerBatch,
+        2 * sizeof(float)));
+    if (pabyTMaskBuf == nullptr || pabyFMaskBuf == nullptr ||
+        pafInBuf == nullptr || pafOutBuf == nullptr || pafWorkBuf == nullptr)
+    {
+        CPLFree(pabyTMaskBuf);
+        CPLFree(pabyFMaskBuf);
+        CPLFree(pafInBuf);
+        CPLFree(pafOutBuf);
+        CPLFree(pafWorkBuf);
+
+        return CE_Failure;
+    }
+
+    CPLWorkerThreadPool *poPool = GDALGetGlobalThreadPool(nThreads);
+
+    /* -------------------------------------------------------------------- */
+    /*      Process batches of strips.                                      */
+    /* -------------------------------------------------------------------- */
+    CPLErr eErr = CE_None;
+
+    // Lines of the band whose original values are in the buffers. As the
+    // band is updated in place, the lines of the upper halo of a batch
+    // must be taken from the previous batch, and not read again.
+    int nPrevLoadStart = 0;
+    int nPrevLoadEnd = 0;
+
+    for (int iFirstStrip = 0; eErr == CE_None && iFirstStrip < nStrips;
+         iFirstStrip += nStripsPerBatch)
+    {
+        const int nBatchStrips =
+            std::min(nStripsPerBatch, nStrips - iFirstStrip);
+        const int nBatchStart = iFirstStrip * nStripHeight;
+        const int nBatchEnd =
+            std::min(nYSize, (iFirstStrip + nBatchStrips) * nStripHeight);
+        // Lines loaded for the batch, including the halos.
+        const int nLoadStart = std::max(0, nBatchStart - nIterations);
+        const int nLoadEnd = static_cast<int>(std::min<GIntBig>(
+            nYSize, static_cast<GIntBig>(nBatchEnd) + nIterations));
+
+        int nReadStart = nLoadStart;
+        if (nPrevLoadEnd > nLoadStart)
+        {
+            const size_t nSrcOffset =
+                static_cast<size_t>(nLoadStart - nPrevLoadStart) * nXSize;
+            const size_t nKeptPixels =
+                static_cast<size_t>(nPrevLoadEnd - nLoadStart) * nXSize;
+            memmove(pabyTMaskBuf, pabyTMaskBuf + nSrcOffset, nKeptPixels);
+            memmove(pabyFMaskBuf, pabyFMaskBuf + nSrcOffset, nKeptPixels);
+            memmove(pafInBuf, pafInBuf + nSrcOffset,
+                    nKeptPixels * sizeof(float));
+            nReadStart = nPrevLoadEnd;
+        }
+        nPrevLoadStart = nLoadStart;
+        nPrevLoadEnd = nLoadEnd;
+
+        const int nReadLines = nLoadEnd - nReadStart;
+        const size_t nReadOffset =
+            static_cast<size_t>(nReadStart - nLoadStart) * nXSize;
+        if (nReadLines > 0)
+        {
+            eErr = GDALRasterIO(hTargetMaskBand, GF_Read, 0, nReadStart,
+                                nXSize, nReadLines, pabyTMaskBuf + nReadOffset,
+                                nXSize, nReadLines, GDT_Byte, 0, 0);
+            if (eErr != CE_None)
+                break;
+
+            eErr = GDALRasterIO(hFiltMaskBand, GF_Read, 0, nReadStart, nXSize,
+                                nReadLines, pabyFMaskBuf + nReadOffset, nXSize,
+                                nReadLines, GDT_Byte, 0, 0);
+            if (eErr != CE_None)
+                break;
+
+            eErr = GDALRasterIO(hTargetBand, GF_Read, 0, nReadStart, nXSize,
+                                nReadLines, pafInBuf + nReadOffset, nXSize,
+                                nReadLines, GDT_Float32, 0, 0);
+            if (eErr != CE_None)
+                break;
+        }
+
+        const auto FilterStrip = [&](int iBatchStrip)
+        {
+            const int nStripStart = nBatchStart + iBatchStrip * nStripHeight;
+            const int nStripEnd =
+                std::min(nBatchEnd, nStripStart + nStripHeight);
+            const int nWinStart =
+                std::max(nLoadStart, nStripStart - nIterations);
+            const int nWinEnd = static_cast<int>(std::min<GIntBig>(
+                nLoadEnd, static_cast<GIntBig>(nStripEnd) + nIterations));
+            const size_t nWinLines = static_cast<size_t>(nWinEnd - nWinStart);
+
+            float *pafLastPass = pafWorkBuf + static_cast<size_t>(iBatchStrip) *
+                                                  nMaxStripLines * 2 * nXSize;
+            float *pafThisPass =
+                pafLastPass + static_cast<size_t>(nMaxStripLines) * nXSize;
+            memcpy(pafLastPass,
+                   pafInBuf + static_cast<size_t>(nWinStart - nLoadStart) *
+                                  nXSize,
+                   sizeof(float) * nXSize * nWinLines);
+
+            const auto Line = [nXSize, nWinStart](float *pafBuf, int iLine)
+            {
+                return pafBuf +
+                       static_cast<size_t>(iLine - nWinStart) * nXSize;
+            };
+            const auto MaskLine = [nXSize, nLoadStart](const GByte *pabyBuf,
+                                                       int iLine)
+            {
+                return pabyBuf +
+                       static_cast<size_t>(iLine - nLoadStart) * nXSize;
+            };
+
+            for (int iIter = 1; iIter <= nIterations; ++iIter)
+            {
+                // Lines whose value at this iteration is needed to compute
+                // the final value of the strip lines.
+                const int iStart = static_cast<int>(std::max<GIntBig>(
+                    nWinStart,
+                    static_cast<GIntBig>(nStripStart) - nIterations + iIter));
+                const int iEnd = static_cast<int>(std::min<GIntBig>(
+                    nWinEnd,
+                    static_cast<GIntBig>(nStripEnd) + nIterations - iIter));
+                for (int iLine = iStart; iLine < iEnd; ++iLine)
+                {
+                    // TODO: Enable first and last line.
+                    // Skip the first and last line.
+                    if (iLine < 1 || iLine >= nYSize - 1)
+                    {
+                        memcpy(Line(pafThisPass, iLine),
+                               Line(pafLastPass, iLine),
+                               sizeof(float) * nXSize);
+                        continue;
+                    }
+
+                    GDALFilterLine(Line(pafLastPass, iLine - 1),
+                                   Line(pafLastPass, iLine),
+                                   Line(pafLastPass, iLine + 1),
+                                   Line(pafThisPass, iLine),
+                                   MaskLine(pabyTMaskBuf, iLine - 1),
+                                   MaskLine(pabyTMaskBuf, iLine),
+                                   MaskLine(pabyTMaskBuf, iLine + 1),
+                                   MaskLine(pabyFMaskBuf, iLine), nXSize);
+                }
+                std::swap(pafLastPass, pafThisPass);
+            }
+
+            memcpy(pafOutBuf + static_cast<size_t>(nStripStart - nBatchStart) *
+                                   nXSize,
+                   Line(pafLastPass, nStripStart),
+                   sizeof(float) * nXSize * (nStripEnd - nStripStart));
+        };
+
+        auto poQueue = poPool ? poPool->CreateJobQueue() : nullptr;
+        for (int iBatchStrip = 0; iBatchStrip < nBatchStrips; ++iBatchStrip)
+        {
+            if (poQueue)
+                poQueue->SubmitJob([&FilterStrip, iBatchStrip]()
+                                   { FilterStrip(iBatchStrip); });
+            else
+                FilterStrip(iBatchStrip);
+        }
+        if (poQueue)
+            poQueue->WaitCompletion();
+
+        eErr = GDALRasterIO(hTargetBand, GF_Write, 0, nBatchStart, nXSize,
+                            nBatchEnd - nBatchStart, pafOutBuf, nXSize,
+                            nBatchEnd - nBatchStart, GDT_Float32, 0, 0);
+
+        /* --------------------------------------------------------------------
+         */
+        /*      Report progress. */
+        /* --------------------------------------------------------------------
+         */
+        if (eErr == CE_None &&
+            !pfnProgress(nBatchEnd / static_cast<double>(nYSize),
+                         "Smoothing Filter...", pProgressArg))
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+            eErr = CE_Failure;
+        }
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Cleanup                                                         */
+    /* -------------------------------------------------------------------- */
+    CPLFree(pabyTMaskBuf);
+    CPLFree(pabyFMaskBuf);
+    CPLFree(pafInBuf);
+    CPLFree(pafOutBuf);
+    CPLFree(pafWorkBuf);
+
+    return eErr;
+}
+
 /************************************************************************/
 /*                             QUAD_CHECK()                             */
 /*                                                                      */
@@ -344,6 +604,158 @@ inline void QUAD_CHECK(double &dfQuadDist, float &fQuadValue, int target_x,
     }
 }
 
+/************************************************************************/
+/*                         GDALFillNodataLine()                         */
+/*                                                                      */
+/*      Interpolate the nodata pixels of one scanline from the          */
+/*      closest valid pixels found above (top down pass) and below      */
+/*      (bottom up pass) it, updating the value, mask and filter        */
+/*      mask scanlines.                                                 */
+/************************************************************************/
+
+static void GDALFillNodataLine(int iY, int nXSize, double dfMaxSearchDist,
+                               int nMaxSearchDist, bool bNearest,
+                               bool bHasNoData, float fNoData,
+                               GUInt32 nNoDataVal, const GUInt32 *panTopDownY,
+                               const float *pafTopDownValue,
+                               const GUInt32 *panBelowY,
+                               const float *pafBelowValue, GByte *pabyMask,
+                               float *pafScanline, GByte *pabyFiltMask)
+{
+    memset(pabyFiltMask, 0, nXSize);
+    for (int iX = 0; iX < nXSize; iX++)
+    {
+        int nThisMaxSearchDist = nMaxSearchDist;
+
+        // If this was a valid target - no change.
+        if (pabyMask[iX])
+            continue;
+
+        enum Quadrants
+        {
+            QUAD_TOP_LEFT = 0,
+            QUAD_BOTTOM_LEFT = 1,
+            QUAD_TOP_RIGHT = 2,
+            QUAD_BOTTOM_RIGHT = 3,
+        };
+
+        constexpr int QUAD_COUNT = 4;
+        double adfQuadDist[QUAD_COUNT] = {};
+        float afQuadValue[QUAD_COUNT] = {};
+
+        for (int iQuad = 0; iQuad < QUAD_COUNT; iQuad++)
+        {
+            adfQuadDist[iQuad] = dfMaxSearchDist + 1.0;
+            afQuadValue[iQuad] = 0.0;
+        }
+
+        // Step left and right by one pixel searching for the closest
+        // target value for each quadrant.
+        for (int iStep = 0; iStep <= nThisMaxSearchDist; iStep++)
+        {
+            const int iLeftX = std::max(0, iX - iStep);
+            const int iRightX = std::min(nXSize - 1, iX + iStep);
+
+            // Top left includes current line.
+            QUAD_CHECK(adfQuadDist[QUAD_TOP_LEFT], afQuadValue[QUAD_TOP_LEFT],
+                       iLeftX, panTopDownY[iLeftX], iX, iY,
+                       pafTopDownValue[iLeftX], nNoDataVal);
+
+            // Bottom left.
+            QUAD_CHECK(adfQuadDist[QUAD_BOTTOM_LEFT],
+                       afQuadValue[QUAD_BOTTOM_LEFT], iLeftX,
+                       panBelowY[iLeftX], iX, iY, pafBelowValue[iLeftX],
+                       nNoDataVal);
+
+            // Top right and bottom right do no include center pixel.
+            if (iStep == 0)
+                continue;
+
+            // Top right includes current line.
+            QUAD_CHECK(adfQuadDist[QUAD_TOP_RIGHT],
+                       afQuadValue[QUAD_TOP_RIGHT], iRightX,
+                       panTopDownY[iRightX], iX, iY, pafTopDownValue[iRightX],
+                       nNoDataVal);
+
+            // Bottom right.
+            QUAD_CHECK(adfQuadDist[QUAD_BOTTOM_RIGHT],
+                       afQuadValue[QUAD_BOTTOM_RIGHT], iRightX,
+                       panBelowY[iRightX], iX, iY, pafBelowValue[iRightX],
+                       nNoDataVal);
+
+            // Every four steps, recompute maximum distance.
+            if ((iStep & 0x3) == 0)
+                nThisMaxSearchDist = static_cast<int>(
+                    floor(std::max(std::max(adfQuadDist[0], adfQuadDist[1]),
+                                   std::max(adfQuadDist[2], adfQuadDist[3]))));
+        }
+
+        bool bHasSrcValues = false;
+        if (bNearest)
+        {
+            double dfNearestDist = dfMaxSearchDist + 1;
+            float fNearestValue = 0.0f;
+
+            for (int iQuad = 0; iQuad < QUAD_COUNT; iQuad++)
+            {
+                if (adfQuadDist[iQuad] < dfNearestDist)
+                {
+                    bHasSrcValues = true;
+                    if (!bHasNoData || afQuadValue[iQuad] != fNoData)
+                    {
+                        fNearestValue = afQuadValue[iQuad];
+                        dfNearestDist = adfQuadDist[iQuad];
+                    }
+                }
+            }
+
+            if (bHasSrcValues)
+            {
+                pabyFiltMask[iX] = 255;
+                if (dfNearestDist <= dfMaxSearchDist)
+                {
+                    pabyMask[iX] = 255;
+                    pafScanline[iX] = fNearestValue;
+                }
+                else
+                    pafScanline[iX] = fNoData;
+            }
+        }
+        else
+        {
+            double dfWeightSum = 0.0;
+            double dfValueSum = 0.0;
+
+            for (int iQuad = 0; iQuad < QUAD_COUNT; iQuad++)
+            {
+                if (adfQuadDist[iQuad] <= dfMaxSearchDist)
+                {
+                    bHasSrcValues = true;
+                    if (!bHasNoData || afQuadValue[iQuad] != fNoData)
+                    {
+                        const double dfWeight = 1.0 / adfQuadDist[iQuad];
+                        dfWeightSum += dfWeight;
+                        dfValueSum += afQuadValue[iQuad] * dfWeight;
+                    }
+                }
+            }
+
+            if (bHasSrcValues)
+            {
+                pabyFiltMask[iX] = 255;
+                if (dfWeightSum > 0.0)
+                {
+                    pabyMask[iX] = 255;
+                    pafScanline[iX] =
+                        static_cast<float>(dfValueSum / dfWeightSum);
+                }
+                else
+                    pafScanline[iX] = fNoData;
+            }
+        }
+    }
+}
+
 /************************************************************************/
 /*                           GDALFillNodata()                           */
 /************************************************************************/
@@ -384,6 +796,10 @@ inline void QUAD_CHECK(double &dfQuadDist, float &fQuadValue, int target_x,
  * <li>INTERPOLATION=INV_DIST/NEAREST (GDAL >= 3.9). By default, pixels are
  * interpolated using an inverse distance weighting (INV_DIST). It is also
  * possible to choose a nearest neighbour (NEAREST) strategy.</li>
+ * <li>NUM_THREADS=number_of_threads or ALL_CPUS (GDAL >= 3.12). Number of
+ * threads used to interpolate and smooth the pixels. Defaults to the value
+ * of the GDAL_NUM_THREADS configuration option, or 1. The result does not
+ * depend on the number of threads.</li>
  * </ul>
  * @param pfnProgress the progress function to report completion.
  * @param pProgressArg callback data for progress function.
@@ -587,31 +1003,57 @@ CPLErr CPL_STDCALL GDALFillNodata(GDALRasterBandH hTargetBand,
         GDALRasterBand::FromHandle(poFiltMaskDS->GetRasterBand(1));
 
     /* -------------------------------------------------------------------- */
-    /*      Allocate buffers for last scanline and this scanline.           */
+    /*      Allocate buffers for last scanline and this scanline, and for   */
+    /*      the batches of lines of the bottom to top pass.                 */
     /* -------------------------------------------------------------------- */
+    const int nThreads =
+        GDALGetNumThreads(CSLFetchNameValue(papszOptions, "NUM_THREADS"));
+    int nBatchLines = 1;
+    if (nThreads > 1)
+    {
+        // Bytes per pixel of the batch buffers.
+        constexpr int BATCH_PIXEL_SIZE =
+            1 + 1 + sizeof(float) * 3 + sizeof(GUInt32) * 2;
+        // Only configurable for debug / testing
+        const GIntBig nBatchSizeBytes = CPLAtoGIntBig(
+            CPLGetConfigOption("GDAL_FILLNODATA_BATCH_MAX_SIZE", "67108864"));
+        const GIntBig nMaxBatchLines =
+            nBatchSizeBytes / (static_cast<GIntBig>(nXSize) * BATCH_PIXEL_SIZE);
+        nBatchLines = static_cast<int>(std::min<GIntBig>(
+            nYSize, std::max<GIntBig>(nThreads, nMaxBatchLines)));
+    }
+    CPLWorkerThreadPool *poPool =
+        nBatchLines > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
 
     GUInt32 *panLastY =
         static_cast<GUInt32 *>(VSI_CALLOC_VERBOSE(nXSize, sizeof(GUInt32)));
     GUInt32 *panThisY =
         static_cast<GUInt32 *>(VSI_CALLOC_VERBOSE(nXSize, sizeof(GUInt32)));
-    GUInt32 *panTopDownY =
-        static_cast<GUInt32 *>(VSI_CALLOC_VERBOSE(nXSize, sizeof(GUInt32)));
+    GUInt32 *panTopDownY = static_cast<GUInt32 *>(
+        VSI_MALLOC3_VERBOSE(nXSize, nBatchLines, sizeof(GUInt32)));
+    GUInt32 *panBelowY = static_cast<GUInt32 *>(
+        VSI_MALLOC3_VERBOSE(nXSize, nBatchLines, sizeof(GUInt32)));
     float *pafLastValue =
         static_cast<float *>(VSI_CALLOC_VERBOSE(nXSize, sizeof(float)));
     float *pafThisValue =
         static_cast<float *>(VSI_CALLOC_VERBOSE(nXSize, sizeof(float)));
-    float *pafTopDownValue =
-        static_cast<float *>(VSI_CALLOC_VERBOSE(nXSize, sizeof(float)));
-    float *pafScanline =
-        static_cast<float *>(VSI_CALLOC_VERBOSE(nXSize, sizeof(float)));
-    GByte *pabyMask = static_cast<GByte *>(VSI_CALLOC_VERBOSE(nXSize, 1));
-    GByte *pabyFiltMask = static_cast<GByte *>(VSI_CALLOC_VERBOSE(nXSize, 1));
+    float *pafTopDownValue = static_cast<float *>(
+        VSI_MALLOC3_VERBOSE(nXSize, nBatchLines, sizeof(float)));
+    float *pafBelowValue = static_cast<float *>(
+        VSI_MALLOC3_VERBOSE(nXSize, nBatchLines, sizeof(float)));
+    float *pafScanline = static_cast<float *>(
+        VSI_MALLOC3_VERBOSE(nXSize, nBatchLines, sizeof(float)));
+    GByte *pabyMask =
+        static_cast<GByte *>(VSI_MALLOC2_VERBOSE(nXSize, nBatchLines));
+    GByte *pabyFiltMask =
+        static_cast<GByte *>(VSI_MALLOC2_VERBOSE(nXSize, nBatchLines));
 
     CPLErr eErr = CE_None;
 
     if (panLastY == nullptr || panThisY == nullptr || panTopDownY == nullptr ||
-        pafLastValue == nullptr || pafThisValue == nullptr ||
-        pafTopDownValue == nullptr || pafScanline == nullptr ||
+        panBelowY == nullptr || pafLastValue == nullptr ||
+        pafThisValue == nullptr || pafTopDownValue == nullptr ||
+        pafBelowValue == nullptr || pafScanline == nullptr ||
         pabyMask == nullptr || pabyFiltMask == nullptr)
     {
         eErr = CE_Failure;
@@ -717,201 +1159,110 @@ CPLErr CPL_STDCALL GDALFillNodata(GDALRasterBandH hTargetBand,
     /* ==================================================================== */
     /*      Now we will do collect similar this/last information from       */
     /*      bottom to top and use it in combination with the top to         */
-    /*      bottom search info to interpolate.                              */
+    /*      bottom search info to interpolate. Lines are processed by       */
+    /*      batches, whose lines can be interpolated in parallel.           */
     /* ==================================================================== */
-    for (int iY = nYSize - 1; iY >= 0 && eErr == CE_None; iY--)
+    for (int iYEnd = nYSize; iYEnd > 0 && eErr == CE_None;
+         iYEnd -= nBatchLines)
     {
-        eErr = GDALRasterIO(hMaskBand, GF_Read, 0, iY, nXSize, 1, pabyMask,
-                            nXSize, 1, GDT_Byte, 0, 0);
+        const int iYStart = std::max(0, iYEnd - nBatchLines);
+        const int nLines = iYEnd - iYStart;
+
+        eErr = GDALRasterIO(hMaskBand, GF_Read, 0, iYStart, nXSize, nLines,
+                            pabyMask, nXSize, nLines, GDT_Byte, 0, 0);
 
         if (eErr != CE_None)
             break;
 
-        eErr = GDALRasterIO(hTargetBand, GF_Read, 0, iY, nXSize, 1, pafScanline,
-                            nXSize, 1, GDT_Float32, 0, 0);
+        eErr = GDALRasterIO(hTargetBand, GF_Read, 0, iYStart, nXSize, nLines,
+                            pafScanline, nXSize, nLines, GDT_Float32, 0, 0);
 
         if (eErr != CE_None)
             break;
 
-        /* --------------------------------------------------------------------
-         */
-        /*      Figure out the most recent pixel for each column. */
-        /* --------------------------------------------------------------------
-         */
-
-        for (int iX = 0; iX < nXSize; iX++)
-        {
-            if (pabyMask[iX])
-            {
-                pafThisValue[iX] = pafScanline[iX];
-                panThisY[iX] = iY;
-            }
-            else if (panLastY[iX] - iY <= dfMaxSearchDist)
-            {
-                pafThisValue[iX] = pafLastValue[iX];
-                panThisY[iX] = panLastY[iX];
-            }
-            else
-            {
-                panThisY[iX] = nNoDataVal;
-            }
-        }
-
         /* --------------------------------------------------------------------
          */
         /*      Load the last y and corresponding value from the top down pass.
          */
         /* --------------------------------------------------------------------
          */
-        eErr = GDALRasterIO(hYBand, GF_Read, 0, iY, nXSize, 1, panTopDownY,
-                            nXSize, 1, GDT_UInt32, 0, 0);
+        eErr = GDALRasterIO(hYBand, GF_Read, 0, iYStart, nXSize, nLines,
+                            panTopDownY, nXSize, nLines, GDT_UInt32, 0, 0);
 
         if (eErr != CE_None)
             break;
 
-        eErr = GDALRasterIO(hValBand, GF_Read, 0, iY, nXSize, 1,
-                            pafTopDownValue, nXSize, 1, GDT_Float32, 0, 0);
+        eErr =
+            GDALRasterIO(hValBand, GF_Read, 0, iYStart, nXSize, nLines,
+                         pafTopDownValue, nXSize, nLines, GDT_Float32, 0, 0);
 
         if (eErr != CE_None)
             break;
 
         /* --------------------------------------------------------------------
          */
-        /*      Attempt to interpolate any pixels that are nodata. */
+        /*      Figure out the most recent pixel for each column, keeping */
+        /*      the one of the line below for each line of the batch. */
         /* --------------------------------------------------------------------
          */
-        memset(pabyFiltMask, 0, nXSize);
-        for (int iX = 0; iX < nXSize; iX++)
+        for (int iY = iYEnd - 1; iY >= iYStart; iY--)
         {
-            int nThisMaxSearchDist = nMaxSearchDist;
-
-            // If this was a valid target - no change.
-            if (pabyMask[iX])
-                continue;
-
-            enum Quadrants
-            {
-                QUAD_TOP_LEFT = 0,
-                QUAD_BOTTOM_LEFT = 1,
-                QUAD_TOP_RIGHT = 2,
-                QUAD_BOTTOM_RIGHT = 3,
-            };
-
-            constexpr int QUAD_COUNT = 4;
-            double adfQuadDist[QUAD_COUNT] = {};
-            float afQuadValue[QUAD_COUNT] = {};
-
-            for (int iQuad = 0; iQuad < QUAD_COUNT; iQuad++)
-            {
-                adfQuadDist[iQuad] = dfMaxSearchDist + 1.0;
-                afQuadValue[iQuad] = 0.0;
-            }
-
-            // Step left and right by one pixel searching for the closest
-            // target value for each quadrant.
-            for (int iStep = 0; iStep <= nThisMaxSearchDist; iStep++)
-            {
-                const int iLeftX = std::max(0, iX - iStep);
-                const int iRightX = std::min(nXSize - 1, iX + iStep);
-
-                // Top left includes current line.
-                QUAD_CHECK(adfQuadDist[QUAD_TOP_LEFT],
-                           afQuadValue[QUAD_TOP_LEFT], iLeftX,
-                           panTopDownY[iLeftX], iX, iY, pafTopDownValue[iLeftX],
-                           nNoDataVal);
-
-                // Bottom left.
-                QUAD_CHECK(adfQuadDist[QUAD_BOTTOM_LEFT],
-                           afQuadValue[QUAD_BOTTOM_LEFT], iLeftX,
-                           panLastY[iLeftX], iX, iY, pafLastValue[iLeftX],
-                           nNoDataVal);
-
-                // Top right and bottom right do no include center pixel.
-                if (iStep == 0)
-                    continue;
-
-                // Top right includes current line.
-                QUAD_CHECK(adfQuadDist[QUAD_TOP_RIGHT],
-                           afQuadValue[QUAD_TOP_RIGHT], iRightX,
-                           panTopDownY[iRightX], iX, iY,
-                           pafTopDownValue[iRightX], nNoDataVal);
-
-                // Bottom right.
-                QUAD_CHECK(adfQuadDist[QUAD_BOTTOM_RIGHT],
-                           afQuadValue[QUAD_BOTTOM_RIGHT], iRightX,
-                           panLastY[iRightX], iX, iY, pafLastValue[iRightX],
-                           nNoDataVal);
-
-                // Every four steps, recompute maximum distance.
-                if ((iStep & 0x3) == 0)
-                    nThisMaxSearchDist = static_cast<int>(floor(
-                        std::max(std::max(adfQuadDist[0], adfQuadDist[1]),
-                                 std::max(adfQuadDist[2], adfQuadDist[3]))));
-            }
+            const size_t nOffset = static_cast<size_t>(iY - iYStart) * nXSize;
+            memcpy(panBelowY + nOffset, panLastY, sizeof(GUInt32) * nXSize);
+            memcpy(pafBelowValue + nOffset, pafLastValue,
+                   sizeof(float) * nXSize);
 
-            bool bHasSrcValues = false;
-            if (bNearest)
+            for (int iX = 0; iX < nXSize; iX++)
             {
-                double dfNearestDist = dfMaxSearchDist + 1;
-                float fNearestValue = 0.0f;
-
-                for (int iQuad = 0; iQuad < QUAD_COUNT; iQuad++)
+                if (pabyMask[nOffset + iX])
                 {
-                    if (adfQuadDist[iQuad] < dfNearestDist)
-                    {
-                        bHasSrcValues = true;
-                        if (!bHasNoData || afQuadValue[iQuad] != fNoData)
-                        {
-                            fNearestValue = afQuadValue[iQuad];
-                            dfNearestDist = adfQuadDist[iQuad];
-                        }
-                    }
+                    pafThisValue[iX] = pafScanline[nOffset + iX];
+                    panThisY[iX] = iY;
                 }
-
-                if (bHasSrcValues)
+                else if (panLastY[iX] - iY <= dfMaxSearchDist)
                 {
-                    pabyFiltMask[iX] = 255;
-                    if (dfNearestDist <= dfMaxSearchDist)
-                    {
-                        pabyMask[iX] = 255;
-                        pafScanline[iX] = fNearestValue;
-                    }
-                    else
-                        pafScanline[iX] = fNoData;
+                    pafThisValue[iX] = pafLastValue[iX];
+                    panThisY[iX] = panLastY[iX];
                 }
-            }
-            else
-            {
-                double dfWeightSum = 0.0;
-                double dfValueSum = 0.0;
-
-                for (int iQuad = 0; iQuad < QUAD_COUNT; iQuad++)
+                else
                 {
-                    if (adfQuadDist[iQuad] <= dfMaxSearchDist)
-                    {
-                        bHasSrcValues = true;
-                        if (!bHasNoData || afQuadValue[iQuad] != fNoData)
-                        {
-                            const double dfWeight = 1.0 / adfQuadDist[iQuad];
-                            dfWeightSum += dfWeight;
-                            dfValueSum += afQuadValue[iQuad] * dfWeight;
-                        }
-                    }
+                    panThisY[iX] = nNoDataVal;
                 }
+            }
 
-                if (bHasSrcValues)
-                {
-                    pabyFiltMask[iX] = 255;
-                    if (dfWeightSum > 0.0)
-                    {
-                        pabyMask[iX] = 255;
-                        pafScanline[iX] =
-                            static_cast<float>(dfValueSum / dfWeightSum);
-                    }
-                    else
-                        pafScanline[iX] = fNoData;
-                }
+            std::swap(pafThisValue, pafLastValue);
+            std::swap(panThisY, panLastY);
+        }
+
+        /* --------------------------------------------------------------------
+         */
+        /*      Attempt to interpolate any pixels that are nodata. */
+        /* --------------------------------------------------------------------
+         */
+        const auto InterpolateLine = [&](int iLine)
+        {
+            const size_t nOffset = static_cast<size_t>(iLine) * nXSize;
+            GDALFillNodataLine(iYStart + iLine, nXSize, dfMaxSearchDist,
+                               nMaxSearchDist, bNearest, bHasNoData, fNoData,
+                               nNoDataVal, panTopDownY + nOffset,
+                               pafTopDownValue + nOffset, panBelowY + nOffset,
+                               pafBelowValue + nOffset, pabyMask + nOffset,
+                               pafScanline + nOffset, pabyFiltMask + nOffset);
+        };
+        if (poPool)
+        {
+            auto poQueue = poPool->CreateJobQueue();
+            for (int iLine = 0; iLine < nLines; ++iLine)
+            {
+                poQueue->SubmitJob([&InterpolateLine, iLine]()
+                                   { InterpolateLine(iLine); });
             }
+            poQueue->WaitCompletion();
+        }
+        else
+        {
+            for (int iLine = 0; iLine < nLines; ++iLine)
+                InterpolateLine(iLine);
         }
 
         /* --------------------------------------------------------------------
@@ -919,8 +1270,8 @@ CPLErr CPL_STDCALL GDALFillNodata(GDALRasterBandH hTargetBand,
         /*      Write out the updated data and mask information. */
         /* --------------------------------------------------------------------
          */
-        eErr = GDALRasterIO(hTargetBand, GF_Write, 0, iY, nXSize, 1,
-                            pafScanline, nXSize, 1, GDT_Float32, 0, 0);
+        eErr = GDALRasterIO(hTargetBand, GF_Write, 0, iYStart, nXSize, nLines,
+                            pafScanline, nXSize, nLines, GDT_Float32, 0, 0);
 
         if (eErr != CE_None)
             break;
@@ -929,36 +1280,30 @@ CPLErr CPL_STDCALL GDALFillNodata(GDALRasterBandH hTargetBand,
         {
             // Update (copy of) mask band when it has been provided by the
             // user
-            eErr = GDALRasterIO(hMaskBand, GF_Write, 0, iY, nXSize, 1, pabyMask,
-                                nXSize, 1, GDT_Byte, 0, 0);
+            eErr = GDALRasterIO(hMaskBand, GF_Write, 0, iYStart, nXSize,
+                                nLines, pabyMask, nXSize, nLines, GDT_Byte, 0,
+                                0);
 
             if (eErr != CE_None)
                 break;
         }
 
-        eErr = GDALRasterIO(hFiltMaskBand, GF_Write, 0, iY, nXSize, 1,
-                            pabyFiltMask, nXSize, 1, GDT_Byte, 0, 0);
+        eErr = GDALRasterIO(hFiltMaskBand, GF_Write, 0, iYStart, nXSize,
+                            nLines, pabyFiltMask, nXSize, nLines, GDT_Byte, 0,
+                            0);
 
         if (eErr != CE_None)
             break;
 
-        /* --------------------------------------------------------------------
-         */
-        /*      Flip this/last buffers. */
-        /* --------------------------------------------------------------------
-         */
-        std::swap(pafThisValue, pafLastValue);
-        std::swap(panThisY, panLastY);
-
         /* --------------------------------------------------------------------
          */
         /*      report progress. */
         /* --------------------------------------------------------------------
          */
-        if (!pfnProgress(
-                dfProgressRatio *
-                    (0.5 + 0.5 * (nYSize - iY) / static_cast<double>(nYSize)),
-                "Filling...", pProgressArg))
+        if (!pfnProgress(dfProgressRatio *
+                             (0.5 + 0.5 * (nYSize - iYStart) /
+                                        static_cast<double>(nYSize)),
+                         "Filling...", pProgressArg))
         {
             CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
             eErr = CE_Failure;
@@ -983,9 +1328,14 @@ CPLErr CPL_STDCALL GDALFillNodata(GDALRasterBandH hTargetBand,
         void *pScaledProgress = GDALCreateScaledProgress(
             dfProgressRatio, 1.0, pfnProgress, pProgressArg);
 
-        eErr = GDALMultiFilter(hTargetBand, hMaskBand, hFiltMaskBand,
-                               nSmoothingIterations, GDALScaledProgress,
-                               pScaledProgress);
+        if (nThreads > 1)
+            eErr = GDALMultiFilterMultiThreaded(
+                hTargetBand, hMaskBand, hFiltMaskBand, nSmoothingIterations,
+                nThreads, GDALScaledProgress, pScaledProgress);
+        else
+            eErr = GDALMultiFilter(hTargetBand, hMaskBand, hFiltMaskBand,
+                                   nSmoothingIterations, GDALScaledProgress,
+                                   pScaledProgress);
 
         GDALDestroyScaledProgress(pScaledProgress);
     }
@@ -997,9 +1347,11 @@ end:
     CPLFree(panLastY);
     CPLFree(panThisY);
     CPLFree(panTopDownY);
+    CPLFree(panBelowY);
     CPLFree(pafLastValue);
     CPLFree(pafThisValue);
     CPLFree(pafTopDownValue);
+    CPLFree(pafBelowValue);
     CPLFree(pafScanline);
     CPLFree(pabyMask);
     CPLFree(pabyFiltMask);
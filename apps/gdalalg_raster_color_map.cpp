@@ -41,6 +41,7 @@ GDALRasterColorMapAlgorithm::GDALRasterColorMapAlgorithm(bool standaloneStep)
            &m_colorSelection)
         .SetChoices("interpolate", "exact", "nearest")
         .SetDefault(m_colorSelection);
+    AddNumThreadsArg(&m_numThreads, &m_numThreadsStr);
 }
 
 /************************************************************************/
@@ -156,6 +157,8 @@ bool GDALRasterColorMapAlgorithm::RunStep(GDALPipelineStepRunContext &ctxt)
             aosOptions.AddString("-exact_color_entry");
         else if (m_colorSelection == "nearest")
             aosOptions.AddString("-nearest_color_entry");
+        aosOptions.AddString("-num_threads");
+        aosOptions.AddString(m_numThreadsStr.c_str());
 
         GDALDEMProcessingOptions *psOptions =
             GDALDEMProcessingOptionsNew(aosOptions.List(), nullptr);
@@ -82,6 +82,7 @@ GDALRasterContourAlgorithm::GDALRasterContourAlgorithm(bool standaloneStep)
            _("Group n features per transaction (default 100 000)"),
            &m_groupTransactions)
         .SetMinValueIncluded(0);
+    AddNumThreadsArg(&m_numThreads, &m_numThreadsStr);
 }
 
 /************************************************************************/
@@ -211,6 +212,8 @@ bool GDALRasterContourAlgorithm::RunStep(GDALPipelineStepRunContext &ctxt)
         aosOptions.AddString("-nln");
         aosOptions.AddString(m_outputLayerName);
     }
+    aosOptions.AddString("-num_threads");
+    aosOptions.AddString(m_numThreadsStr);
 
     // Check that one of --interval, --levels, --exp-base is specified
     if (m_levels.size() == 0 && std::isnan(m_interval) && m_expBase == 0)
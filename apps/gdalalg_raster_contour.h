@@ -72,6 +72,10 @@ class GDALRasterContourAlgorithm /* non final */
     int m_expBase = 0;  // -e <base>
     bool m_polygonize = false;    // -p
     int m_groupTransactions = 0;  // gt <n>
+    int m_numThreads = 0;         // -num_threads <value>
+
+    // Work variables
+    std::string m_numThreadsStr{"ALL_CPUS"};
 };
 
 /************************************************************************/
@@ -65,6 +65,8 @@ GDALRasterFillNodataAlgorithm::GDALRasterFillNodataAlgorithm(
            &m_strategy)
         .SetDefault(m_strategy)
         .SetChoices("invdist", "nearest");
+
+    AddNumThreadsArg(&m_numThreads, &m_numThreadsStr);
 }
 
 /************************************************************************/
@@ -109,6 +111,7 @@ bool GDALRasterFillNodataAlgorithm::RunStep(GDALPipelineStepRunContext &ctxt)
     else
         aosFillOptions.AddNameValue("INTERPOLATION",
                                     "INV_DIST");  // default strategy
+    aosFillOptions.SetNameValue("NUM_THREADS", m_numThreadsStr.c_str());
 
     pScaledData.reset(
         GDALCreateScaledProgress(0.5, 1.0, pfnProgress, pProgressData));
@@ -47,6 +47,10 @@ class GDALRasterFillNodataAlgorithm /* non final */
     GDALArgDatasetValue m_maskDataset{};
     // By default, pixels are interpolated using an inverse distance weighting (inv_dist). It is also possible to choose a nearest neighbour (nearest) strategy.
     std::string m_strategy = "invdist";
+    int m_numThreads = 0;
+
+    // Work variables
+    std::string m_numThreadsStr{"ALL_CPUS"};
 };
 
 /************************************************************************/
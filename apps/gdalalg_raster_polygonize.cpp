@@ -68,6 +68,9 @@ GDALRasterPolygonizeAlgorithm::GDALRasterPolygonizeAlgorithm(
     AddArg("connect-diagonal-pixels", 'c',
            _("Consider diagonal pixels as connected"), &m_connectDiagonalPixels)
         .SetDefault(m_connectDiagonalPixels);
+
+    AddNumThreadsArg(&m_numThreads, &m_numThreadsStr)
+        .SetDefault(m_numThreadsStr);
 }
 
 /************************************************************************/
@@ -245,6 +248,7 @@ bool GDALRasterPolygonizeAlgorithm::RunStep(GDALPipelineStepRunContext &ctxt)
     {
         aosPolygonizeOptions.SetNameValue("8CONNECTED", "8");
     }
+    aosPolygonizeOptions.SetNameValue("NUM_THREADS", m_numThreadsStr.c_str());
 
     bool ret;
     if (GDALDataTypeIsInteger(eDT))
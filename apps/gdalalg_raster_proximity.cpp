@@ -55,6 +55,13 @@ GDALRasterProximityAlgorithm::GDALRasterProximityAlgorithm(bool standaloneStep)
            _("Specify a nodata value to use for pixels that are beyond the "
              "maximum distance"),
            &m_noDataValue);
+    AddArg("algorithm", 0,
+           _("Distance computation algorithm: historical scanline "
+             "propagation, or exact Euclidean distance transform"),
+           &m_algorithm)
+        .SetChoices("scanline", "edt")
+        .SetDefault(m_algorithm);
+    AddNumThreadsArg(&m_numThreads, &m_numThreadsStr);
 }
 
 /************************************************************************/
@@ -130,6 +137,12 @@ bool GDALRasterProximityAlgorithm::RunStep(GDALPipelineStepRunContext &ctxt)
             CPLSPrintf("VALUES=%s", targetPixelValues.c_str()));
     }
 
+    if (m_algorithm == "edt")
+    {
+        proximityOptions.AddString("ALGORITHM=EDT");
+        proximityOptions.SetNameValue("NUM_THREADS", m_numThreadsStr.c_str());
+    }
+
     const auto error = GDALComputeProximity(srcBand, dstBand, proximityOptions,
                                             pfnProgress, pProgressData);
     if (error == CE_None)
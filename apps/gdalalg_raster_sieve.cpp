@@ -51,6 +51,8 @@ GDALRasterSieveAlgorithm::GDALRasterSieveAlgorithm(bool standaloneStep)
     AddArg("connect-diagonal-pixels", 'c',
            _("Consider diagonal pixels as connected"), &m_connectDiagonalPixels)
         .SetDefault(m_connectDiagonalPixels);
+
+    AddNumThreadsArg(&m_numThreads, &m_numThreadsStr);
 }
 
 /************************************************************************/
@@ -86,11 +88,14 @@ bool GDALRasterSieveAlgorithm::RunStep(GDALPipelineStepRunContext &ctxt)
     GDALRasterBand *dstBand = poTmpDS->GetRasterBand(1);
     CPLAssert(dstBand);
 
+    CPLStringList aosOptions;
+    aosOptions.SetNameValue("NUM_THREADS", m_numThreadsStr.c_str());
+
     pScaledData.reset(
         GDALCreateScaledProgress(0.5, 1.0, pfnProgress, pProgressData));
     const CPLErr err = GDALSieveFilter(
         dstBand, maskBand, dstBand, m_sizeThreshold,
-        m_connectDiagonalPixels ? 8 : 4, nullptr,
+        m_connectDiagonalPixels ? 8 : 4, aosOptions.List(),
         pScaledData ? GDALScaledProgress : nullptr, pScaledData.get());
     if (err == CE_None)
     {
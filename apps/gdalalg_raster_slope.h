@@ -42,6 +42,10 @@ class GDALRasterSlopeAlgorithm /* non final */
     double m_yscale = std::numeric_limits<double>::quiet_NaN();
     std::string m_gradientAlg = "Horn";
     bool m_noEdges = false;
+    int m_numThreads = 0;
+
+    // Work variables
+    std::string m_numThreadsStr{"ALL_CPUS"};
 };
 
 /************************************************************************/
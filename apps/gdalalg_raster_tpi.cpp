@@ -38,6 +38,7 @@ GDALRasterTPIAlgorithm::GDALRasterTPIAlgorithm(bool standaloneStep)
            _("Do not try to interpolate values at dataset edges or close to "
              "nodata values"),
            &m_noEdges);
+    AddNumThreadsArg(&m_numThreads, &m_numThreadsStr);
 }
 
 /************************************************************************/
@@ -58,6 +59,8 @@ bool GDALRasterTPIAlgorithm::RunStep(GDALPipelineStepRunContext &)
     aosOptions.AddString(CPLSPrintf("%d", m_band));
     if (!m_noEdges)
         aosOptions.AddString("-compute_edges");
+    aosOptions.AddString("-num_threads");
+    aosOptions.AddString(m_numThreadsStr.c_str());
 
     GDALDEMProcessingOptions *psOptions =
         GDALDEMProcessingOptionsNew(aosOptions.List(), nullptr);
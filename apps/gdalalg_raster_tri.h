@@ -40,6 +40,10 @@ class GDALRasterTRIAlgorithm /* non final */
     int m_band = 1;
     std::string m_algorithm = "Riley";
     bool m_noEdges = false;
+    int m_numThreads = 0;
+
+    // Work variables
+    std::string m_numThreadsStr{"ALL_CPUS"};
 };
 
 /************************************************************************/
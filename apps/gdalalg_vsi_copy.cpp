@@ -54,6 +54,7 @@ GDALVSICopyAlgorithm::GDALVSICopyAlgorithm()
            &m_recursive);
 
     AddArg("skip-errors", 0, _("Skip errors"), &m_skip);
+    AddNumThreadsArg(&m_numThreads, &m_numThreadsStr);
     AddProgressArg();
 }
 
@@ -138,6 +139,19 @@ bool GDALVSICopyAlgorithm::RunImpl(GDALProgressFunc pfnProgress,
             }
         }
 
+        if (m_numThreads > 1 && !m_skip)
+        {
+            // Let VSISync() list directories and copy files concurrently
+            CPLStringList aosOptions;
+            aosOptions.SetNameValue("RECURSIVE", m_recursive ? "YES" : "NO");
+            aosOptions.SetNameValue("SYNC_STRATEGY", "OVERWRITE");
+            aosOptions.SetNameValue("NUM_THREADS",
+                                    CPLSPrintf("%d", m_numThreads));
+            return VSISync((m_source + '/').c_str(), m_destination.c_str(),
+                           aosOptions.List(), pfnProgress, pProgressData,
+                           nullptr);
+        }
+
         uint64_t curAmount = 0;
         return CopyRecursive(m_source, m_destination, 0, m_recursive ? -1 : 0,
                              curAmount, 0, pfnProgress, pProgressData);
@@ -41,6 +41,8 @@ class GDALVSICopyAlgorithm final : public GDALAlgorithm
     std::string m_destination{};
     bool m_recursive = false;
     bool m_skip = false;
+    int m_numThreads = 0;
+    std::string m_numThreadsStr{};
 
     bool RunImpl(GDALProgressFunc, void *) override;
 
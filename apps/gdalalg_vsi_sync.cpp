@@ -66,8 +66,9 @@ bool GDALVSISyncAlgorithm::RunImpl(GDALProgressFunc pfnProgress,
 {
     CPLStringList aosOptions;
     aosOptions.SetNameValue("RECURSIVE", m_recursive ? "YES" : "NO");
-    aosOptions.SetNameValue("STRATEGY", m_strategy.c_str());
-    aosOptions.SetNameValue("NUM_THREADS", CPLSPrintf("%d", m_numThreads));
+    aosOptions.SetNameValue("SYNC_STRATEGY", m_strategy.c_str());
+    if (!m_numThreadsStr.empty())
+        aosOptions.SetNameValue("NUM_THREADS", CPLSPrintf("%d", m_numThreads));
 
     if (!VSISync(m_source.c_str(), m_destination.c_str(), aosOptions.List(),
                  pfnProgress, pProgressData, nullptr))
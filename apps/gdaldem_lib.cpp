@@ -97,7 +97,9 @@
 #include <algorithm>
 #include <array>
 #include <cmath>
+#include <functional>
 #include <limits>
+#include <memory>
 
 #include "cpl_error.h"
 #include "cpl_float.h"
@@ -105,8 +107,10 @@
 #include "cpl_string.h"
 #include "cpl_vsi.h"
 #include "cpl_vsi_virtual.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal.h"
 #include "gdal_priv.h"
+#include "gdal_thread_pool.h"
 
 #if defined(__x86_64__) || defined(_M_X64)
 #define HAVE_16_SSE_REG
@@ -175,6 +179,7 @@ struct GDALDEMProcessingOptions
     bool bMultiDirectional = false;
     CPLStringList aosCreationOptions{};
     int nBand = 1;
+    std::string osNumThreads{};  // empty = use GDAL_NUM_THREADS
 };
 
 /************************************************************************/
@@ -210,7 +215,8 @@ template <class T> struct GDALGeneric3x3ProcessingAlg_multisample
 {
     typedef int (*type)(const T *pafFirstLine, const T *pafSecondLine,
                         const T *pafThirdLine, int nXSize,
-                        const AlgorithmParameters *pData, float *pafOutputBuf);
+                        float fDstNoDataValue, const AlgorithmParameters *pData,
+                        float *pafOutputBuf);
 };
 
 template <class T>
@@ -310,6 +316,356 @@ GInt32 INTERPOL(GInt32 a, GInt32 b, int bSrcHasNoData, GInt32 fSrcNoDataValue)
     return nVal;
 }
 
+/************************************************************************/
+/*                        GDALDEMProcessChunks()                        */
+/************************************************************************/
+
+// Process the [nYOff, nYOff + nYSize) range of output lines by chunks of
+// nChunkLines lines.
+// fnRead(iBuffer, nChunkYOff, nChunkYSize) and
+// fnWrite(iBuffer, nChunkYOff, nChunkYSize) are called from the calling
+// thread only, and in increasing line order, so that they do not need to be
+// thread-safe.
+// fnCompute(iBuffer, nChunkYOff, nStartLine, nEndLine) is called to compute
+// the [nStartLine, nEndLine) subset of lines of a chunk, from worker threads
+// of the global thread pool when nThreads > 1.
+// Two buffers are used alternatively, so that the next chunk is read and the
+// previous one written while the current one is computed.
+static bool GDALDEMProcessChunks(
+    int nYOff, int nYSize, int nChunkLines, int nThreads,
+    const std::function<bool(int, int, int)> &fnRead,
+    const std::function<void(int, int, int, int)> &fnCompute,
+    const std::function<bool(int, int, int)> &fnWrite)
+{
+    CPLWorkerThreadPool *poThreadPool =
+        nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+    std::unique_ptr<CPLJobQueue> poJobQueue =
+        poThreadPool ? poThreadPool->CreateJobQueue() : nullptr;
+
+    const auto SubmitCompute =
+        [&fnCompute, &poJobQueue, nThreads](int iBuffer, int nChunkYOff,
+                                             int nChunkYSize)
+    {
+        if (!poJobQueue)
+        {
+            fnCompute(iBuffer, nChunkYOff, nChunkYOff,
+                      nChunkYOff + nChunkYSize);
+            return;
+        }
+        const int nLinesPerJob = DIV_ROUND_UP(nChunkYSize, nThreads);
+        for (int nStart = nChunkYOff; nStart < nChunkYOff + nChunkYSize;
+             nStart += nLinesPerJob)
+        {
+            const int nEnd =
+                std::min(nStart + nLinesPerJob, nChunkYOff + nChunkYSize);
+            poJobQueue->SubmitJob(
+                [&fnCompute, iBuffer, nChunkYOff, nStart, nEnd]()
+                { fnCompute(iBuffer, nChunkYOff, nStart, nEnd); });
+        }
+    };
+
+    const int nYEnd = nYOff + nYSize;
+    int nChunkYOff = nYOff;
+    int nChunkYSize = std::min(nChunkLines, nYEnd - nChunkYOff);
+    if (!fnRead(0, nChunkYOff, nChunkYSize))
+        return false;
+    SubmitCompute(0, nChunkYOff, nChunkYSize);
+
+    int iBuffer = 0;
+    while (true)
+    {
+        const int nNextYOff = nChunkYOff + nChunkYSize;
+        const int nNextYSize = std::min(nChunkLines, nYEnd - nNextYOff);
+        const bool bReadOK =
+            nNextYSize <= 0 || fnRead(1 - iBuffer, nNextYOff, nNextYSize);
+        if (poJobQueue)
+            poJobQueue->WaitCompletion();
+        if (!bReadOK)
+            return false;
+
+        if (nNextYSize > 0)
+            SubmitCompute(1 - iBuffer, nNextYOff, nNextYSize);
+
+        if (!fnWrite(iBuffer, nChunkYOff, nChunkYSize))
+        {
+            if (poJobQueue)
+                poJobQueue->WaitCompletion();
+            return false;
+        }
+
+        if (nNextYSize <= 0)
+            break;
+        iBuffer = 1 - iBuffer;
+        nChunkYOff = nNextYOff;
+        nChunkYSize = nNextYSize;
+    }
+
+    return true;
+}
+
+/************************************************************************/
+/*                        GDALGeneric3x3Kernel                          */
+/************************************************************************/
+
+// Computation of output lines of a 3x3 algorithm from source lines.
+// Once initialized, it is not modified, so the same instance can be used
+// concurrently from several threads to compute different lines.
+template <class T> struct GDALGeneric3x3Kernel
+{
+    typename GDALGeneric3x3ProcessingAlg<T>::type pfnAlg = nullptr;
+    typename GDALGeneric3x3ProcessingAlg_multisample<T>::type
+        pfnAlg_multisample = nullptr;
+    const AlgorithmParameters *pData = nullptr;
+    int nXSize = 0;
+    int nYSize = 0;
+    bool bSrcHasNoData = false;
+    T fSrcNoDataValue = 0;
+    bool bIsSrcNoDataNan = false;
+    float fDstNoDataValue = 0;
+    bool bComputeAtEdges = false;
+
+    bool LineHasNoData(const T *pafLine) const;
+
+    int ComputeLine(int iY, const T *pafLine1, const T *pafLine2,
+                    const T *pafLine3, bool bOneOfThreeLinesHasNoData,
+                    float *pafOutputBuf) const;
+
+    void ComputeLines(const T *pafSrc, int nSrcYOff, int nStartLine,
+                      int nEndLine, float *pafOutputBuf,
+                      int *panMultiSampleEnd) const;
+};
+
+template <class T>
+bool GDALGeneric3x3Kernel<T>::LineHasNoData(const T *pafLine) const
+{
+    if (!bSrcHasNoData)
+        return false;
+    for (int iX = 0; iX < nXSize; iX++)
+    {
+        if constexpr (std::numeric_limits<T>::is_integer)
+        {
+            if (pafLine[iX] == fSrcNoDataValue)
+                return true;
+        }
+        else
+        {
+            if (pafLine[iX] == fSrcNoDataValue || std::isnan(pafLine[iX]))
+                return true;
+        }
+    }
+    return false;
+}
+
+// Compute output line iY, given source lines iY-1, iY and iY+1 (only the
+// existing ones are used for the first and last lines).
+// Returns the index of the first pixel that has not been computed by
+// pfnAlg_multisample, or 1 if it has not been used.
+template <class T>
+int GDALGeneric3x3Kernel<T>::ComputeLine(int iY, const T *pafLine1,
+                                         const T *pafLine2, const T *pafLine3,
+                                         bool bOneOfThreeLinesHasNoData,
+                                         float *pafOutputBuf) const
+{
+    if (iY == 0 || iY == nYSize - 1)
+    {
+        if (bComputeAtEdges && nXSize >= 2 && nYSize >= 2)
+        {
+            // First line: pafLine2 and pafLine3 are lines 0 and 1.
+            // Last line: pafLine1 and pafLine2 are the last two lines.
+            for (int j = 0; j < nXSize; j++)
+            {
+                int jmin = (j == 0) ? j : j - 1;
+                int jmax = (j == nXSize - 1) ? j : j + 1;
+
+                if (iY == 0)
+                {
+                    T afWin[9] = {
+                        INTERPOL(pafLine2[jmin], pafLine3[jmin], bSrcHasNoData,
+                                 fSrcNoDataValue),
+                        INTERPOL(pafLine2[j], pafLine3[j], bSrcHasNoData,
+                                 fSrcNoDataValue),
+                        INTERPOL(pafLine2[jmax], pafLine3[jmax], bSrcHasNoData,
+                                 fSrcNoDataValue),
+                        pafLine2[jmin],
+                        pafLine2[j],
+                        pafLine2[jmax],
+                        pafLine3[jmin],
+                        pafLine3[j],
+                        pafLine3[jmax]};
+                    pafOutputBuf[j] = ComputeVal(
+                        bSrcHasNoData, fSrcNoDataValue, bIsSrcNoDataNan, afWin,
+                        fDstNoDataValue, pfnAlg, pData, bComputeAtEdges);
+                }
+                else
+                {
+                    T afWin[9] = {
+                        pafLine1[jmin],
+                        pafLine1[j],
+                        pafLine1[jmax],
+                        pafLine2[jmin],
+                        pafLine2[j],
+                        pafLine2[jmax],
+                        INTERPOL(pafLine2[jmin], pafLine1[jmin], bSrcHasNoData,
+                                 fSrcNoDataValue),
+                        INTERPOL(pafLine2[j], pafLine1[j], bSrcHasNoData,
+                                 fSrcNoDataValue),
+                        INTERPOL(pafLine2[jmax], pafLine1[jmax], bSrcHasNoData,
+                                 fSrcNoDataValue),
+                    };
+                    pafOutputBuf[j] = ComputeVal(
+                        bSrcHasNoData, fSrcNoDataValue, bIsSrcNoDataNan, afWin,
+                        fDstNoDataValue, pfnAlg, pData, bComputeAtEdges);
+                }
+            }
+        }
+        else
+        {
+            // Exclude the edges
+            for (int j = 0; j < nXSize; j++)
+            {
+                pafOutputBuf[j] = fDstNoDataValue;
+            }
+        }
+        return 1;
+    }
+
+    if (bComputeAtEdges && nXSize >= 2)
+    {
+        int j = 0;
+        T afWin[9] = {
+            INTERPOL(pafLine1[j], pafLine1[j + 1], bSrcHasNoData,
+                     fSrcNoDataValue),
+            pafLine1[j],
+            pafLine1[j + 1],
+            INTERPOL(pafLine2[j], pafLine2[j + 1], bSrcHasNoData,
+                     fSrcNoDataValue),
+            pafLine2[j],
+            pafLine2[j + 1],
+            INTERPOL(pafLine3[j], pafLine3[j + 1], bSrcHasNoData,
+                     fSrcNoDataValue),
+            pafLine3[j],
+            pafLine3[j + 1]};
+
+        pafOutputBuf[j] = ComputeVal(bOneOfThreeLinesHasNoData, fSrcNoDataValue,
+                                     bIsSrcNoDataNan, afWin, fDstNoDataValue,
+                                     pfnAlg, pData, bComputeAtEdges);
+    }
+    else
+    {
+        // Exclude the edges
+        pafOutputBuf[0] = fDstNoDataValue;
+    }
+
+    int j = 1;
+    if (pfnAlg_multisample && !bOneOfThreeLinesHasNoData)
+    {
+        j = pfnAlg_multisample(pafLine1, pafLine2, pafLine3, nXSize,
+                               fDstNoDataValue, pData, pafOutputBuf);
+    }
+    const int nMultiSampleEnd = j;
+
+    for (; j < nXSize - 1; j++)
+    {
+        T afWin[9] = {pafLine1[j - 1], pafLine1[j], pafLine1[j + 1],
+                      pafLine2[j - 1], pafLine2[j], pafLine2[j + 1],
+                      pafLine3[j - 1], pafLine3[j], pafLine3[j + 1]};
+
+        pafOutputBuf[j] = ComputeVal(bOneOfThreeLinesHasNoData, fSrcNoDataValue,
+                                     bIsSrcNoDataNan, afWin, fDstNoDataValue,
+                                     pfnAlg, pData, bComputeAtEdges);
+    }
+
+    if (bComputeAtEdges && nXSize >= 2)
+    {
+        j = nXSize - 1;
+
+        T afWin[9] = {pafLine1[j - 1],
+                      pafLine1[j],
+                      INTERPOL(pafLine1[j], pafLine1[j - 1], bSrcHasNoData,
+                               fSrcNoDataValue),
+                      pafLine2[j - 1],
+                      pafLine2[j],
+                      INTERPOL(pafLine2[j], pafLine2[j - 1], bSrcHasNoData,
+                               fSrcNoDataValue),
+                      pafLine3[j - 1],
+                      pafLine3[j],
+                      INTERPOL(pafLine3[j], pafLine3[j - 1], bSrcHasNoData,
+                               fSrcNoDataValue)};
+
+        pafOutputBuf[j] = ComputeVal(bOneOfThreeLinesHasNoData, fSrcNoDataValue,
+                                     bIsSrcNoDataNan, afWin, fDstNoDataValue,
+                                     pfnAlg, pData, bComputeAtEdges);
+    }
+    else
+    {
+        // Exclude the edges
+        if (nXSize > 1)
+            pafOutputBuf[nXSize - 1] = fDstNoDataValue;
+    }
+
+    return nMultiSampleEnd;
+}
+
+// Compute output lines [nStartLine, nEndLine) into pafOutputBuf, which
+// points to the output line nStartLine. pafSrc contains the source lines
+// starting at line nSrcYOff, and must contain lines nStartLine - 1 and
+// nEndLine when they exist. If panMultiSampleEnd is not null, it receives
+// the return value of ComputeLine() for each line.
+template <class T>
+void GDALGeneric3x3Kernel<T>::ComputeLines(const T *pafSrc, int nSrcYOff,
+                                           int nStartLine, int nEndLine,
+                                           float *pafOutputBuf,
+                                           int *panMultiSampleEnd) const
+{
+    const auto GetLine = [this, pafSrc, nSrcYOff](int iY)
+    {
+        iY = std::clamp(iY, 0, nYSize - 1);
+        return pafSrc + static_cast<size_t>(iY - nSrcYOff) * nXSize;
+    };
+
+    // In case none of the 3 lines have nodata values, then no need to
+    // check it in ComputeVal()
+    bool abLineHasNoDataValue[3] = {
+        nStartLine > 0 && LineHasNoData(GetLine(nStartLine - 1)),
+        LineHasNoData(GetLine(nStartLine)), false};
+
+    for (int iY = nStartLine; iY < nEndLine; ++iY)
+    {
+        abLineHasNoDataValue[2] =
+            iY + 1 < nYSize && LineHasNoData(GetLine(iY + 1));
+
+        const int nMultiSampleEnd = ComputeLine(
+            iY, GetLine(iY - 1), GetLine(iY), GetLine(iY + 1),
+            abLineHasNoDataValue[0] || abLineHasNoDataValue[1] ||
+                abLineHasNoDataValue[2],
+            pafOutputBuf + static_cast<size_t>(iY - nStartLine) * nXSize);
+        if (panMultiSampleEnd)
+            panMultiSampleEnd[iY - nStartLine] = nMultiSampleEnd;
+
+        abLineHasNoDataValue[0] = abLineHasNoDataValue[1];
+        abLineHasNoDataValue[1] = abLineHasNoDataValue[2];
+    }
+}
+
+/************************************************************************/
+/*                     GDALDEMGetChunkLineCount()                       */
+/************************************************************************/
+
+// Return the number of lines to process at once, so that the source data of
+// a chunk is about 16 MB large, with at least a few lines per thread.
+static int GDALDEMGetChunkLineCount(int nYSize, size_t nBytesPerLine,
+                                    int nThreads)
+{
+    // Only configurable for debug / testing
+    const size_t nBytesPerChunk = static_cast<size_t>(std::max<GIntBig>(
+        1, CPLAtoGIntBig(CPLGetConfigOption("GDALDEM_CHUNK_MAX_SIZE",
+                                            "16777216"))));
+    const size_t nLines = std::max<size_t>(
+        4 * nThreads, nBytesPerChunk / std::max<size_t>(1, nBytesPerLine));
+    return static_cast<int>(std::max<size_t>(
+        1, std::min(static_cast<size_t>(nYSize), nLines)));
+}
+
 /************************************************************************/
 /*                  GDALGeneric3x3Processing()                          */
 /************************************************************************/
@@ -321,7 +677,7 @@ static CPLErr GDALGeneric3x3Processing(
     typename GDALGeneric3x3ProcessingAlg_multisample<T>::type
         pfnAlg_multisample,
     std::unique_ptr<AlgorithmParameters> pData, bool bComputeAtEdges,
-    GDALProgressFunc pfnProgress, void *pProgressData)
+    int nThreads, GDALProgressFunc pfnProgress, void *pProgressData)
 {
     if (pfnProgress == nullptr)
         pfnProgress = GDALDummyProgress;
@@ -338,26 +694,19 @@ static CPLErr GDALGeneric3x3Processing(
     const int nXSize = GDALGetRasterBandXSize(hSrcBand);
     const int nYSize = GDALGetRasterBandYSize(hSrcBand);
 
-    // 1 line destination buffer.
-    float *pafOutputBuf =
-        static_cast<float *>(VSI_MALLOC2_VERBOSE(sizeof(float), nXSize));
-    // 3 line rotating source buffer.
-    T *pafThreeLineWin =
-        static_cast<T *>(VSI_MALLOC2_VERBOSE(3 * sizeof(T), nXSize));
-    if (pafOutputBuf == nullptr || pafThreeLineWin == nullptr)
-    {
-        VSIFree(pafOutputBuf);
-        VSIFree(pafThreeLineWin);
-        return CE_Failure;
-    }
+    GDALGeneric3x3Kernel<T> oKernel;
+    oKernel.pfnAlg = pfnAlg;
+    oKernel.pfnAlg_multisample = pfnAlg_multisample;
+    oKernel.pData = pData.get();
+    oKernel.nXSize = nXSize;
+    oKernel.nYSize = nYSize;
+    oKernel.bComputeAtEdges = bComputeAtEdges;
 
     GDALDataType eReadDT;
     int bSrcHasNoData = FALSE;
     const double dfNoDataValue =
         GDALGetRasterNoDataValue(hSrcBand, &bSrcHasNoData);
 
-    bool bIsSrcNoDataNan = false;
-    T fSrcNoDataValue = 0;
     if constexpr (std::numeric_limits<T>::is_integer)
     {
         eReadDT = GDT_Int32;
@@ -376,7 +725,8 @@ static CPLErr GDALGeneric3x3Processing(
             if (fabs(dfNoDataValue - floor(dfNoDataValue + 0.5)) < 1e-2 &&
                 dfNoDataValue >= nMinVal && dfNoDataValue <= nMaxVal)
             {
-                fSrcNoDataValue = static_cast<T>(floor(dfNoDataValue + 0.5));
+                oKernel.fSrcNoDataValue =
+                    static_cast<T>(floor(dfNoDataValue + 0.5));
             }
             else
             {
@@ -387,384 +737,87 @@ static CPLErr GDALGeneric3x3Processing(
     else
     {
         eReadDT = GDT_Float32;
-        fSrcNoDataValue = static_cast<T>(dfNoDataValue);
-        bIsSrcNoDataNan = bSrcHasNoData && std::isnan(dfNoDataValue);
+        oKernel.fSrcNoDataValue = static_cast<T>(dfNoDataValue);
+        oKernel.bIsSrcNoDataNan = bSrcHasNoData && std::isnan(dfNoDataValue);
     }
+    oKernel.bSrcHasNoData = CPL_TO_BOOL(bSrcHasNoData);
 
     int bDstHasNoData = FALSE;
-    float fDstNoDataValue =
+    oKernel.fDstNoDataValue =
         static_cast<float>(GDALGetRasterNoDataValue(hDstBand, &bDstHasNoData));
     if (!bDstHasNoData)
-        fDstNoDataValue = 0.0;
-
-    int nLine1Off = 0;
-    int nLine2Off = nXSize;
-    int nLine3Off = 2 * nXSize;
-
-    // Move a 3x3 pafWindow over each cell
-    // (where the cell in question is #4)
-    //
-    //      0 1 2
-    //      3 4 5
-    //      6 7 8
-
-    /* Preload the first 2 lines */
-
-    bool abLineHasNoDataValue[3] = {CPL_TO_BOOL(bSrcHasNoData),
-                                    CPL_TO_BOOL(bSrcHasNoData),
-                                    CPL_TO_BOOL(bSrcHasNoData)};
-
-    for (int i = 0; i < 2 && i < nYSize; i++)
+        oKernel.fDstNoDataValue = 0.0;
+
+    // Chunks of output lines are computed from the source lines they cover,
+    // plus one line above and below (when they exist).
+    const int nChunkLines =
+        GDALDEMGetChunkLineCount(nYSize, nXSize * sizeof(T), nThreads);
+    std::unique_ptr<T, VSIFreeReleaser> apafSrcBuf[2];
+    std::unique_ptr<float, VSIFreeReleaser> apafOutputBuf[2];
+    int anSrcYOff[2] = {0, 0};
+    for (int i = 0; i < 2; ++i)
     {
-        if (GDALRasterIO(hSrcBand, GF_Read, 0, i, nXSize, 1,
-                         pafThreeLineWin + i * nXSize, nXSize, 1, eReadDT, 0,
-                         0) != CE_None)
-        {
-            CPLFree(pafOutputBuf);
-            CPLFree(pafThreeLineWin);
-
+        apafSrcBuf[i].reset(static_cast<T *>(
+            VSI_MALLOC3_VERBOSE(sizeof(T), nXSize, nChunkLines + 2)));
+        apafOutputBuf[i].reset(static_cast<float *>(
+            VSI_MALLOC3_VERBOSE(sizeof(float), nXSize, nChunkLines)));
+        if (!apafSrcBuf[i] || !apafOutputBuf[i])
             return CE_Failure;
-        }
-        if (bSrcHasNoData)
-        {
-            abLineHasNoDataValue[i] = false;
-            if constexpr (std::numeric_limits<T>::is_integer)
-            {
-                for (int iX = 0; iX < nXSize; iX++)
-                {
-                    if (pafThreeLineWin[i * nXSize + iX] == fSrcNoDataValue)
-                    {
-                        abLineHasNoDataValue[i] = true;
-                        break;
-                    }
-                }
-            }
-            else
-            {
-                for (int iX = 0; iX < nXSize; iX++)
-                {
-                    if (pafThreeLineWin[i * nXSize + iX] == fSrcNoDataValue ||
-                        std::isnan(pafThreeLineWin[i * nXSize + iX]))
-                    {
-                        abLineHasNoDataValue[i] = true;
-                        break;
-                    }
-                }
-            }
-        }
     }
 
-    CPLErr eErr = CE_None;
-    if (bComputeAtEdges && nXSize >= 2 && nYSize >= 2)
+    const auto ReadChunk =
+        [hSrcBand, nXSize, nYSize, eReadDT, &apafSrcBuf,
+         &anSrcYOff](int iBuffer, int nChunkYOff, int nChunkYSize)
     {
-        for (int j = 0; j < nXSize; j++)
-        {
-            int jmin = (j == 0) ? j : j - 1;
-            int jmax = (j == nXSize - 1) ? j : j + 1;
-
-            T afWin[9] = {
-                INTERPOL(pafThreeLineWin[jmin], pafThreeLineWin[nXSize + jmin],
-                         bSrcHasNoData, fSrcNoDataValue),
-                INTERPOL(pafThreeLineWin[j], pafThreeLineWin[nXSize + j],
-                         bSrcHasNoData, fSrcNoDataValue),
-                INTERPOL(pafThreeLineWin[jmax], pafThreeLineWin[nXSize + jmax],
-                         bSrcHasNoData, fSrcNoDataValue),
-                pafThreeLineWin[jmin],
-                pafThreeLineWin[j],
-                pafThreeLineWin[jmax],
-                pafThreeLineWin[nXSize + jmin],
-                pafThreeLineWin[nXSize + j],
-                pafThreeLineWin[nXSize + jmax]};
-            pafOutputBuf[j] = ComputeVal(
-                CPL_TO_BOOL(bSrcHasNoData), fSrcNoDataValue, bIsSrcNoDataNan,
-                afWin, fDstNoDataValue, pfnAlg, pData.get(), bComputeAtEdges);
-        }
-        eErr = GDALRasterIO(hDstBand, GF_Write, 0, 0, nXSize, 1, pafOutputBuf,
-                            nXSize, 1, GDT_Float32, 0, 0);
-    }
-    else
-    {
-        // Exclude the edges
-        for (int j = 0; j < nXSize; j++)
-        {
-            pafOutputBuf[j] = fDstNoDataValue;
-        }
-        eErr = GDALRasterIO(hDstBand, GF_Write, 0, 0, nXSize, 1, pafOutputBuf,
-                            nXSize, 1, GDT_Float32, 0, 0);
+        const int nSrcYOff = std::max(0, nChunkYOff - 1);
+        const int nSrcYEnd = std::min(nYSize, nChunkYOff + nChunkYSize + 1);
+        anSrcYOff[iBuffer] = nSrcYOff;
+        return GDALRasterIO(hSrcBand, GF_Read, 0, nSrcYOff, nXSize,
+                            nSrcYEnd - nSrcYOff, apafSrcBuf[iBuffer].get(),
+                            nXSize, nSrcYEnd - nSrcYOff, eReadDT, 0,
+                            0) == CE_None;
+    };
 
-        if (eErr == CE_None && nYSize > 1)
-        {
-            eErr = GDALRasterIO(hDstBand, GF_Write, 0, nYSize - 1, nXSize, 1,
-                                pafOutputBuf, nXSize, 1, GDT_Float32, 0, 0);
-        }
-    }
-    if (eErr != CE_None)
+    const auto ComputeLines =
+        [&oKernel, nXSize, &apafSrcBuf, &apafOutputBuf,
+         &anSrcYOff](int iBuffer, int nChunkYOff, int nStartLine, int nEndLine)
     {
-        CPLFree(pafOutputBuf);
-        CPLFree(pafThreeLineWin);
-
-        return eErr;
-    }
+        oKernel.ComputeLines(apafSrcBuf[iBuffer].get(), anSrcYOff[iBuffer],
+                             nStartLine, nEndLine,
+                             apafOutputBuf[iBuffer].get() +
+                                 static_cast<size_t>(nStartLine - nChunkYOff) *
+                                     nXSize,
+                             nullptr);
+    };
 
-    int i = 1;  // Used after for.
-    for (; i < nYSize - 1; i++)
+    const auto WriteChunk = [hDstBand, nXSize, nYSize, &apafOutputBuf,
+                             pfnProgress, pProgressData](
+                                int iBuffer, int nChunkYOff, int nChunkYSize)
     {
-        /* Read third line of the line buffer */
-        eErr =
-            GDALRasterIO(hSrcBand, GF_Read, 0, i + 1, nXSize, 1,
-                         pafThreeLineWin + nLine3Off, nXSize, 1, eReadDT, 0, 0);
-        if (eErr != CE_None)
-        {
-            CPLFree(pafOutputBuf);
-            CPLFree(pafThreeLineWin);
-
-            return eErr;
-        }
-
-        // In case none of the 3 lines have nodata values, then no need to
-        // check it in ComputeVal()
-        bool bOneOfThreeLinesHasNoData = CPL_TO_BOOL(bSrcHasNoData);
-        if (bSrcHasNoData)
+        if (GDALRasterIO(hDstBand, GF_Write, 0, nChunkYOff, nXSize, nChunkYSize,
+                         apafOutputBuf[iBuffer].get(), nXSize, nChunkYSize,
+                         GDT_Float32, 0, 0) != CE_None)
         {
-            if constexpr (std::numeric_limits<T>::is_integer)
-            {
-                bool bLastLineHasNoDataValue = false;
-                int iX = 0;
-                for (; iX + 3 < nXSize; iX += 4)
-                {
-                    if (pafThreeLineWin[nLine3Off + iX] == fSrcNoDataValue ||
-                        pafThreeLineWin[nLine3Off + iX + 1] ==
-                            fSrcNoDataValue ||
-                        pafThreeLineWin[nLine3Off + iX + 2] ==
-                            fSrcNoDataValue ||
-                        pafThreeLineWin[nLine3Off + iX + 3] == fSrcNoDataValue)
-                    {
-                        bLastLineHasNoDataValue = true;
-                        break;
-                    }
-                }
-                if (!bLastLineHasNoDataValue)
-                {
-                    for (; iX < nXSize; iX++)
-                    {
-                        if (pafThreeLineWin[nLine3Off + iX] == fSrcNoDataValue)
-                        {
-                            bLastLineHasNoDataValue = true;
-                        }
-                    }
-                }
-                abLineHasNoDataValue[nLine3Off / nXSize] =
-                    bLastLineHasNoDataValue;
-
-                bOneOfThreeLinesHasNoData = abLineHasNoDataValue[0] ||
-                                            abLineHasNoDataValue[1] ||
-                                            abLineHasNoDataValue[2];
-            }
-            else
-            {
-                bool bLastLineHasNoDataValue = false;
-                int iX = 0;
-                for (; iX + 3 < nXSize; iX += 4)
-                {
-                    if (pafThreeLineWin[nLine3Off + iX] == fSrcNoDataValue ||
-                        std::isnan(pafThreeLineWin[nLine3Off + iX]) ||
-                        pafThreeLineWin[nLine3Off + iX + 1] ==
-                            fSrcNoDataValue ||
-                        std::isnan(pafThreeLineWin[nLine3Off + iX + 1]) ||
-                        pafThreeLineWin[nLine3Off + iX + 2] ==
-                            fSrcNoDataValue ||
-                        std::isnan(pafThreeLineWin[nLine3Off + iX + 2]) ||
-                        pafThreeLineWin[nLine3Off + iX + 3] ==
-                            fSrcNoDataValue ||
-                        std::isnan(pafThreeLineWin[nLine3Off + iX + 3]))
-                    {
-                        bLastLineHasNoDataValue = true;
-                        break;
-                    }
-                }
-                if (!bLastLineHasNoDataValue)
-                {
-                    for (; iX < nXSize; iX++)
-                    {
-                        if (pafThreeLineWin[nLine3Off + iX] ==
-                                fSrcNoDataValue ||
-                            std::isnan(pafThreeLineWin[nLine3Off + iX]))
-                        {
-                            bLastLineHasNoDataValue = true;
-                        }
-                    }
-                }
-                abLineHasNoDataValue[nLine3Off / nXSize] =
-                    bLastLineHasNoDataValue;
-
-                bOneOfThreeLinesHasNoData = abLineHasNoDataValue[0] ||
-                                            abLineHasNoDataValue[1] ||
-                                            abLineHasNoDataValue[2];
-            }
-        }
-
-        if (bComputeAtEdges && nXSize >= 2)
-        {
-            int j = 0;
-            T afWin[9] = {INTERPOL(pafThreeLineWin[nLine1Off + j],
-                                   pafThreeLineWin[nLine1Off + j + 1],
-                                   bSrcHasNoData, fSrcNoDataValue),
-                          pafThreeLineWin[nLine1Off + j],
-                          pafThreeLineWin[nLine1Off + j + 1],
-                          INTERPOL(pafThreeLineWin[nLine2Off + j],
-                                   pafThreeLineWin[nLine2Off + j + 1],
-                                   bSrcHasNoData, fSrcNoDataValue),
-                          pafThreeLineWin[nLine2Off + j],
-                          pafThreeLineWin[nLine2Off + j + 1],
-                          INTERPOL(pafThreeLineWin[nLine3Off + j],
-                                   pafThreeLineWin[nLine3Off + j + 1],
-                                   bSrcHasNoData, fSrcNoDataValue),
-                          pafThreeLineWin[nLine3Off + j],
-                          pafThreeLineWin[nLine3Off + j + 1]};
-
-            pafOutputBuf[j] = ComputeVal(
-                bOneOfThreeLinesHasNoData, fSrcNoDataValue, bIsSrcNoDataNan,
-                afWin, fDstNoDataValue, pfnAlg, pData.get(), bComputeAtEdges);
-        }
-        else
-        {
-            // Exclude the edges
-            pafOutputBuf[0] = fDstNoDataValue;
-        }
-
-        int j = 1;
-        if (pfnAlg_multisample && !bOneOfThreeLinesHasNoData)
-        {
-            j = pfnAlg_multisample(
-                pafThreeLineWin + nLine1Off, pafThreeLineWin + nLine2Off,
-                pafThreeLineWin + nLine3Off, nXSize, pData.get(), pafOutputBuf);
-        }
-
-        for (; j < nXSize - 1; j++)
-        {
-            T afWin[9] = {pafThreeLineWin[nLine1Off + j - 1],
-                          pafThreeLineWin[nLine1Off + j],
-                          pafThreeLineWin[nLine1Off + j + 1],
-                          pafThreeLineWin[nLine2Off + j - 1],
-                          pafThreeLineWin[nLine2Off + j],
-                          pafThreeLineWin[nLine2Off + j + 1],
-                          pafThreeLineWin[nLine3Off + j - 1],
-                          pafThreeLineWin[nLine3Off + j],
-                          pafThreeLineWin[nLine3Off + j + 1]};
-
-            pafOutputBuf[j] = ComputeVal(
-                bOneOfThreeLinesHasNoData, fSrcNoDataValue, bIsSrcNoDataNan,
-                afWin, fDstNoDataValue, pfnAlg, pData.get(), bComputeAtEdges);
-        }
-
-        if (bComputeAtEdges && nXSize >= 2)
-        {
-            j = nXSize - 1;
-
-            T afWin[9] = {pafThreeLineWin[nLine1Off + j - 1],
-                          pafThreeLineWin[nLine1Off + j],
-                          INTERPOL(pafThreeLineWin[nLine1Off + j],
-                                   pafThreeLineWin[nLine1Off + j - 1],
-                                   bSrcHasNoData, fSrcNoDataValue),
-                          pafThreeLineWin[nLine2Off + j - 1],
-                          pafThreeLineWin[nLine2Off + j],
-                          INTERPOL(pafThreeLineWin[nLine2Off + j],
-                                   pafThreeLineWin[nLine2Off + j - 1],
-                                   bSrcHasNoData, fSrcNoDataValue),
-                          pafThreeLineWin[nLine3Off + j - 1],
-                          pafThreeLineWin[nLine3Off + j],
-                          INTERPOL(pafThreeLineWin[nLine3Off + j],
-                                   pafThreeLineWin[nLine3Off + j - 1],
-                                   bSrcHasNoData, fSrcNoDataValue)};
-
-            pafOutputBuf[j] = ComputeVal(
-                bOneOfThreeLinesHasNoData, fSrcNoDataValue, bIsSrcNoDataNan,
-                afWin, fDstNoDataValue, pfnAlg, pData.get(), bComputeAtEdges);
-        }
-        else
-        {
-            // Exclude the edges
-            if (nXSize > 1)
-                pafOutputBuf[nXSize - 1] = fDstNoDataValue;
-        }
-
-        /* -----------------------------------------
-         * Write Line to Raster
-         */
-        eErr = GDALRasterIO(hDstBand, GF_Write, 0, i, nXSize, 1, pafOutputBuf,
-                            nXSize, 1, GDT_Float32, 0, 0);
-        if (eErr != CE_None)
-        {
-            CPLFree(pafOutputBuf);
-            CPLFree(pafThreeLineWin);
-
-            return eErr;
+            return false;
         }
-
-        if (!pfnProgress(1.0 * (i + 1) / nYSize, nullptr, pProgressData))
+        if (!pfnProgress(1.0 * (nChunkYOff + nChunkYSize) / nYSize, nullptr,
+                         pProgressData))
         {
             CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
-            eErr = CE_Failure;
-
-            CPLFree(pafOutputBuf);
-            CPLFree(pafThreeLineWin);
-
-            return eErr;
+            return false;
         }
+        return true;
+    };
 
-        const int nTemp = nLine1Off;
-        nLine1Off = nLine2Off;
-        nLine2Off = nLine3Off;
-        nLine3Off = nTemp;
-    }
-
-    if (bComputeAtEdges && nXSize >= 2 && nYSize >= 2)
+    if (!GDALDEMProcessChunks(0, nYSize, nChunkLines, nThreads, ReadChunk,
+                              ComputeLines, WriteChunk))
     {
-        for (int j = 0; j < nXSize; j++)
-        {
-            int jmin = (j == 0) ? j : j - 1;
-            int jmax = (j == nXSize - 1) ? j : j + 1;
-
-            T afWin[9] = {
-                pafThreeLineWin[nLine1Off + jmin],
-                pafThreeLineWin[nLine1Off + j],
-                pafThreeLineWin[nLine1Off + jmax],
-                pafThreeLineWin[nLine2Off + jmin],
-                pafThreeLineWin[nLine2Off + j],
-                pafThreeLineWin[nLine2Off + jmax],
-                INTERPOL(pafThreeLineWin[nLine2Off + jmin],
-                         pafThreeLineWin[nLine1Off + jmin], bSrcHasNoData,
-                         fSrcNoDataValue),
-                INTERPOL(pafThreeLineWin[nLine2Off + j],
-                         pafThreeLineWin[nLine1Off + j], bSrcHasNoData,
-                         fSrcNoDataValue),
-                INTERPOL(pafThreeLineWin[nLine2Off + jmax],
-                         pafThreeLineWin[nLine1Off + jmax], bSrcHasNoData,
-                         fSrcNoDataValue),
-            };
-
-            pafOutputBuf[j] = ComputeVal(
-                CPL_TO_BOOL(bSrcHasNoData), fSrcNoDataValue, bIsSrcNoDataNan,
-                afWin, fDstNoDataValue, pfnAlg, pData.get(), bComputeAtEdges);
-        }
-        eErr = GDALRasterIO(hDstBand, GF_Write, 0, i, nXSize, 1, pafOutputBuf,
-                            nXSize, 1, GDT_Float32, 0, 0);
-        if (eErr != CE_None)
-        {
-            CPLFree(pafOutputBuf);
-            CPLFree(pafThreeLineWin);
-
-            return eErr;
-        }
+        return CE_Failure;
     }
 
     pfnProgress(1.0, nullptr, pProgressData);
-    eErr = CE_None;
-
-    CPLFree(pafOutputBuf);
-    CPLFree(pafThreeLineWin);
 
-    return eErr;
+    return CE_None;
 }
 
 /************************************************************************/
@@ -939,6 +992,53 @@ static double DifferenceBetweenAngles(double angle1, double angle2,
     return diff;
 }
 
+#ifdef HAVE_16_SSE_REG
+
+/************************************************************************/
+/*                         GDALDEMGradient4()                           */
+/************************************************************************/
+
+// Compute the unscaled gradient terms of Gradient<T, alg>::calc() for the 4
+// pixels starting at column j, that is for Horn:
+//   x = (w0 + w3 + w3 + w6) - (w2 + w5 + w5 + w8)
+//   y = (w6 + w7 + w7 + w8) - (w0 + w1 + w1 + w2)
+// and for ZevenbergenThorne:
+//   x = w3 - w5
+//   y = w7 - w1
+// Operations are done in the same order and type as in the scalar code, so
+// that results are bit-identical.
+template <class T, class REG_T, GradientAlg alg>
+static inline void GDALDEMGradient4(const T *pafFirstLine,
+                                    const T *pafSecondLine,
+                                    const T *pafThirdLine, int j,
+                                    XMMReg4Double &reg_x, XMMReg4Double &reg_y)
+{
+    const T *firstLine = pafFirstLine + j - 1;
+    const T *secondLine = pafSecondLine + j - 1;
+    const T *thirdLine = pafThirdLine + j - 1;
+
+    const auto w1 = REG_T::Load4Val(firstLine + 1);
+    const auto w3 = REG_T::Load4Val(secondLine);
+    const auto w5 = REG_T::Load4Val(secondLine + 2);
+    const auto w7 = REG_T::Load4Val(thirdLine + 1);
+    if constexpr (alg == GradientAlg::HORN)
+    {
+        const auto w0 = REG_T::Load4Val(firstLine);
+        const auto w2 = REG_T::Load4Val(firstLine + 2);
+        const auto w6 = REG_T::Load4Val(thirdLine);
+        const auto w8 = REG_T::Load4Val(thirdLine + 2);
+        reg_x = ((w0 + w3 + w3 + w6) - (w2 + w5 + w5 + w8)).cast_to_double();
+        reg_y = ((w6 + w7 + w7 + w8) - (w0 + w1 + w1 + w2)).cast_to_double();
+    }
+    else
+    {
+        reg_x = (w3 - w5).cast_to_double();
+        reg_y = (w7 - w1).cast_to_double();
+    }
+}
+
+#endif
+
 template <class T, GradientAlg alg>
 static float GDALHillshadeIgorAlg(const T *afWin, float /*fDstNoDataValue*/,
                                   const AlgorithmParameters *pData)
@@ -1073,7 +1173,8 @@ static float GDALHillshadeAlg_same_res(const T *afWin,
 template <class T, class REG_T>
 static int GDALHillshadeAlg_same_res_multisample(
     const T *pafFirstLine, const T *pafSecondLine, const T *pafThirdLine,
-    int nXSize, const AlgorithmParameters *pData, float *pafOutputBuf)
+    int nXSize, float /*fDstNoDataValue*/, const AlgorithmParameters *pData,
+    float *pafOutputBuf)
 {
     // Only valid for T == int
     const GDALHillshadeAlgData *psData =
@@ -1132,6 +1233,57 @@ static int GDALHillshadeAlg_same_res_multisample(
     }
     return j;
 }
+
+/************************************************************************/
+/*                   GDALHillshadeAlg_multisample()                     */
+/************************************************************************/
+
+// Vectorized version of GDALHillshadeAlg(), giving the same results
+template <class T, class REG_T, GradientAlg alg>
+static int GDALHillshadeAlg_multisample(const T *pafFirstLine,
+                                        const T *pafSecondLine,
+                                        const T *pafThirdLine, int nXSize,
+                                        float /*fDstNoDataValue*/,
+                                        const AlgorithmParameters *pData,
+                                        float *pafOutputBuf)
+{
+    const GDALHillshadeAlgData *psData =
+        static_cast<const GDALHillshadeAlgData *>(pData);
+    const auto reg_inv_ewres = XMMReg4Double::Set1(psData->inv_ewres_xscale);
+    const auto reg_inv_nsres = XMMReg4Double::Set1(psData->inv_nsres_yscale);
+    const auto reg_fact_x =
+        XMMReg4Double::Set1(psData->sin_az_mul_cos_alt_mul_z_mul_254);
+    const auto reg_fact_y =
+        XMMReg4Double::Set1(psData->cos_az_mul_cos_alt_mul_z_mul_254);
+    const auto reg_constant_num =
+        XMMReg4Double::Set1(psData->sin_altRadians_mul_254);
+    const auto reg_square_z = XMMReg4Double::Set1(psData->square_z);
+    const auto reg_one = XMMReg4Double::Set1(1.0);
+
+    int j = 1;  // Used after for.
+    for (; j < nXSize - 4; j += 4)
+    {
+        XMMReg4Double reg_x;
+        XMMReg4Double reg_y;
+        GDALDEMGradient4<T, REG_T, alg>(pafFirstLine, pafSecondLine,
+                                        pafThirdLine, j, reg_x, reg_y);
+        reg_x = reg_x * reg_inv_ewres;
+        reg_y = reg_y * reg_inv_nsres;
+        const auto reg_xx_plus_yy = reg_x * reg_x + reg_y * reg_y;
+        const auto reg_numerator =
+            reg_constant_num - (reg_y * reg_fact_y - reg_x * reg_fact_x);
+        const auto reg_denominator = reg_one + reg_square_z * reg_xx_plus_yy;
+        // Same as ApproxADivByInvSqrtB(), which is a / sqrt(b) since
+        // HAVE_SSE2 is not defined in this file
+        const auto cang_mul_254 =
+            reg_numerator / XMMReg4Double::Sqrt(reg_denominator);
+        // Equivalent to cang_mul_254 <= 0.0 ? 1.0 : 1.0 + cang_mul_254
+        XMMReg4Double::Max(reg_one, reg_one + cang_mul_254)
+            .cast_to_float()
+            .Store4Val(pafOutputBuf + j);
+    }
+    return j;
+}
 #endif
 
 static const double INV_SQUARE_OF_HALF_PI = 1.0 / ((M_PI * M_PI) / 4);
@@ -1382,6 +1534,63 @@ static float GDALSlopeZevenbergenThorneAlg(const T *afWin,
     return static_cast<float>(100 * (sqrt(key) / 2));
 }
 
+#ifdef HAVE_16_SSE_REG
+
+/************************************************************************/
+/*                     GDALSlopeAlg_multisample()                       */
+/************************************************************************/
+
+// Vectorized version of GDALSlopeHornAlg() and
+// GDALSlopeZevenbergenThorneAlg(), giving the same results
+template <class T, class REG_T, GradientAlg alg>
+static int GDALSlopeAlg_multisample(const T *pafFirstLine,
+                                    const T *pafSecondLine,
+                                    const T *pafThirdLine, int nXSize,
+                                    float /*fDstNoDataValue*/,
+                                    const AlgorithmParameters *pData,
+                                    float *pafOutputBuf)
+{
+    const GDALSlopeAlgData *psData =
+        static_cast<const GDALSlopeAlgData *>(pData);
+    const auto reg_ewres = XMMReg4Double::Set1(psData->ewres_xscale);
+    const auto reg_nsres = XMMReg4Double::Set1(psData->nsres_yscale);
+    const auto reg_divisor =
+        XMMReg4Double::Set1(alg == GradientAlg::HORN ? 8.0 : 2.0);
+    const auto reg_100 = XMMReg4Double::Set1(100.0);
+    const bool bDegrees = psData->slopeFormat == 1;
+
+    int j = 1;  // Used after for.
+    for (; j < nXSize - 4; j += 4)
+    {
+        XMMReg4Double reg_dx;
+        XMMReg4Double reg_dy;
+        GDALDEMGradient4<T, REG_T, alg>(pafFirstLine, pafSecondLine,
+                                        pafThirdLine, j, reg_dx, reg_dy);
+        reg_dx = reg_dx / reg_ewres;
+        reg_dy = reg_dy / reg_nsres;
+        const auto reg_key = reg_dx * reg_dx + reg_dy * reg_dy;
+        const auto reg_ratio = XMMReg4Double::Sqrt(reg_key) / reg_divisor;
+        if (bDegrees)
+        {
+            // No vectorized atan()
+            double adfRatio[4];
+            reg_ratio.Store4Val(adfRatio);
+            for (int k = 0; k < 4; ++k)
+            {
+                pafOutputBuf[j + k] = static_cast<float>(
+                    atan(adfRatio[k]) * kdfRadiansToDegrees);
+            }
+        }
+        else
+        {
+            (reg_100 * reg_ratio).cast_to_float().Store4Val(pafOutputBuf + j);
+        }
+    }
+    return j;
+}
+
+#endif
+
 static std::unique_ptr<AlgorithmParameters>
 GDALCreateSlopeData(double *adfGeoTransform, double xscale, double yscale,
                     int slopeFormat)
@@ -1485,6 +1694,70 @@ static float GDALAspectZevenbergenThorneAlg(const T *afWin,
     return aspect;
 }
 
+#ifdef HAVE_16_SSE_REG
+
+/************************************************************************/
+/*                    GDALAspectAlg_multisample()                       */
+/************************************************************************/
+
+// Vectorized version of GDALAspectAlg() and GDALAspectZevenbergenThorneAlg(),
+// giving the same results. Only the gradient computation is vectorized.
+template <class T, class REG_T, GradientAlg alg>
+static int GDALAspectAlg_multisample(const T *pafFirstLine,
+                                     const T *pafSecondLine,
+                                     const T *pafThirdLine, int nXSize,
+                                     float fDstNoDataValue,
+                                     const AlgorithmParameters *pData,
+                                     float *pafOutputBuf)
+{
+    const GDALAspectAlgData *psData =
+        static_cast<const GDALAspectAlgData *>(pData);
+
+    int j = 1;  // Used after for.
+    for (; j < nXSize - 4; j += 4)
+    {
+        // x and y are -dx and dy of the scalar code
+        XMMReg4Double reg_x;
+        XMMReg4Double reg_y;
+        GDALDEMGradient4<T, REG_T, alg>(pafFirstLine, pafSecondLine,
+                                        pafThirdLine, j, reg_x, reg_y);
+        double adfX[4];
+        double adfY[4];
+        reg_x.Store4Val(adfX);
+        reg_y.Store4Val(adfY);
+        for (int k = 0; k < 4; ++k)
+        {
+            float aspect = static_cast<float>(atan2(adfY[k], adfX[k]) /
+                                              kdfDegreesToRadians);
+            if (adfX[k] == 0 && adfY[k] == 0)
+            {
+                /* Flat area */
+                aspect = fDstNoDataValue;
+            }
+            else if (psData->bAngleAsAzimuth)
+            {
+                if (aspect > 90.0f)
+                    aspect = 450.0f - aspect;
+                else
+                    aspect = 90.0f - aspect;
+            }
+            else
+            {
+                if (aspect < 0)
+                    aspect += 360.0f;
+            }
+
+            if (aspect == 360.0f)
+                aspect = 0.0;
+
+            pafOutputBuf[j + k] = aspect;
+        }
+    }
+    return j;
+}
+
+#endif
+
 static std::unique_ptr<AlgorithmParameters>
 GDALCreateAspectData(bool bAngleAsAzimuth)
 {
@@ -1856,13 +2129,15 @@ class GDALColorReliefDataset : public GDALDataset
     int *panSourceBuf;
     int nCurBlockXOff;
     int nCurBlockYOff;
+    const int nThreads;
 
     CPL_DISALLOW_COPY_ASSIGN(GDALColorReliefDataset)
 
   public:
     GDALColorReliefDataset(GDALDatasetH hSrcDS, GDALRasterBandH hSrcBand,
                            const char *pszColorFilename,
-                           ColorSelectionMode eColorSelectionMode, int bAlpha);
+                           ColorSelectionMode eColorSelectionMode, int bAlpha,
+                           int nThreadsIn);
     ~GDALColorReliefDataset();
 
     bool InitOK() const
@@ -1884,21 +2159,29 @@ class GDALColorReliefRasterBand : public GDALRasterBand
 {
     friend class GDALColorReliefDataset;
 
+    bool ComputeLinesMultiThreaded(int nYOff, int nYSize, void *pData,
+                                   GDALDataType eBufType, GSpacing nPixelSpace,
+                                   GSpacing nLineSpace,
+                                   GDALRasterIOExtraArg *psExtraArg);
+
   public:
     GDALColorReliefRasterBand(GDALColorReliefDataset *, int);
 
     virtual CPLErr IReadBlock(int, int, void *) override;
+    virtual CPLErr IRasterIO(GDALRWFlag, int, int, int, int, void *, int, int,
+                             GDALDataType, GSpacing, GSpacing,
+                             GDALRasterIOExtraArg *psExtraArg) override;
     virtual GDALColorInterp GetColorInterpretation() override;
 };
 
 GDALColorReliefDataset::GDALColorReliefDataset(
     GDALDatasetH hSrcDSIn, GDALRasterBandH hSrcBandIn,
     const char *pszColorFilename, ColorSelectionMode eColorSelectionModeIn,
-    int bAlpha)
+    int bAlpha, int nThreadsIn)
     : hSrcDS(hSrcDSIn), hSrcBand(hSrcBandIn),
       eColorSelectionMode(eColorSelectionModeIn), pabyPrecomputed(nullptr),
       nIndexOffset(0), pafSourceBuf(nullptr), panSourceBuf(nullptr),
-      nCurBlockXOff(-1), nCurBlockYOff(-1)
+      nCurBlockXOff(-1), nCurBlockYOff(-1), nThreads(nThreadsIn)
 {
     asColorAssociation = GDALColorReliefParseColorFile(
         hSrcBand, pszColorFilename, eColorSelectionMode);
@@ -2020,6 +2303,140 @@ CPLErr GDALColorReliefRasterBand::IReadBlock(int nBlockXOff, int nBlockYOff,
     return CE_None;
 }
 
+/************************************************************************/
+/*                             IRasterIO()                              */
+/************************************************************************/
+
+CPLErr GDALColorReliefRasterBand::IRasterIO(
+    GDALRWFlag eRWFlag, int nXOff, int nYOff, int nXSize, int nYSize,
+    void *pData, int nBufXSize, int nBufYSize, GDALDataType eBufType,
+    GSpacing nPixelSpace, GSpacing nLineSpace,
+    GDALRasterIOExtraArg *psExtraArg)
+{
+    GDALColorReliefDataset *poGDS =
+        cpl::down_cast<GDALColorReliefDataset *>(poDS);
+
+    // Requests of several whole lines, without resampling, are computed in
+    // parallel when several threads are allowed.
+    if (eRWFlag == GF_Read && poGDS->nThreads > 1 && nXOff == 0 &&
+        nXSize == nRasterXSize && nBufXSize == nXSize && nBufYSize == nYSize &&
+        nYSize > 1)
+    {
+        return ComputeLinesMultiThreaded(nYOff, nYSize, pData, eBufType,
+                                         nPixelSpace, nLineSpace, psExtraArg)
+                   ? CE_None
+                   : CE_Failure;
+    }
+
+    return GDALRasterBand::IRasterIO(eRWFlag, nXOff, nYOff, nXSize, nYSize,
+                                     pData, nBufXSize, nBufYSize, eBufType,
+                                     nPixelSpace, nLineSpace, psExtraArg);
+}
+
+/************************************************************************/
+/*                     ComputeLinesMultiThreaded()                      */
+/************************************************************************/
+
+bool GDALColorReliefRasterBand::ComputeLinesMultiThreaded(
+    int nYOff, int nYSize, void *pData, GDALDataType eBufType,
+    GSpacing nPixelSpace, GSpacing nLineSpace,
+    GDALRasterIOExtraArg *psExtraArg)
+{
+    GDALColorReliefDataset *poGDS =
+        cpl::down_cast<GDALColorReliefDataset *>(poDS);
+
+    const int nXSize = nRasterXSize;
+    const bool bUsePrecomputed = poGDS->pabyPrecomputed != nullptr;
+    const int nChunkLines = GDALDEMGetChunkLineCount(
+        nYSize, nXSize * sizeof(float), poGDS->nThreads);
+    // int and float have the same size
+    std::unique_ptr<float, VSIFreeReleaser> apafSrcBuf[2];
+    std::unique_ptr<GByte, VSIFreeReleaser> apabyOutputBuf[2];
+    for (int i = 0; i < 2; ++i)
+    {
+        apafSrcBuf[i].reset(static_cast<float *>(
+            VSI_MALLOC3_VERBOSE(sizeof(float), nXSize, nChunkLines)));
+        apabyOutputBuf[i].reset(
+            static_cast<GByte *>(VSI_MALLOC2_VERBOSE(nXSize, nChunkLines)));
+        if (!apafSrcBuf[i] || !apabyOutputBuf[i])
+            return false;
+    }
+
+    const auto ReadChunk = [poGDS, nXSize, bUsePrecomputed, &apafSrcBuf](
+                               int iBuffer, int nChunkYOff, int nChunkYSize)
+    {
+        return GDALRasterIO(poGDS->hSrcBand, GF_Read, 0, nChunkYOff, nXSize,
+                            nChunkYSize, apafSrcBuf[iBuffer].get(), nXSize,
+                            nChunkYSize,
+                            bUsePrecomputed ? GDT_Int32 : GDT_Float32, 0,
+                            0) == CE_None;
+    };
+
+    const auto ComputeLines =
+        [this, poGDS, nXSize, bUsePrecomputed, &apafSrcBuf,
+         &apabyOutputBuf](int iBuffer, int nChunkYOff, int nStartLine,
+                          int nEndLine)
+    {
+        const size_t nOffset =
+            static_cast<size_t>(nStartLine - nChunkYOff) * nXSize;
+        const size_t nCount =
+            static_cast<size_t>(nEndLine - nStartLine) * nXSize;
+        GByte *pabyDst = apabyOutputBuf[iBuffer].get() + nOffset;
+        if (bUsePrecomputed)
+        {
+            const int *panSrc =
+                reinterpret_cast<const int *>(apafSrcBuf[iBuffer].get()) +
+                nOffset;
+            for (size_t i = 0; i < nCount; i++)
+            {
+                const int nIndex = panSrc[i] + poGDS->nIndexOffset;
+                pabyDst[i] = poGDS->pabyPrecomputed[4 * nIndex + nBand - 1];
+            }
+        }
+        else
+        {
+            const float *pafSrc = apafSrcBuf[iBuffer].get() + nOffset;
+            int anComponents[4] = {0, 0, 0, 0};
+            for (size_t i = 0; i < nCount; i++)
+            {
+                GDALColorReliefGetRGBA(
+                    poGDS->asColorAssociation, pafSrc[i],
+                    poGDS->eColorSelectionMode, &anComponents[0],
+                    &anComponents[1], &anComponents[2], &anComponents[3]);
+                pabyDst[i] = static_cast<GByte>(anComponents[nBand - 1]);
+            }
+        }
+    };
+
+    const auto WriteChunk =
+        [nYOff, nYSize, nXSize, pData, eBufType, nPixelSpace, nLineSpace,
+         psExtraArg,
+         &apabyOutputBuf](int iBuffer, int nChunkYOff, int nChunkYSize)
+    {
+        for (int iY = 0; iY < nChunkYSize; ++iY)
+        {
+            GDALCopyWords64(apabyOutputBuf[iBuffer].get() +
+                                static_cast<size_t>(iY) * nXSize,
+                            GDT_Byte, 1,
+                            static_cast<GByte *>(pData) +
+                                (nChunkYOff - nYOff + iY) * nLineSpace,
+                            eBufType, static_cast<int>(nPixelSpace), nXSize);
+        }
+        if (psExtraArg && psExtraArg->pfnProgress &&
+            !psExtraArg->pfnProgress(
+                1.0 * (nChunkYOff + nChunkYSize - nYOff) / nYSize, "",
+                psExtraArg->pProgressData))
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+            return false;
+        }
+        return true;
+    };
+
+    return GDALDEMProcessChunks(nYOff, nYSize, nChunkLines, poGDS->nThreads,
+                                ReadChunk, ComputeLines, WriteChunk);
+}
+
 GDALColorInterp GDALColorReliefRasterBand::GetColorInterpretation()
 {
     return static_cast<GDALColorInterp>(GCI_RedBand + nBand - 1);
@@ -2029,7 +2446,7 @@ static CPLErr
 GDALColorRelief(GDALRasterBandH hSrcBand, GDALRasterBandH hDstBand1,
                 GDALRasterBandH hDstBand2, GDALRasterBandH hDstBand3,
                 GDALRasterBandH hDstBand4, const char *pszColorFilename,
-                ColorSelectionMode eColorSelectionMode,
+                ColorSelectionMode eColorSelectionMode, int nThreads,
                 GDALProgressFunc pfnProgress, void *pProgressData)
 {
     if (hSrcBand == nullptr || hDstBand1 == nullptr || hDstBand2 == nullptr ||
@@ -2060,26 +2477,19 @@ GDALColorRelief(GDALRasterBandH hSrcBand, GDALRasterBandH hDstBand1,
     const int nXSize = GDALGetRasterBandXSize(hSrcBand);
     const int nYSize = GDALGetRasterBandYSize(hSrcBand);
 
-    std::unique_ptr<float, VSIFreeReleaser> pafSourceBuf;
-    std::unique_ptr<int, VSIFreeReleaser> panSourceBuf;
-    if (pabyPrecomputed)
-        panSourceBuf.reset(
-            static_cast<int *>(VSI_MALLOC2_VERBOSE(sizeof(int), nXSize)));
-    else
-        pafSourceBuf.reset(
-            static_cast<float *>(VSI_MALLOC2_VERBOSE(sizeof(float), nXSize)));
-    std::unique_ptr<GByte, VSIFreeReleaser> pabyDestBuf(
-        static_cast<GByte *>(VSI_MALLOC2_VERBOSE(4, nXSize)));
-    GByte *pabyDestBuf1 = pabyDestBuf.get();
-    GByte *pabyDestBuf2 = pabyDestBuf1 ? pabyDestBuf1 + nXSize : nullptr;
-    GByte *pabyDestBuf3 = pabyDestBuf2 ? pabyDestBuf2 + nXSize : nullptr;
-    GByte *pabyDestBuf4 = pabyDestBuf3 ? pabyDestBuf3 + nXSize : nullptr;
-
-    if ((pabyPrecomputed != nullptr && panSourceBuf == nullptr) ||
-        (pabyPrecomputed == nullptr && pafSourceBuf == nullptr) ||
-        pabyDestBuf1 == nullptr)
+    // int and float have the same size
+    const int nChunkLines =
+        GDALDEMGetChunkLineCount(nYSize, nXSize * sizeof(float), nThreads);
+    std::unique_ptr<float, VSIFreeReleaser> apafSourceBuf[2];
+    std::unique_ptr<GByte, VSIFreeReleaser> apabyDestBuf[2];
+    for (int i = 0; i < 2; ++i)
     {
-        return CE_Failure;
+        apafSourceBuf[i].reset(static_cast<float *>(
+            VSI_MALLOC3_VERBOSE(sizeof(float), nXSize, nChunkLines)));
+        apabyDestBuf[i].reset(static_cast<GByte *>(
+            VSI_MALLOC3_VERBOSE(4, nXSize, nChunkLines)));
+        if (!apafSourceBuf[i] || !apabyDestBuf[i])
+            return CE_Failure;
     }
 
     if (!pfnProgress(0.0, nullptr, pProgressData))
@@ -2088,29 +2498,41 @@ GDALColorRelief(GDALRasterBandH hSrcBand, GDALRasterBandH hDstBand1,
         return CE_Failure;
     }
 
-    int nR = 0;
-    int nG = 0;
-    int nB = 0;
-    int nA = 0;
-
-    for (int i = 0; i < nYSize; i++)
+    const bool bUsePrecomputed = pabyPrecomputed != nullptr;
+    const auto ReadChunk = [hSrcBand, nXSize, bUsePrecomputed, &apafSourceBuf](
+                               int iBuffer, int nChunkYOff, int nChunkYSize)
     {
-        /* Read source buffer */
-        CPLErr eErr = GDALRasterIO(
-            hSrcBand, GF_Read, 0, i, nXSize, 1,
-            panSourceBuf ? static_cast<void *>(panSourceBuf.get())
-                         : static_cast<void *>(pafSourceBuf.get()),
-            nXSize, 1, panSourceBuf ? GDT_Int32 : GDT_Float32, 0, 0);
-        if (eErr != CE_None)
-        {
-            return eErr;
-        }
+        return GDALRasterIO(hSrcBand, GF_Read, 0, nChunkYOff, nXSize,
+                            nChunkYSize, apafSourceBuf[iBuffer].get(), nXSize,
+                            nChunkYSize,
+                            bUsePrecomputed ? GDT_Int32 : GDT_Float32, 0,
+                            0) == CE_None;
+    };
 
+    // Each chunk of the destination buffer holds the 4 components, one after
+    // the other, each of them of nChunkLines lines.
+    const size_t nComponentSize = static_cast<size_t>(nXSize) * nChunkLines;
+    const auto ComputeLines =
+        [nXSize, nIndexOffset, nComponentSize, eColorSelectionMode,
+         &asColorAssociation, &pabyPrecomputed, &apafSourceBuf,
+         &apabyDestBuf](int iBuffer, int nChunkYOff, int nStartLine,
+                        int nEndLine)
+    {
+        const size_t nOffset =
+            static_cast<size_t>(nStartLine - nChunkYOff) * nXSize;
+        const size_t nCount =
+            static_cast<size_t>(nEndLine - nStartLine) * nXSize;
+        GByte *pabyDestBuf1 = apabyDestBuf[iBuffer].get() + nOffset;
+        GByte *pabyDestBuf2 = pabyDestBuf1 + nComponentSize;
+        GByte *pabyDestBuf3 = pabyDestBuf2 + nComponentSize;
+        GByte *pabyDestBuf4 = pabyDestBuf3 + nComponentSize;
         if (pabyPrecomputed)
         {
             const auto pabyPrecomputedRaw = pabyPrecomputed.get();
-            const auto panSourceBufRaw = panSourceBuf.get();
-            for (int j = 0; j < nXSize; j++)
+            const int *panSourceBufRaw =
+                reinterpret_cast<const int *>(apafSourceBuf[iBuffer].get()) +
+                nOffset;
+            for (size_t j = 0; j < nCount; j++)
             {
                 int nIndex = panSourceBufRaw[j] + nIndexOffset;
                 pabyDestBuf1[j] = pabyPrecomputedRaw[4 * nIndex];
@@ -2121,8 +2543,13 @@ GDALColorRelief(GDALRasterBandH hSrcBand, GDALRasterBandH hDstBand1,
         }
         else
         {
-            const auto pafSourceBufRaw = pafSourceBuf.get();
-            for (int j = 0; j < nXSize; j++)
+            const float *pafSourceBufRaw =
+                apafSourceBuf[iBuffer].get() + nOffset;
+            int nR = 0;
+            int nG = 0;
+            int nB = 0;
+            int nA = 0;
+            for (size_t j = 0; j < nCount; j++)
             {
                 GDALColorReliefGetRGBA(asColorAssociation, pafSourceBufRaw[j],
                                        eColorSelectionMode, &nR, &nG, &nB, &nA);
@@ -2132,38 +2559,40 @@ GDALColorRelief(GDALRasterBandH hSrcBand, GDALRasterBandH hDstBand1,
                 pabyDestBuf4[j] = static_cast<GByte>(nA);
             }
         }
+    };
 
-        /* -----------------------------------------
-         * Write Line to Raster
-         */
-        eErr = GDALRasterIO(hDstBand1, GF_Write, 0, i, nXSize, 1, pabyDestBuf1,
-                            nXSize, 1, GDT_Byte, 0, 0);
-        if (eErr == CE_None)
-        {
-            eErr = GDALRasterIO(hDstBand2, GF_Write, 0, i, nXSize, 1,
-                                pabyDestBuf2, nXSize, 1, GDT_Byte, 0, 0);
-        }
-        if (eErr == CE_None)
-        {
-            eErr = GDALRasterIO(hDstBand3, GF_Write, 0, i, nXSize, 1,
-                                pabyDestBuf3, nXSize, 1, GDT_Byte, 0, 0);
-        }
-        if (eErr == CE_None && hDstBand4)
+    const auto WriteChunk =
+        [hDstBand1, hDstBand2, hDstBand3, hDstBand4, nXSize, nYSize,
+         nComponentSize, &apabyDestBuf, pfnProgress,
+         pProgressData](int iBuffer, int nChunkYOff, int nChunkYSize)
+    {
+        GDALRasterBandH ahDstBand[] = {hDstBand1, hDstBand2, hDstBand3,
+                                       hDstBand4};
+        for (int iComp = 0; iComp < 4; ++iComp)
         {
-            eErr = GDALRasterIO(hDstBand4, GF_Write, 0, i, nXSize, 1,
-                                pabyDestBuf4, nXSize, 1, GDT_Byte, 0, 0);
+            if (ahDstBand[iComp] &&
+                GDALRasterIO(ahDstBand[iComp], GF_Write, 0, nChunkYOff, nXSize,
+                             nChunkYSize,
+                             apabyDestBuf[iBuffer].get() +
+                                 iComp * nComponentSize,
+                             nXSize, nChunkYSize, GDT_Byte, 0, 0) != CE_None)
+            {
+                return false;
+            }
         }
-
-        if (eErr == CE_None &&
-            !pfnProgress(1.0 * (i + 1) / nYSize, nullptr, pProgressData))
+        if (!pfnProgress(1.0 * (nChunkYOff + nChunkYSize) / nYSize, nullptr,
+                         pProgressData))
         {
             CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
-            eErr = CE_Failure;
-        }
-        if (eErr != CE_None)
-        {
-            return eErr;
+            return false;
         }
+        return true;
+    };
+
+    if (!GDALDEMProcessChunks(0, nYSize, nChunkLines, nThreads, ReadChunk,
+                              ComputeLines, WriteChunk))
+    {
+        return CE_Failure;
     }
 
     pfnProgress(1.0, nullptr, pProgressData);
@@ -2443,6 +2872,7 @@ template <class T> class GDALGeneric3x3Dataset final : public GDALDataset
     int nCurLine = -1;
     const bool bComputeAtEdges;
     const bool bTakeReference;
+    const int nThreads;
 
     using GDALDatasetRefCountedPtr =
         std::unique_ptr<GDALDataset, GDALDatasetUniquePtrReleaser>;
@@ -2459,7 +2889,7 @@ template <class T> class GDALGeneric3x3Dataset final : public GDALDataset
         typename GDALGeneric3x3ProcessingAlg_multisample<T>::type
             pfnAlg_multisample,
         std::unique_ptr<AlgorithmParameters> pAlgData, bool bComputeAtEdges,
-        bool bTakeReferenceIn);
+        bool bTakeReferenceIn, int nThreadsIn);
     ~GDALGeneric3x3Dataset();
 
     bool InitOK() const
@@ -2488,11 +2918,19 @@ template <class T> class GDALGeneric3x3RasterBand final : public GDALRasterBand
 
     void InitWithNoData(void *pImage);
 
+    bool ComputeLinesMultiThreaded(int nYOff, int nYSize, void *pData,
+                                   GDALDataType eBufType, GSpacing nPixelSpace,
+                                   GSpacing nLineSpace,
+                                   GDALRasterIOExtraArg *psExtraArg);
+
   public:
     GDALGeneric3x3RasterBand(GDALGeneric3x3Dataset<T> *poDSIn,
                              GDALDataType eDstDataType);
 
     virtual CPLErr IReadBlock(int, int, void *) override;
+    virtual CPLErr IRasterIO(GDALRWFlag, int, int, int, int, void *, int, int,
+                             GDALDataType, GSpacing, GSpacing,
+                             GDALRasterIOExtraArg *psExtraArg) override;
     virtual double GetNoDataValue(int *pbHasNoData) override;
 
     int GetOverviewCount() override
@@ -2518,11 +2956,12 @@ GDALGeneric3x3Dataset<T>::GDALGeneric3x3Dataset(
     typename GDALGeneric3x3ProcessingAlg_multisample<T>::type
         pfnAlg_multisampleIn,
     std::unique_ptr<AlgorithmParameters> pAlgDataIn, bool bComputeAtEdgesIn,
-    bool bTakeReferenceIn)
+    bool bTakeReferenceIn, int nThreadsIn)
     : pfnAlg(pfnAlgIn), pfnAlg_multisample(pfnAlg_multisampleIn),
       pAlgData(std::move(pAlgDataIn)), hSrcDS(hSrcDSIn), hSrcBand(hSrcBandIn),
       bDstHasNoData(bDstHasNoDataIn), dfDstNoDataValue(dfDstNoDataValueIn),
-      bComputeAtEdges(bComputeAtEdgesIn), bTakeReference(bTakeReferenceIn)
+      bComputeAtEdges(bComputeAtEdgesIn), bTakeReference(bTakeReferenceIn),
+      nThreads(nThreadsIn)
 {
     CPLAssert(eDstDataType == GDT_Byte || eDstDataType == GDT_Float32);
 
@@ -2563,7 +3002,7 @@ GDALGeneric3x3Dataset<T>::GDALGeneric3x3Dataset(
                                static_cast<double>(nRasterYSize) /
                                    GDALGetRasterYSize(hOvrDS))
                          : nullptr,
-                bComputeAtEdges, false);
+                bComputeAtEdges, false, nThreads);
             if (poOvrDS->InitOK())
             {
                 m_apoOverviewDS.emplace_back(poOvrDS.release());
@@ -2936,7 +3375,8 @@ CPLErr GDALGeneric3x3RasterBand<T>::IReadBlock(int /*nBlockXOff*/,
     {
         j = poGDS->pfnAlg_multisample(
             poGDS->apafSourceBuf[0], poGDS->apafSourceBuf[1],
-            poGDS->apafSourceBuf[2], nRasterXSize, poGDS->pAlgData.get(),
+            poGDS->apafSourceBuf[2], nRasterXSize,
+            static_cast<float>(poGDS->dfDstNoDataValue), poGDS->pAlgData.get(),
             poGDS->pafOutputBuf ? poGDS->pafOutputBuf.get()
                                 : static_cast<float *>(pImage));
 
@@ -2972,6 +3412,182 @@ CPLErr GDALGeneric3x3RasterBand<T>::IReadBlock(int /*nBlockXOff*/,
     return CE_None;
 }
 
+/************************************************************************/
+/*                             IRasterIO()                              */
+/************************************************************************/
+
+template <class T>
+CPLErr GDALGeneric3x3RasterBand<T>::IRasterIO(
+    GDALRWFlag eRWFlag, int nXOff, int nYOff, int nXSize, int nYSize,
+    void *pData, int nBufXSize, int nBufYSize, GDALDataType eBufType,
+    GSpacing nPixelSpace, GSpacing nLineSpace,
+    GDALRasterIOExtraArg *psExtraArg)
+{
+    auto poGDS = cpl::down_cast<GDALGeneric3x3Dataset<T> *>(poDS);
+
+    // Requests of several whole lines, without resampling, are computed in
+    // parallel when several threads are allowed.
+    if (eRWFlag == GF_Read && poGDS->nThreads > 1 && nXOff == 0 &&
+        nXSize == nRasterXSize && nBufXSize == nXSize && nBufYSize == nYSize &&
+        nYSize > 1)
+    {
+        return ComputeLinesMultiThreaded(nYOff, nYSize, pData, eBufType,
+                                         nPixelSpace, nLineSpace, psExtraArg)
+                   ? CE_None
+                   : CE_Failure;
+    }
+
+    return GDALRasterBand::IRasterIO(eRWFlag, nXOff, nYOff, nXSize, nYSize,
+                                     pData, nBufXSize, nBufYSize, eBufType,
+                                     nPixelSpace, nLineSpace, psExtraArg);
+}
+
+/************************************************************************/
+/*                     ComputeLinesMultiThreaded()                      */
+/************************************************************************/
+
+template <class T>
+bool GDALGeneric3x3RasterBand<T>::ComputeLinesMultiThreaded(
+    int nYOff, int nYSize, void *pData, GDALDataType eBufType,
+    GSpacing nPixelSpace, GSpacing nLineSpace,
+    GDALRasterIOExtraArg *psExtraArg)
+{
+    auto poGDS = cpl::down_cast<GDALGeneric3x3Dataset<T> *>(poDS);
+
+    GDALGeneric3x3Kernel<T> oKernel;
+    oKernel.pfnAlg = poGDS->pfnAlg;
+    // Same condition as in IReadBlock()
+    oKernel.pfnAlg_multisample =
+        (eDataType == GDT_Float32 || poGDS->pafOutputBuf)
+            ? poGDS->pfnAlg_multisample
+            : nullptr;
+    oKernel.pData = poGDS->pAlgData.get();
+    oKernel.nXSize = nRasterXSize;
+    oKernel.nYSize = nRasterYSize;
+    oKernel.bSrcHasNoData = CPL_TO_BOOL(bSrcHasNoData);
+    oKernel.fSrcNoDataValue = fSrcNoDataValue;
+    oKernel.bIsSrcNoDataNan = bIsSrcNoDataNan;
+    oKernel.fDstNoDataValue = static_cast<float>(poGDS->dfDstNoDataValue);
+    oKernel.bComputeAtEdges = poGDS->bComputeAtEdges;
+
+    const int nXSize = nRasterXSize;
+    const int nChunkLines = GDALDEMGetChunkLineCount(nYSize, nXSize * sizeof(T),
+                                                     poGDS->nThreads);
+    const int nDTSize = GDALGetDataTypeSizeBytes(eDataType);
+    std::unique_ptr<T, VSIFreeReleaser> apafSrcBuf[2];
+    std::unique_ptr<float, VSIFreeReleaser> apafOutputBuf[2];
+    std::unique_ptr<GByte, VSIFreeReleaser> apabyOutputBuf[2];
+    std::vector<int> anMultiSampleEnd[2];
+    int anSrcYOff[2] = {0, 0};
+    try
+    {
+        for (int i = 0; i < 2; ++i)
+        {
+            apafSrcBuf[i].reset(static_cast<T *>(
+                VSI_MALLOC3_VERBOSE(sizeof(T), nXSize, nChunkLines + 2)));
+            apafOutputBuf[i].reset(static_cast<float *>(
+                VSI_MALLOC3_VERBOSE(sizeof(float), nXSize, nChunkLines)));
+            if (!apafSrcBuf[i] || !apafOutputBuf[i])
+                return false;
+            if (eDataType == GDT_Byte)
+            {
+                apabyOutputBuf[i].reset(static_cast<GByte *>(
+                    VSI_MALLOC2_VERBOSE(nXSize, nChunkLines)));
+                if (!apabyOutputBuf[i])
+                    return false;
+            }
+            anMultiSampleEnd[i].resize(nChunkLines);
+        }
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory, "Out of memory");
+        return false;
+    }
+
+    const auto ReadChunk = [this, poGDS, nXSize, &apafSrcBuf,
+                            &anSrcYOff](int iBuffer, int nChunkYOff,
+                                        int nChunkYSize)
+    {
+        const int nSrcYOff = std::max(0, nChunkYOff - 1);
+        const int nSrcYEnd =
+            std::min(nRasterYSize, nChunkYOff + nChunkYSize + 1);
+        anSrcYOff[iBuffer] = nSrcYOff;
+        return GDALRasterIO(poGDS->hSrcBand, GF_Read, 0, nSrcYOff, nXSize,
+                            nSrcYEnd - nSrcYOff, apafSrcBuf[iBuffer].get(),
+                            nXSize, nSrcYEnd - nSrcYOff, eReadDT, 0,
+                            0) == CE_None;
+    };
+
+    const auto ComputeLines =
+        [this, &oKernel, nXSize, &apafSrcBuf, &apafOutputBuf, &apabyOutputBuf,
+         &anMultiSampleEnd, &anSrcYOff](int iBuffer, int nChunkYOff,
+                                        int nStartLine, int nEndLine)
+    {
+        const size_t nOffset =
+            static_cast<size_t>(nStartLine - nChunkYOff) * nXSize;
+        int *panMultiSampleEnd =
+            anMultiSampleEnd[iBuffer].data() + (nStartLine - nChunkYOff);
+        oKernel.ComputeLines(apafSrcBuf[iBuffer].get(), anSrcYOff[iBuffer],
+                             nStartLine, nEndLine,
+                             apafOutputBuf[iBuffer].get() + nOffset,
+                             panMultiSampleEnd);
+        if (eDataType == GDT_Byte)
+        {
+            // Same rounding as in IReadBlock()
+            for (int iY = 0; iY < nEndLine - nStartLine; ++iY)
+            {
+                const size_t nLineOffset =
+                    nOffset + static_cast<size_t>(iY) * nXSize;
+                const float *pafLine =
+                    apafOutputBuf[iBuffer].get() + nLineOffset;
+                GByte *pabyLine = apabyOutputBuf[iBuffer].get() + nLineOffset;
+                for (int j = 0; j < nXSize; j++)
+                    pabyLine[j] = static_cast<GByte>(pafLine[j] + 0.5);
+                if (panMultiSampleEnd[iY] > 1)
+                {
+                    GDALCopyWords64(pafLine + 1, GDT_Float32,
+                                    static_cast<int>(sizeof(float)),
+                                    pabyLine + 1, GDT_Byte, 1,
+                                    panMultiSampleEnd[iY] - 1);
+                }
+            }
+        }
+    };
+
+    const auto WriteChunk =
+        [this, nYOff, nYSize, nXSize, nDTSize, pData, eBufType, nPixelSpace,
+         nLineSpace, psExtraArg, &apafOutputBuf,
+         &apabyOutputBuf](int iBuffer, int nChunkYOff, int nChunkYSize)
+    {
+        const GByte *pabySrc =
+            eDataType == GDT_Byte
+                ? apabyOutputBuf[iBuffer].get()
+                : reinterpret_cast<const GByte *>(apafOutputBuf[iBuffer].get());
+        for (int iY = 0; iY < nChunkYSize; ++iY)
+        {
+            GDALCopyWords64(pabySrc +
+                                static_cast<size_t>(iY) * nXSize * nDTSize,
+                            eDataType, nDTSize,
+                            static_cast<GByte *>(pData) +
+                                (nChunkYOff - nYOff + iY) * nLineSpace,
+                            eBufType, static_cast<int>(nPixelSpace), nXSize);
+        }
+        if (psExtraArg && psExtraArg->pfnProgress &&
+            !psExtraArg->pfnProgress(
+                1.0 * (nChunkYOff + nChunkYSize - nYOff) / nYSize, "",
+                psExtraArg->pProgressData))
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+            return false;
+        }
+        return true;
+    };
+
+    return GDALDEMProcessChunks(nYOff, nYSize, nChunkLines, poGDS->nThreads,
+                                ReadChunk, ComputeLines, WriteChunk);
+}
+
 template <class T>
 double GDALGeneric3x3RasterBand<T>::GetNoDataValue(int *pbHasNoData)
 {
@@ -3071,6 +3687,11 @@ static std::unique_ptr<GDALArgumentParser> GDALDEMAppOptionsGetParser(
 
         subParser->add_creation_options_argument(psOptions->aosCreationOptions);
 
+        subParser->add_argument("-num_threads")
+            .metavar("<value>")
+            .store_into(psOptions->osNumThreads)
+            .help(_("Number of threads to use (or ALL_CPUS)."));
+
         if (psOptionsForBinary)
         {
             subParser->add_quiet_argument(&psOptionsForBinary->bQuiet);
@@ -3793,6 +4414,11 @@ GDALDatasetH GDALDEMProcessing(const char *pszDest, GDALDatasetH hSrcDataset,
         pfnAlgFloat_multisample = nullptr;
     GDALGeneric3x3ProcessingAlg_multisample<GInt32>::type
         pfnAlgInt32_multisample = nullptr;
+#ifdef HAVE_16_SSE_REG
+    // Vectorized code paths can be disabled, mostly for benchmarking.
+    const bool bUseSSE2 =
+        CPLTestBool(CPLGetConfigOption("GDAL_USE_SSE2", "YES"));
+#endif
 
     if (eUtilityMode == HILL_SHADE && psOptions->bMultiDirectional)
     {
@@ -3849,6 +4475,15 @@ GDALDatasetH GDALDEMProcessing(const char *pszDest, GDALDatasetH hSrcDataset,
                     GDALHillshadeAlg<float, GradientAlg::ZEVENBERGEN_THORNE>;
                 pfnAlgInt32 =
                     GDALHillshadeAlg<GInt32, GradientAlg::ZEVENBERGEN_THORNE>;
+#ifdef HAVE_16_SSE_REG
+                if (bUseSSE2)
+                {
+                    pfnAlgFloat_multisample = GDALHillshadeAlg_multisample<
+                        float, XMMReg4Float, GradientAlg::ZEVENBERGEN_THORNE>;
+                    pfnAlgInt32_multisample = GDALHillshadeAlg_multisample<
+                        GInt32, XMMReg4Int, GradientAlg::ZEVENBERGEN_THORNE>;
+                }
+#endif
             }
         }
         else
@@ -3873,18 +4508,32 @@ GDALDatasetH GDALDEMProcessing(const char *pszDest, GDALDatasetH hSrcDataset,
                     pfnAlgFloat = GDALHillshadeAlg_same_res<float>;
                     pfnAlgInt32 = GDALHillshadeAlg_same_res<GInt32>;
 #ifdef HAVE_16_SSE_REG
-                    pfnAlgFloat_multisample =
-                        GDALHillshadeAlg_same_res_multisample<float,
-                                                              XMMReg4Float>;
-                    pfnAlgInt32_multisample =
-                        GDALHillshadeAlg_same_res_multisample<GInt32,
-                                                              XMMReg4Int>;
+                    if (bUseSSE2)
+                    {
+                        pfnAlgFloat_multisample =
+                            GDALHillshadeAlg_same_res_multisample<float,
+                                                                  XMMReg4Float>;
+                        pfnAlgInt32_multisample =
+                            GDALHillshadeAlg_same_res_multisample<GInt32,
+                                                                  XMMReg4Int>;
+                    }
 #endif
                 }
                 else
                 {
                     pfnAlgFloat = GDALHillshadeAlg<float, GradientAlg::HORN>;
                     pfnAlgInt32 = GDALHillshadeAlg<GInt32, GradientAlg::HORN>;
+#ifdef HAVE_16_SSE_REG
+                    if (bUseSSE2)
+                    {
+                        pfnAlgFloat_multisample =
+                            GDALHillshadeAlg_multisample<float, XMMReg4Float,
+                                                         GradientAlg::HORN>;
+                        pfnAlgInt32_multisample =
+                            GDALHillshadeAlg_multisample<GInt32, XMMReg4Int,
+                                                         GradientAlg::HORN>;
+                    }
+#endif
                 }
             }
         }
@@ -3901,11 +4550,33 @@ GDALDatasetH GDALDEMProcessing(const char *pszDest, GDALDatasetH hSrcDataset,
         {
             pfnAlgFloat = GDALSlopeZevenbergenThorneAlg<float>;
             pfnAlgInt32 = GDALSlopeZevenbergenThorneAlg<GInt32>;
+#ifdef HAVE_16_SSE_REG
+            if (bUseSSE2)
+            {
+                pfnAlgFloat_multisample =
+                    GDALSlopeAlg_multisample<float, XMMReg4Float,
+                                             GradientAlg::ZEVENBERGEN_THORNE>;
+                pfnAlgInt32_multisample =
+                    GDALSlopeAlg_multisample<GInt32, XMMReg4Int,
+                                             GradientAlg::ZEVENBERGEN_THORNE>;
+            }
+#endif
         }
         else
         {
             pfnAlgFloat = GDALSlopeHornAlg<float>;
             pfnAlgInt32 = GDALSlopeHornAlg<GInt32>;
+#ifdef HAVE_16_SSE_REG
+            if (bUseSSE2)
+            {
+                pfnAlgFloat_multisample =
+                    GDALSlopeAlg_multisample<float, XMMReg4Float,
+                                             GradientAlg::HORN>;
+                pfnAlgInt32_multisample =
+                    GDALSlopeAlg_multisample<GInt32, XMMReg4Int,
+                                             GradientAlg::HORN>;
+            }
+#endif
         }
     }
 
@@ -3922,11 +4593,33 @@ GDALDatasetH GDALDEMProcessing(const char *pszDest, GDALDatasetH hSrcDataset,
         {
             pfnAlgFloat = GDALAspectZevenbergenThorneAlg<float>;
             pfnAlgInt32 = GDALAspectZevenbergenThorneAlg<GInt32>;
+#ifdef HAVE_16_SSE_REG
+            if (bUseSSE2)
+            {
+                pfnAlgFloat_multisample =
+                    GDALAspectAlg_multisample<float, XMMReg4Float,
+                                              GradientAlg::ZEVENBERGEN_THORNE>;
+                pfnAlgInt32_multisample =
+                    GDALAspectAlg_multisample<GInt32, XMMReg4Int,
+                                              GradientAlg::ZEVENBERGEN_THORNE>;
+            }
+#endif
         }
         else
         {
             pfnAlgFloat = GDALAspectAlg<float>;
             pfnAlgInt32 = GDALAspectAlg<GInt32>;
+#ifdef HAVE_16_SSE_REG
+            if (bUseSSE2)
+            {
+                pfnAlgFloat_multisample =
+                    GDALAspectAlg_multisample<float, XMMReg4Float,
+                                              GradientAlg::HORN>;
+                pfnAlgInt32_multisample =
+                    GDALAspectAlg_multisample<GInt32, XMMReg4Int,
+                                              GradientAlg::HORN>;
+            }
+#endif
         }
     }
     else if (eUtilityMode == TRI)
@@ -4003,6 +4696,10 @@ GDALDatasetH GDALDEMProcessing(const char *pszDest, GDALDatasetH hSrcDataset,
         }
     }
 
+    const int nThreads = GDALGetNumThreads(
+        psOptions->osNumThreads.empty() ? nullptr
+                                        : psOptions->osNumThreads.c_str());
+
     // We might actually want to always go through the intermediate dataset
     bool bForceUseIntermediateDataset = false;
 
@@ -4055,7 +4752,7 @@ GDALDatasetH GDALDEMProcessing(const char *pszDest, GDALDatasetH hSrcDataset,
         {
             auto poDS = std::make_unique<GDALColorReliefDataset>(
                 hSrcDataset, hSrcBand, pszColorFilename,
-                psOptions->eColorSelectionMode, psOptions->bAddAlpha);
+                psOptions->eColorSelectionMode, psOptions->bAddAlpha, nThreads);
             if (!(poDS->InitOK()))
             {
                 return nullptr;
@@ -4070,7 +4767,8 @@ GDALDatasetH GDALDEMProcessing(const char *pszDest, GDALDatasetH hSrcDataset,
                 auto poDS = std::make_unique<GDALGeneric3x3Dataset<GInt32>>(
                     hSrcDataset, hSrcBand, eDstDataType, bDstHasNoData,
                     dfDstNoDataValue, pfnAlgInt32, pfnAlgInt32_multisample,
-                    std::move(pData), psOptions->bComputeAtEdges, true);
+                    std::move(pData), psOptions->bComputeAtEdges, true,
+                    nThreads);
 
                 if (!(poDS->InitOK()))
                 {
@@ -4083,7 +4781,8 @@ GDALDatasetH GDALDEMProcessing(const char *pszDest, GDALDatasetH hSrcDataset,
                 auto poDS = std::make_unique<GDALGeneric3x3Dataset<float>>(
                     hSrcDataset, hSrcBand, eDstDataType, bDstHasNoData,
                     dfDstNoDataValue, pfnAlgFloat, pfnAlgFloat_multisample,
-                    std::move(pData), psOptions->bComputeAtEdges, true);
+                    std::move(pData), psOptions->bComputeAtEdges, true,
+                    nThreads);
 
                 if (!(poDS->InitOK()))
                 {
@@ -4134,7 +4833,7 @@ GDALDatasetH GDALDEMProcessing(const char *pszDest, GDALDatasetH hSrcDataset,
                         psOptions->bAddAlpha ? GDALGetRasterBand(hDstDataset, 4)
                                              : nullptr,
                         pszColorFilename, psOptions->eColorSelectionMode,
-                        pfnProgress, pProgressData);
+                        nThreads, pfnProgress, pProgressData);
     }
     else
     {
@@ -4145,15 +4844,15 @@ GDALDatasetH GDALDEMProcessing(const char *pszDest, GDALDatasetH hSrcDataset,
         {
             GDALGeneric3x3Processing<GInt32>(
                 hSrcBand, hDstBand, pfnAlgInt32, pfnAlgInt32_multisample,
-                std::move(pData), psOptions->bComputeAtEdges, pfnProgress,
-                pProgressData);
+                std::move(pData), psOptions->bComputeAtEdges, nThreads,
+                pfnProgress, pProgressData);
         }
         else
         {
             GDALGeneric3x3Processing<float>(
                 hSrcBand, hDstBand, pfnAlgFloat, pfnAlgFloat_multisample,
-                std::move(pData), psOptions->bComputeAtEdges, pfnProgress,
-                pProgressData);
+                std::move(pData), psOptions->bComputeAtEdges, nThreads,
+                pfnProgress, pProgressData);
         }
     }
 
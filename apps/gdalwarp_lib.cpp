@@ -3150,7 +3150,39 @@ GDALWarpDirect(const char *pszDest, GDALDatasetH hDstDS, int nSrcCount,
         /*      acceptable error is zero. */
         /* --------------------------------------------------------------------
          */
-        if (bUseApproxTransformer)
+        const char *pszCoordGridCacheDir =
+            psOptions->aosTransformerOptions.FetchNameValue(
+                "COORD_GRID_CACHE_DIR");
+        if (bUseApproxTransformer &&
+            (pszCoordGridCacheDir ||
+             psOptions->aosTransformerOptions.FetchBool("COORD_GRID", false)))
+        {
+            // Use a grid of source coordinates instead, that can be reused
+            // by all chunks, and by subsequent runs if it is persisted.
+            CPLStringList aosCoordGridOptions;
+            if (const char *pszStep =
+                    psOptions->aosTransformerOptions.FetchNameValue(
+                        "COORD_GRID_STEP"))
+                aosCoordGridOptions.SetNameValue("STEP", pszStep);
+            if (pszCoordGridCacheDir)
+                aosCoordGridOptions.SetNameValue("CACHE_DIR",
+                                                 pszCoordGridCacheDir);
+            void *hCoordGridArg = GDALCreateCoordGridTransformer(
+                GDALGenImgProjTransform, hTransformArg.get(),
+                psOptions->dfErrorThreshold, aosCoordGridOptions.List());
+            if (hCoordGridArg == nullptr)
+            {
+                GDALReleaseDataset(hWrkSrcDS);
+                GDALReleaseDataset(hDstDS);
+                return nullptr;
+            }
+            hTransformArg.release();
+            hTransformArg.reset(hCoordGridArg);
+            pfnTransformer = GDALCoordGridTransform;
+            GDALCoordGridTransformerOwnsSubtransformer(hTransformArg.get(),
+                                                       TRUE);
+        }
+        else if (bUseApproxTransformer)
         {
             hTransformArg.reset(GDALCreateApproxTransformer(
                 GDALGenImgProjTransform, hTransformArg.release(),
@@ -607,3 +607,43 @@ cellsize     1
             elev_values.append((f["ELEV_MIN"], f["ELEV_MAX"]))
 
         assert elev_values == expected_elev_values, (elev_values, expected_elev_values)
+
+
+###############################################################################
+# Test that the output does not depend on the number of threads
+
+
+@pytest.mark.parametrize("polygonize", [False, True])
+def test_contour_num_threads(polygonize):
+
+    src_ds = gdal.Open("data/contour_in.tif")
+
+    def run(num_threads):
+        ogr_ds = ogr.GetDriverByName("MEM").CreateDataSource("")
+        lyr = ogr_ds.CreateLayer("contour")
+        lyr.CreateField(ogr.FieldDefn("ID", ogr.OFTInteger))
+        lyr.CreateField(ogr.FieldDefn("ELEV_MIN", ogr.OFTReal))
+        lyr.CreateField(ogr.FieldDefn("ELEV_MAX", ogr.OFTReal))
+        assert (
+            gdal.ContourGenerateEx(
+                src_ds.GetRasterBand(1),
+                lyr,
+                options=[
+                    "LEVEL_INTERVAL=5",
+                    "ID_FIELD=0",
+                    "ELEV_FIELD_MIN=1",
+                    "ELEV_FIELD_MAX=2",
+                    f"POLYGONIZE={polygonize}",
+                    f"NUM_THREADS={num_threads}",
+                ],
+            )
+            == gdal.CE_None
+        )
+        return [
+            (f["ID"], f["ELEV_MIN"], f["ELEV_MAX"], f.GetGeometryRef().ExportToWkt())
+            for f in lyr
+        ]
+
+    ref = run(1)
+    assert len(ref) > 1
+    assert run(4) == ref
@@ -386,3 +386,94 @@ def test_fillnodata_nearest(
         for i in range(height)
     ]
     assert got == expected
+
+
+###############################################################################
+# Test that the result does not depend on the number of threads
+
+
+@pytest.mark.parametrize("interpolation", ["INV_DIST", "NEAREST"])
+def test_fillnodata_num_threads(interpolation):
+
+    def pixel_value(x, y):
+        if (x * 7 + y * 3) % 11 < 6:
+            return 0
+        return (x * 31 + y * 17) % 100 + 1
+
+    width = 50
+    height = 500
+    ar = array.array(
+        "f", [pixel_value(x, y) for y in range(height) for x in range(width)]
+    )
+
+    results = []
+    for num_threads in (1, 4):
+        ds = gdal.GetDriverByName("MEM").Create(
+            "", width, height, 1, gdal.GDT_Float32
+        )
+        ds.GetRasterBand(1).SetNoDataValue(0)
+        ds.WriteRaster(0, 0, width, height, ar.tobytes())
+        gdal.FillNodata(
+            targetBand=ds.GetRasterBand(1),
+            maskBand=None,
+            maxSearchDist=10,
+            smoothingIterations=20,
+            options=[
+                "INTERPOLATION=" + interpolation,
+                "NUM_THREADS=" + str(num_threads),
+            ],
+        )
+        results.append(ds.ReadRaster())
+
+    assert results[0] != ar.tobytes()
+    assert results[0] == results[1]
+
+
+###############################################################################
+# Test that the result does not depend on the number of threads when holes
+# straddle the boundaries of the batches of lines processed in parallel
+
+
+@pytest.mark.parametrize("interpolation", ["INV_DIST", "NEAREST"])
+@pytest.mark.parametrize("smoothing_iterations", [0, 3])
+def test_fillnodata_num_threads_holes_across_batches(
+    interpolation, smoothing_iterations
+):
+
+    width = 40
+    height = 200
+
+    def pixel_value(x, y):
+        # Holes of 13 lines, at offsets that are not multiple of the
+        # batch height
+        if 5 <= x < 35 and (y % 29) < 13:
+            return 0
+        return (x * 31 + y * 17) % 100 + 1
+
+    ar = array.array(
+        "f", [pixel_value(x, y) for y in range(height) for x in range(width)]
+    )
+
+    results = []
+    for num_threads in (1, 4):
+        ds = gdal.GetDriverByName("MEM").Create(
+            "", width, height, 1, gdal.GDT_Float32
+        )
+        ds.GetRasterBand(1).SetNoDataValue(0)
+        ds.WriteRaster(0, 0, width, height, ar.tobytes())
+        # Batches of 4 lines (one per thread)
+        with gdal.config_option("GDAL_FILLNODATA_BATCH_MAX_SIZE", "1"):
+            gdal.FillNodata(
+                targetBand=ds.GetRasterBand(1),
+                maskBand=None,
+                maxSearchDist=20,
+                smoothingIterations=smoothing_iterations,
+                options=[
+                    "INTERPOLATION=" + interpolation,
+                    "NUM_THREADS=" + str(num_threads),
+                ],
+            )
+        results.append(ds.ReadRaster())
+
+    assert results[0] != ar.tobytes()
+    assert results[0] == results[1]
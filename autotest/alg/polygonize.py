@@ -427,3 +427,57 @@ def test_polygonize_8():
         wkt
         == "POLYGON ((1 4,1 3,0 3,0 1,1 1,1 0,3 0,3 1,4 1,4 3,3 3,3 4,1 4),(1 3,3 3,3 1,1 1,1 3))"
     )
+
+
+###############################################################################
+# Test multi-threaded polygonization, with polygons crossing strip boundaries
+
+
+@pytest.mark.parametrize("is_int_polygonize", [True, False])
+@pytest.mark.parametrize("connectedness", [4, 8])
+def test_polygonize_num_threads(is_int_polygonize, connectedness):
+
+    width = 30
+    height = 2500
+    src_ds = gdal.GetDriverByName("MEM").Create("", width, height)
+    src_band = src_ds.GetRasterBand(1)
+    src_band.SetNoDataValue(255)
+    # Diagonal stripes, a first column spanning all the raster, and nodata
+    # holes
+    def pixel_value(x, y):
+        if x == 0:
+            return 5
+        if (x * 7 + y * 3) % 97 == 0:
+            return 255
+        return ((x + y) // 7) % 3
+
+    data = bytes(pixel_value(x, y) for y in range(height) for x in range(width))
+    src_band.WriteRaster(0, 0, width, height, data)
+
+    def polygonize(num_threads):
+        mem_ds = ogr.GetDriverByName("MEM").CreateDataSource("")
+        mem_layer = mem_ds.CreateLayer("poly", None, ogr.wkbPolygon)
+        mem_layer.CreateField(ogr.FieldDefn("DN", ogr.OFTInteger))
+        options = [f"NUM_THREADS={num_threads}"]
+        if connectedness == 8:
+            options.append("8CONNECTED=8")
+        if is_int_polygonize:
+            result = gdal.Polygonize(
+                src_band, src_band.GetMaskBand(), mem_layer, 0, options
+            )
+        else:
+            result = gdal.FPolygonize(
+                src_band, src_band.GetMaskBand(), mem_layer, 0, options
+            )
+        assert result == 0, "Polygonize failed"
+        return [(f["DN"], f.GetGeometryRef().ExportToWkt()) for f in mem_layer]
+
+    single_threaded = polygonize(1)
+    multi_threaded = polygonize(4)
+    assert len(single_threaded) > 100
+    assert sorted(multi_threaded) == sorted(single_threaded)
+    column_wkt = f"POLYGON ((0 {height},0 0,1 0,1 {height},0 {height}))"
+    assert (5, column_wkt) in multi_threaded
+
+    # Output order does not depend on the number of threads
+    assert polygonize(3) == multi_threaded
@@ -12,6 +12,8 @@
 ###############################################################################
 
 
+import struct
+
 import pytest
 
 from osgeo import gdal
@@ -109,3 +111,161 @@ def test_proximity_3():
     if cs != cs_expected:
         print("Got: ", cs)
         pytest.fail("got wrong checksum")
+
+
+###############################################################################
+# Test the exact Euclidean distance transform algorithm against a brute force
+# computation
+
+
+def _brute_force_proximity(values, xsize, ysize, targets, maxdist, nodata):
+
+    target_pixels = [
+        (i % xsize, i // xsize) for i, v in enumerate(values) if v in targets
+    ]
+    res = []
+    for y in range(ysize):
+        for x in range(xsize):
+            distsq = min(
+                ((x - tx) ** 2 + (y - ty) ** 2 for tx, ty in target_pixels),
+                default=None,
+            )
+            if distsq is None or distsq > maxdist * maxdist:
+                res.append(nodata)
+            else:
+                res.append(distsq**0.5)
+    return res
+
+
+@pytest.mark.parametrize("num_threads", ["1", "4"])
+@pytest.mark.parametrize("maxdist", [None, 5.5])
+def test_proximity_edt(num_threads, maxdist):
+
+    src_ds = gdal.Open("data/pat.tif")
+    src_band = src_ds.GetRasterBand(1)
+    xsize = src_ds.RasterXSize
+    ysize = src_ds.RasterYSize
+    values = struct.unpack(
+        "i" * (xsize * ysize), src_band.ReadRaster(buf_type=gdal.GDT_Int32)
+    )
+
+    dst_ds = gdal.GetDriverByName("MEM").Create(
+        "", xsize, ysize, 1, gdal.GDT_Float32
+    )
+    dst_band = dst_ds.GetRasterBand(1)
+
+    options = ["VALUES=65,64", "NODATA=-1", "ALGORITHM=EDT"]
+    options.append("NUM_THREADS=" + num_threads)
+    if maxdist:
+        options.append("MAXDIST=%g" % maxdist)
+    assert gdal.ComputeProximity(src_band, dst_band, options=options) == 0
+
+    got = struct.unpack("f" * (xsize * ysize), dst_band.ReadRaster())
+    expected = _brute_force_proximity(
+        values, xsize, ysize, (64, 65), maxdist if maxdist else xsize + ysize, -1
+    )
+    assert got == pytest.approx(expected, rel=1e-6)
+
+
+###############################################################################
+# Test ALGORITHM=EDT when the raster is processed in several chunks
+
+
+@pytest.mark.parametrize("num_threads", ["1", "4"])
+def test_proximity_edt_several_chunks(num_threads):
+
+    src_ds = gdal.Open("data/pat.tif")
+    src_band = src_ds.GetRasterBand(1)
+    xsize = src_ds.RasterXSize
+    ysize = src_ds.RasterYSize
+
+    options = ["VALUES=65,64", "NODATA=-1", "ALGORITHM=EDT"]
+
+    ref_ds = gdal.GetDriverByName("MEM").Create(
+        "", xsize, ysize, 1, gdal.GDT_Float32
+    )
+    assert gdal.ComputeProximity(src_band, ref_ds.GetRasterBand(1), options) == 0
+
+    dst_ds = gdal.GetDriverByName("MEM").Create(
+        "", xsize, ysize, 1, gdal.GDT_Float32
+    )
+    # 3 lines per chunk
+    with gdal.config_option("GDAL_PROXIMITY_CHUNK_MAX_SIZE", str(3 * xsize * 8)):
+        assert (
+            gdal.ComputeProximity(
+                src_band,
+                dst_ds.GetRasterBand(1),
+                options + ["NUM_THREADS=" + num_threads],
+            )
+            == 0
+        )
+
+    assert (
+        dst_ds.GetRasterBand(1).ReadRaster() == ref_ds.GetRasterBand(1).ReadRaster()
+    )
+
+
+###############################################################################
+# Test ALGORITHM=EDT with an integer output band, fixed value and input nodata
+
+
+@pytest.mark.require_driver("GTiff")
+def test_proximity_edt_byte_output():
+
+    src_ds = gdal.GetDriverByName("MEM").Create("", 5, 3, 1, gdal.GDT_Byte)
+    src_band = src_ds.GetRasterBand(1)
+    src_band.SetNoDataValue(255)
+    src_band.WriteRaster(
+        0,
+        0,
+        5,
+        3,
+        struct.pack("B" * 15, 3, 0, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0),
+    )
+
+    dst_ds = gdal.GetDriverByName("MEM").Create("", 5, 3, 1, gdal.GDT_Byte)
+    dst_band = dst_ds.GetRasterBand(1)
+
+    gdal.ComputeProximity(
+        src_band,
+        dst_band,
+        options=[
+            "VALUES=1",
+            "MAXDIST=2",
+            "NODATA=128",
+            "USE_INPUT_NODATA=YES",
+            "ALGORITHM=EDT",
+            "NUM_THREADS=ALL_CPUS",
+        ],
+    )
+    got = struct.unpack("B" * 15, dst_band.ReadRaster())
+    assert [list(got[i : i + 5]) for i in range(0, 15, 5)] == [
+        [128, 128, 128, 128, 128],
+        [128, 1, 1, 1, 128],
+        [2, 1, 0, 1, 2],
+    ]
+
+    gdal.ComputeProximity(
+        src_band,
+        dst_band,
+        options=["VALUES=1", "MAXDIST=1.5", "FIXED_BUF_VAL=7", "ALGORITHM=EDT"],
+    )
+    # Pixels beyond MAXDIST get the default nodata value 65535, clamped to 255
+    got = struct.unpack("B" * 15, dst_band.ReadRaster())
+    assert [list(got[i : i + 5]) for i in range(0, 15, 5)] == [
+        [255, 255, 255, 255, 255],
+        [255, 7, 7, 7, 255],
+        [255, 7, 0, 7, 255],
+    ]
+
+
+def test_proximity_invalid_algorithm():
+
+    src_ds = gdal.GetDriverByName("MEM").Create("", 1, 1)
+    dst_ds = gdal.GetDriverByName("MEM").Create("", 1, 1)
+    with pytest.raises(Exception, match="Unrecognized ALGORITHM value"):
+        gdal.ComputeProximity(
+            src_ds.GetRasterBand(1),
+            dst_ds.GetRasterBand(1),
+            options=["ALGORITHM=INVALID"],
+        )
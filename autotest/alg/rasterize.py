@@ -11,6 +11,7 @@
 # SPDX-License-Identifier: MIT
 ###############################################################################
 
+import random
 import struct
 
 import ogrtest
@@ -1039,3 +1040,176 @@ def test_rasterize_bugfix_gh12129():
 
     # 121 on s390x
     assert target_ds.GetRasterBand(1).Checksum() in (120, 121)
+
+
+###############################################################################
+# Test that multi-threaded rasterization gives the same result as the
+# single-threaded one
+
+
+@pytest.mark.parametrize("options", [[], ["ALL_TOUCHED=YES"], ["MERGE_ALG=ADD"]])
+@pytest.mark.parametrize("use_layer_api", [True, False])
+@pytest.mark.parametrize("reproject", [False, True])
+def test_rasterize_num_threads(options, use_layer_api, reproject):
+
+    rng = random.Random(0)
+
+    sr = osr.SpatialReference()
+    sr.SetFromUserInput("EPSG:32631")
+
+    # With a reprojecting transformer, geometries are transformed once, and
+    # not by each tile they overlap
+    layer_sr = sr
+    if reproject:
+        layer_sr = osr.SpatialReference()
+        layer_sr.SetFromUserInput("EPSG:4326")
+        layer_sr.SetAxisMappingStrategy(osr.OAMS_TRADITIONAL_GIS_ORDER)
+    ct = osr.CoordinateTransformation(sr, layer_sr)
+
+    rast_ogr_ds = ogr.GetDriverByName("MEM").CreateDataSource("wrk")
+    rast_mem_lyr = rast_ogr_ds.CreateLayer("geoms", srs=layer_sr)
+    rast_mem_lyr.CreateField(ogr.FieldDefn("val", ogr.OFTReal))
+
+    for i in range(300):
+        x = rng.uniform(-100, 1100)
+        y = rng.uniform(-100, 1100)
+        size = rng.uniform(1, 150)
+        kind = i % 4
+        if kind == 0:
+            wkt = "POLYGON ((%f %f,%f %f,%f %f,%f %f))" % (
+                x,
+                y,
+                x + size,
+                y + size / 3,
+                x + size / 2,
+                y + size,
+                x,
+                y,
+            )
+        elif kind == 1:
+            wkt = "LINESTRING (%f %f,%f %f,%f %f)" % (
+                x,
+                y,
+                x + size,
+                y + size / 2,
+                x - size / 3,
+                y + size,
+            )
+        elif kind == 2:
+            wkt = (
+                "MULTIPOLYGON (((%f %f,%f %f,%f %f,%f %f)),"
+                "((%f %f,%f %f,%f %f,%f %f)))"
+            ) % (
+                x,
+                y,
+                x + size,
+                y,
+                x,
+                y + size,
+                x,
+                y,
+                x + size,
+                y + size,
+                x + size / 2,
+                y + size,
+                x + size,
+                y + size / 2,
+                x + size,
+                y + size,
+            )
+        else:
+            wkt = "POINT (%f %f)" % (x, y)
+        geom = ogr.Geometry(wkt=wkt)
+        if reproject:
+            geom.Transform(ct)
+        feat = ogr.Feature(rast_mem_lyr.GetLayerDefn())
+        feat["val"] = rng.uniform(0, 10)
+        feat.SetGeometryDirectly(geom)
+        rast_mem_lyr.CreateFeature(feat)
+
+    def rasterize(num_threads):
+        target_ds = gdal.GetDriverByName("MEM").Create(
+            "", 1000, 1000, 1, gdal.GDT_Float32
+        )
+        target_ds.SetGeoTransform((0, 1, 0, 1000, 0, -1))
+        target_ds.SetSpatialRef(sr)
+        if use_layer_api:
+            gdal.RasterizeLayer(
+                target_ds,
+                [1],
+                rast_mem_lyr,
+                options=options
+                + ["ATTRIBUTE=val", "CHUNKYSIZE=300", "NUM_THREADS=" + num_threads],
+            )
+        else:
+            rasterize_options = ["-a", "val"]
+            if "ALL_TOUCHED=YES" in options:
+                rasterize_options.append("-at")
+            if "MERGE_ALG=ADD" in options:
+                rasterize_options.append("-add")
+            with gdal.config_option("GDAL_NUM_THREADS", num_threads):
+                gdal.Rasterize(target_ds, rast_ogr_ds, options=rasterize_options)
+        return target_ds.GetRasterBand(1).ReadRaster()
+
+    ref = rasterize("1")
+    assert ref != b"\0" * len(ref)
+    assert rasterize("4") == ref
+    assert rasterize("ALL_CPUS") == ref
+
+
+###############################################################################
+# Test that multi-threaded rasterization gives the same result as the
+# single-threaded one with a reprojecting transformer, for which the image of
+# the envelope of a geometry is not the envelope of its image
+
+
+@pytest.mark.parametrize("options", [[], ["ALL_TOUCHED=YES"]])
+def test_rasterize_num_threads_reprojection(options):
+
+    rng = random.Random(0)
+
+    src_sr = osr.SpatialReference()
+    src_sr.SetFromUserInput("EPSG:4326")
+    src_sr.SetAxisMappingStrategy(osr.OAMS_TRADITIONAL_GIS_ORDER)
+
+    rast_ogr_ds = ogr.GetDriverByName("MEM").CreateDataSource("wrk")
+    rast_mem_lyr = rast_ogr_ds.CreateLayer("geoms", srs=src_sr)
+
+    # Sectors of rings around the North pole, whose edges are curved in
+    # polar stereographic
+    for i in range(30):
+        min_lon = rng.uniform(-180, 60)
+        max_lon = min_lon + rng.uniform(30, 120)
+        min_lat = rng.uniform(60, 80)
+        max_lat = min_lat + rng.uniform(1, 5)
+        lons = [min_lon + (max_lon - min_lon) * k / 20 for k in range(21)]
+        coords = ["%f %f" % (lon, min_lat) for lon in lons]
+        coords += ["%f %f" % (lon, max_lat) for lon in reversed(lons)]
+        coords.append(coords[0])
+        feat = ogr.Feature(rast_mem_lyr.GetLayerDefn())
+        feat.SetGeometryDirectly(
+            ogr.CreateGeometryFromWkt("POLYGON ((%s))" % ",".join(coords))
+        )
+        rast_mem_lyr.CreateFeature(feat)
+
+    dst_sr = osr.SpatialReference()
+    dst_sr.SetFromUserInput("EPSG:3413")
+
+    def rasterize(num_threads):
+        target_ds = gdal.GetDriverByName("MEM").Create(
+            "", 1000, 1000, 1, gdal.GDT_Byte
+        )
+        target_ds.SetGeoTransform((-4e6, 8000, 0, 4e6, 0, -8000))
+        target_ds.SetSpatialRef(dst_sr)
+        gdal.RasterizeLayer(
+            target_ds,
+            [1],
+            rast_mem_lyr,
+            burn_values=[1],
+            options=options + ["MERGE_ALG=ADD", "NUM_THREADS=" + num_threads],
+        )
+        return target_ds.GetRasterBand(1).ReadRaster()
+
+    ref = rasterize("1")
+    assert ref != b"\0" * len(ref)
+    assert rasterize("4") == ref
@@ -341,3 +341,46 @@ def test_sieve_all_masked():
     gdal.SieveFilter(src_band, mask_band, src_band, 4, 4)
 
     assert src_band.Checksum() == expected_cs
+
+
+###############################################################################
+# Test that the result does not depend on the number of threads
+
+
+@pytest.mark.parametrize("connectedness", [4, 8])
+def test_sieve_num_threads(connectedness):
+
+    # Tall enough to be split into several strips
+    width = 20
+    height = 3000
+    drv = gdal.GetDriverByName("MEM")
+    src_ds = drv.Create("", width, height, 1, gdal.GDT_Byte)
+    src_ds.WriteRaster(
+        0,
+        0,
+        width,
+        height,
+        bytes(
+            ((x // 3) * 7 + (y // 2) * 13 + (x * y) % 5) % 4
+            for y in range(height)
+            for x in range(width)
+        ),
+    )
+    src_band = src_ds.GetRasterBand(1)
+
+    results = []
+    for num_threads in (1, 4):
+        dst_ds = drv.Create("", width, height, 1, gdal.GDT_Byte)
+        dst_band = dst_ds.GetRasterBand(1)
+        gdal.SieveFilter(
+            src_band,
+            None,
+            dst_band,
+            5,
+            connectedness,
+            options=["NUM_THREADS=" + str(num_threads)],
+        )
+        results.append(dst_ds.ReadRaster())
+
+    assert results[0] != src_ds.ReadRaster()
+    assert results[0] == results[1]
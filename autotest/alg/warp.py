@@ -1529,6 +1529,62 @@ def test_warp_53(typestr, option, alg_name, expected_cs):
     assert cs2 == 1218
 
 
+###############################################################################
+# Test that the bilinear and cubic kernels specialized for masks (nodata,
+# alpha band, destination mask) give the same result as GWKRealCase() and
+# the general case
+
+
+@pytest.mark.parametrize("typestr", ("Byte", "Int16", "UInt16", "Float32"))
+@pytest.mark.parametrize("alg_name", ("bilinear", "cubic"))
+@pytest.mark.parametrize("dstnodata", (True, False))
+@pytest.mark.parametrize("srcalpha", (False, True))
+def test_warp_masks_fast_path_same_as_general_case(
+    typestr, alg_name, dstnodata, srcalpha
+):
+
+    src_ds = gdal.Translate(
+        "",
+        "../gcore/data/byte.tif",
+        options=f"-of MEM -b 1 -b 1 -b 1 -ot {typestr}",
+    )
+    zero = struct.pack("B" * 1, 0)
+    # Isolated invalid pixels, different in each band, and an invalid block
+    for x, y in ((3, 3), (10, 4), (17, 15)):
+        src_ds.GetRasterBand(1).WriteRaster(x, y, 1, 1, zero, buf_type=gdal.GDT_Byte)
+    for x, y in ((5, 12), (12, 10)):
+        src_ds.GetRasterBand(2).WriteRaster(x, y, 1, 1, zero, buf_type=gdal.GDT_Byte)
+    for band in (1, 2):
+        src_ds.GetRasterBand(band).WriteRaster(
+            6, 6, 3, 4, zero * 12, buf_type=gdal.GDT_Byte
+        )
+    # Third band used as alpha: opaque, except a transparent block and a
+    # partially transparent one
+    alpha_band = src_ds.GetRasterBand(3)
+    alpha_band.Fill(255)
+    alpha_band.WriteRaster(14, 2, 3, 3, zero * 9, buf_type=gdal.GDT_Byte)
+    alpha_band.WriteRaster(2, 14, 4, 3, b"\x80" * 12, buf_type=gdal.GDT_Byte)
+
+    def warp(options):
+        return gdal.Warp(
+            "",
+            src_ds,
+            options=f"-of MEM -r {alg_name} -ts 47 53 -srcnodata 0 "
+            + ("-srcalpha " if srcalpha else "-b 1 -b 2 ")
+            + ("-dstnodata 0 " if dstnodata else "")
+            + options,
+        )
+
+    ds = warp("")
+    real_case_ds = warp("-wo USE_MASKS_FAST_PATH=NO")
+    general_case_ds = warp("-wo USE_GENERAL_CASE=TRUE")
+    for band in (1, 2):
+        assert ds.GetRasterBand(band).Checksum() != 0
+        data = ds.GetRasterBand(band).ReadRaster()
+        assert data == real_case_ds.GetRasterBand(band).ReadRaster()
+        assert data == general_case_ds.GetRasterBand(band).ReadRaster()
+
+
 ###############################################################################
 # Test Alpha on UInt16/Int16
 
@@ -2037,6 +2093,100 @@ def test_warp_multi_threaded_errors(tmp_vsimem):
             gdal.Warp("", ds, format="MEM", multithread=True)
 
 
+###############################################################################
+# Test multi-threaded warping with several chunks in flight and concurrent
+# source reads
+
+
+@pytest.mark.parametrize("max_chunks_in_flight", [1, 2, 4, 1000])
+@pytest.mark.parametrize("dst_alpha", [False, True])
+def test_warp_multi_chunks_in_flight(tmp_vsimem, max_chunks_in_flight, dst_alpha):
+
+    pytest.importorskip("numpy")
+
+    src_filename = str(tmp_vsimem / "src.tif")
+    gdal.Translate(src_filename, "../gcore/data/byte.tif", width=400, height=400)
+
+    # Source whose reads are slow, so that concurrent reads do overlap
+    slow_src_filename = str(tmp_vsimem / "slow_src.vrt")
+    with gdal.Open(src_filename) as src_ds:
+        gt = ",".join(str(x) for x in src_ds.GetGeoTransform())
+        srs = src_ds.GetSpatialRef().ExportToWkt()
+    gdal.FileFromMemBuffer(
+        slow_src_filename,
+        f"""<VRTDataset rasterXSize="400" rasterYSize="400">
+  <SRS>{srs}</SRS>
+  <GeoTransform>{gt}</GeoTransform>
+  <VRTRasterBand dataType="Byte" band="1" subClass="VRTDerivedRasterBand">
+    <PixelFunctionType>slow_copy</PixelFunctionType>
+    <PixelFunctionLanguage>Python</PixelFunctionLanguage>
+    <PixelFunctionCode><![CDATA[
+import time
+def slow_copy(in_ar, out_ar, xoff, yoff, xsize, ysize, raster_xsize,
+              raster_ysize, r, gt, **kwargs):
+    time.sleep(0.05)
+    out_ar[:] = in_ar[0]
+]]>
+    </PixelFunctionCode>
+    <SimpleSource>
+      <SourceFilename relativeToVRT="1">src.tif</SourceFilename>
+      <SourceBand>1</SourceBand>
+    </SimpleSource>
+  </VRTRasterBand>
+</VRTDataset>""",
+    )
+
+    options = {
+        "format": "GTiff",
+        "dstSRS": "EPSG:4326",
+        "dstAlpha": dst_alpha,
+        "warpMemoryLimit": "100KB",
+    }
+    ref_ds = gdal.Warp(str(tmp_vsimem / "ref.tif"), src_filename, **options)
+    ref_cs = [
+        ref_ds.GetRasterBand(i + 1).Checksum() for i in range(ref_ds.RasterCount)
+    ]
+
+    debug_msgs = []
+
+    def handler(eErrClass, err_no, msg):
+        if eErrClass == gdal.CE_Debug and "ChunkAndWarpMulti()" in msg:
+            debug_msgs.append(msg)
+
+    with gdal.config_options(
+        {"GDAL_VRT_ENABLE_PYTHON": "YES", "CPL_DEBUG": "WARP"}, thread_local=False
+    ), gdal.Open(slow_src_filename) as src_ds:
+        gdal.PushErrorHandler(handler)
+        gdal.SetCurrentErrorHandlerCatchDebug(True)
+        try:
+            ds = gdal.Warp(
+                str(tmp_vsimem / "out.tif"),
+                src_ds,
+                multithread=True,
+                warpOptions=[
+                    "NUM_THREADS=4",
+                    f"MAX_CHUNKS_IN_FLIGHT={max_chunks_in_flight}",
+                ],
+                **options,
+            )
+        finally:
+            gdal.PopErrorHandler()
+    assert [
+        ds.GetRasterBand(i + 1).Checksum() for i in range(ds.RasterCount)
+    ] == ref_cs
+
+    assert len(debug_msgs) == 1
+    if max_chunks_in_flight > 8:
+        # Capped
+        assert "8 in flight, concurrent" in debug_msgs[0]
+    elif max_chunks_in_flight > 2:
+        assert f"{max_chunks_in_flight} in flight, concurrent" in debug_msgs[0]
+        assert "at most 1 at once" not in debug_msgs[0]
+    else:
+        assert f"{max_chunks_in_flight} in flight, serialized" in debug_msgs[0]
+        assert "at most 1 at once" in debug_msgs[0]
+
+
 ###############################################################################
 
 
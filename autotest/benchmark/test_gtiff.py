@@ -164,3 +164,32 @@ def test_gtiff_build_overviews(tmp_vsimem, source_ds_2048x2048_filename, ovr_alg
     ds = gdal.Open(filename, gdal.GA_Update)
     ds.BuildOverviews(ovr_alg, [2, 4, 8])
     ds.Close()
+
+
+@pytest.fixture(scope="module")
+def source_ds_tiled_local_filename(tmp_path_factory):
+    filename = str(tmp_path_factory.mktemp("gtiff") / "source.tif")
+    ds = gdal.GetDriverByName("GTiff").Create(
+        filename,
+        8192,
+        8192,
+        3,
+        options=["TILED=YES", "BLOCKXSIZE=128", "BLOCKYSIZE=128"],
+    )
+    ds.GetRasterBand(1).Fill(1)
+    ds.GetRasterBand(2).Fill(2)
+    ds.GetRasterBand(3).Fill(3)
+    ds = None
+    return filename
+
+
+@pytest.mark.parametrize("use_io_uring", ["NO", "YES"])
+def test_gtiff_random_access_local_file(source_ds_tiled_local_filename, use_io_uring):
+    with gdal.config_options(
+        {"CPL_VSIL_USE_IO_URING": use_io_uring, "GDAL_CACHEMAX": "0"}
+    ):
+        ds = gdal.Open(source_ds_tiled_local_filename)
+        for i in range(50):
+            x = (i * 1733) % (8192 - 1024)
+            y = (i * 2971) % (8192 - 1024)
+            ds.ReadRaster(x, y, 1024, 1024)
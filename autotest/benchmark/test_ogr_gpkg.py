@@ -14,7 +14,7 @@
 
 import pytest
 
-from osgeo import ogr
+from osgeo import gdal, ogr
 
 # Must be set to run the test_XXX functions under the benchmark fixture
 pytestmark = [
@@ -61,3 +61,19 @@ def test_ogr_gpkg_spatial_index(source_file):
     for f in lyr:
         count += 1
     assert count == 10000 - 1000 + 1
+
+
+@pytest.fixture(scope="module")
+def source_file_local(tmp_path_factory):
+    filename = str(tmp_path_factory.mktemp("gpkg") / "test.gpkg")
+    create_file(filename)
+    return filename
+
+
+@pytest.mark.parametrize("use_io_uring", ["NO", "YES"])
+def test_ogr_gpkg_random_access_local_file(source_file_local, use_io_uring):
+    with gdal.config_option("CPL_VSIL_USE_IO_URING", use_io_uring):
+        ds = ogr.Open(source_file_local)
+        lyr = ds.GetLayer(0)
+        for i in range(10000):
+            assert lyr.GetFeature(1 + (i * 7919) % 50000) is not None
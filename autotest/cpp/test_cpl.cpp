@@ -49,6 +49,14 @@
 #include <fstream>
 #include <string>
 
+#if defined(HAVE_CURL) && !defined(_WIN32)
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
 #include "gtest_include.h"
 
 static bool gbGotError = false;
@@ -4890,6 +4898,422 @@ TEST_F(test_cpl, file_system_pread)
     VSIUnlink("temp_test_64.bin");
 }
 
+// Test regular file system ReadMultiRange() implementation
+TEST_F(test_cpl, file_system_read_multi_range)
+{
+    const char *pszFilename = "temp_test_read_multi_range.bin";
+    {
+        VSILFILE *fp = VSIFOpenL(pszFilename, "wb");
+        if (fp == nullptr)
+            return;
+        std::vector<GByte> abyData(100000);
+        for (size_t i = 0; i < abyData.size(); ++i)
+            abyData[i] = static_cast<GByte>(i % 251);
+        ASSERT_EQ(VSIFWriteL(abyData.data(), 1, abyData.size(), fp),
+                  abyData.size());
+        VSIFCloseL(fp);
+    }
+
+    for (const char *pszUseIOURing : {"NO", "YES"})
+    {
+        CPLConfigOptionSetter oSetter("CPL_VSIL_USE_IO_URING", pszUseIOURing,
+                                      false);
+        VSILFILE *fp = VSIFOpenL(pszFilename, "rb");
+        ASSERT_NE(fp, nullptr);
+        ASSERT_EQ(VSIFSeekL(fp, 10, SEEK_SET), 0);
+
+        // Unordered, overlapping, and empty ranges
+        const vsi_l_offset anOffsets[] = {99000, 1, 1, 50000, 0};
+        const size_t anSizes[] = {1000, 20000, 3, 0, 1};
+        constexpr int N_RANGES = static_cast<int>(CPL_ARRAYSIZE(anOffsets));
+        std::vector<std::vector<GByte>> aabyBuffers(N_RANGES);
+        std::vector<void *> apData(N_RANGES);
+        for (int i = 0; i < N_RANGES; ++i)
+        {
+            aabyBuffers[i].resize(anSizes[i] + 1);
+            apData[i] = aabyBuffers[i].data();
+        }
+        ASSERT_EQ(VSIFReadMultiRangeL(N_RANGES, apData.data(), anOffsets,
+                                      anSizes, fp),
+                  0);
+        for (int i = 0; i < N_RANGES; ++i)
+        {
+            for (size_t j = 0; j < anSizes[i]; ++j)
+            {
+                ASSERT_EQ(aabyBuffers[i][j],
+                          static_cast<GByte>((anOffsets[i] + j) % 251));
+            }
+        }
+        // File position is preserved
+        EXPECT_EQ(VSIFTellL(fp), 10U);
+
+        // Range beyond end of file
+        const vsi_l_offset anOffsetsEOF[] = {0, 99990};
+        const size_t anSizesEOF[] = {1, 11};
+        EXPECT_NE(VSIFReadMultiRangeL(2, apData.data(), anOffsetsEOF,
+                                      anSizesEOF, fp),
+                  0);
+
+        VSIFCloseL(fp);
+    }
+    VSIUnlink(pszFilename);
+}
+
+// Test regular file system AdviseRead() implementation
+TEST_F(test_cpl, file_system_advise_read)
+{
+    const char *pszFilename = "temp_test_advise_read.bin";
+    {
+        VSILFILE *fp = VSIFOpenL(pszFilename, "wb");
+        if (fp == nullptr)
+            return;
+        std::vector<GByte> abyData(100000);
+        for (size_t i = 0; i < abyData.size(); ++i)
+            abyData[i] = static_cast<GByte>(i % 251);
+        ASSERT_EQ(VSIFWriteL(abyData.data(), 1, abyData.size(), fp),
+                  abyData.size());
+        VSIFCloseL(fp);
+    }
+
+    VSILFILE *fp = VSIFOpenL(pszFilename, "rb");
+    ASSERT_NE(fp, nullptr);
+    auto poHandle = reinterpret_cast<VSIVirtualHandle *>(fp);
+
+    const vsi_l_offset anOffsets[] = {50000, 0};
+    const size_t anSizes[] = {1000, 20000};
+    poHandle->AdviseRead(2, anOffsets, anSizes);
+
+    // Reads are not affected by the advice
+    GByte abyBuffer[3] = {0};
+    ASSERT_EQ(VSIFSeekL(fp, 50000, SEEK_SET), 0);
+    ASSERT_EQ(VSIFReadL(abyBuffer, 1, 3, fp), 3U);
+    EXPECT_EQ(abyBuffer[0], static_cast<GByte>(50000 % 251));
+    EXPECT_EQ(abyBuffer[2], static_cast<GByte>(50002 % 251));
+
+#ifdef __linux__
+    {
+        // A negative length (once cast to off_t) makes posix_fadvise()
+        // fail with EINVAL, which is reported as a debug message.
+        CPLConfigOptionSetter oDebugSetter("CPL_DEBUG", "ON", false);
+        std::string osMsg;
+        CPLPushErrorHandlerEx(
+            [](CPLErr eErr, CPLErrorNum, const char *pszMsg)
+            {
+                if (eErr == CE_Debug)
+                {
+                    void *pUserData = CPLGetErrorHandlerUserData();
+                    *static_cast<std::string *>(pUserData) += pszMsg;
+                }
+            },
+            &osMsg);
+        const vsi_l_offset nOffset = 0;
+        const size_t nSize = std::numeric_limits<size_t>::max();
+        poHandle->AdviseRead(1, &nOffset, &nSize);
+        CPLPopErrorHandler();
+        EXPECT_TRUE(osMsg.find("posix_fadvise") != std::string::npos)
+            << osMsg;
+    }
+#endif
+
+    VSIFCloseL(fp);
+    VSIUnlink(pszFilename);
+}
+
+// Test VSIVirtualHandle::ReadAsync() and VSIFReadAsyncL()
+TEST_F(test_cpl, read_async)
+{
+    const auto TestHandle = [](const char *pszFilename)
+    {
+        VSILFILE *fp = VSIFOpenL(pszFilename, "rb");
+        ASSERT_NE(fp, nullptr);
+        VSIVirtualHandle *poHandle = reinterpret_cast<VSIVirtualHandle *>(fp);
+        ASSERT_EQ(poHandle->Seek(1, SEEK_SET), 0);
+
+        char szBuffer1[5] = {0};
+        char szBuffer2[5] = {0};
+        char szBuffer3[5] = {0};
+        std::atomic<int> nCallbacks{0};
+        auto oFuture1 = poHandle->ReadAsync(szBuffer1, 2, 1, nullptr);
+        auto oFuture2 = poHandle->ReadAsync(
+            szBuffer2, 4, 1,
+            [&nCallbacks](size_t nRead)
+            {
+                EXPECT_EQ(nRead, 3U);
+                ++nCallbacks;
+            });
+        auto oFuture3 = poHandle->ReadAsync(szBuffer3, 1, 4, nullptr);
+        EXPECT_EQ(oFuture1.get(), 2U);
+        EXPECT_EQ(std::string(szBuffer1), std::string("bc"));
+        EXPECT_EQ(oFuture2.get(), 3U);
+        EXPECT_EQ(std::string(szBuffer2), std::string("bcd"));
+        EXPECT_EQ(nCallbacks, 1);
+        EXPECT_EQ(oFuture3.get(), 0U);
+        EXPECT_EQ(std::string(szBuffer3), std::string());
+
+        // The current file offset is not affected
+        EXPECT_EQ(poHandle->Tell(), 1U);
+
+        struct Context
+        {
+            std::mutex oMutex{};
+            std::condition_variable oCV{};
+            size_t nRead = 0;
+            bool bDone = false;
+        };
+
+        Context sContext;
+        char szBuffer4[5] = {0};
+        VSIFReadAsyncL(
+            fp, szBuffer4, 4, 0,
+            [](size_t nRead, void *pUserData)
+            {
+                auto psContext = static_cast<Context *>(pUserData);
+                std::lock_guard<std::mutex> oLock(psContext->oMutex);
+                psContext->nRead = nRead;
+                psContext->bDone = true;
+                psContext->oCV.notify_one();
+            },
+            &sContext);
+        {
+            std::unique_lock<std::mutex> oLock(sContext.oMutex);
+            sContext.oCV.wait(oLock, [&sContext] { return sContext.bDone; });
+        }
+        EXPECT_EQ(sContext.nRead, 4U);
+        EXPECT_EQ(std::string(szBuffer4), std::string("abcd"));
+
+        VSIFCloseL(fp);
+    };
+
+    {
+        VSILFILE *fp = VSIFOpenL("/vsimem/read_async.bin", "wb");
+        ASSERT_NE(fp, nullptr);
+        ASSERT_EQ(VSIFWriteL("abcd", 1, 4, fp), 4U);
+        VSIFCloseL(fp);
+    }
+    // Native implementation
+    TestHandle("/vsimem/read_async.bin");
+    // Synchronous fallback of handles without PRead()
+    TestHandle("/vsisubfile/0_4,/vsimem/read_async.bin");
+    VSIUnlink("/vsimem/read_async.bin");
+
+    // Thread pool implementation
+    {
+        VSILFILE *fp = VSIFOpenL("temp_test_read_async.bin", "wb");
+        if (fp == nullptr)
+            return;
+        ASSERT_EQ(VSIFWriteL("abcd", 1, 4, fp), 4U);
+        VSIFCloseL(fp);
+    }
+    TestHandle("temp_test_read_async.bin");
+    VSIUnlink("temp_test_read_async.bin");
+}
+
+#if defined(HAVE_CURL) && !defined(_WIN32)
+
+namespace
+{
+// Minimal HTTP server, listening on an ephemeral port of the loopback
+// interface. HEAD requests get osHeadResponse, and other requests get the
+// next response of aosResponses. Each connection serves a single request.
+class CannedHTTPServer
+{
+  public:
+    CannedHTTPServer(const std::string &osHeadResponse,
+                     const std::vector<std::string> &aosResponses)
+        : m_osHeadResponse(osHeadResponse), m_aosResponses(aosResponses)
+    {
+        m_nListenFD = socket(AF_INET, SOCK_STREAM, 0);
+        if (m_nListenFD < 0)
+            return;
+        sockaddr_in sAddr{};
+        sAddr.sin_family = AF_INET;
+        sAddr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        sAddr.sin_port = 0;
+        socklen_t nAddrLen = sizeof(sAddr);
+        if (bind(m_nListenFD, reinterpret_cast<sockaddr *>(&sAddr),
+                 sizeof(sAddr)) != 0 ||
+            listen(m_nListenFD, 16) != 0 ||
+            getsockname(m_nListenFD, reinterpret_cast<sockaddr *>(&sAddr),
+                        &nAddrLen) != 0)
+        {
+            close(m_nListenFD);
+            m_nListenFD = -1;
+            return;
+        }
+        m_nPort = ntohs(sAddr.sin_port);
+        m_oThread = std::thread([this]() { Run(); });
+    }
+
+    ~CannedHTTPServer()
+    {
+        m_bStop = true;
+        if (m_oThread.joinable())
+            m_oThread.join();
+        if (m_nListenFD >= 0)
+            close(m_nListenFD);
+    }
+
+    int GetPort() const
+    {
+        return m_nPort;
+    }
+
+    // Header of the requests, other than HEAD, received so far
+    std::vector<std::string> GetRequests()
+    {
+        std::lock_guard<std::mutex> oLock(m_oMutex);
+        return m_aosRequests;
+    }
+
+  private:
+    CPL_DISALLOW_COPY_ASSIGN(CannedHTTPServer)
+
+    const std::string m_osHeadResponse;
+    const std::vector<std::string> m_aosResponses;
+    int m_nListenFD = -1;
+    int m_nPort = 0;
+    std::atomic<bool> m_bStop{false};
+    std::thread m_oThread{};
+    std::mutex m_oMutex{};
+    std::vector<std::string> m_aosRequests{};
+
+    void Run()
+    {
+        size_t iResponse = 0;
+        while (!m_bStop)
+        {
+            pollfd sPollFD{m_nListenFD, POLLIN, 0};
+            if (poll(&sPollFD, 1, 100) <= 0)
+                continue;
+            const int nFD = accept(m_nListenFD, nullptr, nullptr);
+            if (nFD < 0)
+                continue;
+            std::string osRequest;
+            while (osRequest.find("\r\n\r\n") == std::string::npos)
+            {
+                char szBuffer[1024];
+                const auto nRead = recv(nFD, szBuffer, sizeof(szBuffer), 0);
+                if (nRead <= 0)
+                    break;
+                osRequest.append(szBuffer, static_cast<size_t>(nRead));
+            }
+            std::string osResponse;
+            if (STARTS_WITH(osRequest.c_str(), "HEAD "))
+            {
+                osResponse = m_osHeadResponse;
+            }
+            else
+            {
+                {
+                    std::lock_guard<std::mutex> oLock(m_oMutex);
+                    m_aosRequests.push_back(osRequest);
+                }
+                osResponse = iResponse < m_aosResponses.size()
+                                 ? m_aosResponses[iResponse++]
+                                 : std::string("HTTP/1.1 404 Not Found\r\n"
+                                               "Content-Length: 0\r\n"
+                                               "Connection: close\r\n\r\n");
+            }
+#ifdef MSG_NOSIGNAL
+            constexpr int nFlags = MSG_NOSIGNAL;
+#else
+            constexpr int nFlags = 0;
+#endif
+            CPL_IGNORE_RET_VAL(
+                send(nFD, osResponse.data(), osResponse.size(), nFlags));
+            close(nFD);
+        }
+    }
+};
+}  // namespace
+
+#endif
+
+// Test VSIVirtualHandle::ReadAsync() on /vsicurl/
+TEST_F(test_cpl, vsicurl_read_async)
+{
+#if defined(HAVE_CURL) && !defined(_WIN32)
+    CPLConfigOptionSetter oSetterReadDir("GDAL_DISABLE_READDIR_ON_OPEN",
+                                         "EMPTY_DIR", false);
+    CPLConfigOptionSetter oSetterMaxRetry("GDAL_HTTP_MAX_RETRY", "1", false);
+    CPLConfigOptionSetter oSetterRetryDelay("GDAL_HTTP_RETRY_DELAY", "0.01",
+                                            false);
+    const std::string osHeadResponse("HTTP/1.1 200 OK\r\n"
+                                     "Content-Length: 10\r\n"
+                                     "Connection: close\r\n\r\n");
+
+    const auto ReadAsync = [](int nPort, const char *pszName, size_t nSize,
+                              vsi_l_offset nOffset, std::string &osData)
+    {
+        const std::string osFilename(CPLSPrintf(
+            "/vsicurl/http://127.0.0.1:%d/%s", nPort, pszName));
+        VSILFILE *fp = VSIFOpenL(osFilename.c_str(), "rb");
+        if (fp == nullptr)
+            return static_cast<size_t>(0);
+        std::string osBuffer(nSize, '\0');
+        auto oFuture = fp->ReadAsync(&osBuffer[0], nSize, nOffset, nullptr);
+        const size_t nRead = oFuture.get();
+        osData = osBuffer.substr(0, nRead);
+        VSIFCloseL(fp);
+        return nRead;
+    };
+
+    // Warnings about retries are emitted from the thread running the
+    // requests
+    CPLErrorHandler pfnOldHandler = CPLSetErrorHandler(CPLQuietErrorHandler);
+
+    // Retry after a 503 error
+    {
+        CannedHTTPServer oServer(
+            osHeadResponse,
+            {"HTTP/1.1 503 Service Unavailable\r\n"
+             "Content-Length: 0\r\n"
+             "Connection: close\r\n\r\n",
+             "HTTP/1.1 206 Partial Content\r\n"
+             "Content-Range: bytes 2-5/10\r\n"
+             "Content-Length: 4\r\n"
+             "Connection: close\r\n\r\n"
+             "cdef"});
+        if (oServer.GetPort() != 0)
+        {
+            std::string osData;
+            EXPECT_EQ(ReadAsync(oServer.GetPort(), "retry.bin", 4, 2, osData),
+                      4U);
+            EXPECT_STREQ(osData.c_str(), "cdef");
+            const auto aosRequests = oServer.GetRequests();
+            EXPECT_EQ(aosRequests.size(), 2U);
+            for (const auto &osRequest : aosRequests)
+            {
+                EXPECT_TRUE(osRequest.find("Range: bytes=2-5") !=
+                            std::string::npos)
+                    << osRequest;
+            }
+        }
+    }
+
+    // Server ignoring the Range header, and returning the whole file
+    {
+        CannedHTTPServer oServer(osHeadResponse, {"HTTP/1.1 200 OK\r\n"
+                                                  "Content-Length: 10\r\n"
+                                                  "Connection: close\r\n\r\n"
+                                                  "abcdefghij"});
+        if (oServer.GetPort() != 0)
+        {
+            std::string osData;
+            EXPECT_EQ(
+                ReadAsync(oServer.GetPort(), "full_body.bin", 4, 3, osData),
+                4U);
+            EXPECT_STREQ(osData.c_str(), "defg");
+        }
+    }
+
+    CPLSetErrorHandler(pfnOldHandler);
+    VSICurlClearCache();
+#else
+    GTEST_SKIP() << "CURL not available";
+#endif
+}
+
 // Test CPLMask implementation
 TEST_F(test_cpl, CPLMask)
 {
@@ -17,8 +17,11 @@
 #include "marching_squares/level_generator.h"
 #include "marching_squares/segment_merger.h"
 #include "marching_squares/contour_generator.h"
+#include "marching_squares/segment_recorder.h"
 
+#include <cmath>
 #include <limits>
+#include <sstream>
 
 #include "gtest_include.h"
 
@@ -474,4 +477,82 @@ TEST_F(test_ms_contour, saddle_point)
                                      {0.9, 2}}));
     }
 }
+
+// Writer recording the exact sequence of emitted lines
+struct OrderedLineWriter
+{
+    std::ostringstream o{};
+
+    void addLine(double level, LineString &ls, bool closed)
+    {
+        o << level << (closed ? " closed:" : " open:");
+        for (const auto &pt : ls)
+            o << " " << pt.x << "," << pt.y;
+        o << "\n";
+    }
+};
+
+// Check that processing strips independently, and replaying their recorded
+// segments in order, gives the same result as processing the whole raster.
+TEST_F(test_ms_contour, strips)
+{
+    constexpr int width = 23;
+    constexpr int height = 41;
+    std::vector<double> data(width * height);
+    for (int y = 0; y < height; y++)
+    {
+        for (int x = 0; x < width; x++)
+        {
+            data[y * width + x] =
+                (x * 7 + y * 3) % 19 == 0
+                    ? -9999
+                    : 10 * std::sin(x * 0.3) * std::cos(y * 0.2) + (x % 3);
+        }
+    }
+    const std::vector<double> fixedLevels = {-5, -2.5, 0, 1, 2.5, 5, 7.5};
+    FixedLevelRangeIterator levels(&fixedLevels[0], fixedLevels.size(), -20,
+                                   20);
+
+    for (bool polygonize : {false, true})
+    {
+        OrderedLineWriter refWriter;
+        {
+            SegmentMerger<OrderedLineWriter, FixedLevelRangeIterator> writer(
+                refWriter, levels, polygonize);
+            ContourGenerator<decltype(writer), FixedLevelRangeIterator> cg(
+                width, height, /* hasNoData */ true, -9999, writer, levels);
+            for (int y = 0; y < height; y++)
+                cg.feedLine(&data[y * width]);
+        }
+        EXPECT_TRUE(!refWriter.o.str().empty());
+
+        for (int stripHeight : {1, 2, 5, 16})
+        {
+            OrderedLineWriter stripWriter;
+            {
+                SegmentMerger<OrderedLineWriter, FixedLevelRangeIterator>
+                    writer(stripWriter, levels, polygonize);
+                for (int firstLine = 0; firstLine < height;
+                     firstLine += stripHeight)
+                {
+                    SegmentRecorder recorder(polygonize);
+                    ContourGenerator<SegmentRecorder, FixedLevelRangeIterator>
+                        cg(width, height, /* hasNoData */ true, -9999,
+                           recorder, levels);
+                    if (firstLine > 0)
+                        cg.setStartLine(firstLine,
+                                        &data[(firstLine - 1) * width]);
+                    for (int y = firstLine;
+                         y < std::min(height, firstLine + stripHeight); y++)
+                        cg.feedLine(&data[y * width]);
+                    for (size_t i = 0; i < recorder.linesCount(); i++)
+                        recorder.replayLine(i, writer);
+                }
+            }
+            EXPECT_EQ(stripWriter.o.str(), refWriter.o.str())
+                << "polygonize=" << polygonize
+                << ", stripHeight=" << stripHeight;
+        }
+    }
+}
 }  // namespace
@@ -202,6 +202,19 @@ int main()
         MY_ASSERT(res[2] == input[2] + diff[2]);
         MY_ASSERT(res[3] == input[3]);
 
+        XMMReg4Double::Max(reg, reg + XMMReg4Double::Load4Val(diff))
+            .Store4Val(res);
+        MY_ASSERT(res[0] == input[0] + diff[0]);
+        MY_ASSERT(res[1] == input[1]);
+        MY_ASSERT(res[2] == input[2]);
+        MY_ASSERT(res[3] == input[3] + diff[3]);
+
+        XMMReg4Double::Sqrt(reg * reg).Store4Val(res);
+        MY_ASSERT(res[0] == input[0]);
+        MY_ASSERT(res[1] == input[1]);
+        MY_ASSERT(res[2] == input[2]);
+        MY_ASSERT(res[3] == input[3]);
+
         reg = XMMReg4Double::Load4Val(input);
         XMMReg4Double reg_diff = XMMReg4Double::Load4Val(diff);
         XMMReg4Double::Ternary(XMMReg4Double::Greater(reg, reg + reg_diff), reg,
@@ -942,3 +942,67 @@ def test_stats_all_large_values(value):
     src_ds.WriteRaster(0, 0, 2, 1, struct.pack("d" * 2, value, value))
     assert src_ds.GetRasterBand(1).ComputeRasterMinMax(False) == (value, value)
     assert src_ds.GetRasterBand(1).ComputeStatistics(False) == [value, value, value, 0]
+
+
+###############################################################################
+# Test that multi-threaded computation of statistics, min/max and histogram
+# gives the same results as the single-threaded one
+
+
+@pytest.mark.parametrize(
+    "datatype,fmt",
+    [
+        (gdal.GDT_Byte, "B"),
+        (gdal.GDT_UInt16, "H"),
+        (gdal.GDT_Int16, "h"),
+        (gdal.GDT_Int32, "i"),
+        (gdal.GDT_Float32, "f"),
+        (gdal.GDT_Float64, "d"),
+    ],
+)
+@pytest.mark.parametrize("nodata_or_mask", [None, "nodata", "mask"])
+def test_stats_multithreaded(datatype, fmt, nodata_or_mask):
+
+    width = 1031
+    height = 517
+    ds = gdal.GetDriverByName("MEM").Create("", width, height, 1, datatype)
+    band = ds.GetRasterBand(1)
+    band.WriteRaster(
+        0,
+        0,
+        width,
+        height,
+        struct.pack(
+            fmt * (width * height),
+            *[(i * 7919) % 251 for i in range(width * height)],
+        ),
+    )
+    if nodata_or_mask == "nodata":
+        band.SetNoDataValue(17)
+    elif nodata_or_mask == "mask":
+        ds.CreateMaskBand(gdal.GMF_PER_DATASET)
+        band.GetMaskBand().WriteRaster(
+            0,
+            0,
+            width,
+            height,
+            struct.pack(
+                "B" * (width * height),
+                *[255 if (i % 13) else 0 for i in range(width * height)],
+            ),
+        )
+
+    expected_minmax = band.ComputeRasterMinMax(False)
+    expected_stats = band.ComputeStatistics(False)
+    expected_hist = band.GetHistogram(-0.5, 255.5, 256, False, False)
+    expected_hist_scaled = band.GetHistogram(-10, 300, 7, True, False)
+
+    with gdal.config_option("GDAL_NUM_THREADS", "4"):
+        assert band.ComputeRasterMinMax(False) == expected_minmax
+        stats = band.ComputeStatistics(False)
+        if datatype in (gdal.GDT_Float32, gdal.GDT_Float64):
+            assert stats == pytest.approx(expected_stats, rel=1e-12)
+        else:
+            assert stats == expected_stats
+        assert band.GetHistogram(-0.5, 255.5, 256, False, False) == expected_hist
+        assert band.GetHistogram(-10, 300, 7, True, False) == expected_hist_scaled
@@ -13,6 +13,7 @@
 ###############################################################################
 
 import math
+import platform
 import struct
 import sys
 
@@ -3003,6 +3004,40 @@ def test_rasterio_rms_halfsize_downsampling_uint16_with_byte_content():
     internal_test_rasterio_rms_halfsize_downsampling_byte_content(gdal.GDT_UInt16, "H")
 
 
+###############################################################################
+# Test that the AVX2 kernels for downsampling by a factor of 2, selected at
+# runtime, give the same results as the SSE2 ones. GDAL_USE_AVX2=NO has no
+# effect on non-x86_64 CPUs, on CPUs without AVX2, and on builds of GDAL with
+# AVX2 enabled at compile time.
+
+
+@pytest.mark.parametrize("resampling", ["AVERAGE", "RMS"])
+@pytest.mark.parametrize("dt", [gdal.GDT_Byte, gdal.GDT_UInt16, gdal.GDT_Float32])
+def test_rasterio_halfsize_downsampling_avx2_vs_sse2(resampling, dt):
+
+    if platform.machine().lower() not in ("x86_64", "amd64"):
+        pytest.skip("AVX2 kernels only selected at runtime on x86_64")
+    if sys.platform.startswith("linux"):
+        with open("/proc/cpuinfo") as f:
+            if " avx2" not in f.read():
+                pytest.skip("CPU without AVX2")
+
+    gdaltest.importorskip_gdal_array()
+    numpy = pytest.importorskip("numpy")
+
+    max_val = 65535 if dt == gdal.GDT_UInt16 else 255
+    ar = numpy.random.default_rng(0).integers(0, max_val + 1, (64, 198))
+    ds = gdal.GetDriverByName("MEM").Create("", 198, 64, 1, dt)
+    ds.GetRasterBand(1).WriteArray(ar)
+
+    alg = gdal.GRIORA_Average if resampling == "AVERAGE" else gdal.GRIORA_RMS
+    res = []
+    for use_avx2 in ("YES", "NO"):
+        with gdal.config_option("GDAL_USE_AVX2", use_avx2):
+            res.append(ds.ReadRaster(buf_xsize=99, buf_ysize=32, resample_alg=alg))
+    assert res[0] == res[1]
+
+
 ###############################################################################
 # Test rms downsampling by a factor of 2. / 3, with float data type
 
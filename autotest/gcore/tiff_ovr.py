@@ -3143,3 +3143,40 @@ def test_tiff_ovr_INT_MAX_reduction_factor_external(tmp_vsimem):
     gdal.GetDriverByName("GTIFF").Create(tmp_vsimem / "out.tif", 20, 20)
     ds = gdal.Open(tmp_vsimem / "out.tif")
     ds.BuildOverviews("NEAR", [(1 << 31) - 1])
+
+
+###############################################################################
+# Test that generating several overview levels in a single pass over the
+# source gives the same result as generating them level by level
+
+
+@pytest.mark.parametrize("resampling", ["NEAREST", "AVERAGE", "CUBIC", "MODE"])
+@pytest.mark.parametrize(
+    "translate_options",
+    [
+        "-co COMPRESS=LZW",
+        "-b 1 -b 2 -b 3 -a_nodata 0 -co COMPRESS=LZW -co TILED=YES "
+        "-co BLOCKXSIZE=16 -co BLOCKYSIZE=16",
+    ],
+)
+@pytest.mark.parametrize("num_threads", ["1", "4"])
+def test_tiff_ovr_single_pass(tmp_vsimem, resampling, translate_options, num_threads):
+
+    def get_checksums(single_pass):
+        filename = tmp_vsimem / f"test_{single_pass}.tif"
+        ds = gdal.Translate(
+            filename, "data/stefan_full_rgba.tif", options=translate_options
+        )
+        with gdaltest.config_options(
+            {"GDAL_OVR_SINGLE_PASS": single_pass, "GDAL_NUM_THREADS": num_threads}
+        ):
+            ds.BuildOverviews(resampling, [2, 4, 8, 16])
+        ds = None
+        ds = gdal.Open(filename)
+        return [
+            ds.GetRasterBand(i + 1).GetOverview(j).Checksum()
+            for i in range(ds.RasterCount)
+            for j in range(4)
+        ]
+
+    assert get_checksums("YES") == get_checksums("NO")
@@ -11,6 +11,7 @@
 # SPDX-License-Identifier: MIT
 ###############################################################################
 
+import json
 import sys
 import time
 
@@ -1678,3 +1679,388 @@ def test_vsicurl_GDAL_HTTP_MAX_TOTAL_CONNECTIONS(server):
         full_filename = f"/vsicurl/http://localhost:{server.port}/test.bin"
         statres = gdal.VSIStatL(full_filename)
         assert statres.size == 3
+
+
+###############################################################################
+# Test CPL_VSIL_CURL_PERSISTENT_CACHE_DIR
+
+
+@gdaltest.enable_exceptions()
+def test_vsicurl_persistent_cache(server, tmp_path):
+
+    cache_dir = str(tmp_path / "cache")
+    url = "/vsicurl/http://localhost:%d/test_persistent_cache.bin" % server.port
+
+    def read(etag, content=None):
+        gdal.VSICurlClearCache()
+        handler = webserver.SequentialHandler()
+        handler.add("GET", "/", 404)
+        handler.add(
+            "HEAD",
+            "/test_persistent_cache.bin",
+            200,
+            {"Content-Length": "6", "ETag": '"%s"' % etag},
+        )
+        if content:
+            handler.add("GET", "/test_persistent_cache.bin", 200, {}, content)
+        with webserver.install_http_handler(handler):
+            with gdal.VSIFile(url, "rb") as f:
+                return f.read(6).decode("ascii")
+
+    with gdal.config_option("CPL_VSIL_CURL_PERSISTENT_CACHE_DIR", cache_dir):
+        assert read("etag1", "foobar") == "foobar"
+        assert len(gdal.ReadDirRecursive(cache_dir)) == 2
+
+        # Served from the persistent cache
+        assert read("etag1") == "foobar"
+
+        # Remote file has changed
+        assert read("etag2", "barbaz") == "barbaz"
+        assert read("etag2") == "barbaz"
+
+    gdal.VSICurlClearCache()
+
+
+###############################################################################
+# Test that content is not stored in the CPL_VSIL_CURL_PERSISTENT_CACHE_DIR
+# cache when the remote file has changed between the HEAD and GET requests
+
+
+def test_vsicurl_persistent_cache_etag_changed(server, tmp_path):
+
+    cache_dir = str(tmp_path / "cache")
+    url = "/vsicurl/http://localhost:%d/test_persistent_cache.bin" % server.port
+
+    def read(head_etag, get_etag=None, content=None):
+        gdal.VSICurlClearCache()
+        handler = webserver.SequentialHandler()
+        handler.add("GET", "/", 404)
+        handler.add(
+            "HEAD",
+            "/test_persistent_cache.bin",
+            200,
+            {"Content-Length": "6", "ETag": '"%s"' % head_etag},
+        )
+        if content:
+            handler.add(
+                "GET",
+                "/test_persistent_cache.bin",
+                200,
+                {"ETag": '"%s"' % get_etag},
+                content,
+            )
+        with webserver.install_http_handler(handler):
+            with gdal.VSIFile(url, "rb") as f:
+                return f.read(6).decode("ascii")
+
+    with gdal.config_option("CPL_VSIL_CURL_PERSISTENT_CACHE_DIR", cache_dir):
+        # Content of etag2 must not be stored with the validator of etag1
+        assert read("etag1", "etag2", "barbaz") == "barbaz"
+        assert not gdal.ReadDirRecursive(cache_dir)
+
+        # Consistent validators: content is stored and reused
+        assert read("etag2", "etag2", "barbaz") == "barbaz"
+        assert len(gdal.ReadDirRecursive(cache_dir)) == 2
+        assert read("etag2") == "barbaz"
+
+    gdal.VSICurlClearCache()
+
+
+###############################################################################
+# Test that ReadMultiRange() (used by the GTiff driver to read several tiles
+# at once) is served from the CPL_VSIL_CURL_PERSISTENT_CACHE_DIR cache
+
+
+@gdaltest.enable_exceptions()
+@pytest.mark.require_driver("COG")
+def test_vsicurl_persistent_cache_read_multi_range(server, tmp_path):
+
+    src_ds = gdal.GetDriverByName("MEM").Create("", 512, 512)
+    src_ds.GetRasterBand(1).WriteRaster(
+        0, 0, 512, 512, bytes((i * 7) % 251 for i in range(512 * 512))
+    )
+    cog_filename = str(tmp_path / "test.tif")
+    gdal.GetDriverByName("COG").CreateCopy(
+        cog_filename, src_ds, options=["BLOCKSIZE=128", "COMPRESS=NONE"]
+    )
+    with open(cog_filename, "rb") as f:
+        content = f.read()
+
+    cache_dir = str(tmp_path / "cache")
+    url = "/vsicurl/http://localhost:%d/test_persistent_cache.tif" % server.port
+
+    def add_head(handler):
+        handler.add(
+            "HEAD",
+            "/test_persistent_cache.tif",
+            200,
+            {"Content-Length": "%d" % len(content), "ETag": '"etag"'},
+        )
+
+    with gdal.config_options(
+        {
+            "CPL_VSIL_CURL_PERSISTENT_CACHE_DIR": cache_dir,
+            "GDAL_DISABLE_READDIR_ON_OPEN": "EMPTY_DIR",
+        }
+    ):
+        # Fill the persistent cache
+        gdal.VSICurlClearCache()
+        handler = webserver.SequentialHandler()
+        add_head(handler)
+        handler.add("GET", "/test_persistent_cache.tif", 200, {}, content)
+        with webserver.install_http_handler(handler):
+            with gdal.VSIFile(url, "rb") as f:
+                assert f.read(len(content)) == content
+
+        # No GET request is expected
+        gdal.VSICurlClearCache()
+        handler = webserver.SequentialHandler()
+        add_head(handler)
+        with webserver.install_http_handler(handler):
+            ds = gdal.Open(url)
+            assert (
+                ds.GetRasterBand(1).ReadRaster()
+                == src_ds.GetRasterBand(1).ReadRaster()
+            )
+            ds.Close()
+
+    gdal.VSICurlClearCache()
+
+
+###############################################################################
+# Test CPL_VSIL_CURL_PERSISTENT_CACHE_METADATA_TTL
+
+
+@gdaltest.enable_exceptions()
+def test_vsicurl_persistent_metadata_cache(server, tmp_path):
+
+    cache_dir = str(tmp_path / "cache")
+    url = "/vsicurl/http://localhost:%d/test_persistent_metadata" % server.port
+
+    with gdal.config_options(
+        {
+            "CPL_VSIL_CURL_PERSISTENT_CACHE_DIR": cache_dir,
+            "CPL_VSIL_CURL_PERSISTENT_CACHE_METADATA_TTL": "60",
+        }
+    ):
+        gdal.VSICurlClearCache()
+        handler = webserver.SequentialHandler()
+        handler.add(
+            "HEAD", "/test_persistent_metadata.bin", 200, {"Content-Length": "3"}
+        )
+        handler.add("HEAD", "/test_persistent_metadata_missing.bin", 404)
+        with webserver.install_http_handler(handler):
+            assert gdal.VSIStatL(url + ".bin").size == 3
+            assert gdal.VSIStatL(url + "_missing.bin") is None
+
+        assert len(gdal.ReadDirRecursive(cache_dir + "/metadata")) == 2
+
+        # Simulate another process by clearing the in-memory cache: no request
+        # should be issued
+        gdal.VSICurlClearCache()
+        gdal.NetworkStatsReset()
+        with gdaltest.config_option(
+            "CPL_VSIL_NETWORK_STATS_ENABLED", "YES", thread_local=False
+        ):
+            with webserver.install_http_handler(webserver.SequentialHandler()):
+                assert gdal.VSIStatL(url + ".bin").size == 3
+                assert gdal.VSIStatL(url + "_missing.bin") is None
+
+        j = json.loads(gdal.NetworkStatsGetAsSerializedJSON())
+        assert j["avoided_by_persistent_cache"] == {"HEAD": {"count": 2}}
+        gdal.NetworkStatsReset()
+
+    # Without the option, the persistent entries are ignored
+    gdal.VSICurlClearCache()
+    handler = webserver.SequentialHandler()
+    handler.add(
+        "HEAD", "/test_persistent_metadata.bin", 200, {"Content-Length": "4"}
+    )
+    with gdal.config_option("CPL_VSIL_CURL_PERSISTENT_CACHE_DIR", cache_dir):
+        with webserver.install_http_handler(handler):
+            assert gdal.VSIStatL(url + ".bin").size == 4
+
+    gdal.VSICurlClearCache()
+
+
+###############################################################################
+# Test that the persistent metadata cache is not used for authenticated access
+
+
+@pytest.mark.parametrize(
+    "auth_options",
+    [
+        {"GDAL_HTTP_USERPWD": "user:password"},
+        {"GDAL_HTTP_BEARER": "token"},
+        {"GDAL_HTTP_HEADERS": "Authorization: secret"},
+    ],
+)
+def test_vsicurl_persistent_metadata_cache_authenticated(
+    server, tmp_path, auth_options
+):
+
+    cache_dir = str(tmp_path / "cache")
+    url = "/vsicurl/http://localhost:%d/test_persistent_metadata_auth.bin" % (
+        server.port
+    )
+
+    with gdal.config_options(
+        {
+            "CPL_VSIL_CURL_PERSISTENT_CACHE_DIR": cache_dir,
+            "CPL_VSIL_CURL_PERSISTENT_CACHE_METADATA_TTL": "60",
+            **auth_options,
+        }
+    ):
+        gdal.VSICurlClearCache()
+        handler = webserver.SequentialHandler()
+        handler.add(
+            "HEAD",
+            "/test_persistent_metadata_auth.bin",
+            200,
+            {"Content-Length": "3"},
+        )
+        with webserver.install_http_handler(handler):
+            assert gdal.VSIStatL(url).size == 3
+
+    assert gdal.ReadDirRecursive(cache_dir + "/metadata") is None
+
+    gdal.VSICurlClearCache()
+
+
+###############################################################################
+# Handler serving byte ranges of a single file
+
+
+class RangeRequestHandler:
+    def __init__(self, path, data):
+        self.path = path
+        self.data = data
+
+    def final_check(self):
+        pass
+
+    def do_HEAD(self, request):
+        if request.path != self.path:
+            request.send_response(404)
+            request.end_headers()
+            return
+        request.send_response(200)
+        request.send_header("Content-Length", len(self.data))
+        request.end_headers()
+
+    def do_GET(self, request):
+        if request.path != self.path:
+            request.send_response(404)
+            request.end_headers()
+            return
+        start, end = (
+            int(x) for x in request.headers["Range"][len("bytes=") :].split("-")
+        )
+        end = min(end, len(self.data) - 1)
+        request.send_response(206)
+        request.send_header(
+            "Content-Range", "bytes %d-%d/%d" % (start, end, len(self.data))
+        )
+        request.send_header("Content-Length", end - start + 1)
+        request.end_headers()
+        request.wfile.write(self.data[start : end + 1])
+
+
+###############################################################################
+# Test GDAL_HTTP_MERGE_RANGES_MAX_GAP and the STATISTICS metadata domain
+
+
+@gdaltest.enable_exceptions()
+def test_vsicurl_merge_ranges_max_gap(server, tmp_vsimem):
+
+    src_filename = str(tmp_vsimem / "test.tif")
+    src_ds = gdal.GetDriverByName("MEM").Create("", 1024, 1024)
+    src_ds.GetRasterBand(1).Fill(1)
+    gdal.GetDriverByName("GTiff").CreateCopy(
+        src_filename,
+        src_ds,
+        options=["TILED=YES", "BLOCKXSIZE=256", "BLOCKYSIZE=256"],
+    )
+    with gdal.VSIFile(src_filename, "rb") as f:
+        data = f.read()
+
+    url = "/vsicurl/http://localhost:%d/test.tif" % server.port
+
+    gdal.VSICurlClearCache()
+    with webserver.install_http_handler(
+        RangeRequestHandler("/test.tif", data)
+    ), gdal.config_options(
+        {
+            "GDAL_HTTP_MULTIRANGE": "YES",
+            "GDAL_HTTP_MERGE_RANGES_MAX_GAP": "1000000",
+        }
+    ):
+        ds = gdal.Open(url)
+        # Window covering the first tile of the first two tile rows, which
+        # are separated in the file by the other tiles of the first row.
+        assert ds.GetRasterBand(1).ReadRaster(0, 200, 100, 100) == b"\x01" * (
+            100 * 100
+        )
+        md = gdal.GetFileMetadata(url, "STATISTICS")
+        ds = None
+
+    assert int(md["MULTI_RANGE_CALLS"]) == 1
+    assert int(md["RANGES"]) == 2
+    assert int(md["REQUESTS"]) == 1
+    assert int(md["DOWNLOADED_BYTES"]) > int(md["REQUESTED_BYTES"])
+    assert int(md["IN_FLIGHT_REQUESTS"]) == 0
+    assert int(md["MAX_IN_FLIGHT_REQUESTS"]) == 1
+
+    gdal.VSICurlClearCache()
+
+
+###############################################################################
+# Test CPL_VSIL_CURL_READ_AHEAD
+
+
+@gdaltest.enable_exceptions()
+def test_vsicurl_read_ahead(server):
+
+    data = bytes(range(256)) * 4096
+    url = "/vsicurl/http://localhost:%d/test_read_ahead.bin" % server.port
+
+    gdal.VSICurlClearCache()
+    with webserver.install_http_handler(
+        RangeRequestHandler("/test_read_ahead.bin", data)
+    ), gdal.config_options(
+        {
+            "GDAL_DISABLE_READDIR_ON_OPEN": "EMPTY_DIR",
+            "CPL_VSIL_CURL_READ_AHEAD_CHUNK_SIZE": "65536",
+        }
+    ):
+        try:
+            gdal.SetPathSpecificOption(url, "CPL_VSIL_CURL_READ_AHEAD", "YES")
+
+            # Sequential read
+            with gdal.VSIFile(url, "rb") as f:
+                got = b""
+                while True:
+                    chunk = f.read(4000)
+                    if not chunk:
+                        break
+                    got += chunk
+            assert got == data
+
+            md = gdal.GetFileMetadata(url, "STATISTICS")
+            assert int(md["READ_AHEAD_HITS"]) > 0
+            assert int(md["READ_AHEAD_REQUESTS"]) > 0
+            assert int(md["READ_AHEAD_CHUNKS"]) > 0
+
+            # Seeking outside of the read-ahead window
+            gdal.VSICurlClearCache()
+            with gdal.VSIFile(url, "rb") as f:
+                for _ in range(10):
+                    assert len(f.read(4000)) == 4000
+                f.seek(700000)
+                assert f.read(4000) == data[700000:704000]
+                f.seek(100)
+                assert f.read(4000) == data[100:4100]
+        finally:
+            gdal.ClearPathSpecificOptions(url)
+
+    gdal.VSICurlClearCache()
@@ -914,6 +914,82 @@ def test_vsigzip_multi_thread():
         pytest.fail()
 
 
+###############################################################################
+# Test the indexed reader with parallel decompression
+
+
+@pytest.mark.parametrize("independent_blocks", [True, False])
+def test_vsigzip_indexed_reader(tmp_path, independent_blocks):
+
+    import gzip
+
+    data = os.urandom(10 * 1024 * 1024 + 1)
+    filename = str(tmp_path / "test.gz")
+    if independent_blocks:
+        with gdaltest.config_option("GDAL_NUM_THREADS", "2"):
+            f = gdal.VSIFOpenL("/vsigzip/" + filename, "wb")
+            gdal.VSIFWriteL(data, 1, len(data), f)
+            gdal.VSIFCloseL(f)
+    else:
+        with gzip.open(filename, "wb") as f:
+            f.write(data)
+
+    def check(f):
+        assert gdal.VSIFSeekL(f, 0, 2) == 0
+        assert gdal.VSIFTellL(f) == len(data)
+        for offset, size in [(len(data) - 10, 100), (5000000, 100000), (1, 10)]:
+            assert gdal.VSIFSeekL(f, offset, 0) == 0
+            assert gdal.VSIFReadL(1, size, f) == data[offset : offset + size]
+
+    with gdaltest.config_options(
+        {"CPL_VSIL_GZIP_NUM_THREADS": "2", "CPL_VSIL_GZIP_WRITE_INDEX": "YES"}
+    ):
+        f = gdal.VSIFOpenL("/vsigzip/" + filename, "rb")
+        assert gdal.VSIFReadL(1, len(data) + 1, f) == data
+        assert gdal.VSIFEofL(f)
+        check(f)
+        gdal.VSIFCloseL(f)
+
+        assert gdal.VSIStatL(filename + ".gzidx") is not None
+
+        f = gdal.VSIFOpenL("/vsigzip/" + filename, "rb")
+        check(f)
+        gdal.VSIFCloseL(f)
+
+    # Index in a separate directory
+    index_dir = tmp_path / "index"
+    index_dir.mkdir()
+    with gdaltest.config_options(
+        {
+            "CPL_VSIL_GZIP_WRITE_INDEX": "YES",
+            "CPL_VSIL_GZIP_INDEX_DIR": str(index_dir),
+        }
+    ):
+        f = gdal.VSIFOpenL("/vsigzip/" + filename, "rb")
+        check(f)
+        gdal.VSIFCloseL(f)
+    assert len(os.listdir(index_dir)) == 1
+
+
+###############################################################################
+# Test the indexed reader on concatenated gzip members
+
+
+def test_vsigzip_indexed_reader_concatenated_members(tmp_path):
+
+    import gzip
+
+    filename = str(tmp_path / "test.gz")
+    with open(filename, "wb") as f:
+        f.write(gzip.compress(b"hello "))
+        f.write(gzip.compress(b"world"))
+
+    with gdaltest.config_option("CPL_VSIL_GZIP_NUM_THREADS", "2"):
+        f = gdal.VSIFOpenL("/vsigzip/" + filename, "rb")
+        assert gdal.VSIFReadL(1, 100, f) == b"hello world"
+        gdal.VSIFCloseL(f)
+
+
 ###############################################################################
 # Test vsisync()
 
@@ -970,6 +1046,46 @@ def test_vsisync():
     gdal.RmdirRecursive("/vsimem/out")
 
 
+###############################################################################
+# Test that vsisync() with NUM_THREADS gives the same tree as the serial one
+
+
+@pytest.mark.parametrize("recursive", ["YES", "NO"])
+def test_vsisync_num_threads(tmp_vsimem, recursive):
+
+    src = tmp_vsimem / "src"
+    gdal.Mkdir(src, 0o755)
+    for i in range(5):
+        gdal.FileFromMemBuffer(src / f"file{i}.txt", "x" * i)
+    gdal.Mkdir(src / "subdir", 0o755)
+    gdal.FileFromMemBuffer(src / "subdir" / "a.txt", "a")
+    gdal.Mkdir(src / "subdir" / "subsubdir", 0o755)
+    gdal.FileFromMemBuffer(src / "subdir" / "subsubdir" / "b.txt", "bb")
+    gdal.Mkdir(src / "emptydir", 0o755)
+
+    def get_tree(dirname):
+        return sorted(
+            (x, gdal.VSIStatL(f"{dirname}/{x.rstrip('/')}").size)
+            for x in gdal.ReadDirRecursive(dirname)
+        )
+
+    assert gdal.Sync(
+        f"{src}/", tmp_vsimem / "serial", options=[f"RECURSIVE={recursive}"]
+    )
+    assert gdal.Sync(
+        f"{src}/",
+        tmp_vsimem / "parallel",
+        options=[f"RECURSIVE={recursive}", "NUM_THREADS=4"],
+    )
+
+    serial_tree = get_tree(tmp_vsimem / "serial")
+    if recursive == "YES":
+        assert serial_tree == get_tree(src)
+    else:
+        assert "subdir/a.txt" not in [x[0] for x in serial_tree]
+    assert get_tree(tmp_vsimem / "parallel") == serial_tree
+
+
 ###############################################################################
 # Test gdal.OpenDir()
 
@@ -3135,6 +3135,119 @@ def test_vsis3_write_multipart_retry(aws_test_config, webserver_port):
                 gdal.VSIFCloseL(f)
 
 
+###############################################################################
+# Test multipart upload with parts uploaded in parallel
+
+
+def test_vsis3_write_multipart_parallel(aws_test_config, webserver_port):
+
+    size = 3 * 1024 * 1024 + 1
+    big_buffer = "a" * size
+
+    handler = webserver.NonSequentialMockedHttpHandler()
+    handler.add(
+        "POST",
+        "/s3_fake_bucket4/large_file.tif?uploads",
+        200,
+        {},
+        """<?xml version="1.0" encoding="UTF-8"?>
+        <InitiateMultipartUploadResult>
+        <UploadId>my_id</UploadId>
+        </InitiateMultipartUploadResult>""",
+    )
+    for part in range(1, 5):
+        handler.add(
+            "PUT",
+            "/s3_fake_bucket4/large_file.tif?partNumber=%d&uploadId=my_id" % part,
+            200,
+            {"ETag": '"etag%d"' % part, "Content-Length": "0"},
+            b"",
+            expected_headers={"Content-Length": "1" if part == 4 else "1048576"},
+        )
+    handler.add(
+        "POST",
+        "/s3_fake_bucket4/large_file.tif?uploadId=my_id",
+        200,
+        {},
+        b"",
+        expected_body=b"""<CompleteMultipartUpload>
+<Part>
+<PartNumber>1</PartNumber><ETag>"etag1"</ETag></Part>
+<Part>
+<PartNumber>2</PartNumber><ETag>"etag2"</ETag></Part>
+<Part>
+<PartNumber>3</PartNumber><ETag>"etag3"</ETag></Part>
+<Part>
+<PartNumber>4</PartNumber><ETag>"etag4"</ETag></Part>
+</CompleteMultipartUpload>
+""",
+    )
+
+    with gdaltest.config_options(
+        {"VSIS3_CHUNK_SIZE": "1", "CPL_VSIL_UPLOAD_NUM_THREADS": "3"},
+        thread_local=False,
+    ):
+        with webserver.install_http_handler(handler):
+            f = gdal.VSIFOpenL("/vsis3/s3_fake_bucket4/large_file.tif", "wb")
+            assert f is not None
+            assert gdal.VSIFWriteL(big_buffer, 1, size, f) == size
+            gdal.ErrorReset()
+            assert gdal.VSIFCloseL(f) == 0
+            assert gdal.GetLastErrorMsg() == ""
+
+
+###############################################################################
+# Test that a failed part upload aborts a parallel multipart upload
+
+
+def test_vsis3_write_multipart_parallel_part_error(aws_test_config, webserver_port):
+
+    size = 3 * 1024 * 1024 + 1
+    big_buffer = "a" * size
+
+    handler = webserver.NonSequentialMockedHttpHandler()
+    handler.add(
+        "POST",
+        "/s3_fake_bucket4/large_file.tif?uploads",
+        200,
+        {},
+        """<?xml version="1.0" encoding="UTF-8"?>
+        <InitiateMultipartUploadResult>
+        <UploadId>my_id</UploadId>
+        </InitiateMultipartUploadResult>""",
+    )
+    for part in range(1, 4):
+        handler.add(
+            "PUT",
+            "/s3_fake_bucket4/large_file.tif?partNumber=%d&uploadId=my_id" % part,
+            200,
+            {"ETag": '"etag%d"' % part, "Content-Length": "0"},
+            b"",
+        )
+    # The last part is uploaded from Close()
+    handler.add(
+        "PUT",
+        "/s3_fake_bucket4/large_file.tif?partNumber=4&uploadId=my_id",
+        400,
+    )
+    handler.add(
+        "DELETE",
+        "/s3_fake_bucket4/large_file.tif?uploadId=my_id",
+        204,
+    )
+
+    with gdaltest.config_options(
+        {"VSIS3_CHUNK_SIZE": "1", "CPL_VSIL_UPLOAD_NUM_THREADS": "3"},
+        thread_local=False,
+    ):
+        with webserver.install_http_handler(handler):
+            f = gdal.VSIFOpenL("/vsis3/s3_fake_bucket4/large_file.tif", "wb")
+            assert f is not None
+            assert gdal.VSIFWriteL(big_buffer, 1, size, f) == size
+            with gdal.quiet_errors():
+                assert gdal.VSIFCloseL(f) != 0
+
+
 ###############################################################################
 # Test abort pending multipart uploads
 
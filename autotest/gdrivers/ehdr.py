@@ -390,3 +390,50 @@ def test_ehdr_approx_stats_flag():
     ds = None
 
     gdal.GetDriverByName("EHDR").Delete(tmpfile)
+
+
+###############################################################################
+# Test memory mapped I/O, with byte swapping and data type conversion
+
+
+@pytest.mark.parametrize("layout", ["BIL", "BIP", "BSQ"])
+def test_ehdr_mmap_io(tmp_path, layout):
+
+    width, height, bands = 37, 23, 3
+    filename = str(tmp_path / "test.bil")
+    with open(filename[0:-4] + ".hdr", "wt") as f:
+        f.write(f"""BYTEORDER M
+LAYOUT {layout}
+NROWS {height}
+NCOLS {width}
+NBANDS {bands}
+NBITS 16
+PIXELTYPE SIGNEDINT
+""")
+    values = [(i * 37 + 11) % 65536 - 32768 for i in range(width * height * bands)]
+    with open(filename, "wb") as f:
+        f.write(struct.pack(">%dh" % len(values), *values))
+
+    def read_all():
+        ds = gdal.Open(filename)
+        res = []
+        for buf_type in [gdal.GDT_Int16, gdal.GDT_Float64]:
+            res.append(ds.ReadRaster(buf_type=buf_type))
+            res.append(ds.ReadRaster(3, 5, 20, 11, buf_type=buf_type))
+            res.append(ds.ReadRaster(3, 5, 20, 11, 7, 4, buf_type=buf_type))
+            res.append(ds.ReadRaster(3, 5, 20, 11, 40, 22, buf_type=buf_type))
+            for i in range(bands):
+                band = ds.GetRasterBand(i + 1)
+                res.append(band.ReadRaster(1, 2, 30, 20, buf_type=buf_type))
+                res.append(band.ReadRaster(1, 2, 30, 20, 9, 8, buf_type=buf_type))
+                res.append(band.Checksum())
+        return res
+
+    with gdal.config_option("RAW_USE_MMAP", "NO"):
+        ref = read_all()
+    with gdal.config_option("RAW_USE_MMAP", "YES"):
+        got = read_all()
+    assert got == ref
+    ds = gdal.Open(filename)
+    data = ds.GetRasterBand(1).ReadRaster(0, 0, 1, 1)
+    assert struct.unpack("h", data)[0] == values[0]
@@ -546,3 +546,61 @@ def test_ogr_join_on_special_field():
         assert f["a"] == "a2"
         assert f["b"] is None
         assert sql_lyr.GetNextFeature() is None
+
+
+###############################################################################
+# Test that hash joins give the same results as attribute filter based joins
+
+
+def _get_join_results(ds, sql):
+    with ds.ExecuteSQL(sql) as sql_lyr:
+        return [
+            [f.GetField(i) for i in range(f.GetFieldCount())] + [f.GetFID()]
+            for f in sql_lyr
+        ]
+
+
+@pytest.mark.parametrize(
+    "on_clause",
+    [
+        "first.ikey = second.ikey",
+        "second.ikey = first.ikey",
+        "first.ikey = second.rkey",
+        "first.rkey = second.rkey",
+        "first.skey = second.skey",
+        "first.FID = second.ikey",
+    ],
+)
+def test_ogr_join_hash(on_clause):
+
+    ds = ogr.GetDriverByName("MEM").CreateDataSource("")
+    lyr = ds.CreateLayer("first")
+    ogrtest.quick_create_layer_def(
+        lyr, [["ikey", ogr.OFTInteger], ["rkey", ogr.OFTReal], ["skey"]]
+    )
+    for i in range(20):
+        ogrtest.quick_create_feature(lyr, [i % 7, i % 5 + 0.5, "k%d" % (i % 6)], None)
+    ogrtest.quick_create_feature(lyr, [None, None, None], None)
+
+    lyr = ds.CreateLayer("second")
+    ogrtest.quick_create_layer_def(
+        lyr,
+        [["ikey", ogr.OFTInteger64], ["rkey", ogr.OFTReal], ["skey"], ["val"]],
+    )
+    for i in range(10):
+        ogrtest.quick_create_feature(
+            lyr, [i % 5, i + 0.5, "K%d" % (i % 4), "val%d" % i], "POINT (%d 0)" % i
+        )
+    ogrtest.quick_create_feature(lyr, [None, None, None, "null"], None)
+
+    sql = "SELECT * FROM first LEFT JOIN second ON " + on_clause
+    with gdal.config_option("OGR_SQL_JOIN_METHOD", "FILTER"):
+        expected = _get_join_results(ds, sql)
+    assert any(row[-2] is not None for row in expected)
+
+    with gdal.config_option("OGR_SQL_JOIN_METHOD", "HASH"):
+        assert _get_join_results(ds, sql) == expected
+
+        # Spill to temporary file
+        with gdal.config_option("OGR_SQL_JOIN_HASH_MAX_MEMORY", "100"):
+            assert _get_join_results(ds, sql) == expected
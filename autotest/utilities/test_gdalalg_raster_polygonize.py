@@ -48,6 +48,23 @@ def test_gdalalg_raster_polygonize():
     )
 
 
+@pytest.mark.parametrize("connect_diagonal_pixels", [False, True])
+def test_gdalalg_raster_polygonize_num_threads(connect_diagonal_pixels):
+
+    def polygonize(num_threads):
+        alg = get_alg()
+        alg["input"] = "../gcore/data/byte.tif"
+        alg["output"] = ""
+        alg["output-format"] = "MEM"
+        alg["connect-diagonal-pixels"] = connect_diagonal_pixels
+        alg["num-threads"] = num_threads
+        assert alg.Run()
+        lyr = alg["output"].GetDataset().GetLayerByName("polygonize")
+        return sorted((f["DN"], f.GetGeometryRef().ExportToWkt()) for f in lyr)
+
+    assert polygonize("4") == polygonize("1")
+
+
 def test_gdalalg_raster_polygonize_invalid_driver():
 
     alg = get_alg()
@@ -170,6 +170,34 @@ def create_gtiff_from_array(
                 dtype=np.float32,
             ),
         ),
+        # Test exact Euclidean distance transform
+        (
+            {
+                "datatype": "Float32",
+                "target-values": [1],
+                "distance-units": "PIXEL",
+                "max-distance": 2,
+                "nodata": 0,
+                "algorithm": "edt",
+                "num-threads": 2,
+            },
+            np.array(
+                [[0.0, 0.0, 2.0], [0.0, 1.4142135, 1.0], [2.0, 1.0, 0.0]],
+                dtype=np.float32,
+            ),
+        ),
+        (
+            {
+                "datatype": "Byte",
+                "target-values": [1, 3],
+                "distance-units": "PIXEL",
+                "max-distance": 2,
+                "nodata": 255,
+                "fixed-value": 128,
+                "algorithm": "edt",
+            },
+            np.array([[0, 128, 128], [128, 128, 128], [128, 128, 0]], dtype=np.uint8),
+        ),
         # Test using band 2
         (
             {
@@ -130,6 +130,35 @@ def test_gdalalg_vsi_copy_recursive_destination_does_not_exist(tmp_vsimem):
     assert set(res) == set(gdal.ReadDirRecursive(tmp_vsimem / "src"))
 
 
+def test_gdalalg_vsi_copy_recursive_num_threads(tmp_vsimem):
+
+    gdal.Mkdir(tmp_vsimem / "src", 0o755)
+    for i in range(10):
+        gdal.FileFromMemBuffer(tmp_vsimem / "src" / f"file{i}", "foo" * i)
+    gdal.Mkdir(tmp_vsimem / "src" / "subdir", 0o755)
+    gdal.FileFromMemBuffer(tmp_vsimem / "src" / "subdir" / "b", "bar")
+    gdal.Mkdir(tmp_vsimem / "src" / "subdir" / "subsubdir", 0o755)
+    gdal.FileFromMemBuffer(tmp_vsimem / "src" / "subdir" / "subsubdir" / "c", "baz")
+
+    last_pct = [0]
+
+    def my_progress(pct, msg, user_data):
+        last_pct[0] = pct
+        return True
+
+    alg = get_alg()
+    alg["source"] = tmp_vsimem / "src"
+    alg["destination"] = tmp_vsimem / "dst"
+    alg["recursive"] = True
+    alg["num-threads"] = 4
+    assert alg.Run(my_progress)
+    assert last_pct[0] == 1.0
+    res = set(gdal.ReadDirRecursive(tmp_vsimem / "dst"))
+    assert set(res) == set(gdal.ReadDirRecursive(tmp_vsimem / "src"))
+    for i in range(10):
+        assert gdal.VSIStatL(tmp_vsimem / "dst" / f"file{i}").size == 3 * i
+
+
 def test_gdalalg_vsi_copy_recursive_destination_exists(tmp_vsimem):
 
     gdal.Mkdir(tmp_vsimem / "src", 0o755)
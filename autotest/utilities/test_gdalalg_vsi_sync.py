@@ -31,6 +31,41 @@ def test_gdalalg_vsi_sync_nominal(tmp_vsimem, tmp_path):
     assert gdal.VSIStatL(tmp_path / "dest.bin").size == 3
 
 
+@pytest.mark.parametrize("num_threads", [None, 4])
+def test_gdalalg_vsi_sync_directory(tmp_vsimem, tmp_path, num_threads):
+
+    gdal.Mkdir(tmp_vsimem / "src", 0o755)
+    for i in range(10):
+        gdal.FileFromMemBuffer(tmp_vsimem / "src" / f"file{i}", "foo" * i)
+    gdal.Mkdir(tmp_vsimem / "src" / "subdir", 0o755)
+    gdal.FileFromMemBuffer(tmp_vsimem / "src" / "subdir" / "b", "bar")
+
+    alg = get_alg()
+    alg["source"] = f"{tmp_vsimem}/src/"
+    alg["destination"] = tmp_path / "dst"
+    alg["recursive"] = True
+    if num_threads:
+        alg["num-threads"] = num_threads
+    assert alg.Run()
+    assert set(gdal.ReadDirRecursive(tmp_path / "dst")) == set(
+        gdal.ReadDirRecursive(tmp_vsimem / "src")
+    )
+    for i in range(10):
+        assert gdal.VSIStatL(tmp_path / "dst" / f"file{i}").size == 3 * i
+
+    # Overwrite strategy
+    gdal.FileFromMemBuffer(tmp_vsimem / "src" / "file1", "FOO")
+    alg = get_alg()
+    alg["source"] = f"{tmp_vsimem}/src/"
+    alg["destination"] = tmp_path / "dst"
+    alg["recursive"] = True
+    alg["strategy"] = "overwrite"
+    if num_threads:
+        alg["num-threads"] = num_threads
+    assert alg.Run()
+    assert open(tmp_path / "dst" / "file1", "rb").read() == b"FOO"
+
+
 def test_gdalalg_vsi_sync_source_does_not_exist(tmp_vsimem):
 
     alg = get_alg()
@@ -910,3 +910,101 @@ def test_gdaldem_lib_dict_arguments():
     ind = opt.index("-co")
 
     assert opt[ind : ind + 4] == ["-co", "COMPRESS=DEFLATE", "-co", "LEVEL=4"]
+
+
+###############################################################################
+# Test that multi-threaded processing gives the same result as single-threaded
+# processing, both when materializing the output and when streaming it. The
+# chunk size is lowered so that the raster is processed in several chunks.
+
+
+@pytest.mark.parametrize(
+    "processing,kwargs",
+    [
+        ("hillshade", {"zFactor": 30}),
+        ("hillshade", {"zFactor": 30, "computeEdges": True}),
+        ("hillshade", {"zFactor": 30, "multiDirectional": True}),
+        ("hillshade", {"zFactor": 30, "combined": True}),
+        ("hillshade", {"zFactor": 30, "igor": True}),
+        ("hillshade", {"zFactor": 30, "alg": "ZevenbergenThorne"}),
+        ("slope", {}),
+        ("slope", {"computeEdges": True}),
+        ("slope", {"alg": "ZevenbergenThorne"}),
+        ("aspect", {}),
+        ("aspect", {"alg": "ZevenbergenThorne"}),
+        ("TRI", {}),
+        ("TRI", {"alg": "Wilson"}),
+        ("TPI", {}),
+        ("roughness", {"computeEdges": True}),
+        ("color-relief", {"colorFilename": "data/color_file.txt"}),
+    ],
+)
+@pytest.mark.parametrize("format", ["MEM", "stream"])
+def test_gdaldem_lib_num_threads(processing, kwargs, format):
+
+    src_ds = gdal.Open("../gdrivers/data/n43.tif")
+    src_ds.GetRasterBand(1).SetNoDataValue(0)
+
+    ref_ds = gdal.DEMProcessing(
+        "",
+        src_ds,
+        processing,
+        options=["-num_threads", "1"],
+        format=format,
+        **kwargs,
+    )
+    # Chunks are then made of 4 lines per thread, hence 8 chunks for the
+    # 121 lines of n43.tif
+    with gdal.config_option("GDALDEM_CHUNK_MAX_SIZE", "1"):
+        ds = gdal.DEMProcessing(
+            "",
+            src_ds,
+            processing,
+            options=["-num_threads", "4"],
+            format=format,
+            **kwargs,
+        )
+        assert ds.RasterCount == ref_ds.RasterCount
+        for i in range(ds.RasterCount):
+            assert ds.GetRasterBand(i + 1).ReadRaster() == ref_ds.GetRasterBand(
+                i + 1
+            ).ReadRaster()
+
+
+def test_gdaldem_lib_num_threads_config_option():
+
+    src_ds = gdal.Open("../gdrivers/data/n43.tif")
+    ref_ds = gdal.DEMProcessing("", src_ds, "hillshade", format="MEM")
+    with gdal.config_option("GDAL_NUM_THREADS", "ALL_CPUS"):
+        ds = gdal.DEMProcessing("", src_ds, "hillshade", format="MEM")
+    assert ds.GetRasterBand(1).ReadRaster() == ref_ds.GetRasterBand(1).ReadRaster()
+
+
+###############################################################################
+# Test that the vectorized code paths give the same result as the scalar ones
+
+
+@pytest.mark.parametrize(
+    "processing,kwargs",
+    [
+        ("hillshade", {"zFactor": 30, "xscale": 111120, "yscale": 111120 * 1.5}),
+        ("hillshade", {"zFactor": 30, "alg": "ZevenbergenThorne"}),
+        ("slope", {}),
+        ("slope", {"slopeFormat": "percent"}),
+        ("slope", {"alg": "ZevenbergenThorne"}),
+        ("aspect", {}),
+        ("aspect", {"trigonometric": True, "zeroForFlat": True}),
+        ("aspect", {"alg": "ZevenbergenThorne"}),
+    ],
+)
+@pytest.mark.parametrize("datatype", [gdal.GDT_Int16, gdal.GDT_Float32])
+def test_gdaldem_lib_vectorized_same_as_scalar(processing, kwargs, datatype):
+
+    src_ds = gdal.Translate(
+        "", "../gdrivers/data/n43.tif", format="MEM", outputType=datatype
+    )
+
+    with gdal.config_option("GDAL_USE_SSE2", "NO"):
+        ref_ds = gdal.DEMProcessing("", src_ds, processing, format="MEM", **kwargs)
+    ds = gdal.DEMProcessing("", src_ds, processing, format="MEM", **kwargs)
+    assert ds.GetRasterBand(1).ReadRaster() == ref_ds.GetRasterBand(1).ReadRaster()
@@ -14,6 +14,7 @@
 ###############################################################################
 
 import collections
+import contextlib
 import json
 import shutil
 import struct
@@ -4587,3 +4588,99 @@ def test_gdalwarp_te_srs_check_extent():
     assert out_ds.GetGeoTransform() == pytest.approx(
         (166021, 37108, 0.0, 0.0, 0.0, -36622), abs=1000
     )
+
+
+###############################################################################
+# Test the coordinate grid transformer (COORD_GRID_CACHE_DIR transformer option)
+
+
+def test_gdalwarp_lib_coord_grid_cache_dir(tmp_vsimem):
+
+    cache_dir = tmp_vsimem / "cache"
+
+    debug_msgs = []
+
+    def handler(eErrClass, err_no, msg):
+        if eErrClass == gdal.CE_Debug and (
+            msg.startswith("Loaded ") or msg.startswith("Saved ")
+        ):
+            debug_msgs.append(msg)
+
+    @contextlib.contextmanager
+    def collect_coord_grid_debug_msgs():
+        del debug_msgs[:]
+        with gdal.config_option("CPL_DEBUG", "COORDGRID"):
+            gdal.PushErrorHandler(handler)
+            gdal.SetCurrentErrorHandlerCatchDebug(True)
+            try:
+                yield
+            finally:
+                gdal.PopErrorHandler()
+
+    options = "-t_srs EPSG:32631 -te 200000 4000000 800000 6000000 -ts 150 500 -of MEM"
+
+    exact_ds = gdal.Warp(
+        "", "../gdrivers/data/small_world.tif", options=options + " -et 0"
+    )
+    exact_data = exact_ds.GetRasterBand(1).ReadRaster()
+
+    in_memory_ds = gdal.Warp(
+        "",
+        "../gdrivers/data/small_world.tif",
+        options=options,
+        transformerOptions=["COORD_GRID=YES"],
+    )
+    in_memory_cs = in_memory_ds.GetRasterBand(1).Checksum()
+    grid_data = in_memory_ds.GetRasterBand(1).ReadRaster()
+    assert sum(a != b for a, b in zip(exact_data, grid_data)) < len(grid_data) // 20
+
+    # First run computes the grid and saves it. Second run reuses it, without
+    # computing (and thus saving) any new block.
+    for i in range(2):
+        with collect_coord_grid_debug_msgs():
+            out_ds = gdal.Warp(
+                "",
+                "../gdrivers/data/small_world.tif",
+                options=options,
+                transformerOptions=[f"COORD_GRID_CACHE_DIR={cache_dir}"],
+            )
+            assert out_ds.GetRasterBand(1).Checksum() == in_memory_cs
+            del out_ds
+        assert len(gdal.ReadDir(cache_dir)) == 1
+        if i == 0:
+            assert any(msg.startswith("Saved ") for msg in debug_msgs)
+        else:
+            assert debug_msgs
+            assert all(msg.startswith("Loaded ") for msg in debug_msgs)
+
+    # Changing the target grid changes the key
+    gdal.Warp(
+        "",
+        "../gdrivers/data/small_world.tif",
+        options=options.replace("-ts 150 500", "-ts 300 1000"),
+        transformerOptions=[f"COORD_GRID_CACHE_DIR={cache_dir}"],
+    )
+    assert len(gdal.ReadDir(cache_dir)) == 2
+
+    # A warped VRT reuses the grid saved by a direct warp with the same
+    # error threshold, which must thus be serialized exactly
+    options += " -et 0.123456789"
+    gdal.Warp(
+        "",
+        "../gdrivers/data/small_world.tif",
+        options=options,
+        transformerOptions=[f"COORD_GRID_CACHE_DIR={cache_dir}"],
+    )
+    assert len(gdal.ReadDir(cache_dir)) == 3
+    vrt_filename = str(tmp_vsimem / "out.vrt")
+    gdal.Warp(
+        vrt_filename,
+        "../gdrivers/data/small_world.tif",
+        options=options.replace("-of MEM", "-of VRT"),
+        transformerOptions=[f"COORD_GRID_CACHE_DIR={cache_dir}"],
+    )
+    with collect_coord_grid_debug_msgs():
+        with gdal.Open(vrt_filename) as ds:
+            ds.GetRasterBand(1).Checksum()
+    assert len(gdal.ReadDir(cache_dir)) == 3
+    assert debug_msgs and all(msg.startswith("Loaded ") for msg in debug_msgs)
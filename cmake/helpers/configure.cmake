@@ -433,6 +433,8 @@ else ()
   endif()
 
   check_include_file("linux/userfaultfd.h" HAVE_USERFAULTFD_H)
+  # IORING_FEAT_SINGLE_MMAP is a proxy for recent enough (>= 5.4) kernel headers
+  check_symbol_exists(IORING_FEAT_SINGLE_MMAP "linux/io_uring.h" HAVE_IO_URING)
 endif ()
 
 if (${CMAKE_SYSTEM_NAME} MATCHES "Darwin")
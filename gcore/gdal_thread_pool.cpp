@@ -12,6 +12,12 @@
 
 #include "gdal_thread_pool.h"
 
+#include "cpl_conv.h"
+#include "cpl_multiproc.h"
+#include "cpl_string.h"
+
+#include <algorithm>
+#include <cstdlib>
 #include <mutex>
 
 // For unclear reasons, attempts at making this a std::unique_ptr<>, even
@@ -52,3 +58,24 @@ void GDALDestroyGlobalThreadPool()
     delete gpoCompressThreadPool;
     gpoCompressThreadPool = nullptr;
 }
+
+/************************************************************************/
+/*                         GDALGetNumThreads()                          */
+/************************************************************************/
+
+/** Return a number of threads from a value that is either "ALL_CPUS" or an
+ * integer.
+ *
+ * If pszValue is nullptr, the value of the GDAL_NUM_THREADS configuration
+ * option is used, with a default of 1.
+ *
+ * The returned value is in the [1, nMaxThreads] range.
+ */
+int GDALGetNumThreads(const char *pszValue, int nMaxThreads)
+{
+    if (pszValue == nullptr)
+        pszValue = CPLGetConfigOption("GDAL_NUM_THREADS", "1");
+    const int nThreads =
+        EQUAL(pszValue, "ALL_CPUS") ? CPLGetNumCPUs() : atoi(pszValue);
+    return std::max(1, std::min(nMaxThreads, nThreads));
+}
@@ -19,4 +19,7 @@ CPLWorkerThreadPool CPL_DLL *GDALGetGlobalThreadPool(int nThreads);
 
 void GDALDestroyGlobalThreadPool();
 
+int CPL_DLL GDALGetNumThreads(const char *pszValue = nullptr,
+                              int nMaxThreads = 128);
+
 #endif  // GDAL_THREAD_POOL_H
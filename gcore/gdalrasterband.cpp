@@ -24,10 +24,12 @@
 #include <cstdlib>
 #include <cstring>
 #include <algorithm>
+#include <functional>
 #include <limits>
 #include <memory>
 #include <new>
 #include <type_traits>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
@@ -41,6 +43,7 @@
 #include "gdal_priv_templates.hpp"
 #include "gdal_interpolateatpoint.h"
 #include "gdal_minmax_element.hpp"
+#include "gdal_thread_pool.h"
 
 /************************************************************************/
 /*                           GDALRasterBand()                           */
@@ -4087,6 +4090,354 @@ inline bool ARE_REAL_EQUAL(GFloat16 dfVal1, GFloat16 dfVal2, int ulp = 2)
                                       abs(dfVal1 + dfVal2) * ulp;
 }
 
+/************************************************************************/
+/*                  GDALRasterBandProcessInParallel()                   */
+/************************************************************************/
+
+// Scan the whole band (and its mask band, if not null) by chunks made of
+// full rows of blocks, and dispatch the processing of each chunk, split into
+// nThreads horizontal slices, to the global thread pool.
+// Reading is done from the calling thread only, so that drivers are not
+// required to be thread-safe (but multi-block requests will benefit from
+// drivers that use multi-threaded decoding), while the next chunk is read
+// concurrently with the processing of the current one.
+// fnProcessSlice(iSlice, pData, pabyMask, nLines, nLineStride) is called with
+// a slice index in [0, nThreads-1], so that callers can accumulate partial
+// results per slice without synchronization, since two jobs with the same
+// slice index never run at the same time. Each line has GetXSize() valid
+// pixels, and lines are nLineStride pixels apart. Lines of pData and pabyMask
+// are aligned on 64 bytes.
+
+typedef std::function<void(int iSlice, const void *pData,
+                           const GByte *pabyMask, int nLines, int nLineStride)>
+    GDALProcessSliceFunc;
+
+static bool GDALRasterBandProcessInParallel(
+    GDALRasterBand *poBand, GDALRasterBand *poMaskBand, int nThreads,
+    const GDALProcessSliceFunc &fnProcessSlice, const char *pszMessage,
+    GDALProgressFunc pfnProgress, void *pProgressData)
+{
+    const int nXSize = poBand->GetXSize();
+    const int nYSize = poBand->GetYSize();
+    const GDALDataType eDT = poBand->GetRasterDataType();
+    const int nDTSize = GDALGetDataTypeSizeBytes(eDT);
+    int nBlockXSize = 0;
+    int nBlockYSize = 0;
+    poBand->GetBlockSize(&nBlockXSize, &nBlockYSize);
+
+    constexpr int ALIGNMENT = 64;
+    if (nXSize > INT_MAX - ALIGNMENT)
+    {
+        CPLError(CE_Failure, CPLE_NotSupported, "Too large raster width");
+        return false;
+    }
+    const int nLineStride = DIV_ROUND_UP(nXSize, ALIGNMENT) * ALIGNMENT;
+    const size_t nLineBytes = static_cast<size_t>(nLineStride) * nDTSize;
+
+    // Chunks of about 64 MB, made of whole rows of blocks. When a single
+    // row of blocks is larger than that (large strips), use ranges of lines
+    // within it, so that the two chunk buffers remain within the budget.
+    constexpr size_t CHUNK_MAX_SIZE = 64 * 1024 * 1024;
+    int nChunkLines = static_cast<int>(std::min<size_t>(
+        nYSize, std::max<size_t>(1, CHUNK_MAX_SIZE / nLineBytes)));
+    if (nChunkLines >= nBlockYSize)
+        nChunkLines = (nChunkLines / nBlockYSize) * nBlockYSize;
+
+    using BufferUniquePtr = std::unique_ptr<GByte, decltype(&VSIFreeAligned)>;
+    std::vector<BufferUniquePtr> apabyData;
+    std::vector<BufferUniquePtr> apabyMask;
+    for (int i = 0; i < 2; ++i)
+    {
+        apabyData.emplace_back(
+            static_cast<GByte *>(VSI_MALLOC_ALIGNED_AUTO_VERBOSE(
+                nLineBytes * nChunkLines)),
+            VSIFreeAligned);
+        if (!apabyData.back())
+            return false;
+        if (poMaskBand)
+        {
+            apabyMask.emplace_back(
+                static_cast<GByte *>(VSI_MALLOC_ALIGNED_AUTO_VERBOSE(
+                    static_cast<size_t>(nLineStride) * nChunkLines)),
+                VSIFreeAligned);
+            if (!apabyMask.back())
+                return false;
+        }
+    }
+
+    const auto ReadChunk = [poBand, poMaskBand, nXSize, nLineStride, nDTSize,
+                            eDT, &apabyData, &apabyMask](int iBuffer, int nYOff,
+                                                         int nLines)
+    {
+        if (poBand->RasterIO(GF_Read, 0, nYOff, nXSize, nLines,
+                             apabyData[iBuffer].get(), nXSize, nLines, eDT,
+                             nDTSize,
+                             static_cast<GSpacing>(nLineStride) * nDTSize,
+                             nullptr) != CE_None)
+        {
+            return false;
+        }
+        return poMaskBand == nullptr ||
+               poMaskBand->RasterIO(GF_Read, 0, nYOff, nXSize, nLines,
+                                    apabyMask[iBuffer].get(), nXSize, nLines,
+                                    GDT_Byte, 1, nLineStride,
+                                    nullptr) == CE_None;
+    };
+
+    auto poThreadPool = GDALGetGlobalThreadPool(nThreads);
+    auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue()
+                                   : std::unique_ptr<CPLJobQueue>(nullptr);
+    if (!poJobQueue)
+        return false;
+
+    if (!ReadChunk(0, 0, std::min(nChunkLines, nYSize)))
+        return false;
+
+    int iBuffer = 0;
+    for (int nYOff = 0; nYOff < nYSize; nYOff += nChunkLines)
+    {
+        const int nLines = std::min(nChunkLines, nYSize - nYOff);
+        const int nSliceLines = DIV_ROUND_UP(nLines, nThreads);
+        for (int iSlice = 0; iSlice < nThreads; ++iSlice)
+        {
+            const int nSliceYOff = iSlice * nSliceLines;
+            if (nSliceYOff >= nLines)
+                break;
+            const int nSliceYSize = std::min(nSliceLines, nLines - nSliceYOff);
+            const GByte *pabyData = apabyData[iBuffer].get() +
+                                    static_cast<size_t>(nSliceYOff) *
+                                        nLineStride * nDTSize;
+            const GByte *pabyMask =
+                poMaskBand ? apabyMask[iBuffer].get() +
+                                 static_cast<size_t>(nSliceYOff) * nLineStride
+                           : nullptr;
+            poJobQueue->SubmitJob(
+                [&fnProcessSlice, iSlice, pabyData, pabyMask, nSliceYSize,
+                 nLineStride]()
+                {
+                    fnProcessSlice(iSlice, pabyData, pabyMask, nSliceYSize,
+                                   nLineStride);
+                });
+        }
+
+        // Read next chunk while the current one is processed
+        const int nNextYOff = nYOff + nChunkLines;
+        bool bOK = true;
+        if (nNextYOff < nYSize)
+        {
+            bOK = ReadChunk(1 - iBuffer, nNextYOff,
+                            std::min(nChunkLines, nYSize - nNextYOff));
+        }
+        poJobQueue->WaitCompletion();
+        if (!bOK)
+            return false;
+        iBuffer = 1 - iBuffer;
+
+        if (!pfnProgress(static_cast<double>(nYOff + nLines) / nYSize,
+                         pszMessage, pProgressData))
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/************************************************************************/
+/*                     ComputeHistogramForBuffer()                      */
+/************************************************************************/
+
+// Accumulate into panHistogram[] the values of a nXCheck x nYCheck buffer,
+// whose lines are nLineStride pixels apart.
+static void ComputeHistogramForBuffer(
+    const void *pData, GDALDataType eDataType, bool bSignedByte, int nXCheck,
+    int nYCheck, int nLineStride, const GByte *pabyMaskData,
+    const GDALNoDataValues &sNoDataValues, double dfMin, double dfScale,
+    int nBuckets, bool bIncludeOutOfRange, GUIntBig *panHistogram)
+{
+    // this is a special case for a common situation.
+    if (eDataType == GDT_Byte && !bSignedByte && dfScale == 1.0 &&
+        (dfMin >= -0.5 && dfMin <= 0.5) && nXCheck == nLineStride &&
+        nBuckets == 256)
+    {
+        const GPtrDiff_t nPixels = static_cast<GPtrDiff_t>(nXCheck) * nYCheck;
+        const GByte *pabyData = static_cast<const GByte *>(pData);
+
+        for (GPtrDiff_t i = 0; i < nPixels; i++)
+        {
+            if (pabyMaskData && pabyMaskData[i] == 0)
+                continue;
+            if (!(sNoDataValues.bGotNoDataValue &&
+                  (pabyData[i] ==
+                   static_cast<GByte>(sNoDataValues.dfNoDataValue))))
+            {
+                panHistogram[pabyData[i]]++;
+            }
+        }
+
+        return;
+    }
+
+    // This isn't the fastest way to do this, but is easier for now.
+    for (int iY = 0; iY < nYCheck; iY++)
+    {
+        for (int iX = 0; iX < nXCheck; iX++)
+        {
+            const GPtrDiff_t iOffset =
+                iX + static_cast<GPtrDiff_t>(iY) * nLineStride;
+
+            if (pabyMaskData && pabyMaskData[iOffset] == 0)
+                continue;
+
+            double dfValue = 0.0;
+
+            switch (eDataType)
+            {
+                case GDT_Byte:
+                {
+                    if (bSignedByte)
+                        dfValue =
+                            static_cast<const signed char *>(pData)[iOffset];
+                    else
+                        dfValue = static_cast<const GByte *>(pData)[iOffset];
+                    break;
+                }
+                case GDT_Int8:
+                    dfValue = static_cast<const GInt8 *>(pData)[iOffset];
+                    break;
+                case GDT_UInt16:
+                    dfValue = static_cast<const GUInt16 *>(pData)[iOffset];
+                    break;
+                case GDT_Int16:
+                    dfValue = static_cast<const GInt16 *>(pData)[iOffset];
+                    break;
+                case GDT_UInt32:
+                    dfValue = static_cast<const GUInt32 *>(pData)[iOffset];
+                    break;
+                case GDT_Int32:
+                    dfValue = static_cast<const GInt32 *>(pData)[iOffset];
+                    break;
+                case GDT_UInt64:
+                    dfValue = static_cast<double>(
+                        static_cast<const GUInt64 *>(pData)[iOffset]);
+                    break;
+                case GDT_Int64:
+                    dfValue = static_cast<double>(
+                        static_cast<const GInt64 *>(pData)[iOffset]);
+                    break;
+                case GDT_Float16:
+                {
+                    using namespace std;
+                    const GFloat16 hfValue =
+                        static_cast<const GFloat16 *>(pData)[iOffset];
+                    if (isnan(hfValue) ||
+                        (sNoDataValues.bGotFloat16NoDataValue &&
+                         ARE_REAL_EQUAL(hfValue, sNoDataValues.hfNoDataValue)))
+                        continue;
+                    dfValue = hfValue;
+                    break;
+                }
+                case GDT_Float32:
+                {
+                    const float fValue =
+                        static_cast<const float *>(pData)[iOffset];
+                    if (std::isnan(fValue) ||
+                        (sNoDataValues.bGotFloatNoDataValue &&
+                         ARE_REAL_EQUAL(fValue, sNoDataValues.fNoDataValue)))
+                        continue;
+                    dfValue = fValue;
+                    break;
+                }
+                case GDT_Float64:
+                    dfValue = static_cast<const double *>(pData)[iOffset];
+                    if (std::isnan(dfValue))
+                        continue;
+                    break;
+                case GDT_CInt16:
+                {
+                    double dfReal =
+                        static_cast<const GInt16 *>(pData)[iOffset * 2];
+                    double dfImag =
+                        static_cast<const GInt16 *>(pData)[iOffset * 2 + 1];
+                    dfValue = sqrt(dfReal * dfReal + dfImag * dfImag);
+                    break;
+                }
+                case GDT_CInt32:
+                {
+                    double dfReal =
+                        static_cast<const GInt32 *>(pData)[iOffset * 2];
+                    double dfImag =
+                        static_cast<const GInt32 *>(pData)[iOffset * 2 + 1];
+                    dfValue = sqrt(dfReal * dfReal + dfImag * dfImag);
+                    break;
+                }
+                case GDT_CFloat16:
+                {
+                    double dfReal =
+                        static_cast<const GFloat16 *>(pData)[iOffset * 2];
+                    double dfImag =
+                        static_cast<const GFloat16 *>(pData)[iOffset * 2 + 1];
+                    if (std::isnan(dfReal) || std::isnan(dfImag))
+                        continue;
+                    dfValue = sqrt(dfReal * dfReal + dfImag * dfImag);
+                    break;
+                }
+                case GDT_CFloat32:
+                {
+                    double dfReal =
+                        static_cast<const float *>(pData)[iOffset * 2];
+                    double dfImag =
+                        static_cast<const float *>(pData)[iOffset * 2 + 1];
+                    if (std::isnan(dfReal) || std::isnan(dfImag))
+                        continue;
+                    dfValue = sqrt(dfReal * dfReal + dfImag * dfImag);
+                    break;
+                }
+                case GDT_CFloat64:
+                {
+                    double dfReal =
+                        static_cast<const double *>(pData)[iOffset * 2];
+                    double dfImag =
+                        static_cast<const double *>(pData)[iOffset * 2 + 1];
+                    if (std::isnan(dfReal) || std::isnan(dfImag))
+                        continue;
+                    dfValue = sqrt(dfReal * dfReal + dfImag * dfImag);
+                    break;
+                }
+                case GDT_Unknown:
+                case GDT_TypeCount:
+                    CPLAssert(false);
+                    return;
+            }
+
+            if (eDataType != GDT_Float16 && eDataType != GDT_Float32 &&
+                sNoDataValues.bGotNoDataValue &&
+                ARE_REAL_EQUAL(dfValue, sNoDataValues.dfNoDataValue))
+                continue;
+
+            // Given that dfValue and dfMin are not NaN, and dfScale > 0 and
+            // finite, the result of the multiplication cannot be NaN
+            const double dfIndex = floor((dfValue - dfMin) * dfScale);
+
+            if (dfIndex < 0)
+            {
+                if (bIncludeOutOfRange)
+                    panHistogram[0]++;
+            }
+            else if (dfIndex >= nBuckets)
+            {
+                if (bIncludeOutOfRange)
+                    ++panHistogram[nBuckets - 1];
+            }
+            else
+            {
+                ++panHistogram[static_cast<int>(dfIndex)];
+            }
+        }
+    }
+}
+
 /************************************************************************/
 /*                            GetHistogram()                            */
 /************************************************************************/
@@ -4113,6 +4464,11 @@ inline bool ARE_REAL_EQUAL(GFloat16 dfVal1, GFloat16 dfVal2, int ulp = 2)
  * in generating histogram based luts for instance.  Generally bApproxOK is
  * much faster than an exactly computed histogram.
  *
+ * Starting with GDAL 3.12, the GDAL_NUM_THREADS configuration option can be
+ * set to "ALL_CPUS" or a integer value to specify the number of threads to use
+ * when computing an exact histogram. Reading is still done from the calling
+ * thread.
+ *
  * This method is the same as the C functions GDALGetRasterHistogram() and
  * GDALGetRasterHistogramEx().
  *
@@ -4463,6 +4819,73 @@ CPLErr GDALRasterBand::GetHistogram(double dfMin, double dfMax, int nBuckets,
                 nSampleRate += 1;
         }
 
+        /* --------------------------------------------------------------------
+         */
+        /*      Multi-threaded computation: each slice accumulates into   */
+        /*      its own histogram, which are summed at the end.           */
+        /* --------------------------------------------------------------------
+         */
+        const int nThreads = nSampleRate == 1 ? GDALGetNumThreads() : 1;
+        if (nThreads > 1)
+        {
+            std::vector<std::vector<GUIntBig>> aanSliceHistograms;
+            try
+            {
+                aanSliceHistograms.resize(nThreads,
+                                          std::vector<GUIntBig>(nBuckets));
+            }
+            catch (const std::bad_alloc &)
+            {
+                ReportError(CE_Failure, CPLE_OutOfMemory,
+                            "Out of memory in GetHistogram()");
+                return CE_Failure;
+            }
+
+            const int nXSize = nRasterXSize;
+            const size_t nDTSize = GDALGetDataTypeSizeBytes(eDataType);
+            const auto ProcessSlice =
+                [this, nXSize, nDTSize, bSignedByte, &sNoDataValues, dfMin,
+                 dfScale, nBuckets, bIncludeOutOfRange,
+                 &aanSliceHistograms](int iSlice, const void *pData,
+                                      const GByte *pabyMask, int nLines,
+                                      int nLineStride)
+            {
+                for (int iY = 0; iY < nLines; ++iY)
+                {
+                    // Process line by line, so that the special case for
+                    // Byte can be taken whatever the line stride.
+                    ComputeHistogramForBuffer(
+                        static_cast<const GByte *>(pData) +
+                            static_cast<size_t>(iY) * nLineStride * nDTSize,
+                        eDataType, bSignedByte, nXSize, 1, nXSize,
+                        pabyMask ? pabyMask + static_cast<size_t>(iY) *
+                                                  nLineStride
+                                 : nullptr,
+                        sNoDataValues, dfMin, dfScale, nBuckets,
+                        CPL_TO_BOOL(bIncludeOutOfRange),
+                        aanSliceHistograms[iSlice].data());
+                }
+            };
+
+            if (!GDALRasterBandProcessInParallel(this, poMaskBand, nThreads,
+                                                 ProcessSlice,
+                                                 "Compute Histogram",
+                                                 pfnProgress, pProgressData))
+            {
+                return CE_Failure;
+            }
+
+            for (const auto &anSliceHistogram : aanSliceHistograms)
+            {
+                for (int i = 0; i < nBuckets; ++i)
+                    panHistogram[i] += anSliceHistogram[i];
+            }
+
+            pfnProgress(1.0, "Compute Histogram", pProgressData);
+
+            return CE_None;
+        }
+
         GByte *pabyMaskData = nullptr;
         if (poMaskBand)
         {
@@ -4519,192 +4942,11 @@ CPLErr GDALRasterBand::GetHistogram(double dfMin, double dfMax, int nBuckets,
                 return CE_Failure;
             }
 
-            // this is a special case for a common situation.
-            if (eDataType == GDT_Byte && !bSignedByte && dfScale == 1.0 &&
-                (dfMin >= -0.5 && dfMin <= 0.5) && nYCheck == nBlockYSize &&
-                nXCheck == nBlockXSize && nBuckets == 256)
-            {
-                const GPtrDiff_t nPixels =
-                    static_cast<GPtrDiff_t>(nXCheck) * nYCheck;
-                GByte *pabyData = static_cast<GByte *>(pData);
-
-                for (GPtrDiff_t i = 0; i < nPixels; i++)
-                {
-                    if (pabyMaskData && pabyMaskData[i] == 0)
-                        continue;
-                    if (!(sNoDataValues.bGotNoDataValue &&
-                          (pabyData[i] ==
-                           static_cast<GByte>(sNoDataValues.dfNoDataValue))))
-                    {
-                        panHistogram[pabyData[i]]++;
-                    }
-                }
-
-                poBlock->DropLock();
-                continue;  // To next sample block.
-            }
-
-            // This isn't the fastest way to do this, but is easier for now.
-            for (int iY = 0; iY < nYCheck; iY++)
-            {
-                for (int iX = 0; iX < nXCheck; iX++)
-                {
-                    const GPtrDiff_t iOffset =
-                        iX + static_cast<GPtrDiff_t>(iY) * nBlockXSize;
-
-                    if (pabyMaskData && pabyMaskData[iOffset] == 0)
-                        continue;
-
-                    double dfValue = 0.0;
-
-                    switch (eDataType)
-                    {
-                        case GDT_Byte:
-                        {
-                            if (bSignedByte)
-                                dfValue =
-                                    static_cast<signed char *>(pData)[iOffset];
-                            else
-                                dfValue = static_cast<GByte *>(pData)[iOffset];
-                            break;
-                        }
-                        case GDT_Int8:
-                            dfValue = static_cast<GInt8 *>(pData)[iOffset];
-                            break;
-                        case GDT_UInt16:
-                            dfValue = static_cast<GUInt16 *>(pData)[iOffset];
-                            break;
-                        case GDT_Int16:
-                            dfValue = static_cast<GInt16 *>(pData)[iOffset];
-                            break;
-                        case GDT_UInt32:
-                            dfValue = static_cast<GUInt32 *>(pData)[iOffset];
-                            break;
-                        case GDT_Int32:
-                            dfValue = static_cast<GInt32 *>(pData)[iOffset];
-                            break;
-                        case GDT_UInt64:
-                            dfValue = static_cast<double>(
-                                static_cast<GUInt64 *>(pData)[iOffset]);
-                            break;
-                        case GDT_Int64:
-                            dfValue = static_cast<double>(
-                                static_cast<GInt64 *>(pData)[iOffset]);
-                            break;
-                        case GDT_Float16:
-                        {
-                            using namespace std;
-                            const GFloat16 hfValue =
-                                static_cast<GFloat16 *>(pData)[iOffset];
-                            if (isnan(hfValue) ||
-                                (sNoDataValues.bGotFloat16NoDataValue &&
-                                 ARE_REAL_EQUAL(hfValue,
-                                                sNoDataValues.hfNoDataValue)))
-                                continue;
-                            dfValue = hfValue;
-                            break;
-                        }
-                        case GDT_Float32:
-                        {
-                            const float fValue =
-                                static_cast<float *>(pData)[iOffset];
-                            if (std::isnan(fValue) ||
-                                (sNoDataValues.bGotFloatNoDataValue &&
-                                 ARE_REAL_EQUAL(fValue,
-                                                sNoDataValues.fNoDataValue)))
-                                continue;
-                            dfValue = fValue;
-                            break;
-                        }
-                        case GDT_Float64:
-                            dfValue = static_cast<double *>(pData)[iOffset];
-                            if (std::isnan(dfValue))
-                                continue;
-                            break;
-                        case GDT_CInt16:
-                        {
-                            double dfReal =
-                                static_cast<GInt16 *>(pData)[iOffset * 2];
-                            double dfImag =
-                                static_cast<GInt16 *>(pData)[iOffset * 2 + 1];
-                            dfValue = sqrt(dfReal * dfReal + dfImag * dfImag);
-                            break;
-                        }
-                        case GDT_CInt32:
-                        {
-                            double dfReal =
-                                static_cast<GInt32 *>(pData)[iOffset * 2];
-                            double dfImag =
-                                static_cast<GInt32 *>(pData)[iOffset * 2 + 1];
-                            dfValue = sqrt(dfReal * dfReal + dfImag * dfImag);
-                            break;
-                        }
-                        case GDT_CFloat16:
-                        {
-                            double dfReal =
-                                static_cast<GFloat16 *>(pData)[iOffset * 2];
-                            double dfImag =
-                                static_cast<GFloat16 *>(pData)[iOffset * 2 + 1];
-                            if (std::isnan(dfReal) || std::isnan(dfImag))
-                                continue;
-                            dfValue = sqrt(dfReal * dfReal + dfImag * dfImag);
-                            break;
-                        }
-                        case GDT_CFloat32:
-                        {
-                            double dfReal =
-                                static_cast<float *>(pData)[iOffset * 2];
-                            double dfImag =
-                                static_cast<float *>(pData)[iOffset * 2 + 1];
-                            if (std::isnan(dfReal) || std::isnan(dfImag))
-                                continue;
-                            dfValue = sqrt(dfReal * dfReal + dfImag * dfImag);
-                            break;
-                        }
-                        case GDT_CFloat64:
-                        {
-                            double dfReal =
-                                static_cast<double *>(pData)[iOffset * 2];
-                            double dfImag =
-                                static_cast<double *>(pData)[iOffset * 2 + 1];
-                            if (std::isnan(dfReal) || std::isnan(dfImag))
-                                continue;
-                            dfValue = sqrt(dfReal * dfReal + dfImag * dfImag);
-                            break;
-                        }
-                        case GDT_Unknown:
-                        case GDT_TypeCount:
-                            CPLAssert(false);
-                            CPLFree(pabyMaskData);
-                            return CE_Failure;
-                    }
-
-                    if (eDataType != GDT_Float16 && eDataType != GDT_Float32 &&
-                        sNoDataValues.bGotNoDataValue &&
-                        ARE_REAL_EQUAL(dfValue, sNoDataValues.dfNoDataValue))
-                        continue;
-
-                    // Given that dfValue and dfMin are not NaN, and dfScale > 0
-                    // and finite, the result of the multiplication cannot be
-                    // NaN
-                    const double dfIndex = floor((dfValue - dfMin) * dfScale);
-
-                    if (dfIndex < 0)
-                    {
-                        if (bIncludeOutOfRange)
-                            panHistogram[0]++;
-                    }
-                    else if (dfIndex >= nBuckets)
-                    {
-                        if (bIncludeOutOfRange)
-                            ++panHistogram[nBuckets - 1];
-                    }
-                    else
-                    {
-                        ++panHistogram[static_cast<int>(dfIndex)];
-                    }
-                }
-            }
+            ComputeHistogramForBuffer(pData, eDataType, bSignedByte, nXCheck,
+                                      nYCheck, nBlockXSize, pabyMaskData,
+                                      sNoDataValues, dfMin, dfScale, nBuckets,
+                                      CPL_TO_BOOL(bIncludeOutOfRange),
+                                      panHistogram);
 
             poBlock->DropLock();
         }
@@ -6453,6 +6695,11 @@ void GDALRasterBand::SetValidPercent(GUIntBig nSampleCount,
  *
  * Cached statistics can be cleared with GDALDataset::ClearStatistics().
  *
+ * Starting with GDAL 3.12, the GDAL_NUM_THREADS configuration option can be
+ * set to "ALL_CPUS" or a integer value to specify the number of threads to use
+ * when computing exact statistics of Byte, UInt16 and floating-point bands.
+ * Reading is still done from the calling thread.
+ *
  * This method is the same as the C function GDALComputeRasterStatistics().
  *
  * @param bApproxOK If TRUE statistics may be computed based on overviews
@@ -6726,55 +6973,134 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
                     ? static_cast<GUInt32>(sNoDataValues.dfNoDataValue + 1e-10)
                     : nMaxValueType + 1;
 
-            for (GIntBig iSampleBlock = 0;
-                 iSampleBlock <
-                 static_cast<GIntBig>(nBlocksPerRow) * nBlocksPerColumn;
-                 iSampleBlock += nSampleRate)
+            const int nThreads = nSampleRate == 1 ? GDALGetNumThreads() : 1;
+            if (nThreads > 1)
             {
-                const int iYBlock =
-                    static_cast<int>(iSampleBlock / nBlocksPerRow);
-                const int iXBlock =
-                    static_cast<int>(iSampleBlock % nBlocksPerRow);
+                // Each slice accumulates into its own integer accumulators,
+                // which are then merged, so that the result is identical to
+                // the single-threaded computation.
+                struct IntegerStats
+                {
+                    GUInt32 nMin;
+                    GUInt32 nMax;
+                    GUIntBig nSum;
+                    GUIntBig nSumSquare;
+                    GUIntBig nSampleCount;
+                    GUIntBig nValidCount;
+                };
+
+                std::vector<IntegerStats> asSliceStats(
+                    nThreads, IntegerStats{nMaxValueType, 0, 0, 0, 0, 0});
+                const int nXSize = nRasterXSize;
+                const auto ProcessSlice =
+                    [this, nXSize, nMaxValueType, nNoDataValue,
+                     &asSliceStats](int iSlice, const void *pData,
+                                    const GByte *, int nLines, int nLineStride)
+                {
+                    auto &sStats = asSliceStats[iSlice];
+                    for (int iY = 0; iY < nLines; ++iY)
+                    {
+                        // Process line by line, with a line stride equal to
+                        // the width, so that the SIMD code paths can be taken
+                        if (eDataType == GDT_Byte)
+                        {
+                            ComputeStatisticsInternal<
+                                GByte, /* COMPUTE_OTHER_STATS = */ true>::
+                                f(nXSize, nXSize, 1,
+                                  static_cast<const GByte *>(pData) +
+                                      static_cast<size_t>(iY) * nLineStride,
+                                  nNoDataValue <= nMaxValueType, nNoDataValue,
+                                  sStats.nMin, sStats.nMax, sStats.nSum,
+                                  sStats.nSumSquare, sStats.nSampleCount,
+                                  sStats.nValidCount);
+                        }
+                        else
+                        {
+                            ComputeStatisticsInternal<
+                                GUInt16, /* COMPUTE_OTHER_STATS = */ true>::
+                                f(nXSize, nXSize, 1,
+                                  static_cast<const GUInt16 *>(pData) +
+                                      static_cast<size_t>(iY) * nLineStride,
+                                  nNoDataValue <= nMaxValueType, nNoDataValue,
+                                  sStats.nMin, sStats.nMax, sStats.nSum,
+                                  sStats.nSumSquare, sStats.nSampleCount,
+                                  sStats.nValidCount);
+                        }
+                    }
+                };
 
-                GDALRasterBlock *const poBlock =
-                    GetLockedBlockRef(iXBlock, iYBlock);
-                if (poBlock == nullptr)
+                // The mask band is ignored by the single-threaded code path
+                if (!GDALRasterBandProcessInParallel(
+                        this, nullptr, nThreads, ProcessSlice,
+                        "Compute Statistics", pfnProgress, pProgressData))
+                {
                     return CE_Failure;
+                }
 
-                void *const pData = poBlock->GetDataRef();
-
-                int nXCheck = 0, nYCheck = 0;
-                GetActualBlockSize(iXBlock, iYBlock, &nXCheck, &nYCheck);
-
-                if (eDataType == GDT_Byte)
+                for (const auto &sStats : asSliceStats)
                 {
-                    ComputeStatisticsInternal<
-                        GByte, /* COMPUTE_OTHER_STATS = */ true>::
-                        f(nXCheck, nBlockXSize, nYCheck,
-                          static_cast<const GByte *>(pData),
-                          nNoDataValue <= nMaxValueType, nNoDataValue, nMin,
-                          nMax, nSum, nSumSquare, nSampleCount, nValidCount);
+                    nMin = std::min(nMin, sStats.nMin);
+                    nMax = std::max(nMax, sStats.nMax);
+                    nSum += sStats.nSum;
+                    nSumSquare += sStats.nSumSquare;
+                    nSampleCount += sStats.nSampleCount;
+                    nValidCount += sStats.nValidCount;
                 }
-                else
+            }
+            else
+            {
+                for (GIntBig iSampleBlock = 0;
+                     iSampleBlock <
+                     static_cast<GIntBig>(nBlocksPerRow) * nBlocksPerColumn;
+                     iSampleBlock += nSampleRate)
                 {
-                    ComputeStatisticsInternal<
-                        GUInt16, /* COMPUTE_OTHER_STATS = */ true>::
-                        f(nXCheck, nBlockXSize, nYCheck,
-                          static_cast<const GUInt16 *>(pData),
-                          nNoDataValue <= nMaxValueType, nNoDataValue, nMin,
-                          nMax, nSum, nSumSquare, nSampleCount, nValidCount);
-                }
+                    const int iYBlock =
+                        static_cast<int>(iSampleBlock / nBlocksPerRow);
+                    const int iXBlock =
+                        static_cast<int>(iSampleBlock % nBlocksPerRow);
 
-                poBlock->DropLock();
+                    GDALRasterBlock *const poBlock =
+                        GetLockedBlockRef(iXBlock, iYBlock);
+                    if (poBlock == nullptr)
+                        return CE_Failure;
 
-                if (!pfnProgress(static_cast<double>(iSampleBlock) /
-                                     (static_cast<double>(nBlocksPerRow) *
-                                      nBlocksPerColumn),
-                                 "Compute Statistics", pProgressData))
-                {
-                    ReportError(CE_Failure, CPLE_UserInterrupt,
-                                "User terminated");
-                    return CE_Failure;
+                    void *const pData = poBlock->GetDataRef();
+
+                    int nXCheck = 0, nYCheck = 0;
+                    GetActualBlockSize(iXBlock, iYBlock, &nXCheck, &nYCheck);
+
+                    if (eDataType == GDT_Byte)
+                    {
+                        ComputeStatisticsInternal<
+                            GByte, /* COMPUTE_OTHER_STATS = */ true>::
+                            f(nXCheck, nBlockXSize, nYCheck,
+                              static_cast<const GByte *>(pData),
+                              nNoDataValue <= nMaxValueType, nNoDataValue,
+                              nMin, nMax, nSum, nSumSquare, nSampleCount,
+                              nValidCount);
+                    }
+                    else
+                    {
+                        ComputeStatisticsInternal<
+                            GUInt16, /* COMPUTE_OTHER_STATS = */ true>::
+                            f(nXCheck, nBlockXSize, nYCheck,
+                              static_cast<const GUInt16 *>(pData),
+                              nNoDataValue <= nMaxValueType, nNoDataValue,
+                              nMin, nMax, nSum, nSumSquare, nSampleCount,
+                              nValidCount);
+                    }
+
+                    poBlock->DropLock();
+
+                    if (!pfnProgress(static_cast<double>(iSampleBlock) /
+                                         (static_cast<double>(nBlocksPerRow) *
+                                          nBlocksPerColumn),
+                                     "Compute Statistics", pProgressData))
+                    {
+                        ReportError(CE_Failure, CPLE_UserInterrupt,
+                                    "User terminated");
+                        return CE_Failure;
+                    }
                 }
             }
 
@@ -6843,101 +7169,209 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
             return CE_Failure;
         }
 
-        GByte *pabyMaskData = nullptr;
-        if (poMaskBand)
+        // Multi-threaded computation for floating-point data types. Each
+        // slice runs the Welford algorithm on its own, and the partial results
+        // are merged in a deterministic order with the pairwise update of Chan
+        // et al. Integer data types are kept on the single-threaded code path
+        // so that their statistics remain bit-identical to previous versions.
+        const int nThreads =
+            nSampleRate == 1 && !GDALDataTypeIsInteger(eDataType)
+                ? GDALGetNumThreads()
+                : 1;
+        if (nThreads > 1)
         {
-            pabyMaskData = static_cast<GByte *>(
-                VSI_MALLOC2_VERBOSE(nBlockXSize, nBlockYSize));
-            if (!pabyMaskData)
+            struct WelfordStats
             {
-                return CE_Failure;
-            }
-        }
+                double dfMin = std::numeric_limits<double>::infinity();
+                double dfMax = -std::numeric_limits<double>::infinity();
+                double dfMean = 0.0;
+                double dfM2 = 0.0;
+                GUIntBig nSampleCount = 0;
+                GUIntBig nValidCount = 0;
+            };
+
+            std::vector<WelfordStats> asSliceStats(nThreads);
+            const int nXSize = nRasterXSize;
+            const auto ProcessSlice =
+                [this, nXSize, bSignedByte, &sNoDataValues,
+                 &asSliceStats](int iSlice, const void *pData,
+                                const GByte *pabyMask, int nLines,
+                                int nLineStride)
+            {
+                auto &sStats = asSliceStats[iSlice];
+                for (int iY = 0; iY < nLines; iY++)
+                {
+                    for (int iX = 0; iX < nXSize; iX++)
+                    {
+                        const GPtrDiff_t iOffset =
+                            iX + static_cast<GPtrDiff_t>(iY) * nLineStride;
+                        if (pabyMask && pabyMask[iOffset] == 0)
+                            continue;
 
-        for (GIntBig iSampleBlock = 0;
-             iSampleBlock <
-             static_cast<GIntBig>(nBlocksPerRow) * nBlocksPerColumn;
-             iSampleBlock += nSampleRate)
-        {
-            const int iYBlock = static_cast<int>(iSampleBlock / nBlocksPerRow);
-            const int iXBlock = static_cast<int>(iSampleBlock % nBlocksPerRow);
+                        bool bValid = true;
+                        const double dfValue =
+                            GetPixelValue(eDataType, bSignedByte, pData,
+                                          iOffset, sNoDataValues, bValid);
+                        if (!bValid)
+                            continue;
 
-            GDALRasterBlock *const poBlock =
-                GetLockedBlockRef(iXBlock, iYBlock);
-            if (poBlock == nullptr)
+                        sStats.dfMin = std::min(sStats.dfMin, dfValue);
+                        sStats.dfMax = std::max(sStats.dfMax, dfValue);
+
+                        sStats.nValidCount++;
+                        if (sStats.dfMin == sStats.dfMax)
+                        {
+                            if (sStats.nValidCount == 1)
+                                sStats.dfMean = sStats.dfMin;
+                        }
+                        else
+                        {
+                            const double dfDelta = dfValue - sStats.dfMean;
+                            sStats.dfMean += dfDelta / sStats.nValidCount;
+                            sStats.dfM2 += dfDelta * (dfValue - sStats.dfMean);
+                        }
+                    }
+                }
+                sStats.nSampleCount += static_cast<GUIntBig>(nXSize) * nLines;
+            };
+
+            if (!GDALRasterBandProcessInParallel(
+                    this, poMaskBand, nThreads, ProcessSlice,
+                    "Compute Statistics", pfnProgress, pProgressData))
             {
-                CPLFree(pabyMaskData);
                 return CE_Failure;
             }
 
-            void *const pData = poBlock->GetDataRef();
-
-            int nXCheck = 0, nYCheck = 0;
-            GetActualBlockSize(iXBlock, iYBlock, &nXCheck, &nYCheck);
-
-            if (poMaskBand &&
-                poMaskBand->RasterIO(GF_Read, iXBlock * nBlockXSize,
-                                     iYBlock * nBlockYSize, nXCheck, nYCheck,
-                                     pabyMaskData, nXCheck, nYCheck, GDT_Byte,
-                                     0, nBlockXSize, nullptr) != CE_None)
+            for (const auto &sStats : asSliceStats)
             {
-                CPLFree(pabyMaskData);
-                poBlock->DropLock();
-                return CE_Failure;
+                nSampleCount += sStats.nSampleCount;
+                if (sStats.nValidCount == 0)
+                    continue;
+                dfMin = std::min(dfMin, sStats.dfMin);
+                dfMax = std::max(dfMax, sStats.dfMax);
+                if (nValidCount == 0)
+                {
+                    dfMean = sStats.dfMean;
+                    dfM2 = sStats.dfM2;
+                    nValidCount = sStats.nValidCount;
+                }
+                else
+                {
+                    const double dfCountA = static_cast<double>(nValidCount);
+                    const double dfCountB =
+                        static_cast<double>(sStats.nValidCount);
+                    nValidCount += sStats.nValidCount;
+                    const double dfCount = static_cast<double>(nValidCount);
+                    const double dfDelta = sStats.dfMean - dfMean;
+                    dfMean += dfDelta * dfCountB / dfCount;
+                    dfM2 += sStats.dfM2 +
+                            dfDelta * dfDelta * dfCountA * dfCountB / dfCount;
+                }
+            }
+        }
+        else
+        {
+            GByte *pabyMaskData = nullptr;
+            if (poMaskBand)
+            {
+                pabyMaskData = static_cast<GByte *>(
+                    VSI_MALLOC2_VERBOSE(nBlockXSize, nBlockYSize));
+                if (!pabyMaskData)
+                {
+                    return CE_Failure;
+                }
             }
 
-            // This isn't the fastest way to do this, but is easier for now.
-            for (int iY = 0; iY < nYCheck; iY++)
+            for (GIntBig iSampleBlock = 0;
+                 iSampleBlock <
+                 static_cast<GIntBig>(nBlocksPerRow) * nBlocksPerColumn;
+                 iSampleBlock += nSampleRate)
             {
-                for (int iX = 0; iX < nXCheck; iX++)
+                const int iYBlock =
+                    static_cast<int>(iSampleBlock / nBlocksPerRow);
+                const int iXBlock =
+                    static_cast<int>(iSampleBlock % nBlocksPerRow);
+
+                GDALRasterBlock *const poBlock =
+                    GetLockedBlockRef(iXBlock, iYBlock);
+                if (poBlock == nullptr)
                 {
-                    const GPtrDiff_t iOffset =
-                        iX + static_cast<GPtrDiff_t>(iY) * nBlockXSize;
-                    if (pabyMaskData && pabyMaskData[iOffset] == 0)
-                        continue;
+                    CPLFree(pabyMaskData);
+                    return CE_Failure;
+                }
 
-                    bool bValid = true;
-                    double dfValue =
-                        GetPixelValue(eDataType, bSignedByte, pData, iOffset,
-                                      sNoDataValues, bValid);
+                void *const pData = poBlock->GetDataRef();
 
-                    if (!bValid)
-                        continue;
+                int nXCheck = 0, nYCheck = 0;
+                GetActualBlockSize(iXBlock, iYBlock, &nXCheck, &nYCheck);
 
-                    dfMin = std::min(dfMin, dfValue);
-                    dfMax = std::max(dfMax, dfValue);
+                if (poMaskBand &&
+                    poMaskBand->RasterIO(GF_Read, iXBlock * nBlockXSize,
+                                         iYBlock * nBlockYSize, nXCheck,
+                                         nYCheck, pabyMaskData, nXCheck,
+                                         nYCheck, GDT_Byte, 0, nBlockXSize,
+                                         nullptr) != CE_None)
+                {
+                    CPLFree(pabyMaskData);
+                    poBlock->DropLock();
+                    return CE_Failure;
+                }
 
-                    nValidCount++;
-                    if (dfMin == dfMax)
-                    {
-                        if (nValidCount == 1)
-                            dfMean = dfMin;
-                    }
-                    else
+                // This isn't the fastest way to do this, but is easier for
+                // now.
+                for (int iY = 0; iY < nYCheck; iY++)
+                {
+                    for (int iX = 0; iX < nXCheck; iX++)
                     {
-                        const double dfDelta = dfValue - dfMean;
-                        dfMean += dfDelta / nValidCount;
-                        dfM2 += dfDelta * (dfValue - dfMean);
+                        const GPtrDiff_t iOffset =
+                            iX + static_cast<GPtrDiff_t>(iY) * nBlockXSize;
+                        if (pabyMaskData && pabyMaskData[iOffset] == 0)
+                            continue;
+
+                        bool bValid = true;
+                        double dfValue =
+                            GetPixelValue(eDataType, bSignedByte, pData,
+                                          iOffset, sNoDataValues, bValid);
+
+                        if (!bValid)
+                            continue;
+
+                        dfMin = std::min(dfMin, dfValue);
+                        dfMax = std::max(dfMax, dfValue);
+
+                        nValidCount++;
+                        if (dfMin == dfMax)
+                        {
+                            if (nValidCount == 1)
+                                dfMean = dfMin;
+                        }
+                        else
+                        {
+                            const double dfDelta = dfValue - dfMean;
+                            dfMean += dfDelta / nValidCount;
+                            dfM2 += dfDelta * (dfValue - dfMean);
+                        }
                     }
                 }
-            }
 
-            nSampleCount += static_cast<GUIntBig>(nXCheck) * nYCheck;
+                nSampleCount += static_cast<GUIntBig>(nXCheck) * nYCheck;
 
-            poBlock->DropLock();
+                poBlock->DropLock();
 
-            if (!pfnProgress(
-                    static_cast<double>(iSampleBlock) /
-                        (static_cast<double>(nBlocksPerRow) * nBlocksPerColumn),
-                    "Compute Statistics", pProgressData))
-            {
-                ReportError(CE_Failure, CPLE_UserInterrupt, "User terminated");
-                CPLFree(pabyMaskData);
-                return CE_Failure;
+                if (!pfnProgress(static_cast<double>(iSampleBlock) /
+                                     (static_cast<double>(nBlocksPerRow) *
+                                      nBlocksPerColumn),
+                                 "Compute Statistics", pProgressData))
+                {
+                    ReportError(CE_Failure, CPLE_UserInterrupt,
+                                "User terminated");
+                    CPLFree(pabyMaskData);
+                    return CE_Failure;
+                }
             }
-        }
 
-        CPLFree(pabyMaskData);
+            CPLFree(pabyMaskData);
+        }
     }
 
     if (!pfnProgress(1.0, "Compute Statistics", pProgressData))
@@ -7341,6 +7775,11 @@ static bool ComputeMinMaxGenericIterBlocks(
  * If bApprox is FALSE, then all pixels will be read and used to compute
  * an exact range.
  *
+ * Starting with GDAL 3.12, the GDAL_NUM_THREADS configuration option can be
+ * set to "ALL_CPUS" or a integer value to specify the number of threads to use
+ * when computing an exact range. Reading is still done from the calling
+ * thread.
+ *
  * This method is the same as the C function GDALComputeRasterMinMax().
  *
  * @param bApproxOK TRUE if an approximate (faster) answer is OK, otherwise
@@ -7431,9 +7870,10 @@ CPLErr GDALRasterBand::ComputeRasterMinMax(int bApproxOK, double *adfMinMax)
                         eDataType == GDT_Int16 || eDataType == GDT_UInt16);
 
     const auto ComputeMinMaxForBlock =
-        [this, bSignedByte, &sNoDataValues, &nMin, &nMax, &nMinInt16,
-         &nMaxInt16](const void *pData, int nXCheck, int nBufferWidth,
-                     int nYCheck)
+        [this, bSignedByte, &sNoDataValues](
+            const void *pData, int nXCheck, int nBufferWidth, int nYCheck,
+            GUInt32 &nMinAcc, GUInt32 &nMaxAcc, GInt16 &nMinInt16Acc,
+            GInt16 &nMaxInt16Acc)
     {
         if (eDataType == GDT_Byte && !bSignedByte)
         {
@@ -7450,7 +7890,8 @@ CPLErr GDALRasterBand::ComputeRasterMinMax(int bApproxOK, double *adfMinMax)
                                       /* COMPUTE_OTHER_STATS = */ false>::
                 f(nXCheck, nBufferWidth, nYCheck,
                   static_cast<const GByte *>(pData), bHasNoData, nNoDataValue,
-                  nMin, nMax, nSum, nSumSquare, nSampleCount, nValidCount);
+                  nMinAcc, nMaxAcc, nSum, nSumSquare, nSampleCount,
+                  nValidCount);
         }
         else if (eDataType == GDT_UInt16)
         {
@@ -7467,7 +7908,8 @@ CPLErr GDALRasterBand::ComputeRasterMinMax(int bApproxOK, double *adfMinMax)
                                       /* COMPUTE_OTHER_STATS = */ false>::
                 f(nXCheck, nBufferWidth, nYCheck,
                   static_cast<const GUInt16 *>(pData), bHasNoData, nNoDataValue,
-                  nMin, nMax, nSum, nSumSquare, nSampleCount, nValidCount);
+                  nMinAcc, nMaxAcc, nSum, nSumSquare, nSampleCount,
+                  nValidCount);
         }
         else if (eDataType == GDT_Int16)
         {
@@ -7485,7 +7927,7 @@ CPLErr GDALRasterBand::ComputeRasterMinMax(int bApproxOK, double *adfMinMax)
                     ComputeMinMax<int16_t, true>(
                         static_cast<const int16_t *>(pData) +
                             static_cast<size_t>(iY) * nBufferWidth,
-                        nXCheck, nNoDataValue, &nMinInt16, &nMaxInt16);
+                        nXCheck, nNoDataValue, &nMinInt16Acc, &nMaxInt16Acc);
                 }
             }
             else
@@ -7495,7 +7937,7 @@ CPLErr GDALRasterBand::ComputeRasterMinMax(int bApproxOK, double *adfMinMax)
                     ComputeMinMax<int16_t, false>(
                         static_cast<const int16_t *>(pData) +
                             static_cast<size_t>(iY) * nBufferWidth,
-                        nXCheck, 0, &nMinInt16, &nMaxInt16);
+                        nXCheck, 0, &nMinInt16Acc, &nMaxInt16Acc);
                 }
             }
         }
@@ -7561,7 +8003,8 @@ CPLErr GDALRasterBand::ComputeRasterMinMax(int bApproxOK, double *adfMinMax)
 
         if (bUseOptimizedPath)
         {
-            ComputeMinMaxForBlock(pData, nXReduced, nXReduced, nYReduced);
+            ComputeMinMaxForBlock(pData, nXReduced, nXReduced, nYReduced, nMin,
+                                  nMax, nMinInt16, nMaxInt16);
         }
         else
         {
@@ -7599,7 +8042,74 @@ CPLErr GDALRasterBand::ComputeRasterMinMax(int bApproxOK, double *adfMinMax)
                 nSampleRate += 1;
         }
 
-        if (bUseOptimizedPath)
+        const int nThreads = nSampleRate == 1 ? GDALGetNumThreads() : 1;
+        if (nThreads > 1)
+        {
+            // Each slice accumulates into its own minimum and maximum,
+            // which are then merged.
+            struct MinMax
+            {
+                GUInt32 nMin;
+                GUInt32 nMax;
+                GInt16 nMinInt16;
+                GInt16 nMaxInt16;
+                double dfMin;
+                double dfMax;
+            };
+
+            std::vector<MinMax> asSliceMinMax(
+                nThreads,
+                MinMax{nMin, nMax, nMinInt16, nMaxInt16, dfMin, dfMax});
+            const int nXSize = nRasterXSize;
+            const size_t nDTSize = GDALGetDataTypeSizeBytes(eDataType);
+            const auto ProcessSlice =
+                [this, nXSize, nDTSize, bSignedByte, bUseOptimizedPath,
+                 &sNoDataValues, &ComputeMinMaxForBlock,
+                 &asSliceMinMax](int iSlice, const void *pData,
+                                 const GByte *pabyMask, int nLines,
+                                 int nLineStride)
+            {
+                auto &sMinMax = asSliceMinMax[iSlice];
+                if (bUseOptimizedPath)
+                {
+                    // Process line by line, with a line stride equal to the
+                    // width, so that the SIMD code paths can be taken
+                    for (int iY = 0; iY < nLines; ++iY)
+                    {
+                        ComputeMinMaxForBlock(
+                            static_cast<const GByte *>(pData) +
+                                static_cast<size_t>(iY) * nLineStride * nDTSize,
+                            nXSize, nXSize, 1, sMinMax.nMin, sMinMax.nMax,
+                            sMinMax.nMinInt16, sMinMax.nMaxInt16);
+                    }
+                }
+                else
+                {
+                    ComputeMinMaxGeneric(pData, eDataType, bSignedByte, nXSize,
+                                         nLines, nLineStride, sNoDataValues,
+                                         pabyMask, sMinMax.dfMin,
+                                         sMinMax.dfMax);
+                }
+            };
+
+            if (!GDALRasterBandProcessInParallel(
+                    this, poMaskBand, nThreads, ProcessSlice,
+                    "Compute Min/Max", GDALDummyProgress, nullptr))
+            {
+                return CE_Failure;
+            }
+
+            for (const auto &sMinMax : asSliceMinMax)
+            {
+                nMin = std::min(nMin, sMinMax.nMin);
+                nMax = std::max(nMax, sMinMax.nMax);
+                nMinInt16 = std::min(nMinInt16, sMinMax.nMinInt16);
+                nMaxInt16 = std::max(nMaxInt16, sMinMax.nMaxInt16);
+                dfMin = std::min(dfMin, sMinMax.dfMin);
+                dfMax = std::max(dfMax, sMinMax.dfMax);
+            }
+        }
+        else if (bUseOptimizedPath)
         {
             for (GIntBig iSampleBlock = 0;
                  iSampleBlock <
@@ -7620,7 +8130,8 @@ CPLErr GDALRasterBand::ComputeRasterMinMax(int bApproxOK, double *adfMinMax)
                 int nXCheck = 0, nYCheck = 0;
                 GetActualBlockSize(iXBlock, iYBlock, &nXCheck, &nYCheck);
 
-                ComputeMinMaxForBlock(pData, nXCheck, nBlockXSize, nYCheck);
+                ComputeMinMaxForBlock(pData, nXCheck, nBlockXSize, nYCheck,
+                                      nMin, nMax, nMinInt16, nMaxInt16);
 
                 poBlock->DropLock();
 
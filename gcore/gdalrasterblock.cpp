@@ -17,7 +17,9 @@
 #include "gdal_priv.h"
 
 #include <algorithm>
+#include <atomic>
 #include <climits>
+#include <cstdint>
 #include <cstring>
 #include <mutex>
 
@@ -30,21 +32,39 @@
 
 // Will later be overridden by the default 5% if GDAL_CACHEMAX not defined.
 static GIntBig nCacheMax = 40 * 1024 * 1024;
-static GIntBig nCacheUsed = 0;
-
-static GDALRasterBlock *poOldest = nullptr;  // Tail.
-static GDALRasterBlock *poNewest = nullptr;  // Head.
+static std::atomic<GIntBig> nCacheUsed{0};
 
 static int nDisableDirtyBlockFlushCounter = 0;
 
-#if 0
-static CPLMutex *hRBLock = nullptr;
-#define INITIALIZE_LOCK CPLMutexHolderD(&hRBLock)
-#define TAKE_LOCK CPLMutexHolderOptionalLockD(hRBLock)
-#define DESTROY_LOCK CPLDestroyMutex(hRBLock)
-#else
+/************************************************************************/
+/*                      GDALRasterBlockCacheShard                       */
+/************************************************************************/
+
+// The block cache is made of one or several independent LRU lists (shards).
+// By default there is a single shard, which matches the historical behavior
+// of a single global LRU list protected by a single lock. When
+// GDAL_BLOCK_CACHE_SHARDS is set to a value greater than one, blocks are
+// dispatched to shards according to a hash of their (band, x, y) key, so that
+// threads working on different blocks rarely compete for the same lock.
+// The GDAL_CACHEMAX limit is still enforced globally (nCacheUsed), and
+// eviction takes place preferably in shards that exceed their share of it.
+
+namespace
+{
+struct GDALRasterBlockCacheShard
+{
+    CPLLock *hLock = nullptr;
+    GDALRasterBlock *poOldest = nullptr;  // Tail.
+    GDALRasterBlock *poNewest = nullptr;  // Head.
+    std::atomic<GIntBig> nCacheUsed{0};
+};
+}  // namespace
+
+constexpr int MAX_BLOCK_CACHE_SHARDS = 64;
+static GDALRasterBlockCacheShard asShards[MAX_BLOCK_CACHE_SHARDS];
+// Must be a power of two. Only modified before the first block is cached.
+static int nShardCount = 1;
 
-static CPLLock *hRBLock = nullptr;
 static bool bDebugContention = false;
 static bool bSleepsForBockCacheDebug = false;
 
@@ -75,13 +95,104 @@ static CPLLockType GetLockType()
     return static_cast<CPLLockType>(nLockType);
 }
 
-#define INITIALIZE_LOCK                                                        \
-    CPLLockHolderD(&hRBLock, GetLockType());                                   \
-    CPLLockSetDebugPerf(hRBLock, bDebugContention)
-#define TAKE_LOCK CPLLockHolderOptionalLockD(hRBLock)
-#define DESTROY_LOCK CPLDestroyLock(hRBLock)
+/************************************************************************/
+/*                           GetShardCount()                            */
+/************************************************************************/
 
-#endif
+static int GetShardCount()
+{
+    const char *pszShards =
+        CPLGetConfigOption("GDAL_BLOCK_CACHE_SHARDS", "1");
+    int nShards;
+    if (EQUAL(pszShards, "AUTO"))
+    {
+        nShards = CPLGetNumCPUs();
+    }
+    else
+    {
+        nShards = atoi(pszShards);
+        if (nShards <= 0 || nShards > MAX_BLOCK_CACHE_SHARDS)
+        {
+            CPLError(CE_Warning, CPLE_IllegalArg,
+                     "Invalid value for GDAL_BLOCK_CACHE_SHARDS: %s. "
+                     "Should be AUTO or an integer in [1,%d] range",
+                     pszShards, MAX_BLOCK_CACHE_SHARDS);
+            nShards = std::clamp(nShards, 1, MAX_BLOCK_CACHE_SHARDS);
+        }
+    }
+    // Round up to the next power of two, so that shard selection is a mask.
+    int nRet = 1;
+    while (nRet < nShards && nRet < MAX_BLOCK_CACHE_SHARDS)
+        nRet *= 2;
+    return nRet;
+}
+
+/************************************************************************/
+/*                        InitializeShardLocks()                        */
+/************************************************************************/
+
+static void InitializeShardLocks()
+{
+    for (int i = 0; i < nShardCount; ++i)
+    {
+        CPLLockHolderD(&asShards[i].hLock, GetLockType());
+        CPLLockSetDebugPerf(asShards[i].hLock, bDebugContention);
+    }
+}
+
+/************************************************************************/
+/*                              GetShard()                              */
+/************************************************************************/
+
+static inline GDALRasterBlockCacheShard &
+GetShard(const GDALRasterBand *poBand, int nXOff, int nYOff)
+{
+    if (nShardCount == 1)
+        return asShards[0];
+    // Mix the band pointer and block coordinates (splitmix64 finalizer)
+    uint64_t h = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(poBand));
+    h ^= static_cast<uint64_t>(static_cast<uint32_t>(nXOff)) << 32;
+    h ^= static_cast<uint32_t>(nYOff);
+    h ^= h >> 30;
+    h *= UINT64_C(0xbf58476d1ce4e5b9);
+    h ^= h >> 27;
+    h *= UINT64_C(0x94d049bb133111eb);
+    h ^= h >> 31;
+    return asShards[static_cast<int>(h &
+                                     static_cast<uint64_t>(nShardCount - 1))];
+}
+
+/************************************************************************/
+/*                         GetMostLoadedShard()                         */
+/************************************************************************/
+
+static int GetMostLoadedShard()
+{
+    int iBest = 0;
+    GIntBig nBest = asShards[0].nCacheUsed.load(std::memory_order_relaxed);
+    for (int i = 1; i < nShardCount; ++i)
+    {
+        const GIntBig nUsed =
+            asShards[i].nCacheUsed.load(std::memory_order_relaxed);
+        if (nUsed > nBest)
+        {
+            nBest = nUsed;
+            iBest = i;
+        }
+    }
+    return iBest;
+}
+
+#define TAKE_LOCK(oShard) CPLLockHolderOptionalLockD((oShard).hLock)
+
+static void InitializeCache()
+{
+    GDALGetCacheMax64();
+    // Needed for scenarios where GDALAllRegister() is called after
+    // GDALDestroyDriverManager()
+    if (asShards[0].hLock == nullptr)
+        InitializeShardLocks();
+}
 
 // #define ENABLE_DEBUG
 
@@ -221,9 +332,10 @@ GIntBig CPL_STDCALL GDALGetCacheMax64()
         flagSetupGDALGetCacheMax64,
         []()
         {
-            {
-                INITIALIZE_LOCK;
-            }
+            nShardCount = GetShardCount();
+            InitializeShardLocks();
+            if (nShardCount > 1)
+                CPLDebug("GDAL", "Using %d block cache shards", nShardCount);
             bSleepsForBockCacheDebug =
                 CPLTestBool(CPLGetConfigOption("GDAL_DEBUG_BLOCK_CACHE", "NO"));
 
@@ -272,14 +384,15 @@ GIntBig CPL_STDCALL GDALGetCacheMax64()
 
 int CPL_STDCALL GDALGetCacheUsed()
 {
-    if (nCacheUsed > INT_MAX)
+    const GIntBig nUsed = nCacheUsed.load();
+    if (nUsed > INT_MAX)
     {
         CPLErrorOnce(CE_Warning, CPLE_AppDefined,
                      "Cache used value doesn't fit on a 32 bit integer. "
                      "Call GDALGetCacheUsed64() instead");
         return INT_MAX;
     }
-    return static_cast<int>(nCacheUsed);
+    return static_cast<int>(nUsed);
 }
 
 /************************************************************************/
@@ -297,7 +410,7 @@ int CPL_STDCALL GDALGetCacheUsed()
 
 GIntBig CPL_STDCALL GDALGetCacheUsed64()
 {
-    return nCacheUsed;
+    return nCacheUsed.load();
 }
 
 /************************************************************************/
@@ -377,11 +490,18 @@ int CPL_STDCALL GDALFlushCacheBlock()
 int GDALRasterBlock::FlushCacheBlock(int bDirtyBlocksOnly)
 
 {
-    GDALRasterBlock *poTarget;
+    GDALRasterBlock *poTarget = nullptr;
+
+    InitializeCache();
 
+    // Start with the shard that uses the most memory, and then visit the
+    // other ones.
+    const int iFirstShard = nShardCount == 1 ? 0 : GetMostLoadedShard();
+    for (int iShard = 0; iShard < nShardCount && poTarget == nullptr; ++iShard)
     {
-        INITIALIZE_LOCK;
-        poTarget = poOldest;
+        auto &oShard = asShards[(iFirstShard + iShard) & (nShardCount - 1)];
+        TAKE_LOCK(oShard);
+        poTarget = oShard.poOldest;
 
         while (poTarget != nullptr)
         {
@@ -395,7 +515,7 @@ int GDALRasterBlock::FlushCacheBlock(int bDirtyBlocksOnly)
         }
 
         if (poTarget == nullptr)
-            return FALSE;
+            continue;
 #ifndef __COVERITY__
         // Disabled to avoid complains about sleeping under locks, that
         // are only true for debug/testing code
@@ -412,6 +532,9 @@ int GDALRasterBlock::FlushCacheBlock(int bDirtyBlocksOnly)
         poTarget->GetBand()->UnreferenceBlock(poTarget);
     }
 
+    if (poTarget == nullptr)
+        return FALSE;
+
 #ifndef __COVERITY__
     // Disabled to avoid complains about sleeping under locks, that
     // are only true for debug/testing code
@@ -536,12 +659,7 @@ GDALRasterBlock::GDALRasterBlock(GDALRasterBand *poBandIn, int nXOffIn,
       nXOff(nXOffIn), nYOff(nYOffIn), nXSize(0), nYSize(0), pData(nullptr),
       poBand(poBandIn), poNext(nullptr), poPrevious(nullptr), bMustDetach(true)
 {
-    if (!hRBLock)
-    {
-        // Needed for scenarios where GDALAllRegister() is called after
-        // GDALDestroyDriverManager()
-        INITIALIZE_LOCK;
-    }
+    InitializeCache();
 
     CPLAssert(poBandIn != nullptr);
     poBand->GetBlockSize(&nXSize, &nYSize);
@@ -657,19 +775,20 @@ void GDALRasterBlock::Detach()
 {
     if (bMustDetach)
     {
-        TAKE_LOCK;
+        TAKE_LOCK(GetShard(poBand, nXOff, nYOff));
         Detach_unlocked();
     }
 }
 
 void GDALRasterBlock::Detach_unlocked()
 {
-    if (poOldest == this)
-        poOldest = poPrevious;
+    auto &oShard = GetShard(poBand, nXOff, nYOff);
+    if (oShard.poOldest == this)
+        oShard.poOldest = poPrevious;
 
-    if (poNewest == this)
+    if (oShard.poNewest == this)
     {
-        poNewest = poNext;
+        oShard.poNewest = poNext;
     }
 
     if (poPrevious != nullptr)
@@ -683,7 +802,12 @@ void GDALRasterBlock::Detach_unlocked()
     bMustDetach = false;
 
     if (pData)
-        nCacheUsed -= GetEffectiveBlockSize(GetBlockSize());
+    {
+        const GIntBig nEffectiveBlockSize =
+            GetEffectiveBlockSize(GetBlockSize());
+        nCacheUsed -= nEffectiveBlockSize;
+        oShard.nCacheUsed -= nEffectiveBlockSize;
+    }
 
 #ifdef ENABLE_DEBUG
     Verify();
@@ -703,26 +827,33 @@ void GDALRasterBlock::Detach_unlocked()
 void GDALRasterBlock::Verify()
 
 {
-    TAKE_LOCK;
-
-    CPLAssert((poNewest == nullptr && poOldest == nullptr) ||
-              (poNewest != nullptr && poOldest != nullptr));
-
-    if (poNewest != nullptr)
+    for (int iShard = 0; iShard < nShardCount; ++iShard)
     {
-        CPLAssert(poNewest->poPrevious == nullptr);
-        CPLAssert(poOldest->poNext == nullptr);
+        auto &oShard = asShards[iShard];
+        TAKE_LOCK(oShard);
 
-        GDALRasterBlock *poLast = nullptr;
-        for (GDALRasterBlock *poBlock = poNewest; poBlock != nullptr;
-             poBlock = poBlock->poNext)
+        CPLAssert(
+            (oShard.poNewest == nullptr && oShard.poOldest == nullptr) ||
+            (oShard.poNewest != nullptr && oShard.poOldest != nullptr));
+
+        if (oShard.poNewest != nullptr)
         {
-            CPLAssert(poBlock->poPrevious == poLast);
+            CPLAssert(oShard.poNewest->poPrevious == nullptr);
+            CPLAssert(oShard.poOldest->poNext == nullptr);
 
-            poLast = poBlock;
-        }
+            GDALRasterBlock *poLast = nullptr;
+            for (GDALRasterBlock *poBlock = oShard.poNewest;
+                 poBlock != nullptr; poBlock = poBlock->poNext)
+            {
+                CPLAssert(poBlock->poPrevious == poLast);
+                CPLAssert(&GetShard(poBlock->poBand, poBlock->nXOff,
+                                    poBlock->nYOff) == &oShard);
+
+                poLast = poBlock;
+            }
 
-        CPLAssert(poOldest == poLast);
+            CPLAssert(oShard.poOldest == poLast);
+        }
     }
 }
 
@@ -735,24 +866,27 @@ void GDALRasterBlock::Verify()
 #ifdef notdef
 void GDALRasterBlock::CheckNonOrphanedBlocks(GDALRasterBand *poBand)
 {
-    TAKE_LOCK;
-    for (GDALRasterBlock *poBlock = poNewest; poBlock != nullptr;
-         poBlock = poBlock->poNext)
+    for (int iShard = 0; iShard < nShardCount; ++iShard)
     {
-        if (poBlock->GetBand() == poBand)
+        TAKE_LOCK(asShards[iShard]);
+        for (GDALRasterBlock *poBlock = asShards[iShard].poNewest;
+             poBlock != nullptr; poBlock = poBlock->poNext)
         {
-            printf("Cache has still blocks of band %p\n", poBand); /*ok*/
-            printf("Band : %d\n", poBand->GetBand());              /*ok*/
-            printf("nRasterXSize = %d\n", poBand->GetXSize());     /*ok*/
-            printf("nRasterYSize = %d\n", poBand->GetYSize());     /*ok*/
-            int nBlockXSize, nBlockYSize;
-            poBand->GetBlockSize(&nBlockXSize, &nBlockYSize);
-            printf("nBlockXSize = %d\n", nBlockXSize);      /*ok*/
-            printf("nBlockYSize = %d\n", nBlockYSize);      /*ok*/
-            printf("Dataset : %p\n", poBand->GetDataset()); /*ok*/
-            if (poBand->GetDataset())
-                printf("Dataset : %s\n", /*ok*/
-                       poBand->GetDataset()->GetDescription());
+            if (poBlock->GetBand() == poBand)
+            {
+                printf("Cache has still blocks of band %p\n", poBand); /*ok*/
+                printf("Band : %d\n", poBand->GetBand());              /*ok*/
+                printf("nRasterXSize = %d\n", poBand->GetXSize());     /*ok*/
+                printf("nRasterYSize = %d\n", poBand->GetYSize());     /*ok*/
+                int nBlockXSize, nBlockYSize;
+                poBand->GetBlockSize(&nBlockXSize, &nBlockYSize);
+                printf("nBlockXSize = %d\n", nBlockXSize);      /*ok*/
+                printf("nBlockYSize = %d\n", nBlockYSize);      /*ok*/
+                printf("Dataset : %p\n", poBand->GetDataset()); /*ok*/
+                if (poBand->GetDataset())
+                    printf("Dataset : %s\n", /*ok*/
+                           poBand->GetDataset()->GetDescription());
+            }
         }
     }
 }
@@ -809,11 +943,13 @@ CPLErr GDALRasterBlock::Write()
 void GDALRasterBlock::Touch()
 
 {
+    auto &oShard = GetShard(poBand, nXOff, nYOff);
+
     // Can be safely tested outside the lock
-    if (poNewest == this)
+    if (oShard.poNewest == this)
         return;
 
-    TAKE_LOCK;
+    TAKE_LOCK(oShard);
     Touch_unlocked();
 }
 
@@ -826,15 +962,16 @@ void GDALRasterBlock::Touch_unlocked()
     // 1. Thread 1 calls Touch() and poNewest != this at that point
     // 2. Thread 2 detaches poNewest
     // 3. Thread 1 arrives here
-    if (poNewest == this)
+    auto &oShard = GetShard(poBand, nXOff, nYOff);
+    if (oShard.poNewest == this)
         return;
 
     // We should not try to touch a block that has been detached.
     // If that happen, corruption has already occurred.
     CPLAssert(bMustDetach);
 
-    if (poOldest == this)
-        poOldest = this->poPrevious;
+    if (oShard.poOldest == this)
+        oShard.poOldest = this->poPrevious;
 
     if (poPrevious != nullptr)
         poPrevious->poNext = poNext;
@@ -843,19 +980,19 @@ void GDALRasterBlock::Touch_unlocked()
         poNext->poPrevious = poPrevious;
 
     poPrevious = nullptr;
-    poNext = poNewest;
+    poNext = oShard.poNewest;
 
-    if (poNewest != nullptr)
+    if (oShard.poNewest != nullptr)
     {
-        CPLAssert(poNewest->poPrevious == nullptr);
-        poNewest->poPrevious = this;
+        CPLAssert(oShard.poNewest->poPrevious == nullptr);
+        oShard.poNewest->poPrevious = this;
     }
-    poNewest = this;
+    oShard.poNewest = this;
 
-    if (poOldest == nullptr)
+    if (oShard.poOldest == nullptr)
     {
         CPLAssert(poPrevious == nullptr && poNext == nullptr);
-        poOldest = this;
+        oShard.poOldest = this;
     }
 #ifdef ENABLE_DEBUG
     Verify();
@@ -884,10 +1021,13 @@ CPLErr GDALRasterBlock::Internalize()
 
     void *pNewData = nullptr;
 
-    // This call will initialize the hRBLock mutex. Other call places can
+    // This call will initialize the shard locks. Other call places can
     // only be called if we have go through there.
     const GIntBig nCurCacheMax = GDALGetCacheMax64();
 
+    auto &oOwnShard = GetShard(poBand, nXOff, nYOff);
+    const GIntBig nShardShare = nCurCacheMax / nShardCount;
+
     // No risk of overflow as it is checked in GDALRasterBand::InitBlockInfo().
     const auto nSizeInBytes = GetBlockSize();
 
@@ -902,12 +1042,29 @@ CPLErr GDALRasterBlock::Internalize()
         bLoopAgain = false;
         GDALRasterBlock *apoBlocksToFree[64] = {nullptr};
         int nBlocksToFree = 0;
+        bool bTouched = false;
+        if (bFirstIter)
+        {
+            const GIntBig nEffectiveBlockSize =
+                GetEffectiveBlockSize(nSizeInBytes);
+            nCacheUsed += nEffectiveBlockSize;
+            oOwnShard.nCacheUsed += nEffectiveBlockSize;
+        }
+
+        // Evict from our own shard, unless it uses less than its share
+        // of the cache, in which case we evict from the most loaded
+        // shard instead (approximate global LRU). If all blocks of that
+        // shard are locked, visit the other ones.
+        const int iFirstShard =
+            (nShardCount == 1 || oOwnShard.nCacheUsed > nShardShare)
+                ? static_cast<int>(&oOwnShard - &asShards[0])
+                : GetMostLoadedShard();
+        for (int iShard = 0; iShard < nShardCount; ++iShard)
         {
-            TAKE_LOCK;
+            auto &oShard = asShards[(iFirstShard + iShard) & (nShardCount - 1)];
+            TAKE_LOCK(oShard);
 
-            if (bFirstIter)
-                nCacheUsed += GetEffectiveBlockSize(nSizeInBytes);
-            GDALRasterBlock *poTarget = poOldest;
+            GDALRasterBlock *poTarget = oShard.poOldest;
             while (nCacheUsed > nCurCacheMax)
             {
                 GDALRasterBlock *poDirtyBlockOtherDataset = nullptr;
@@ -954,7 +1111,7 @@ CPLErr GDALRasterBlock::Internalize()
                     }
                     else
                     {
-                        poTarget = poOldest;
+                        poTarget = oShard.poOldest;
                         while (poTarget != nullptr)
                         {
                             if (CPLAtomicCompareAndExchange(
@@ -1017,8 +1174,20 @@ CPLErr GDALRasterBlock::Internalize()
             /*      Add this block to the list. */
             /* ------------------------------------------------------------------
              */
-            if (!bLoopAgain)
+            if (!bLoopAgain && &oShard == &oOwnShard)
+            {
                 Touch_unlocked();
+                bTouched = true;
+            }
+
+            if (nBlocksToFree > 0 || nCacheUsed <= nCurCacheMax)
+                break;
+        }
+
+        if (!bLoopAgain && !bTouched)
+        {
+            TAKE_LOCK(oOwnShard);
+            Touch_unlocked();
         }
 
         bFirstIter = false;
@@ -1129,9 +1298,12 @@ void GDALRasterBlock::MarkClean()
 /*! @cond Doxygen_Suppress */
 void GDALRasterBlock::DestroyRBMutex()
 {
-    if (hRBLock != nullptr)
-        DESTROY_LOCK;
-    hRBLock = nullptr;
+    for (auto &oShard : asShards)
+    {
+        if (oShard.hLock != nullptr)
+            CPLDestroyLock(oShard.hLock);
+        oShard.hLock = nullptr;
+    }
 }
 
 /*! @endcond */
@@ -1214,7 +1386,7 @@ int GDALRasterBlock::DropLockForRemovalFromStorage()
 #endif
 
     // Wait for the block for having been unreferenced.
-    TAKE_LOCK;
+    TAKE_LOCK(GetShard(poBand, nXOff, nYOff));
 
     return FALSE;
 }
@@ -1223,14 +1395,17 @@ int GDALRasterBlock::DropLockForRemovalFromStorage()
 void GDALRasterBlock::DumpAll()
 {
     int iBlock = 0;
-    for( GDALRasterBlock *poBlock = poNewest;
-         poBlock != nullptr;
-         poBlock = poBlock->poNext )
+    for( int iShard = 0; iShard < nShardCount; ++iShard )
     {
-        printf("Block %d\n", iBlock);/*ok*/
-        poBlock->DumpBlock();
-        printf("\n");/*ok*/
-        iBlock++;
+        for( GDALRasterBlock *poBlock = asShards[iShard].poNewest;
+             poBlock != nullptr;
+             poBlock = poBlock->poNext )
+        {
+            printf("Block %d\n", iBlock);/*ok*/
+            poBlock->DumpBlock();
+            printf("\n");/*ok*/
+            iBlock++;
+        }
     }
 }
 
@@ -754,6 +754,21 @@ class XMMReg2Double
         return reg;
     }
 
+    static inline XMMReg2Double Max(const XMMReg2Double &expr1,
+                                    const XMMReg2Double &expr2)
+    {
+        XMMReg2Double reg;
+        reg.xmm = _mm_max_pd(expr1.xmm, expr2.xmm);
+        return reg;
+    }
+
+    static inline XMMReg2Double Sqrt(const XMMReg2Double &expr)
+    {
+        XMMReg2Double reg;
+        reg.xmm = _mm_sqrt_pd(expr.xmm);
+        return reg;
+    }
+
     inline void nsLoad1ValHighAndLow(const double *ptr)
     {
         xmm = _mm_load1_pd(ptr);
@@ -977,6 +992,8 @@ class XMMReg2Double
 #warning "Software emulation of SSE2 !"
 #endif
 
+#include <cmath>
+
 class XMMReg2Double
 {
   public:
@@ -1116,6 +1133,23 @@ class XMMReg2Double
         return reg;
     }
 
+    static inline XMMReg2Double Max(const XMMReg2Double &expr1,
+                                    const XMMReg2Double &expr2)
+    {
+        XMMReg2Double reg;
+        reg.low = (expr1.low > expr2.low) ? expr1.low : expr2.low;
+        reg.high = (expr1.high > expr2.high) ? expr1.high : expr2.high;
+        return reg;
+    }
+
+    static inline XMMReg2Double Sqrt(const XMMReg2Double &expr)
+    {
+        XMMReg2Double reg;
+        reg.low = std::sqrt(expr.low);
+        reg.high = std::sqrt(expr.high);
+        return reg;
+    }
+
     static inline XMMReg2Double Load2Val(const double *ptr)
     {
         XMMReg2Double reg;
@@ -1594,6 +1628,21 @@ class XMMReg4Double
         return reg;
     }
 
+    static inline XMMReg4Double Max(const XMMReg4Double &expr1,
+                                    const XMMReg4Double &expr2)
+    {
+        XMMReg4Double reg;
+        reg.ymm = _mm256_max_pd(expr1.ymm, expr2.ymm);
+        return reg;
+    }
+
+    static inline XMMReg4Double Sqrt(const XMMReg4Double &expr)
+    {
+        XMMReg4Double reg;
+        reg.ymm = _mm256_sqrt_pd(expr.ymm);
+        return reg;
+    }
+
     inline XMMReg4Double &operator=(const XMMReg4Double &other)
     {
         ymm = other.ymm;
@@ -1926,6 +1975,23 @@ class XMMReg4Double
         return reg;
     }
 
+    static inline XMMReg4Double Max(const XMMReg4Double &expr1,
+                                    const XMMReg4Double &expr2)
+    {
+        XMMReg4Double reg;
+        reg.low = XMMReg2Double::Max(expr1.low, expr2.low);
+        reg.high = XMMReg2Double::Max(expr1.high, expr2.high);
+        return reg;
+    }
+
+    static inline XMMReg4Double Sqrt(const XMMReg4Double &expr)
+    {
+        XMMReg4Double reg;
+        reg.low = XMMReg2Double::Sqrt(expr.low);
+        reg.high = XMMReg2Double::Sqrt(expr.high);
+        return reg;
+    }
+
     inline XMMReg4Double &operator=(const XMMReg4Double &other)
     {
         low = other.low;
@@ -29,6 +29,7 @@
 #include <vector>
 
 #include "cpl_conv.h"
+#include "cpl_cpu_features.h"
 #include "cpl_error.h"
 #include "cpl_float.h"
 #include "cpl_progress.h"
@@ -37,6 +38,7 @@
 #include "gdal_thread_pool.h"
 #include "gdalwarper.h"
 #include "gdal_vrt.h"
+#include "overview_avx2.h"
 #include "vrtdataset.h"
 
 #ifdef USE_NEON_OPTIMIZATIONS
@@ -341,803 +343,14 @@ inline GUInt16 ComputeIntegerRMS_4values<GUInt16, double>(double sumSquares)
 }
 
 #ifdef USE_SSE2
+#include "overview_sse2_avx2.hpp"
 
-/************************************************************************/
-/*                   QuadraticMeanByteSSE2OrAVX2()                      */
-/************************************************************************/
-
-#if defined(__SSE4_1__) || defined(__AVX__) || defined(USE_NEON_OPTIMIZATIONS)
-#define sse2_packus_epi32 _mm_packus_epi32
-#else
-inline __m128i sse2_packus_epi32(__m128i a, __m128i b)
-{
-    const auto minus32768_32 = _mm_set1_epi32(-32768);
-    const auto minus32768_16 = _mm_set1_epi16(-32768);
-    a = _mm_add_epi32(a, minus32768_32);
-    b = _mm_add_epi32(b, minus32768_32);
-    a = _mm_packs_epi32(a, b);
-    a = _mm_sub_epi16(a, minus32768_16);
-    return a;
-}
-#endif
-
-#if defined(__SSSE3__) || defined(USE_NEON_OPTIMIZATIONS)
-#define sse2_hadd_epi16 _mm_hadd_epi16
-#else
-inline __m128i sse2_hadd_epi16(__m128i a, __m128i b)
-{
-    // Horizontal addition of adjacent pairs
-    const auto mask = _mm_set1_epi32(0xFFFF);
-    const auto horizLo =
-        _mm_add_epi32(_mm_and_si128(a, mask), _mm_srli_epi32(a, 16));
-    const auto horizHi =
-        _mm_add_epi32(_mm_and_si128(b, mask), _mm_srli_epi32(b, 16));
-
-    // Recombine low and high parts
-    return _mm_packs_epi32(horizLo, horizHi);
-}
-#endif
-
-#ifdef __AVX2__
-
-#define DEST_ELTS 16
-#define set1_epi16 _mm256_set1_epi16
-#define set1_epi32 _mm256_set1_epi32
-#define setzero _mm256_setzero_si256
-#define set1_ps _mm256_set1_ps
-#define loadu_int(x) _mm256_loadu_si256(reinterpret_cast<__m256i const *>(x))
-#define unpacklo_epi8 _mm256_unpacklo_epi8
-#define unpackhi_epi8 _mm256_unpackhi_epi8
-#define madd_epi16 _mm256_madd_epi16
-#define add_epi32 _mm256_add_epi32
-#define mul_ps _mm256_mul_ps
-#define cvtepi32_ps _mm256_cvtepi32_ps
-#define sqrt_ps _mm256_sqrt_ps
-#define cvttps_epi32 _mm256_cvttps_epi32
-#define packs_epi32 _mm256_packs_epi32
-#define packus_epi32 _mm256_packus_epi32
-#define srli_epi32 _mm256_srli_epi32
-#define mullo_epi16 _mm256_mullo_epi16
-#define srli_epi16 _mm256_srli_epi16
-#define cmpgt_epi16 _mm256_cmpgt_epi16
-#define add_epi16 _mm256_add_epi16
-#define sub_epi16 _mm256_sub_epi16
-#define packus_epi16 _mm256_packus_epi16
-
-/* AVX2 operates on 2 separate 128-bit lanes, so we have to do shuffling */
-/* to get the lower 128-bit bits of what would be a true 256-bit vector register
- */
-
-inline __m256i FIXUP_LANES(__m256i x)
-{
-    return _mm256_permute4x64_epi64(x, _MM_SHUFFLE(3, 1, 2, 0));
-}
-
-#define store_lo(x, y)                                                         \
-    _mm_storeu_si128(reinterpret_cast<__m128i *>(x),                           \
-                     _mm256_extracti128_si256(FIXUP_LANES(y), 0))
-#define storeu_int(x, y)                                                       \
-    _mm256_storeu_si256(reinterpret_cast<__m256i *>(x), FIXUP_LANES(y))
-#define hadd_epi16 _mm256_hadd_epi16
-#else
-#define DEST_ELTS 8
-#define set1_epi16 _mm_set1_epi16
-#define set1_epi32 _mm_set1_epi32
-#define setzero _mm_setzero_si128
-#define set1_ps _mm_set1_ps
-#define loadu_int(x) _mm_loadu_si128(reinterpret_cast<__m128i const *>(x))
-#define unpacklo_epi8 _mm_unpacklo_epi8
-#define unpackhi_epi8 _mm_unpackhi_epi8
-#define madd_epi16 _mm_madd_epi16
-#define add_epi32 _mm_add_epi32
-#define mul_ps _mm_mul_ps
-#define cvtepi32_ps _mm_cvtepi32_ps
-#define sqrt_ps _mm_sqrt_ps
-#define cvttps_epi32 _mm_cvttps_epi32
-#define packs_epi32 _mm_packs_epi32
-#define packus_epi32 sse2_packus_epi32
-#define srli_epi32 _mm_srli_epi32
-#define mullo_epi16 _mm_mullo_epi16
-#define srli_epi16 _mm_srli_epi16
-#define cmpgt_epi16 _mm_cmpgt_epi16
-#define add_epi16 _mm_add_epi16
-#define sub_epi16 _mm_sub_epi16
-#define packus_epi16 _mm_packus_epi16
-#define store_lo(x, y) _mm_storel_epi64(reinterpret_cast<__m128i *>(x), (y))
-#define storeu_int(x, y) _mm_storeu_si128(reinterpret_cast<__m128i *>(x), (y))
-#define hadd_epi16 sse2_hadd_epi16
-#endif
-
-template <class T>
-static int
-#if defined(__GNUC__)
-    __attribute__((noinline))
-#endif
-    QuadraticMeanByteSSE2OrAVX2(int nDstXWidth, int nChunkXSize,
-                                const T *&CPL_RESTRICT pSrcScanlineShiftedInOut,
-                                T *CPL_RESTRICT pDstScanline)
-{
-    // Optimized implementation for RMS on Byte by
-    // processing by group of 8 output pixels, so as to use
-    // a single _mm_sqrt_ps() call for 4 output pixels
-    const T *CPL_RESTRICT pSrcScanlineShifted = pSrcScanlineShiftedInOut;
-
-    int iDstPixel = 0;
-    const auto one16 = set1_epi16(1);
-    const auto one32 = set1_epi32(1);
-    const auto zero = setzero();
-    const auto minus32768 = set1_epi16(-32768);
-
-    for (; iDstPixel < nDstXWidth - (DEST_ELTS - 1); iDstPixel += DEST_ELTS)
-    {
-        // Load 2 * DEST_ELTS bytes from each line
-        auto firstLine = loadu_int(pSrcScanlineShifted);
-        auto secondLine = loadu_int(pSrcScanlineShifted + nChunkXSize);
-        // Extend those Bytes as UInt16s
-        auto firstLineLo = unpacklo_epi8(firstLine, zero);
-        auto firstLineHi = unpackhi_epi8(firstLine, zero);
-        auto secondLineLo = unpacklo_epi8(secondLine, zero);
-        auto secondLineHi = unpackhi_epi8(secondLine, zero);
-
-        // Multiplication of 16 bit values and horizontal
-        // addition of 32 bit results
-        // [ src[2*i+0]^2 + src[2*i+1]^2 for i in range(4) ]
-        firstLineLo = madd_epi16(firstLineLo, firstLineLo);
-        firstLineHi = madd_epi16(firstLineHi, firstLineHi);
-        secondLineLo = madd_epi16(secondLineLo, secondLineLo);
-        secondLineHi = madd_epi16(secondLineHi, secondLineHi);
-
-        // Vertical addition
-        const auto sumSquaresLo = add_epi32(firstLineLo, secondLineLo);
-        const auto sumSquaresHi = add_epi32(firstLineHi, secondLineHi);
-
-        const auto sumSquaresPlusOneDiv4Lo =
-            srli_epi32(add_epi32(sumSquaresLo, one32), 2);
-        const auto sumSquaresPlusOneDiv4Hi =
-            srli_epi32(add_epi32(sumSquaresHi, one32), 2);
-
-        // Take square root and truncate/floor to int32
-        const auto rmsLo =
-            cvttps_epi32(sqrt_ps(cvtepi32_ps(sumSquaresPlusOneDiv4Lo)));
-        const auto rmsHi =
-            cvttps_epi32(sqrt_ps(cvtepi32_ps(sumSquaresPlusOneDiv4Hi)));
-
-        // Merge back low and high registers with each RMS value
-        // as a 16 bit value.
-        auto rms = packs_epi32(rmsLo, rmsHi);
-
-        // Round to upper value if it minimizes the
-        // error |rms^2 - sumSquares/4|
-        // if( 2 * (2 * rms * (rms + 1) + 1) < sumSquares )
-        //    rms += 1;
-        // which is equivalent to:
-        // if( rms * (rms + 1) < (sumSquares+1) / 4 )
-        //    rms += 1;
-        // And both left and right parts fit on 16 (unsigned) bits
-        const auto sumSquaresPlusOneDiv4 =
-            packus_epi32(sumSquaresPlusOneDiv4Lo, sumSquaresPlusOneDiv4Hi);
-        // cmpgt_epi16 operates on signed int16, but here
-        // we have unsigned values, so shift them by -32768 before
-        auto mask = cmpgt_epi16(
-            add_epi16(sumSquaresPlusOneDiv4, minus32768),
-            add_epi16(mullo_epi16(rms, add_epi16(rms, one16)), minus32768));
-        // The value of the mask will be -1 when the correction needs to be
-        // applied
-        rms = sub_epi16(rms, mask);
-
-        // Pack each 16 bit RMS value to 8 bits
-        rms = packus_epi16(rms, rms /* could be anything */);
-        store_lo(&pDstScanline[iDstPixel], rms);
-        pSrcScanlineShifted += 2 * DEST_ELTS;
-    }
-
-    pSrcScanlineShiftedInOut = pSrcScanlineShifted;
-    return iDstPixel;
-}
-
-/************************************************************************/
-/*                      AverageByteSSE2OrAVX2()                         */
-/************************************************************************/
-
-template <class T>
-static int
-AverageByteSSE2OrAVX2(int nDstXWidth, int nChunkXSize,
-                      const T *&CPL_RESTRICT pSrcScanlineShiftedInOut,
-                      T *CPL_RESTRICT pDstScanline)
-{
-    // Optimized implementation for average on Byte by
-    // processing by group of 16 output pixels for SSE2, or 32 for AVX2
-
-    const auto zero = setzero();
-    const auto two16 = set1_epi16(2);
-    const T *CPL_RESTRICT pSrcScanlineShifted = pSrcScanlineShiftedInOut;
-
-    int iDstPixel = 0;
-    for (; iDstPixel < nDstXWidth - (2 * DEST_ELTS - 1);
-         iDstPixel += 2 * DEST_ELTS)
-    {
-        decltype(setzero()) average0;
-        {
-            // Load 2 * DEST_ELTS bytes from each line
-            const auto firstLine = loadu_int(pSrcScanlineShifted);
-            const auto secondLine =
-                loadu_int(pSrcScanlineShifted + nChunkXSize);
-            // Extend those Bytes as UInt16s
-            const auto firstLineLo = unpacklo_epi8(firstLine, zero);
-            const auto firstLineHi = unpackhi_epi8(firstLine, zero);
-            const auto secondLineLo = unpacklo_epi8(secondLine, zero);
-            const auto secondLineHi = unpackhi_epi8(secondLine, zero);
-
-            // Vertical addition
-            const auto sumLo = add_epi16(firstLineLo, secondLineLo);
-            const auto sumHi = add_epi16(firstLineHi, secondLineHi);
-
-            // Horizontal addition of adjacent pairs, and recombine low and high
-            // parts
-            const auto sum = hadd_epi16(sumLo, sumHi);
-
-            // average = (sum + 2) / 4
-            average0 = srli_epi16(add_epi16(sum, two16), 2);
-
-            pSrcScanlineShifted += 2 * DEST_ELTS;
-        }
-
-        decltype(setzero()) average1;
-        {
-            // Load 2 * DEST_ELTS bytes from each line
-            const auto firstLine = loadu_int(pSrcScanlineShifted);
-            const auto secondLine =
-                loadu_int(pSrcScanlineShifted + nChunkXSize);
-            // Extend those Bytes as UInt16s
-            const auto firstLineLo = unpacklo_epi8(firstLine, zero);
-            const auto firstLineHi = unpackhi_epi8(firstLine, zero);
-            const auto secondLineLo = unpacklo_epi8(secondLine, zero);
-            const auto secondLineHi = unpackhi_epi8(secondLine, zero);
-
-            // Vertical addition
-            const auto sumLo = add_epi16(firstLineLo, secondLineLo);
-            const auto sumHi = add_epi16(firstLineHi, secondLineHi);
-
-            // Horizontal addition of adjacent pairs, and recombine low and high
-            // parts
-            const auto sum = hadd_epi16(sumLo, sumHi);
-
-            // average = (sum + 2) / 4
-            average1 = srli_epi16(add_epi16(sum, two16), 2);
-
-            pSrcScanlineShifted += 2 * DEST_ELTS;
-        }
-
-        // Pack each 16 bit average value to 8 bits
-        const auto average = packus_epi16(average0, average1);
-        storeu_int(&pDstScanline[iDstPixel], average);
-    }
-
-    pSrcScanlineShiftedInOut = pSrcScanlineShifted;
-    return iDstPixel;
-}
-
-/************************************************************************/
-/*                     QuadraticMeanUInt16SSE2()                        */
-/************************************************************************/
-
-#ifdef __SSE3__
-#define sse2_hadd_pd _mm_hadd_pd
-#else
-inline __m128d sse2_hadd_pd(__m128d a, __m128d b)
-{
-    auto aLo_bLo =
-        _mm_castps_pd(_mm_movelh_ps(_mm_castpd_ps(a), _mm_castpd_ps(b)));
-    auto aHi_bHi =
-        _mm_castps_pd(_mm_movehl_ps(_mm_castpd_ps(b), _mm_castpd_ps(a)));
-    return _mm_add_pd(aLo_bLo, aHi_bHi);  // (aLo + aHi, bLo + bHi)
-}
-#endif
-
-inline __m128d SQUARE_PD(__m128d x)
-{
-    return _mm_mul_pd(x, x);
-}
-
-#ifdef __AVX2__
-
-inline __m256d SQUARE_PD(__m256d x)
-{
-    return _mm256_mul_pd(x, x);
-}
-
-inline __m256d FIXUP_LANES(__m256d x)
-{
-    return _mm256_permute4x64_pd(x, _MM_SHUFFLE(3, 1, 2, 0));
-}
-
-inline __m256 FIXUP_LANES(__m256 x)
-{
-    return _mm256_castpd_ps(FIXUP_LANES(_mm256_castps_pd(x)));
-}
-
-#endif
-
-template <class T>
-static int
-QuadraticMeanUInt16SSE2(int nDstXWidth, int nChunkXSize,
-                        const T *&CPL_RESTRICT pSrcScanlineShiftedInOut,
-                        T *CPL_RESTRICT pDstScanline)
-{
-    // Optimized implementation for RMS on UInt16 by
-    // processing by group of 4 output pixels.
-    const T *CPL_RESTRICT pSrcScanlineShifted = pSrcScanlineShiftedInOut;
-
-    int iDstPixel = 0;
-    const auto zero = _mm_setzero_si128();
-
-#ifdef __AVX2__
-    const auto zeroDot25 = _mm256_set1_pd(0.25);
-    const auto zeroDot5 = _mm256_set1_pd(0.5);
-
-    // The first four 0's could be anything, as we only take the bottom
-    // 128 bits.
-    const auto permutation = _mm256_set_epi32(0, 0, 0, 0, 6, 4, 2, 0);
-#else
-    const auto zeroDot25 = _mm_set1_pd(0.25);
-    const auto zeroDot5 = _mm_set1_pd(0.5);
-#endif
-
-    for (; iDstPixel < nDstXWidth - 3; iDstPixel += 4)
-    {
-        // Load 8 UInt16 from each line
-        const auto firstLine = _mm_loadu_si128(
-            reinterpret_cast<__m128i const *>(pSrcScanlineShifted));
-        const auto secondLine =
-            _mm_loadu_si128(reinterpret_cast<__m128i const *>(
-                pSrcScanlineShifted + nChunkXSize));
-
-        // Detect if all of the source values fit in 14 bits.
-        // because if x < 2^14, then 4 * x^2 < 2^30 which fits in a signed int32
-        // and we can do a much faster implementation.
-        const auto maskTmp =
-            _mm_srli_epi16(_mm_or_si128(firstLine, secondLine), 14);
-#if defined(__i386__) || defined(_M_IX86)
-        uint64_t nMaskFitsIn14Bits = 0;
-        _mm_storel_epi64(
-            reinterpret_cast<__m128i *>(&nMaskFitsIn14Bits),
-            _mm_packus_epi16(maskTmp, maskTmp /* could be anything */));
-#else
-        const auto nMaskFitsIn14Bits = _mm_cvtsi128_si64(
-            _mm_packus_epi16(maskTmp, maskTmp /* could be anything */));
-#endif
-        if (nMaskFitsIn14Bits == 0)
-        {
-            // Multiplication of 16 bit values and horizontal
-            // addition of 32 bit results
-            const auto firstLineHSumSquare =
-                _mm_madd_epi16(firstLine, firstLine);
-            const auto secondLineHSumSquare =
-                _mm_madd_epi16(secondLine, secondLine);
-            // Vertical addition
-            const auto sumSquares =
-                _mm_add_epi32(firstLineHSumSquare, secondLineHSumSquare);
-            // In theory we should take sqrt(sumSquares * 0.25f)
-            // but given the rounding we do, this is equivalent to
-            // sqrt((sumSquares + 1)/4). This has been verified exhaustively for
-            // sumSquares <= 4 * 16383^2
-            const auto one32 = _mm_set1_epi32(1);
-            const auto sumSquaresPlusOneDiv4 =
-                _mm_srli_epi32(_mm_add_epi32(sumSquares, one32), 2);
-            // Take square root and truncate/floor to int32
-            auto rms = _mm_cvttps_epi32(
-                _mm_sqrt_ps(_mm_cvtepi32_ps(sumSquaresPlusOneDiv4)));
-
-            // Round to upper value if it minimizes the
-            // error |rms^2 - sumSquares/4|
-            // if( 2 * (2 * rms * (rms + 1) + 1) < sumSquares )
-            //    rms += 1;
-            // which is equivalent to:
-            // if( rms * rms + rms < (sumSquares+1) / 4 )
-            //    rms += 1;
-            auto mask =
-                _mm_cmpgt_epi32(sumSquaresPlusOneDiv4,
-                                _mm_add_epi32(_mm_madd_epi16(rms, rms), rms));
-            rms = _mm_sub_epi32(rms, mask);
-            // Pack each 32 bit RMS value to 16 bits
-            rms = _mm_packs_epi32(rms, rms /* could be anything */);
-            _mm_storel_epi64(
-                reinterpret_cast<__m128i *>(&pDstScanline[iDstPixel]), rms);
-            pSrcScanlineShifted += 8;
-            continue;
-        }
-
-        // An approach using _mm_mullo_epi16, _mm_mulhi_epu16 before extending
-        // to 32 bit would result in 4 multiplications instead of 8, but
-        // mullo/mulhi have a worse throughput than mul_pd.
-
-        // Extend those UInt16s as UInt32s
-        const auto firstLineLo = _mm_unpacklo_epi16(firstLine, zero);
-        const auto firstLineHi = _mm_unpackhi_epi16(firstLine, zero);
-        const auto secondLineLo = _mm_unpacklo_epi16(secondLine, zero);
-        const auto secondLineHi = _mm_unpackhi_epi16(secondLine, zero);
-
-#ifdef __AVX2__
-        // Multiplication of 32 bit values previously converted to 64 bit double
-        const auto firstLineLoDbl = SQUARE_PD(_mm256_cvtepi32_pd(firstLineLo));
-        const auto firstLineHiDbl = SQUARE_PD(_mm256_cvtepi32_pd(firstLineHi));
-        const auto secondLineLoDbl =
-            SQUARE_PD(_mm256_cvtepi32_pd(secondLineLo));
-        const auto secondLineHiDbl =
-            SQUARE_PD(_mm256_cvtepi32_pd(secondLineHi));
-
-        // Vertical addition of squares
-        const auto sumSquaresLo =
-            _mm256_add_pd(firstLineLoDbl, secondLineLoDbl);
-        const auto sumSquaresHi =
-            _mm256_add_pd(firstLineHiDbl, secondLineHiDbl);
-
-        // Horizontal addition of squares
-        const auto sumSquares =
-            FIXUP_LANES(_mm256_hadd_pd(sumSquaresLo, sumSquaresHi));
-
-        const auto sumDivWeight = _mm256_mul_pd(sumSquares, zeroDot25);
-
-        // Take square root and truncate/floor to int32
-        auto rms = _mm256_cvttpd_epi32(_mm256_sqrt_pd(sumDivWeight));
-        const auto rmsDouble = _mm256_cvtepi32_pd(rms);
-        const auto right = _mm256_sub_pd(
-            sumDivWeight, _mm256_add_pd(SQUARE_PD(rmsDouble), rmsDouble));
-
-        auto mask =
-            _mm256_castpd_ps(_mm256_cmp_pd(zeroDot5, right, _CMP_LT_OS));
-        // Extract 32-bit from each of the 4 64-bit masks
-        // mask = FIXUP_LANES(_mm256_shuffle_ps(mask, mask,
-        // _MM_SHUFFLE(2,0,2,0)));
-        mask = _mm256_permutevar8x32_ps(mask, permutation);
-        const auto maskI = _mm_castps_si128(_mm256_extractf128_ps(mask, 0));
-
-        // Apply the correction
-        rms = _mm_sub_epi32(rms, maskI);
-
-        // Pack each 32 bit RMS value to 16 bits
-        rms = _mm_packus_epi32(rms, rms /* could be anything */);
-#else
-        // Multiplication of 32 bit values previously converted to 64 bit double
-        const auto firstLineLoLo = SQUARE_PD(_mm_cvtepi32_pd(firstLineLo));
-        const auto firstLineLoHi =
-            SQUARE_PD(_mm_cvtepi32_pd(_mm_srli_si128(firstLineLo, 8)));
-        const auto firstLineHiLo = SQUARE_PD(_mm_cvtepi32_pd(firstLineHi));
-        const auto firstLineHiHi =
-            SQUARE_PD(_mm_cvtepi32_pd(_mm_srli_si128(firstLineHi, 8)));
-
-        const auto secondLineLoLo = SQUARE_PD(_mm_cvtepi32_pd(secondLineLo));
-        const auto secondLineLoHi =
-            SQUARE_PD(_mm_cvtepi32_pd(_mm_srli_si128(secondLineLo, 8)));
-        const auto secondLineHiLo = SQUARE_PD(_mm_cvtepi32_pd(secondLineHi));
-        const auto secondLineHiHi =
-            SQUARE_PD(_mm_cvtepi32_pd(_mm_srli_si128(secondLineHi, 8)));
-
-        // Vertical addition of squares
-        const auto sumSquaresLoLo = _mm_add_pd(firstLineLoLo, secondLineLoLo);
-        const auto sumSquaresLoHi = _mm_add_pd(firstLineLoHi, secondLineLoHi);
-        const auto sumSquaresHiLo = _mm_add_pd(firstLineHiLo, secondLineHiLo);
-        const auto sumSquaresHiHi = _mm_add_pd(firstLineHiHi, secondLineHiHi);
-
-        // Horizontal addition of squares
-        const auto sumSquaresLo = sse2_hadd_pd(sumSquaresLoLo, sumSquaresLoHi);
-        const auto sumSquaresHi = sse2_hadd_pd(sumSquaresHiLo, sumSquaresHiHi);
-
-        const auto sumDivWeightLo = _mm_mul_pd(sumSquaresLo, zeroDot25);
-        const auto sumDivWeightHi = _mm_mul_pd(sumSquaresHi, zeroDot25);
-        // Take square root and truncate/floor to int32
-        const auto rmsLo = _mm_cvttpd_epi32(_mm_sqrt_pd(sumDivWeightLo));
-        const auto rmsHi = _mm_cvttpd_epi32(_mm_sqrt_pd(sumDivWeightHi));
-
-        // Correctly round rms to minimize | rms^2 - sumSquares / 4 |
-        // if( 0.5 < sumDivWeight - (rms * rms + rms) )
-        //     rms += 1;
-        const auto rmsLoDouble = _mm_cvtepi32_pd(rmsLo);
-        const auto rmsHiDouble = _mm_cvtepi32_pd(rmsHi);
-        const auto rightLo = _mm_sub_pd(
-            sumDivWeightLo, _mm_add_pd(SQUARE_PD(rmsLoDouble), rmsLoDouble));
-        const auto rightHi = _mm_sub_pd(
-            sumDivWeightHi, _mm_add_pd(SQUARE_PD(rmsHiDouble), rmsHiDouble));
-
-        const auto maskLo = _mm_castpd_ps(_mm_cmplt_pd(zeroDot5, rightLo));
-        const auto maskHi = _mm_castpd_ps(_mm_cmplt_pd(zeroDot5, rightHi));
-        // The value of the mask will be -1 when the correction needs to be
-        // applied
-        const auto mask = _mm_castps_si128(_mm_shuffle_ps(
-            maskLo, maskHi, (0 << 0) | (2 << 2) | (0 << 4) | (2 << 6)));
-
-        auto rms = _mm_castps_si128(
-            _mm_movelh_ps(_mm_castsi128_ps(rmsLo), _mm_castsi128_ps(rmsHi)));
-        // Apply the correction
-        rms = _mm_sub_epi32(rms, mask);
-
-        // Pack each 32 bit RMS value to 16 bits
-        rms = sse2_packus_epi32(rms, rms /* could be anything */);
-#endif
-
-        _mm_storel_epi64(reinterpret_cast<__m128i *>(&pDstScanline[iDstPixel]),
-                         rms);
-        pSrcScanlineShifted += 8;
-    }
-
-    pSrcScanlineShiftedInOut = pSrcScanlineShifted;
-    return iDstPixel;
-}
-
-/************************************************************************/
-/*                         AverageUInt16SSE2()                          */
-/************************************************************************/
-
-template <class T>
-static int AverageUInt16SSE2(int nDstXWidth, int nChunkXSize,
-                             const T *&CPL_RESTRICT pSrcScanlineShiftedInOut,
-                             T *CPL_RESTRICT pDstScanline)
-{
-    // Optimized implementation for average on UInt16 by
-    // processing by group of 8 output pixels.
-
-    const auto mask = _mm_set1_epi32(0xFFFF);
-    const auto two = _mm_set1_epi32(2);
-    const T *CPL_RESTRICT pSrcScanlineShifted = pSrcScanlineShiftedInOut;
-
-    int iDstPixel = 0;
-    for (; iDstPixel < nDstXWidth - 7; iDstPixel += 8)
-    {
-        __m128i averageLow;
-        // Load 8 UInt16 from each line
-        {
-            const auto firstLine = _mm_loadu_si128(
-                reinterpret_cast<__m128i const *>(pSrcScanlineShifted));
-            const auto secondLine =
-                _mm_loadu_si128(reinterpret_cast<__m128i const *>(
-                    pSrcScanlineShifted + nChunkXSize));
-
-            // Horizontal addition and extension to 32 bit
-            const auto horizAddFirstLine = _mm_add_epi32(
-                _mm_and_si128(firstLine, mask), _mm_srli_epi32(firstLine, 16));
-            const auto horizAddSecondLine =
-                _mm_add_epi32(_mm_and_si128(secondLine, mask),
-                              _mm_srli_epi32(secondLine, 16));
-
-            // Vertical addition and average computation
-            // average = (sum + 2) >> 2
-            const auto sum = _mm_add_epi32(
-                _mm_add_epi32(horizAddFirstLine, horizAddSecondLine), two);
-            averageLow = _mm_srli_epi32(sum, 2);
-        }
-        // Load 8 UInt16 from each line
-        __m128i averageHigh;
-        {
-            const auto firstLine = _mm_loadu_si128(
-                reinterpret_cast<__m128i const *>(pSrcScanlineShifted + 8));
-            const auto secondLine =
-                _mm_loadu_si128(reinterpret_cast<__m128i const *>(
-                    pSrcScanlineShifted + 8 + nChunkXSize));
-
-            // Horizontal addition and extension to 32 bit
-            const auto horizAddFirstLine = _mm_add_epi32(
-                _mm_and_si128(firstLine, mask), _mm_srli_epi32(firstLine, 16));
-            const auto horizAddSecondLine =
-                _mm_add_epi32(_mm_and_si128(secondLine, mask),
-                              _mm_srli_epi32(secondLine, 16));
-
-            // Vertical addition and average computation
-            // average = (sum + 2) >> 2
-            const auto sum = _mm_add_epi32(
-                _mm_add_epi32(horizAddFirstLine, horizAddSecondLine), two);
-            averageHigh = _mm_srli_epi32(sum, 2);
-        }
-
-        // Pack each 32 bit average value to 16 bits
-        auto average = sse2_packus_epi32(averageLow, averageHigh);
-        _mm_storeu_si128(reinterpret_cast<__m128i *>(&pDstScanline[iDstPixel]),
-                         average);
-        pSrcScanlineShifted += 16;
-    }
-
-    pSrcScanlineShiftedInOut = pSrcScanlineShifted;
-    return iDstPixel;
-}
-
-/************************************************************************/
-/*                      QuadraticMeanFloatSSE2()                        */
-/************************************************************************/
-
-#ifdef __SSE3__
-#define sse2_hadd_ps _mm_hadd_ps
-#else
-inline __m128 sse2_hadd_ps(__m128 a, __m128 b)
-{
-    auto aEven_bEven = _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
-    auto aOdd_bOdd = _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
-    return _mm_add_ps(aEven_bEven, aOdd_bOdd);  // (aEven + aOdd, bEven + bOdd)
-}
+// When AVX2 is not enabled at compile time, but the AVX2 kernels of
+// overview_avx2.cpp are available, select them at runtime.
+#if defined(HAVE_AVX2_AT_COMPILE_TIME) && !defined(__AVX2__) &&               \
+    (defined(__x86_64) || defined(_M_X64))
+#define USE_AVX2_RUNTIME_DISPATCH
 #endif
-
-#ifdef __AVX2__
-#define RMS_FLOAT_ELTS 8
-#define set1_ps _mm256_set1_ps
-#define loadu_ps _mm256_loadu_ps
-#define andnot_ps _mm256_andnot_ps
-#define and_ps _mm256_and_ps
-#define max_ps _mm256_max_ps
-#define shuffle_ps _mm256_shuffle_ps
-#define div_ps _mm256_div_ps
-#define cmpeq_ps(x, y) _mm256_cmp_ps(x, y, _CMP_EQ_OQ)
-#define mul_ps _mm256_mul_ps
-#define add_ps _mm256_add_ps
-#define hadd_ps _mm256_hadd_ps
-#define sqrt_ps _mm256_sqrt_ps
-#define or_ps _mm256_or_ps
-#define unpacklo_ps _mm256_unpacklo_ps
-#define unpackhi_ps _mm256_unpackhi_ps
-#define storeu_ps _mm256_storeu_ps
-
-inline __m256 SQUARE_PS(__m256 x)
-{
-    return _mm256_mul_ps(x, x);
-}
-
-#else
-
-#define RMS_FLOAT_ELTS 4
-#define set1_ps _mm_set1_ps
-#define loadu_ps _mm_loadu_ps
-#define andnot_ps _mm_andnot_ps
-#define and_ps _mm_and_ps
-#define max_ps _mm_max_ps
-#define shuffle_ps _mm_shuffle_ps
-#define div_ps _mm_div_ps
-#define cmpeq_ps _mm_cmpeq_ps
-#define mul_ps _mm_mul_ps
-#define add_ps _mm_add_ps
-#define hadd_ps sse2_hadd_ps
-#define sqrt_ps _mm_sqrt_ps
-#define or_ps _mm_or_ps
-#define unpacklo_ps _mm_unpacklo_ps
-#define unpackhi_ps _mm_unpackhi_ps
-#define storeu_ps _mm_storeu_ps
-
-inline __m128 SQUARE_PS(__m128 x)
-{
-    return _mm_mul_ps(x, x);
-}
-
-inline __m128 FIXUP_LANES(__m128 x)
-{
-    return x;
-}
-
-#endif
-
-static int
-#if defined(__GNUC__)
-    __attribute__((noinline))
-#endif
-    QuadraticMeanFloatSSE2(int nDstXWidth, int nChunkXSize,
-                           const float *&CPL_RESTRICT pSrcScanlineShiftedInOut,
-                           float *CPL_RESTRICT pDstScanline)
-{
-    // Optimized implementation for RMS on Float32 by
-    // processing by group of RMS_FLOAT_ELTS output pixels.
-    const float *CPL_RESTRICT pSrcScanlineShifted = pSrcScanlineShiftedInOut;
-
-    int iDstPixel = 0;
-    const auto minus_zero = set1_ps(-0.0f);
-    const auto zeroDot25 = set1_ps(0.25f);
-    const auto one = set1_ps(1.0f);
-    const auto infv = set1_ps(std::numeric_limits<float>::infinity());
-
-    for (; iDstPixel < nDstXWidth - (RMS_FLOAT_ELTS - 1);
-         iDstPixel += RMS_FLOAT_ELTS)
-    {
-        // Load 2*RMS_FLOAT_ELTS Float32 from each line
-        auto firstLineLo = loadu_ps(pSrcScanlineShifted);
-        auto firstLineHi = loadu_ps(pSrcScanlineShifted + RMS_FLOAT_ELTS);
-        auto secondLineLo = loadu_ps(pSrcScanlineShifted + nChunkXSize);
-        auto secondLineHi =
-            loadu_ps(pSrcScanlineShifted + RMS_FLOAT_ELTS + nChunkXSize);
-
-        // Take the absolute value
-        firstLineLo = andnot_ps(minus_zero, firstLineLo);
-        firstLineHi = andnot_ps(minus_zero, firstLineHi);
-        secondLineLo = andnot_ps(minus_zero, secondLineLo);
-        secondLineHi = andnot_ps(minus_zero, secondLineHi);
-
-        auto firstLineEven =
-            shuffle_ps(firstLineLo, firstLineHi, _MM_SHUFFLE(2, 0, 2, 0));
-        auto firstLineOdd =
-            shuffle_ps(firstLineLo, firstLineHi, _MM_SHUFFLE(3, 1, 3, 1));
-        auto secondLineEven =
-            shuffle_ps(secondLineLo, secondLineHi, _MM_SHUFFLE(2, 0, 2, 0));
-        auto secondLineOdd =
-            shuffle_ps(secondLineLo, secondLineHi, _MM_SHUFFLE(3, 1, 3, 1));
-
-        // Compute the maximum of each RMS_FLOAT_ELTS value to RMS-average
-        const auto maxV = max_ps(max_ps(firstLineEven, firstLineOdd),
-                                 max_ps(secondLineEven, secondLineEven));
-
-        // Normalize each value by the maximum of the RMS_FLOAT_ELTS ones.
-        // This step is important to avoid that the square evaluates to infinity
-        // for sufficiently big input.
-        auto invMax = div_ps(one, maxV);
-        // Deal with 0 being the maximum to correct division by zero
-        // note: comparing to -0 leads to identical results as to comparing with
-        // 0
-        invMax = andnot_ps(cmpeq_ps(maxV, minus_zero), invMax);
-
-        firstLineEven = mul_ps(firstLineEven, invMax);
-        firstLineOdd = mul_ps(firstLineOdd, invMax);
-        secondLineEven = mul_ps(secondLineEven, invMax);
-        secondLineOdd = mul_ps(secondLineOdd, invMax);
-
-        // Compute squares
-        firstLineEven = SQUARE_PS(firstLineEven);
-        firstLineOdd = SQUARE_PS(firstLineOdd);
-        secondLineEven = SQUARE_PS(secondLineEven);
-        secondLineOdd = SQUARE_PS(secondLineOdd);
-
-        const auto sumSquares = add_ps(add_ps(firstLineEven, firstLineOdd),
-                                       add_ps(secondLineEven, secondLineOdd));
-
-        auto rms = mul_ps(maxV, sqrt_ps(mul_ps(sumSquares, zeroDot25)));
-
-        // Deal with infinity being the maximum
-        const auto maskIsInf = cmpeq_ps(maxV, infv);
-        rms = or_ps(andnot_ps(maskIsInf, rms), and_ps(maskIsInf, infv));
-
-        rms = FIXUP_LANES(rms);
-
-        storeu_ps(&pDstScanline[iDstPixel], rms);
-        pSrcScanlineShifted += RMS_FLOAT_ELTS * 2;
-    }
-
-    pSrcScanlineShiftedInOut = pSrcScanlineShifted;
-    return iDstPixel;
-}
-
-/************************************************************************/
-/*                        AverageFloatSSE2()                            */
-/************************************************************************/
-
-static int AverageFloatSSE2(int nDstXWidth, int nChunkXSize,
-                            const float *&CPL_RESTRICT pSrcScanlineShiftedInOut,
-                            float *CPL_RESTRICT pDstScanline)
-{
-    // Optimized implementation for average on Float32 by
-    // processing by group of 4 output pixels.
-    const float *CPL_RESTRICT pSrcScanlineShifted = pSrcScanlineShiftedInOut;
-
-    int iDstPixel = 0;
-    const auto zeroDot25 = _mm_set1_ps(0.25f);
-
-    for (; iDstPixel < nDstXWidth - 3; iDstPixel += 4)
-    {
-        // Load 8 Float32 from each line
-        const auto firstLineLo = _mm_loadu_ps(pSrcScanlineShifted);
-        const auto firstLineHi = _mm_loadu_ps(pSrcScanlineShifted + 4);
-        const auto secondLineLo =
-            _mm_loadu_ps(pSrcScanlineShifted + nChunkXSize);
-        const auto secondLineHi =
-            _mm_loadu_ps(pSrcScanlineShifted + 4 + nChunkXSize);
-
-        // Vertical addition
-        const auto sumLo = _mm_add_ps(firstLineLo, secondLineLo);
-        const auto sumHi = _mm_add_ps(firstLineHi, secondLineHi);
-
-        // Horizontal addition
-        const auto sum = sse2_hadd_ps(sumLo, sumHi);
-
-        const auto average = _mm_mul_ps(sum, zeroDot25);
-
-        _mm_storeu_ps(&pDstScanline[iDstPixel], average);
-        pSrcScanlineShifted += 8;
-    }
-
-    pSrcScanlineShiftedInOut = pSrcScanlineShifted;
-    return iDstPixel;
-}
-
 #endif
 
 /************************************************************************/
@@ -1175,6 +388,12 @@ GDALResampleChunk_AverageOrRMS_T(const GDALOverviewResampleArgs &args,
     if (bBit2Grayscale)
         poColorTable = nullptr;
 
+#ifdef USE_AVX2_RUNTIME_DISPATCH
+    const bool bHasAVX2 =
+        CPLHaveRuntimeAVX2() &&
+        CPLTestBool(CPLGetConfigOption("GDAL_USE_AVX2", "YES"));
+#endif
+
     T tNoDataValue;
     if (!bHasNoData)
         tNoDataValue = 0;
@@ -1327,15 +546,29 @@ GDALResampleChunk_AverageOrRMS_T(const GDALOverviewResampleArgs &args,
                     {
                         if (bQuadraticMean)
                         {
-                            iDstPixel = QuadraticMeanByteSSE2OrAVX2(
-                                nDstXWidth, nChunkXSize, pSrcScanlineShifted,
-                                pDstScanline);
+#ifdef USE_AVX2_RUNTIME_DISPATCH
+                            if (bHasAVX2)
+                                iDstPixel = GDALQuadraticMeanByte_AVX2(
+                                    nDstXWidth, nChunkXSize,
+                                    pSrcScanlineShifted, pDstScanline);
+                            else
+#endif
+                                iDstPixel = QuadraticMeanByteSSE2OrAVX2(
+                                    nDstXWidth, nChunkXSize,
+                                    pSrcScanlineShifted, pDstScanline);
                         }
                         else
                         {
-                            iDstPixel = AverageByteSSE2OrAVX2(
-                                nDstXWidth, nChunkXSize, pSrcScanlineShifted,
-                                pDstScanline);
+#ifdef USE_AVX2_RUNTIME_DISPATCH
+                            if (bHasAVX2)
+                                iDstPixel = GDALAverageByte_AVX2(
+                                    nDstXWidth, nChunkXSize,
+                                    pSrcScanlineShifted, pDstScanline);
+                            else
+#endif
+                                iDstPixel = AverageByteSSE2OrAVX2(
+                                    nDstXWidth, nChunkXSize,
+                                    pSrcScanlineShifted, pDstScanline);
                         }
                     }
                     else
@@ -1343,9 +576,16 @@ GDALResampleChunk_AverageOrRMS_T(const GDALOverviewResampleArgs &args,
                         static_assert(eWrkDataType == GDT_UInt16);
                         if (bQuadraticMean)
                         {
-                            iDstPixel = QuadraticMeanUInt16SSE2(
-                                nDstXWidth, nChunkXSize, pSrcScanlineShifted,
-                                pDstScanline);
+#ifdef USE_AVX2_RUNTIME_DISPATCH
+                            if (bHasAVX2)
+                                iDstPixel = GDALQuadraticMeanUInt16_AVX2(
+                                    nDstXWidth, nChunkXSize,
+                                    pSrcScanlineShifted, pDstScanline);
+                            else
+#endif
+                                iDstPixel = QuadraticMeanUInt16SSE2(
+                                    nDstXWidth, nChunkXSize,
+                                    pSrcScanlineShifted, pDstScanline);
                         }
                         else
                         {
@@ -1401,9 +641,16 @@ GDALResampleChunk_AverageOrRMS_T(const GDALOverviewResampleArgs &args,
                         static_assert(std::is_same_v<T, float>);
                         if (bQuadraticMean)
                         {
-                            iDstPixel = QuadraticMeanFloatSSE2(
-                                nDstXWidth, nChunkXSize, pSrcScanlineShifted,
-                                pDstScanline);
+#ifdef USE_AVX2_RUNTIME_DISPATCH
+                            if (bHasAVX2)
+                                iDstPixel = GDALQuadraticMeanFloat_AVX2(
+                                    nDstXWidth, nChunkXSize,
+                                    pSrcScanlineShifted, pDstScanline);
+                            else
+#endif
+                                iDstPixel = QuadraticMeanFloatSSE2(
+                                    nDstXWidth, nChunkXSize,
+                                    pSrcScanlineShifted, pDstScanline);
                         }
                         else
                         {
@@ -5108,6 +4355,700 @@ CPLErr GDALRegenerateOverviewsEx(GDALRasterBandH hSrcBand, int nOverviewCount,
     return eErr;
 }
 
+/************************************************************************/
+/*                     GDALOvrGetQueriedSrcWindow()                     */
+/************************************************************************/
+
+// Compute, along one axis, the source window that must be read to compute
+// the [nDstOff, nDstOff + nDstCount[ range of an overview. This mirrors the
+// chunk computation of the per-level loop of
+// GDALRegenerateOverviewsMultiBand(), so that both code paths feed the
+// resampling functions with the same source pixels.
+static void GDALOvrGetQueriedSrcWindow(int nDstOff, int nDstCount,
+                                       int nDstTotal, int nSrcTotal,
+                                       double dfRatioDstToSrc, int nMargin,
+                                       int &nQueriedOff, int &nQueriedSize)
+{
+    const int nChunkOff = static_cast<int>(nDstOff * dfRatioDstToSrc);
+    int nChunkOff2 =
+        static_cast<int>(ceil((nDstOff + nDstCount) * dfRatioDstToSrc));
+    if (nChunkOff2 > nSrcTotal || nDstOff + nDstCount == nDstTotal)
+        nChunkOff2 = nSrcTotal;
+
+    nQueriedOff = nChunkOff - nMargin;
+    nQueriedSize = nChunkOff2 - nChunkOff + RADIUS_TO_DIAMETER * nMargin;
+    if (nQueriedOff < 0)
+    {
+        nQueriedSize += nQueriedOff;
+        nQueriedOff = 0;
+    }
+    if (nQueriedSize + nQueriedOff > nSrcTotal)
+        nQueriedSize = nSrcTotal - nQueriedOff;
+}
+
+/************************************************************************/
+/*                      GDALOvrSinglePassBuilder                        */
+/************************************************************************/
+
+namespace
+{
+
+// Generates all the overview levels of GDALRegenerateOverviewsMultiBand()
+// with a single top-down read of the source bands.
+//
+// Each level (the source bands, then each overview but the last one) owns a
+// window of full-width rows holding what is still needed to compute the next
+// level. Overview levels are computed by horizontal strips, pulling rows from
+// the level below on demand, so that all levels progress together and only
+// a few strips per level are held in memory. Once a strip is written, it is
+// read back from the overview bands, while its blocks are still in the block
+// cache, to feed the next level: this gives exactly the same source values
+// (and masks) as the per-level code path.
+class GDALOvrSinglePassBuilder
+{
+  public:
+    GDALOvrSinglePassBuilder(int nBands, GDALRasterBand *const *papoSrcBands,
+                             int nOverviews,
+                             GDALRasterBand *const *const *papapoOverviewBands,
+                             const char *pszResampling,
+                             GDALResampleFunction pfnResampleFn,
+                             int nKernelRadius, GDALDataType eWrkDataType,
+                             bool bUseNoDataMask,
+                             const std::vector<bool> &abHasNoData,
+                             const std::vector<double> &adfNoDataValue,
+                             bool bPropagateNoData, CPLJobQueue *poJobQueue,
+                             int nThreads)
+        : m_nBands(nBands), m_papoSrcBands(papoSrcBands),
+          m_nOverviews(nOverviews), m_papapoOverviewBands(papapoOverviewBands),
+          m_pszResampling(pszResampling), m_pfnResampleFn(pfnResampleFn),
+          m_nKernelRadius(nKernelRadius), m_eWrkDataType(eWrkDataType),
+          m_nWrkDataTypeSize(
+              std::max(1, GDALGetDataTypeSizeBytes(eWrkDataType))),
+          m_bUseNoDataMask(bUseNoDataMask), m_abHasNoData(abHasNoData),
+          m_adfNoDataValue(adfNoDataValue),
+          m_bPropagateNoData(bPropagateNoData), m_poJobQueue(poJobQueue),
+          m_nThreads(nThreads)
+    {
+    }
+
+    bool Plan(GIntBig nMaxMemory);
+    CPLErr Run(double dfTotalPixelCount, GDALProgressFunc pfnProgress,
+               void *pProgressData);
+
+  private:
+    // Rows of a level still needed to compute the next one
+    struct Level
+    {
+        int nXSize = 0;
+        int nYSize = 0;
+        int nRowCapacity = 0;
+        // First row held in the buffers
+        int nRowStart = 0;
+        // One past the last row held in the buffers (i.e. number of rows
+        // of the level produced so far)
+        int nRowEnd = 0;
+        std::vector<std::unique_ptr<void, VSIFreeReleaser>> apData{};
+        std::vector<std::unique_ptr<GByte, VSIFreeReleaser>> apabyMask{};
+    };
+
+    // Computation state of an overview level
+    struct Overview
+    {
+        int nXSize = 0;
+        int nYSize = 0;
+        int nBlockXSize = 0;
+        int nStripHeight = 0;
+        double dfXRatioDstToSrc = 0;
+        double dfYRatioDstToSrc = 0;
+        int nMargin = 0;
+        int nNextDstYOff = 0;
+        std::vector<int> anNBITS{};
+    };
+
+    // Resampling of (part of) a strip of one band
+    struct Job
+    {
+        GDALOverviewResampleArgs args{};
+        const void *pChunk = nullptr;
+        std::unique_ptr<void, VSIFreeReleaser> pChunkCopy{};
+        std::unique_ptr<GByte, VSIFreeReleaser> pabyMaskCopy{};
+        GDALRasterBand *poDstBand = nullptr;
+        CPLErr eErr = CE_Failure;
+        std::unique_ptr<void, VSIFreeReleaser> pDstBuffer{};
+        GDALDataType eDstBufferDataType = GDT_Unknown;
+    };
+
+    const int m_nBands;
+    GDALRasterBand *const *const m_papoSrcBands;
+    const int m_nOverviews;
+    GDALRasterBand *const *const *const m_papapoOverviewBands;
+    const char *const m_pszResampling;
+    const GDALResampleFunction m_pfnResampleFn;
+    const int m_nKernelRadius;
+    const GDALDataType m_eWrkDataType;
+    const int m_nWrkDataTypeSize;
+    const bool m_bUseNoDataMask;
+    const std::vector<bool> &m_abHasNoData;
+    const std::vector<double> &m_adfNoDataValue;
+    const bool m_bPropagateNoData;
+    CPLJobQueue *const m_poJobQueue;
+    const int m_nThreads;
+
+    // m_aoLevels[0] is the source, m_aoLevels[i] the source of overview i
+    std::vector<Level> m_aoLevels{};
+    std::vector<Overview> m_aoOverviews{};
+    // Number of source rows read at once
+    int m_nSrcStepHeight = 0;
+
+    double m_dfCurPixelCount = 0;
+    double m_dfTotalPixelCount = 0;
+    GDALProgressFunc m_pfnProgress = nullptr;
+    void *m_pProgressData = nullptr;
+
+    GDALRasterBand *GetLevelBand(int iLevel, int iBand) const
+    {
+        return iLevel == 0 ? m_papoSrcBands[iBand]
+                           : m_papapoOverviewBands[iBand][iLevel - 1];
+    }
+
+    // Number of rows added at once to a level
+    int GetStepHeight(int iLevel) const
+    {
+        return iLevel == 0 ? m_nSrcStepHeight
+                           : m_aoOverviews[iLevel - 1].nStripHeight;
+    }
+
+    int GetXChunkCount(int iOvr) const;
+    int GetMaxQueriedRows(int iOvr) const;
+    double EstimateMemory() const;
+    CPLErr AppendRows(int iLevel, int nYOff, int nYCount);
+    void DiscardRows(int iLevel, int nNewRowStart);
+    CPLErr ProduceStrip(int iOvr);
+
+    CPL_DISALLOW_COPY_ASSIGN(GDALOvrSinglePassBuilder)
+};
+
+/************************************************************************/
+/*                           GetXChunkCount()                           */
+/************************************************************************/
+
+// Number of jobs per band in which a strip is split, so that the thread
+// pool is kept busy when there are fewer bands than threads.
+int GDALOvrSinglePassBuilder::GetXChunkCount(int iOvr) const
+{
+    if (!m_poJobQueue || m_nBands >= m_nThreads)
+        return 1;
+    const auto &oOvr = m_aoOverviews[iOvr];
+    const int nBlocks =
+        static_cast<int>((static_cast<GIntBig>(oOvr.nXSize) +
+                          oOvr.nBlockXSize - 1) /
+                         oOvr.nBlockXSize);
+    return std::max(1, std::min((m_nThreads + m_nBands - 1) / m_nBands,
+                                nBlocks));
+}
+
+/************************************************************************/
+/*                         GetMaxQueriedRows()                          */
+/************************************************************************/
+
+// Maximum number of rows of its source level needed by a strip of overview
+// iOvr.
+int GDALOvrSinglePassBuilder::GetMaxQueriedRows(int iOvr) const
+{
+    const auto &oOvr = m_aoOverviews[iOvr];
+    const int nStripHeight = oOvr.nStripHeight;
+    int nMaxQueried = 0;
+    for (int nDstYOff = 0; nDstYOff < oOvr.nYSize; nDstYOff += nStripHeight)
+    {
+        int nQueriedOff = 0;
+        int nQueriedSize = 0;
+        GDALOvrGetQueriedSrcWindow(
+            nDstYOff, std::min(nStripHeight, oOvr.nYSize - nDstYOff),
+            oOvr.nYSize, m_aoLevels[iOvr].nYSize, oOvr.dfYRatioDstToSrc,
+            oOvr.nMargin, nQueriedOff, nQueriedSize);
+        nMaxQueried = std::max(nMaxQueried, nQueriedSize);
+    }
+    return nMaxQueried;
+}
+
+/************************************************************************/
+/*                           EstimateMemory()                           */
+/************************************************************************/
+
+// Compute the capacity of the row windows for the current strip heights,
+// and return the peak amount of memory needed.
+double GDALOvrSinglePassBuilder::EstimateMemory() const
+{
+    const double dfPixelSize =
+        static_cast<double>(m_nBands) *
+        (m_nWrkDataTypeSize + (m_bUseNoDataMask ? 1 : 0));
+    double dfRowsMem = 0;
+    double dfMaxStripMem = 0;
+    for (int iOvr = 0; iOvr < m_nOverviews; ++iOvr)
+    {
+        const auto &oSrc = m_aoLevels[iOvr];
+        const auto &oOvr = m_aoOverviews[iOvr];
+        const int nMaxQueried = GetMaxQueriedRows(iOvr);
+        dfRowsMem += static_cast<double>(std::min(
+                         oSrc.nYSize, nMaxQueried + GetStepHeight(iOvr))) *
+                     oSrc.nXSize * dfPixelSize;
+
+        // Per-job copies of the source window and resampled strips
+        double dfStripMem = static_cast<double>(oOvr.nStripHeight) *
+                            oOvr.nXSize * m_nBands * sizeof(double);
+        if (GetXChunkCount(iOvr) > 1)
+            dfStripMem +=
+                static_cast<double>(nMaxQueried) * oSrc.nXSize * dfPixelSize;
+        dfMaxStripMem = std::max(dfMaxStripMem, dfStripMem);
+    }
+    return dfRowsMem + dfMaxStripMem;
+}
+
+/************************************************************************/
+/*                                Plan()                                */
+/************************************************************************/
+
+// Select strip heights so that the memory needed remains below nMaxMemory.
+// Returns false if that is not possible.
+bool GDALOvrSinglePassBuilder::Plan(GIntBig nMaxMemory)
+{
+    m_aoLevels.resize(m_nOverviews);
+    m_aoOverviews.resize(m_nOverviews);
+
+    int nSrcBlockXSize = 0;
+    int nSrcBlockYSize = 0;
+    m_papoSrcBands[0]->GetBlockSize(&nSrcBlockXSize, &nSrcBlockYSize);
+
+    for (int iOvr = 0; iOvr < m_nOverviews; ++iOvr)
+    {
+        auto &oSrc = m_aoLevels[iOvr];
+        oSrc.nXSize = GetLevelBand(iOvr, 0)->GetXSize();
+        oSrc.nYSize = GetLevelBand(iOvr, 0)->GetYSize();
+
+        auto &oOvr = m_aoOverviews[iOvr];
+        const auto poOvrBand = m_papapoOverviewBands[0][iOvr];
+        oOvr.nXSize = poOvrBand->GetXSize();
+        oOvr.nYSize = poOvrBand->GetYSize();
+        oOvr.dfXRatioDstToSrc = static_cast<double>(oSrc.nXSize) / oOvr.nXSize;
+        oOvr.dfYRatioDstToSrc = static_cast<double>(oSrc.nYSize) / oOvr.nYSize;
+        const int nOvrFactor = std::max(
+            1, std::max(static_cast<int>(0.5 + oOvr.dfXRatioDstToSrc),
+                        static_cast<int>(0.5 + oOvr.dfYRatioDstToSrc)));
+        if (m_nKernelRadius > 0 && nOvrFactor > INT_MAX / RADIUS_TO_DIAMETER /
+                                                    m_nKernelRadius)
+        {
+            return false;
+        }
+        oOvr.nMargin = m_nKernelRadius * nOvrFactor;
+
+        int nBlockYSize = 0;
+        poOvrBand->GetBlockSize(&oOvr.nBlockXSize, &nBlockYSize);
+        oOvr.nBlockXSize = std::max(1, oOvr.nBlockXSize);
+        oOvr.nStripHeight = std::max(1, std::min(nBlockYSize, oOvr.nYSize));
+
+        for (int iBand = 0; iBand < m_nBands; ++iBand)
+        {
+            const char *pszNBITS =
+                m_papapoOverviewBands[iBand][iOvr]->GetMetadataItem(
+                    "NBITS", "IMAGE_STRUCTURE");
+            oOvr.anNBITS.push_back(pszNBITS ? atoi(pszNBITS) : 0);
+        }
+    }
+
+    // Read the source by whole rows of blocks, covering at least the
+    // source rows of a strip of the first overview.
+    const auto ComputeSrcStepHeight = [this, nSrcBlockYSize]()
+    {
+        const auto &oOvr = m_aoOverviews[0];
+        const int nBlockYSize = std::max(1, nSrcBlockYSize);
+        const double dfRows = std::min<double>(
+            m_aoLevels[0].nYSize,
+            std::ceil(oOvr.nStripHeight * oOvr.dfYRatioDstToSrc));
+        const double dfBlocks = std::max(1.0, std::ceil(dfRows / nBlockYSize));
+        return static_cast<int>(std::min<double>(m_aoLevels[0].nYSize,
+                                                 dfBlocks * nBlockYSize));
+    };
+    m_nSrcStepHeight = ComputeSrcStepHeight();
+
+    while (EstimateMemory() > static_cast<double>(nMaxMemory))
+    {
+        bool bReduced = false;
+        for (auto &oOvr : m_aoOverviews)
+        {
+            if (oOvr.nStripHeight > 1)
+            {
+                oOvr.nStripHeight /= 2;
+                bReduced = true;
+            }
+        }
+        if (m_nSrcStepHeight > 1)
+        {
+            m_nSrcStepHeight =
+                std::min(m_nSrcStepHeight / 2, ComputeSrcStepHeight());
+            bReduced = true;
+        }
+        if (!bReduced)
+            return false;
+    }
+
+    for (int iLevel = 0; iLevel < m_nOverviews; ++iLevel)
+    {
+        auto &oLevel = m_aoLevels[iLevel];
+        oLevel.nRowCapacity = std::min(
+            oLevel.nYSize, GetMaxQueriedRows(iLevel) + GetStepHeight(iLevel));
+
+        oLevel.apData.resize(m_nBands);
+        if (m_bUseNoDataMask)
+            oLevel.apabyMask.resize(m_nBands);
+        for (int iBand = 0; iBand < m_nBands; ++iBand)
+        {
+            oLevel.apData[iBand].reset(VSIMalloc3(
+                oLevel.nRowCapacity, oLevel.nXSize, m_nWrkDataTypeSize));
+            if (!oLevel.apData[iBand])
+                return false;
+            if (m_bUseNoDataMask)
+            {
+                oLevel.apabyMask[iBand].reset(static_cast<GByte *>(
+                    VSIMalloc2(oLevel.nRowCapacity, oLevel.nXSize)));
+                if (!oLevel.apabyMask[iBand])
+                    return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+/************************************************************************/
+/*                             AppendRows()                             */
+/************************************************************************/
+
+// Read rows [nYOff, nYOff + nYCount[ of a level, that must follow the ones
+// already held.
+CPLErr GDALOvrSinglePassBuilder::AppendRows(int iLevel, int nYOff, int nYCount)
+{
+    auto &oLevel = m_aoLevels[iLevel];
+    CPLAssert(nYOff == oLevel.nRowEnd);
+    if (nYOff + nYCount - oLevel.nRowStart > oLevel.nRowCapacity)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "GDALRegenerateOverviewsMultiBand(): row buffer overflow");
+        return CE_Failure;
+    }
+
+    const size_t nOffset =
+        static_cast<size_t>(nYOff - oLevel.nRowStart) * oLevel.nXSize;
+    for (int iBand = 0; iBand < m_nBands; ++iBand)
+    {
+        GDALRasterBand *poBand = GetLevelBand(iLevel, iBand);
+        CPLErr eErr = poBand->RasterIO(
+            GF_Read, 0, nYOff, oLevel.nXSize, nYCount,
+            static_cast<GByte *>(oLevel.apData[iBand].get()) +
+                nOffset * m_nWrkDataTypeSize,
+            oLevel.nXSize, nYCount, m_eWrkDataType, 0, 0, nullptr);
+        if (eErr == CE_None && m_bUseNoDataMask)
+        {
+            auto poMaskBand =
+                poBand->IsMaskBand() ? poBand : poBand->GetMaskBand();
+            eErr = poMaskBand->RasterIO(
+                GF_Read, 0, nYOff, oLevel.nXSize, nYCount,
+                oLevel.apabyMask[iBand].get() + nOffset, oLevel.nXSize,
+                nYCount, GDT_Byte, 0, 0, nullptr);
+        }
+        if (eErr != CE_None)
+            return eErr;
+    }
+    oLevel.nRowEnd = nYOff + nYCount;
+    return CE_None;
+}
+
+/************************************************************************/
+/*                            DiscardRows()                             */
+/************************************************************************/
+
+// Forget about rows before nNewRowStart, and move the remaining ones at
+// the beginning of the buffers.
+void GDALOvrSinglePassBuilder::DiscardRows(int iLevel, int nNewRowStart)
+{
+    auto &oLevel = m_aoLevels[iLevel];
+    nNewRowStart = std::min(nNewRowStart, oLevel.nRowEnd);
+    if (nNewRowStart <= oLevel.nRowStart)
+        return;
+
+    const size_t nSkipped =
+        static_cast<size_t>(nNewRowStart - oLevel.nRowStart) * oLevel.nXSize;
+    const size_t nKept =
+        static_cast<size_t>(oLevel.nRowEnd - nNewRowStart) * oLevel.nXSize;
+    if (nKept > 0)
+    {
+        for (int iBand = 0; iBand < m_nBands; ++iBand)
+        {
+            GByte *pabyData = static_cast<GByte *>(oLevel.apData[iBand].get());
+            memmove(pabyData, pabyData + nSkipped * m_nWrkDataTypeSize,
+                    nKept * m_nWrkDataTypeSize);
+            if (m_bUseNoDataMask)
+            {
+                GByte *pabyMask = oLevel.apabyMask[iBand].get();
+                memmove(pabyMask, pabyMask + nSkipped, nKept);
+            }
+        }
+    }
+    oLevel.nRowStart = nNewRowStart;
+}
+
+/************************************************************************/
+/*                            ProduceStrip()                            */
+/************************************************************************/
+
+// Compute, write and make available to the next level the next strip of
+// overview iOvr.
+CPLErr GDALOvrSinglePassBuilder::ProduceStrip(int iOvr)
+{
+    auto &oSrc = m_aoLevels[iOvr];
+    auto &oOvr = m_aoOverviews[iOvr];
+    const int nStripHeight = oOvr.nStripHeight;
+    const int nDstYOff = oOvr.nNextDstYOff;
+    const int nDstYCount = std::min(nStripHeight, oOvr.nYSize - nDstYOff);
+
+    int nChunkYOff = 0;
+    int nChunkYSize = 0;
+    GDALOvrGetQueriedSrcWindow(nDstYOff, nDstYCount, oOvr.nYSize, oSrc.nYSize,
+                               oOvr.dfYRatioDstToSrc, oOvr.nMargin,
+                               nChunkYOff, nChunkYSize);
+
+    // Make sure that the source rows are available, by reading the source
+    // or computing strips of the previous overview.
+    while (oSrc.nRowEnd < nChunkYOff + nChunkYSize)
+    {
+        CPLErr eErr;
+        if (iOvr == 0)
+        {
+            eErr = AppendRows(
+                0, oSrc.nRowEnd,
+                std::min(m_nSrcStepHeight, oSrc.nYSize - oSrc.nRowEnd));
+        }
+        else
+        {
+            eErr = ProduceStrip(iOvr - 1);
+        }
+        if (eErr != CE_None)
+            return eErr;
+    }
+    CPLAssert(oSrc.nRowStart <= nChunkYOff);
+
+    const int nXChunks = GetXChunkCount(iOvr);
+    const int nDstChunkXSize = static_cast<int>(std::min<GIntBig>(
+        oOvr.nXSize,
+        ((static_cast<GIntBig>(oOvr.nXSize) + nXChunks - 1) / nXChunks +
+         oOvr.nBlockXSize - 1) /
+            oOvr.nBlockXSize * oOvr.nBlockXSize));
+
+    std::vector<std::unique_ptr<Job>> apoJobs;
+    CPLErr eErr = CE_None;
+    for (int nDstXOff = 0; nDstXOff < oOvr.nXSize && eErr == CE_None;
+         nDstXOff += nDstChunkXSize)
+    {
+        const int nDstXCount =
+            std::min(nDstChunkXSize, oOvr.nXSize - nDstXOff);
+        int nChunkXOff = 0;
+        int nChunkXSize = 0;
+        GDALOvrGetQueriedSrcWindow(nDstXOff, nDstXCount, oOvr.nXSize,
+                                   oSrc.nXSize, oOvr.dfXRatioDstToSrc,
+                                   oOvr.nMargin, nChunkXOff, nChunkXSize);
+        const size_t nRowOffset =
+            static_cast<size_t>(nChunkYOff - oSrc.nRowStart) * oSrc.nXSize;
+
+        for (int iBand = 0; iBand < m_nBands; ++iBand)
+        {
+            auto poJob = std::make_unique<Job>();
+            const GByte *pabySrcData =
+                static_cast<const GByte *>(oSrc.apData[iBand].get()) +
+                nRowOffset * m_nWrkDataTypeSize;
+            const GByte *pabySrcMask =
+                m_bUseNoDataMask ? oSrc.apabyMask[iBand].get() + nRowOffset
+                                 : nullptr;
+            if (nChunkXSize == oSrc.nXSize)
+            {
+                poJob->pChunk = pabySrcData;
+                poJob->args.pabyChunkNodataMask = pabySrcMask;
+            }
+            else
+            {
+                // The resampling functions expect a compact source window
+                poJob->pChunkCopy.reset(VSI_MALLOC3_VERBOSE(
+                    nChunkXSize, nChunkYSize, m_nWrkDataTypeSize));
+                if (m_bUseNoDataMask)
+                    poJob->pabyMaskCopy.reset(static_cast<GByte *>(
+                        VSI_MALLOC2_VERBOSE(nChunkXSize, nChunkYSize)));
+                if (!poJob->pChunkCopy ||
+                    (m_bUseNoDataMask && !poJob->pabyMaskCopy))
+                {
+                    eErr = CE_Failure;
+                    break;
+                }
+                GByte *pabyDst = static_cast<GByte *>(poJob->pChunkCopy.get());
+                for (int iY = 0; iY < nChunkYSize; ++iY)
+                {
+                    const size_t nSrcOff =
+                        static_cast<size_t>(iY) * oSrc.nXSize + nChunkXOff;
+                    const size_t nDstOff =
+                        static_cast<size_t>(iY) * nChunkXSize;
+                    memcpy(pabyDst + nDstOff * m_nWrkDataTypeSize,
+                           pabySrcData + nSrcOff * m_nWrkDataTypeSize,
+                           static_cast<size_t>(nChunkXSize) *
+                               m_nWrkDataTypeSize);
+                    if (pabySrcMask)
+                    {
+                        memcpy(poJob->pabyMaskCopy.get() + nDstOff,
+                               pabySrcMask + nSrcOff, nChunkXSize);
+                    }
+                }
+                poJob->pChunk = poJob->pChunkCopy.get();
+                poJob->args.pabyChunkNodataMask = poJob->pabyMaskCopy.get();
+            }
+
+            poJob->poDstBand = m_papapoOverviewBands[iBand][iOvr];
+            poJob->args.eOvrDataType = poJob->poDstBand->GetRasterDataType();
+            poJob->args.nOvrXSize = oOvr.nXSize;
+            poJob->args.nOvrYSize = oOvr.nYSize;
+            poJob->args.nOvrNBITS = oOvr.anNBITS[iBand];
+            poJob->args.dfXRatioDstToSrc = oOvr.dfXRatioDstToSrc;
+            poJob->args.dfYRatioDstToSrc = oOvr.dfYRatioDstToSrc;
+            poJob->args.eWrkDataType = m_eWrkDataType;
+            poJob->args.nChunkXOff = nChunkXOff;
+            poJob->args.nChunkXSize = nChunkXSize;
+            poJob->args.nChunkYOff = nChunkYOff;
+            poJob->args.nChunkYSize = nChunkYSize;
+            poJob->args.nDstXOff = nDstXOff;
+            poJob->args.nDstXOff2 = nDstXOff + nDstXCount;
+            poJob->args.nDstYOff = nDstYOff;
+            poJob->args.nDstYOff2 = nDstYOff + nDstYCount;
+            poJob->args.pszResampling = m_pszResampling;
+            poJob->args.bHasNoData = m_abHasNoData[iBand];
+            poJob->args.dfNoDataValue = m_adfNoDataValue[iBand];
+            poJob->args.eSrcDataType = m_papoSrcBands[0]->GetRasterDataType();
+            poJob->args.bPropagateNoData = m_bPropagateNoData;
+            apoJobs.emplace_back(std::move(poJob));
+        }
+    }
+
+    const auto pfnResampleFn = m_pfnResampleFn;
+    const auto RunJob = [pfnResampleFn](Job *poJob)
+    {
+        void *pDstBuffer = nullptr;
+        poJob->eErr = pfnResampleFn(poJob->args, poJob->pChunk, &pDstBuffer,
+                                    &(poJob->eDstBufferDataType));
+        poJob->pDstBuffer.reset(pDstBuffer);
+    };
+    if (eErr == CE_None)
+    {
+        if (m_poJobQueue && apoJobs.size() > 1)
+        {
+            for (auto &poJob : apoJobs)
+            {
+                Job *poJobPtr = poJob.get();
+                m_poJobQueue->SubmitJob([RunJob, poJobPtr]()
+                                        { RunJob(poJobPtr); });
+            }
+            m_poJobQueue->WaitCompletion();
+        }
+        else
+        {
+            for (auto &poJob : apoJobs)
+                RunJob(poJob.get());
+        }
+    }
+
+    for (const auto &poJob : apoJobs)
+    {
+        if (eErr != CE_None)
+            break;
+        eErr = poJob->eErr;
+        if (eErr == CE_None)
+        {
+            const int nXCount = poJob->args.nDstXOff2 - poJob->args.nDstXOff;
+            eErr = poJob->poDstBand->RasterIO(
+                GF_Write, poJob->args.nDstXOff, nDstYOff, nXCount, nDstYCount,
+                poJob->pDstBuffer.get(), nXCount, nDstYCount,
+                poJob->eDstBufferDataType, 0, 0, nullptr);
+        }
+    }
+    apoJobs.clear();
+    if (eErr != CE_None)
+        return eErr;
+
+    oOvr.nNextDstYOff = nDstYOff + nDstYCount;
+
+    // Feed the next level with what we have just written.
+    if (iOvr + 1 < m_nOverviews)
+    {
+        eErr = AppendRows(iOvr + 1, nDstYOff, nDstYCount);
+        if (eErr != CE_None)
+            return eErr;
+    }
+
+    // Release the source rows that the next strip does not need.
+    if (oOvr.nNextDstYOff < oOvr.nYSize)
+    {
+        GDALOvrGetQueriedSrcWindow(
+            oOvr.nNextDstYOff,
+            std::min(nStripHeight, oOvr.nYSize - oOvr.nNextDstYOff),
+            oOvr.nYSize, oSrc.nYSize, oOvr.dfYRatioDstToSrc, oOvr.nMargin,
+            nChunkYOff, nChunkYSize);
+        DiscardRows(iOvr, nChunkYOff);
+    }
+    else
+    {
+        DiscardRows(iOvr, oSrc.nYSize);
+    }
+
+    m_dfCurPixelCount += static_cast<double>(oOvr.nXSize) * nDstYCount;
+    if (!m_pfnProgress(std::min(1.0, m_dfCurPixelCount / m_dfTotalPixelCount),
+                       nullptr, m_pProgressData))
+    {
+        CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+        return CE_Failure;
+    }
+
+    return CE_None;
+}
+
+/************************************************************************/
+/*                                Run()                                 */
+/************************************************************************/
+
+CPLErr GDALOvrSinglePassBuilder::Run(double dfTotalPixelCount,
+                                     GDALProgressFunc pfnProgress,
+                                     void *pProgressData)
+{
+    m_dfTotalPixelCount = dfTotalPixelCount;
+    m_pfnProgress = pfnProgress;
+    m_pProgressData = pProgressData;
+
+    // The last strip of an overview needs the last rows of its source level,
+    // so completing the smallest overview produces all the other ones.
+    CPLErr eErr = CE_None;
+    const auto &oLastOvr = m_aoOverviews.back();
+    while (eErr == CE_None && oLastOvr.nNextDstYOff < oLastOvr.nYSize)
+    {
+        eErr = ProduceStrip(m_nOverviews - 1);
+    }
+
+    for (int iOvr = 0; iOvr < m_nOverviews; ++iOvr)
+    {
+        for (int iBand = 0; iBand < m_nBands; ++iBand)
+        {
+            if (m_papapoOverviewBands[iBand][iOvr]->FlushCache(false) !=
+                CE_None)
+                eErr = CE_Failure;
+        }
+    }
+
+    return eErr;
+}
+
+}  // namespace
+
 /************************************************************************/
 /*            GDALRegenerateOverviewsMultiBand()                        */
 /************************************************************************/
@@ -5137,6 +5078,14 @@ CPLErr GDALRegenerateOverviewsEx(GDALRasterBandH hSrcBand, int nOverviewCount,
  *               read the source data of size deltax * deltay for all the bands
  *               generate the corresponding overview block for all the bands
  *
+ * Starting with GDAL 3.12, when the whole extent of several overview levels,
+ * each one smaller than the previous one, is regenerated, all levels are
+ * computed in a single top-down pass over the source bands: each level is
+ * computed by strips from rows of the previous level held in memory, instead
+ * of being read back once the previous level has been entirely generated.
+ * This can be disabled by setting the GDAL_OVR_SINGLE_PASS configuration
+ * option to NO.
+ *
  * This function will honour properly NODATA_VALUES tuples (special dataset
  * metadata) so that only a given RGB triplet (in case of a RGB image) will be
  * considered as the nodata value and not each value of the triplet
@@ -5340,6 +5289,46 @@ CPLErr GDALRegenerateOverviewsMultiBand(
         return 100 * 1024 * 1024;
     }();
 
+    // When regenerating whole overview levels of decreasing size, compute
+    // them all with a single read of the source, each level being fed with
+    // the rows of the previous one.
+    if (nOverviews > 1 && nSrcXOff == 0 && nSrcYOff == 0 &&
+        nSrcXSize == nToplevelSrcWidth && nSrcYSize == nToplevelSrcHeight &&
+        CPLTestBool(CPLGetConfigOption("GDAL_OVR_SINGLE_PASS", "YES")))
+    {
+        bool bDecreasingSizes = true;
+        for (int iOverview = 1; iOverview < nOverviews; ++iOverview)
+        {
+            if (papapoOverviewBands[0][iOverview - 1]->GetXSize() <=
+                papapoOverviewBands[0][iOverview]->GetXSize())
+            {
+                bDecreasingSizes = false;
+                break;
+            }
+        }
+
+        if (bDecreasingSizes)
+        {
+            GDALOvrSinglePassBuilder oBuilder(
+                nBands, papoSrcBands, nOverviews, papapoOverviewBands,
+                pszResampling, pfnResampleFn, nKernelRadius, eWrkDataType,
+                bUseNoDataMask, abHasNoData, adfNoDataValue, bPropagateNoData,
+                poJobQueue.get(), nThreads);
+            if (oBuilder.Plan(nChunkMaxSizeForTempFile))
+            {
+                CPLDebug("GDAL", "Generating %d overview levels in one pass",
+                         nOverviews);
+                const CPLErr eErr =
+                    oBuilder.Run(dfTotalPixelCount, pfnProgress, pProgressData);
+                if (eErr == CE_None)
+                    pfnProgress(1.0, nullptr, pProgressData);
+                return eErr;
+            }
+            CPLDebug("GDAL", "Not enough memory to generate overview levels "
+                             "in one pass");
+        }
+    }
+
     // Second pass to do the real job.
     double dfCurPixelCount = 0;
     CPLErr eErr = CE_None;
@@ -0,0 +1,83 @@
+/******************************************************************************
+ *
+ * Project:  GDAL Core
+ * Purpose:  AVX2 kernels for overview computation, selected at runtime
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "cpl_port.h"
+
+#if defined(HAVE_AVX2_AT_COMPILE_TIME) && (defined(__x86_64) || defined(_M_X64))
+
+#include "overview_avx2.h"
+
+#include <cmath>
+#include <limits>
+
+#include <immintrin.h>
+
+#ifndef __AVX2__
+#error "This file must be compiled with AVX2 enabled"
+#endif
+
+#define OVERVIEW_AVX2_KERNELS_ONLY
+
+namespace
+{
+#include "overview_sse2_avx2.hpp"
+}  // namespace
+
+/************************************************************************/
+/*                     GDALQuadraticMeanByte_AVX2()                     */
+/************************************************************************/
+
+int GDALQuadraticMeanByte_AVX2(int nDstXWidth, int nChunkXSize,
+                               const GByte *&CPL_RESTRICT pSrcScanlineShifted,
+                               GByte *CPL_RESTRICT pDstScanline)
+{
+    return QuadraticMeanByteSSE2OrAVX2(nDstXWidth, nChunkXSize,
+                                       pSrcScanlineShifted, pDstScanline);
+}
+
+/************************************************************************/
+/*                        GDALAverageByte_AVX2()                        */
+/************************************************************************/
+
+int GDALAverageByte_AVX2(int nDstXWidth, int nChunkXSize,
+                         const GByte *&CPL_RESTRICT pSrcScanlineShifted,
+                         GByte *CPL_RESTRICT pDstScanline)
+{
+    return AverageByteSSE2OrAVX2(nDstXWidth, nChunkXSize, pSrcScanlineShifted,
+                                 pDstScanline);
+}
+
+/************************************************************************/
+/*                    GDALQuadraticMeanUInt16_AVX2()                    */
+/************************************************************************/
+
+int GDALQuadraticMeanUInt16_AVX2(
+    int nDstXWidth, int nChunkXSize,
+    const GUInt16 *&CPL_RESTRICT pSrcScanlineShifted,
+    GUInt16 *CPL_RESTRICT pDstScanline)
+{
+    return QuadraticMeanUInt16SSE2(nDstXWidth, nChunkXSize,
+                                   pSrcScanlineShifted, pDstScanline);
+}
+
+/************************************************************************/
+/*                     GDALQuadraticMeanFloat_AVX2()                    */
+/************************************************************************/
+
+int GDALQuadraticMeanFloat_AVX2(int nDstXWidth, int nChunkXSize,
+                                const float *&CPL_RESTRICT pSrcScanlineShifted,
+                                float *CPL_RESTRICT pDstScanline)
+{
+    return QuadraticMeanFloatSSE2(nDstXWidth, nChunkXSize, pSrcScanlineShifted,
+                                  pDstScanline);
+}
+
+#endif
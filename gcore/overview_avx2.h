@@ -0,0 +1,42 @@
+/******************************************************************************
+ *
+ * Project:  GDAL Core
+ * Purpose:  AVX2 kernels for overview computation, selected at runtime
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#ifndef OVERVIEW_AVX2_H_INCLUDED
+#define OVERVIEW_AVX2_H_INCLUDED
+
+#include "cpl_port.h"
+
+#if defined(HAVE_AVX2_AT_COMPILE_TIME) && (defined(__x86_64) || defined(_M_X64))
+
+// Those functions must only be called if CPLHaveRuntimeAVX2() is true.
+// They process the destination pixels by groups, and return the index of the
+// first destination pixel that has not been processed.
+
+int GDALQuadraticMeanByte_AVX2(int nDstXWidth, int nChunkXSize,
+                               const GByte *&CPL_RESTRICT pSrcScanlineShifted,
+                               GByte *CPL_RESTRICT pDstScanline);
+
+int GDALAverageByte_AVX2(int nDstXWidth, int nChunkXSize,
+                         const GByte *&CPL_RESTRICT pSrcScanlineShifted,
+                         GByte *CPL_RESTRICT pDstScanline);
+
+int GDALQuadraticMeanUInt16_AVX2(
+    int nDstXWidth, int nChunkXSize,
+    const GUInt16 *&CPL_RESTRICT pSrcScanlineShifted,
+    GUInt16 *CPL_RESTRICT pDstScanline);
+
+int GDALQuadraticMeanFloat_AVX2(int nDstXWidth, int nChunkXSize,
+                                const float *&CPL_RESTRICT pSrcScanlineShifted,
+                                float *CPL_RESTRICT pDstScanline);
+
+#endif
+
+#endif /* OVERVIEW_AVX2_H_INCLUDED */
@@ -322,6 +322,9 @@ RawRasterBand::~RawRasterBand()
 
     RawRasterBand::FlushCache(true);
 
+    if (m_psMappedData)
+        CPLVirtualMemFree(m_psMappedData);
+
     if (bOwnsFP)
     {
         if (VSIFCloseL(fpRawL) != 0)
@@ -1048,6 +1051,178 @@ int RawRasterBand::CanUseDirectIO(int /* nXOff */, int nYOff, int nXSize,
     return result;
 }
 
+/************************************************************************/
+/*                           GetMappedData()                            */
+/*                                                                      */
+/*  Lazily establish a read-only memory mapping of the whole extent of  */
+/*  the band in the file. Returns a pointer to the first pixel, or      */
+/*  nullptr if the file cannot be mapped.                               */
+/************************************************************************/
+
+const GByte *RawRasterBand::GetMappedData()
+{
+    if (!m_bMappedDataTried)
+    {
+        m_bMappedDataTried = true;
+
+        if (nPixelOffset > 0 && nLineOffset > 0 &&
+            CPLIsVirtualMemFileMapAvailable() &&
+            VSIFGetNativeFileDescriptorL(fpRawL) != nullptr &&
+            CPLTestBool(CPLGetConfigOption("RAW_USE_MMAP", "YES")))
+        {
+            const vsi_l_offset nSize =
+                static_cast<vsi_l_offset>(nRasterYSize - 1) * nLineOffset +
+                static_cast<vsi_l_offset>(nRasterXSize - 1) * nPixelOffset +
+                GDALGetDataTypeSizeBytes(eDataType);
+            if (static_cast<size_t>(nSize) == nSize)
+            {
+                // Fails in particular if the file is truncated, in which case
+                // we fall back to the regular code paths that report I/O
+                // errors only for the lines that are actually missing.
+                CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+                m_psMappedData = CPLVirtualMemFileMapNew(
+                    fpRawL, nImgOffset, nSize, VIRTUALMEM_READONLY, nullptr,
+                    nullptr);
+            }
+            if (m_psMappedData)
+                CPLDebug("RAW", "Using memory mapped I/O");
+        }
+    }
+    if (!m_psMappedData)
+        return nullptr;
+    return static_cast<const GByte *>(CPLVirtualMemGetAddr(m_psMappedData));
+}
+
+/************************************************************************/
+/*                           CanUseMappedIO()                           */
+/************************************************************************/
+
+bool RawRasterBand::CanUseMappedIO(GDALRWFlag eRWFlag, int nXSize, int nYSize,
+                                   int nBufXSize, int nBufYSize,
+                                   GDALRasterIOExtraArg *psExtraArg)
+{
+    // Restricted to read-only datasets, so that there can be no pending
+    // modifications in the block cache or in the line buffer that the
+    // mapping would not see.
+    if (eRWFlag != GF_Read || eAccess != GA_ReadOnly ||
+        psExtraArg->eResampleAlg != GRIORA_NearestNeighbour)
+    {
+        return false;
+    }
+
+    // Prefer overviews, if any, for down-sampling requests.
+    if ((nBufXSize < nXSize || nBufYSize < nYSize) && GetOverviewCount() > 0)
+    {
+        return false;
+    }
+
+    return GetMappedData() != nullptr;
+}
+
+/************************************************************************/
+/*                          MappedRasterIO()                            */
+/*                                                                      */
+/*  Copy pixels straight from the mapped pages into the user buffer,    */
+/*  without going through the block cache nor an intermediate read      */
+/*  buffer (except when both byte swapping and data type conversion     */
+/*  are needed).                                                        */
+/************************************************************************/
+
+CPLErr RawRasterBand::MappedRasterIO(int nXOff, int nYOff, int nXSize,
+                                     int nYSize, void *pData, int nBufXSize,
+                                     int nBufYSize, GDALDataType eBufType,
+                                     GSpacing nPixelSpace, GSpacing nLineSpace,
+                                     GDALRasterIOExtraArg *psExtraArg)
+{
+    const GByte *pabyMapped = GetMappedData();
+    CPLAssert(pabyMapped);
+
+    // Needed for ICC fast math approximations
+    constexpr double EPS = 1e-10;
+
+    const double dfSrcXInc = static_cast<double>(nXSize) / nBufXSize;
+    const double dfSrcYInc = static_cast<double>(nYSize) / nBufYSize;
+    const int nDTSize = GDALGetDataTypeSizeBytes(eDataType);
+    const bool bNeedsByteOrderChange = NeedsByteOrderChange();
+
+    // When byte swapping is needed, it is done in the user buffer if it has
+    // the band data type, or in a temporary line buffer otherwise.
+    std::vector<GByte> abyLine;
+    if (bNeedsByteOrderChange && eBufType != eDataType)
+    {
+        try
+        {
+            abyLine.resize(static_cast<size_t>(nBufXSize) * nDTSize);
+        }
+        catch (const std::exception &)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory,
+                     "Out of memory allocating line buffer");
+            return CE_Failure;
+        }
+    }
+
+    const auto CopyLine = [this, nXSize, nBufXSize, dfSrcXInc](
+                              const GByte *pabySrc, void *pDst,
+                              GDALDataType eDstType, int nDstPixelSpace)
+    {
+        if (nXSize == nBufXSize)
+        {
+            GDALCopyWords64(pabySrc, eDataType, nPixelOffset, pDst, eDstType,
+                            nDstPixelSpace, nBufXSize);
+        }
+        else
+        {
+            for (int iPixel = 0; iPixel < nBufXSize; iPixel++)
+            {
+                GDALCopyWords64(
+                    pabySrc +
+                        static_cast<size_t>(iPixel * dfSrcXInc + EPS) *
+                            nPixelOffset,
+                    eDataType, nPixelOffset,
+                    static_cast<GByte *>(pDst) +
+                        static_cast<size_t>(iPixel) * nDstPixelSpace,
+                    eDstType, nDstPixelSpace, 1);
+            }
+        }
+    };
+
+    for (int iLine = 0; iLine < nBufYSize; iLine++)
+    {
+        const size_t nLine = static_cast<size_t>(nYOff) +
+                             static_cast<size_t>(iLine * dfSrcYInc + EPS);
+        const GByte *pabySrc = pabyMapped + nLine * nLineOffset +
+                               static_cast<size_t>(nXOff) * nPixelOffset;
+        GByte *pabyDst = static_cast<GByte *>(pData) + iLine * nLineSpace;
+
+        if (abyLine.empty())
+        {
+            CopyLine(pabySrc, pabyDst, eBufType, static_cast<int>(nPixelSpace));
+            if (bNeedsByteOrderChange)
+            {
+                DoByteSwap(pabyDst, nBufXSize, static_cast<int>(nPixelSpace),
+                           true);
+            }
+        }
+        else
+        {
+            CopyLine(pabySrc, abyLine.data(), eDataType, nDTSize);
+            DoByteSwap(abyLine.data(), nBufXSize, nDTSize, true);
+            GDALCopyWords64(abyLine.data(), eDataType, nDTSize, pabyDst,
+                            eBufType, static_cast<int>(nPixelSpace), nBufXSize);
+        }
+
+        if (psExtraArg->pfnProgress != nullptr &&
+            !psExtraArg->pfnProgress(1.0 * (iLine + 1) / nBufYSize, "",
+                                     psExtraArg->pProgressData))
+        {
+            return CE_Failure;
+        }
+    }
+
+    return CE_None;
+}
+
 /************************************************************************/
 /*                             IRasterIO()                              */
 /************************************************************************/
@@ -1069,6 +1244,14 @@ CPLErr RawRasterBand::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
 #endif
     const int nBufDataSize = GDALGetDataTypeSizeBytes(eBufType);
 
+    if (CanUseMappedIO(eRWFlag, nXSize, nYSize, nBufXSize, nBufYSize,
+                       psExtraArg))
+    {
+        return MappedRasterIO(nXOff, nYOff, nXSize, nYSize, pData, nBufXSize,
+                              nBufYSize, eBufType, nPixelSpace, nLineSpace,
+                              psExtraArg);
+    }
+
     if (!CanUseDirectIO(nXOff, nYOff, nXSize, nYSize, eBufType, psExtraArg))
     {
         return GDALRasterBand::IRasterIO(eRWFlag, nXOff, nYOff, nXSize, nYSize,
@@ -1613,7 +1796,9 @@ CPLErr RawDataset::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
                 break;
             }
             else if (!poBand->CanUseDirectIO(nXOff, nYOff, nXSize, nYSize,
-                                             eBufType, psExtraArg))
+                                             eBufType, psExtraArg) &&
+                     !poBand->CanUseMappedIO(eRWFlag, nXSize, nYSize,
+                                             nBufXSize, nBufYSize, psExtraArg))
             {
                 bCanUseDirectIO = false;
                 if (!bCanDirectAccessToBIPDataset)
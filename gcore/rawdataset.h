@@ -119,6 +119,9 @@ class CPL_DLL RawRasterBand : public GDALPamRasterBand
 
     int bOwnsFP{};
 
+    CPLVirtualMem *m_psMappedData = nullptr;
+    bool m_bMappedDataTried = false;
+
     int Seek(vsi_l_offset, int);
     size_t Read(void *, size_t, size_t);
     size_t Write(void *, size_t, size_t);
@@ -135,6 +138,10 @@ class CPL_DLL RawRasterBand : public GDALPamRasterBand
     int CanUseDirectIO(int nXOff, int nYOff, int nXSize, int nYSize,
                        GDALDataType eBufType, GDALRasterIOExtraArg *psExtraArg);
 
+    bool CanUseMappedIO(GDALRWFlag eRWFlag, int nXSize, int nYSize,
+                        int nBufXSize, int nBufYSize,
+                        GDALRasterIOExtraArg *psExtraArg);
+
   public:
     enum class OwnFP
     {
@@ -246,6 +253,12 @@ class CPL_DLL RawRasterBand : public GDALPamRasterBand
     vsi_l_offset ComputeFileOffset(int iLine) const;
     bool FlushCurrentLine(bool bNeedUsableBufferAfter);
     CPLErr BIPWriteBlock(int nBlockYOff, int nCallingBand, const void *pImage);
+    const GByte *GetMappedData();
+    CPLErr MappedRasterIO(int nXOff, int nYOff, int nXSize, int nYSize,
+                          void *pData, int nBufXSize, int nBufYSize,
+                          GDALDataType eBufType, GSpacing nPixelSpace,
+                          GSpacing nLineSpace,
+                          GDALRasterIOExtraArg *psExtraArg);
 };
 
 #ifdef GDAL_COMPILATION
@@ -19,10 +19,14 @@
 #include "ogr_recordbatch.h"
 #include "ogrlayerarrow.h"
 #include "cpl_time.h"
+#include "cpl_vsi.h"
+#include "ogr_attrind.h"
 #include <algorithm>
+#include <cmath>
 #include <limits>
 #include <map>
 #include <set>
+#include <unordered_map>
 #include <vector>
 
 //! @cond Doxygen_Suppress
@@ -1472,6 +1476,471 @@ static CPLString GetFilterForJoin(swq_expr_node *poExpr, OGRFeature *poSrcFeat,
     return "";
 }
 
+/************************************************************************/
+/*                        OGRGenSQLJoinHashTable                        */
+/*                                                                      */
+/*      Features of a secondary layer, read once and keyed on the       */
+/*      value of the join field, to resolve JOINs of the form           */
+/*      "primary.field = secondary.field" without issuing one           */
+/*      attribute filter per primary feature. Features are stored       */
+/*      serialized in RAM, and spilled to a temporary file once the     */
+/*      memory budget is exceeded.                                      */
+/************************************************************************/
+
+class OGRGenSQLJoinHashTable
+{
+  public:
+    enum class KeyType
+    {
+        INTEGER,
+        REAL,
+        STRING
+    };
+
+    OGRGenSQLJoinHashTable(OGRLayer *poLayer, int iPrimaryField,
+                           int iSecondaryField, KeyType eKeyType,
+                           GIntBig nMaxMemory)
+        : m_poLayer(poLayer), m_iPrimaryField(iPrimaryField),
+          m_iSecondaryField(iSecondaryField), m_eKeyType(eKeyType),
+          m_nMaxMemory(nMaxMemory)
+    {
+    }
+
+    ~OGRGenSQLJoinHashTable();
+
+    bool Build();
+
+    bool CanLookup(const OGRFeature *poSrcFeat) const;
+    std::unique_ptr<OGRFeature> Lookup(const OGRFeature *poSrcFeat);
+
+  private:
+    struct Entry
+    {
+        vsi_l_offset nOffset;
+        size_t nSize;
+        bool bInFile;
+    };
+
+    OGRLayer *const m_poLayer;
+    const int m_iPrimaryField;
+    const int m_iSecondaryField;
+    const KeyType m_eKeyType;
+    const GIntBig m_nMaxMemory;
+
+    std::unordered_map<std::string, Entry> m_oMap{};
+    std::vector<GByte> m_abyMemory{};
+    std::string m_osTmpFilename{};
+    VSILFILE *m_fpTmp = nullptr;
+    vsi_l_offset m_nTmpFileSize = 0;
+    std::vector<GByte> m_abyBuffer{};
+
+    bool GetKey(const OGRFeature *poFeature, int iField,
+                std::string &osKey) const;
+
+    CPL_DISALLOW_COPY_ASSIGN(OGRGenSQLJoinHashTable)
+};
+
+/************************************************************************/
+/*                      ~OGRGenSQLJoinHashTable()                       */
+/************************************************************************/
+
+OGRGenSQLJoinHashTable::~OGRGenSQLJoinHashTable()
+{
+    if (m_fpTmp)
+    {
+        VSIFCloseL(m_fpTmp);
+        VSIUnlink(m_osTmpFilename.c_str());
+    }
+}
+
+/************************************************************************/
+/*                               GetKey()                               */
+/************************************************************************/
+
+bool OGRGenSQLJoinHashTable::GetKey(const OGRFeature *poFeature, int iField,
+                                    std::string &osKey) const
+{
+    // Also deals with special fields of the primary layer
+    if (!poFeature->IsFieldSetAndNotNull(iField))
+        return false;
+
+    switch (m_eKeyType)
+    {
+        case KeyType::INTEGER:
+        {
+            const GIntBig nVal = poFeature->GetFieldAsInteger64(iField);
+            osKey.assign(reinterpret_cast<const char *>(&nVal), sizeof(nVal));
+            break;
+        }
+
+        case KeyType::REAL:
+        {
+            double dfVal = poFeature->GetFieldAsDouble(iField);
+            if (std::isnan(dfVal))
+                return false;
+            // Normalize -0.0 to 0.0
+            dfVal += 0.0;
+            osKey.assign(reinterpret_cast<const char *>(&dfVal),
+                         sizeof(dfVal));
+            break;
+        }
+
+        case KeyType::STRING:
+        {
+            // Equality of strings in OGR SQL is case insensitive
+            osKey = poFeature->GetFieldAsString(iField);
+            for (char &ch : osKey)
+            {
+                if (ch >= 'a' && ch <= 'z')
+                    ch = static_cast<char>(ch - 'a' + 'A');
+            }
+            break;
+        }
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                               Build()                                */
+/************************************************************************/
+
+bool OGRGenSQLJoinHashTable::Build()
+{
+    m_poLayer->SetAttributeFilter(nullptr);
+    m_poLayer->ResetReading();
+
+    std::string osKey;
+    std::vector<GByte> abyFeature;
+    for (auto &&poFeature : *m_poLayer)
+    {
+        // Only the first matching feature is used, as with the attribute
+        // filter based join.
+        if (!GetKey(poFeature.get(), m_iSecondaryField, osKey) ||
+            cpl::contains(m_oMap, osKey))
+        {
+            continue;
+        }
+
+        abyFeature.clear();
+        if (!poFeature->SerializeToBinary(abyFeature))
+            return false;
+
+        Entry sEntry;
+        sEntry.nSize = abyFeature.size();
+        try
+        {
+            if (m_fpTmp == nullptr &&
+                static_cast<GIntBig>(m_abyMemory.size() + abyFeature.size()) <=
+                    m_nMaxMemory)
+            {
+                sEntry.nOffset = m_abyMemory.size();
+                sEntry.bInFile = false;
+                m_abyMemory.insert(m_abyMemory.end(), abyFeature.begin(),
+                                   abyFeature.end());
+            }
+            else
+            {
+                if (m_fpTmp == nullptr)
+                {
+                    m_osTmpFilename =
+                        CPLGenerateTempFilenameSafe("ogr_gensql_join");
+                    m_fpTmp = VSIFOpenL(m_osTmpFilename.c_str(), "wb+");
+                    if (m_fpTmp == nullptr)
+                    {
+                        CPLError(CE_Failure, CPLE_FileIO, "Cannot create %s",
+                                 m_osTmpFilename.c_str());
+                        return false;
+                    }
+                    CPLDebug("GenSQL",
+                             "Hash join on layer %s exceeds %s bytes of RAM. "
+                             "Spilling to %s",
+                             m_poLayer->GetName(),
+                             CPLSPrintf(CPL_FRMT_GIB, m_nMaxMemory),
+                             m_osTmpFilename.c_str());
+                }
+                sEntry.nOffset = m_nTmpFileSize;
+                sEntry.bInFile = true;
+                if (VSIFWriteL(abyFeature.data(), 1, abyFeature.size(),
+                               m_fpTmp) != abyFeature.size())
+                {
+                    CPLError(CE_Failure, CPLE_FileIO, "Cannot write into %s",
+                             m_osTmpFilename.c_str());
+                    return false;
+                }
+                m_nTmpFileSize += abyFeature.size();
+            }
+            m_oMap[osKey] = sEntry;
+        }
+        catch (const std::bad_alloc &)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory,
+                     "Out of memory while building hash table for join on "
+                     "layer %s",
+                     m_poLayer->GetName());
+            return false;
+        }
+    }
+    m_poLayer->ResetReading();
+
+    CPLDebug("GenSQL", "Hash join on layer %s: %u distinct keys",
+             m_poLayer->GetName(), static_cast<unsigned>(m_oMap.size()));
+    return true;
+}
+
+/************************************************************************/
+/*                             CanLookup()                              */
+/************************************************************************/
+
+bool OGRGenSQLJoinHashTable::CanLookup(const OGRFeature *poSrcFeat) const
+{
+    if (m_eKeyType != KeyType::STRING ||
+        !poSrcFeat->IsFieldSetAndNotNull(m_iPrimaryField))
+        return true;
+
+    // Strings looking like timestamps with and without an explicit +00
+    // timezone are compared in a special way by the OGR SQL engine.
+    const char *pszVal = poSrcFeat->GetFieldAsString(m_iPrimaryField);
+    const size_t nLen = strlen(pszVal);
+    return nLen <= 3 ||
+           (pszVal[nLen - 3] != ':' && strcmp(pszVal + nLen - 3, "+00") != 0);
+}
+
+/************************************************************************/
+/*                               Lookup()                               */
+/************************************************************************/
+
+std::unique_ptr<OGRFeature>
+OGRGenSQLJoinHashTable::Lookup(const OGRFeature *poSrcFeat)
+{
+    std::string osKey;
+    if (!GetKey(poSrcFeat, m_iPrimaryField, osKey))
+        return nullptr;
+
+    const auto oIter = m_oMap.find(osKey);
+    if (oIter == m_oMap.end())
+        return nullptr;
+    const Entry &sEntry = oIter->second;
+
+    const GByte *pabyData;
+    if (sEntry.bInFile)
+    {
+        try
+        {
+            m_abyBuffer.resize(sEntry.nSize);
+        }
+        catch (const std::bad_alloc &)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory,
+                     "Out of memory while reading joined feature");
+            return nullptr;
+        }
+        if (VSIFSeekL(m_fpTmp, sEntry.nOffset, SEEK_SET) != 0 ||
+            VSIFReadL(m_abyBuffer.data(), 1, sEntry.nSize, m_fpTmp) !=
+                sEntry.nSize)
+        {
+            CPLError(CE_Failure, CPLE_FileIO, "Cannot read from %s",
+                     m_osTmpFilename.c_str());
+            return nullptr;
+        }
+        pabyData = m_abyBuffer.data();
+    }
+    else
+    {
+        pabyData = m_abyMemory.data() + static_cast<size_t>(sEntry.nOffset);
+    }
+
+    auto poFeature = std::make_unique<OGRFeature>(m_poLayer->GetLayerDefn());
+    if (!poFeature->DeserializeFromBinary(pabyData, sEntry.nSize))
+        return nullptr;
+    return poFeature;
+}
+
+/************************************************************************/
+/*                     InitializeJoinHashTables()                       */
+/*                                                                      */
+/*      Decide, for each JOIN, whether it is resolved with a hash       */
+/*      table of the secondary layer, or by setting an attribute        */
+/*      filter on it for each primary feature. The latter is only       */
+/*      used for complex join expressions, or when the join field of    */
+/*      the secondary layer is indexed.                                 */
+/************************************************************************/
+
+void OGRGenSQLResultsLayer::InitializeJoinHashTables()
+{
+    m_bJoinHashTablesInitialized = true;
+
+    swq_select *psSelectInfo = m_pSelectInfo.get();
+    const char *pszMethod = CPLGetConfigOption("OGR_SQL_JOIN_METHOD", "AUTO");
+    if (EQUAL(pszMethod, "FILTER"))
+        return;
+    const bool bForceHash = EQUAL(pszMethod, "HASH");
+
+    GIntBig nMaxMemory = 0;
+    const char *pszMaxMemory =
+        CPLGetConfigOption("OGR_SQL_JOIN_HASH_MAX_MEMORY", nullptr);
+    if (pszMaxMemory)
+    {
+        CPLParseMemorySize(pszMaxMemory, &nMaxMemory, nullptr);
+    }
+    else
+    {
+        const auto nUsableRAM = CPLGetUsablePhysicalRAM();
+        nMaxMemory = nUsableRAM > 0 ? nUsableRAM / 10 : 100 * 1024 * 1024;
+    }
+
+    m_apoJoinHashTables.resize(psSelectInfo->join_count);
+    for (int iJoin = 0; iJoin < psSelectInfo->join_count; iJoin++)
+    {
+        const swq_join_def *psJoinInfo = psSelectInfo->join_defs + iJoin;
+        OGRLayer *poJoinLayer = m_apoTableLayers[psJoinInfo->secondary_table];
+
+        // Only "primary.field = secondary.field" expressions are handled
+        const swq_expr_node *poExpr = psJoinInfo->poExpr;
+        if (poJoinLayer == m_poSrcLayer ||
+            poExpr->eNodeType != SNT_OPERATION ||
+            poExpr->nOperation != SWQ_EQ || poExpr->nSubExprCount != 2 ||
+            poExpr->papoSubExpr[0]->eNodeType != SNT_COLUMN ||
+            poExpr->papoSubExpr[1]->eNodeType != SNT_COLUMN)
+        {
+            continue;
+        }
+        const swq_expr_node *poPrimary = poExpr->papoSubExpr[0];
+        const swq_expr_node *poSecondary = poExpr->papoSubExpr[1];
+        if (poPrimary->table_index != 0)
+            std::swap(poPrimary, poSecondary);
+        if (poPrimary->table_index != 0 ||
+            poSecondary->table_index != psJoinInfo->secondary_table)
+        {
+            continue;
+        }
+
+        // The join field of the secondary layer must be a regular field
+        const OGRFeatureDefn *poJoinFDefn = poJoinLayer->GetLayerDefn();
+        const int iSecondaryField = poSecondary->field_index;
+        if (iSecondaryField < 0 ||
+            iSecondaryField >= poJoinFDefn->GetFieldCount())
+        {
+            continue;
+        }
+
+        if (!bForceHash && poJoinLayer->GetIndex() != nullptr &&
+            poJoinLayer->GetIndex()->GetFieldIndex(iSecondaryField) != nullptr)
+        {
+            CPLDebug("GenSQL",
+                     "Using attribute index of layer %s to resolve join",
+                     poJoinLayer->GetName());
+            continue;
+        }
+
+        const auto GetKeyClass = [](swq_field_type eType)
+        {
+            switch (eType)
+            {
+                case SWQ_INTEGER:
+                case SWQ_INTEGER64:
+                    return 0;
+                case SWQ_FLOAT:
+                    return 1;
+                case SWQ_STRING:
+                    return 2;
+                default:
+                    break;
+            }
+            return -1;
+        };
+
+        const OGRFeatureDefn *poSrcFDefn = m_poSrcLayer->GetLayerDefn();
+        const int iPrimaryField = poPrimary->field_index;
+        swq_field_type ePrimaryType;
+        if (iPrimaryField >= 0 && iPrimaryField < poSrcFDefn->GetFieldCount())
+        {
+            const auto poFieldDefn = poSrcFDefn->GetFieldDefn(iPrimaryField);
+            if (poFieldDefn->GetSubType() == OFSTBoolean)
+                continue;
+            switch (poFieldDefn->GetType())
+            {
+                case OFTInteger:
+                    ePrimaryType = SWQ_INTEGER;
+                    break;
+                case OFTInteger64:
+                    ePrimaryType = SWQ_INTEGER64;
+                    break;
+                case OFTReal:
+                    ePrimaryType = SWQ_FLOAT;
+                    break;
+                case OFTString:
+                    ePrimaryType = SWQ_STRING;
+                    break;
+                default:
+                    continue;
+            }
+        }
+        else if (iPrimaryField >= poSrcFDefn->GetFieldCount() &&
+                 iPrimaryField <
+                     poSrcFDefn->GetFieldCount() + SPECIAL_FIELD_COUNT)
+        {
+            ePrimaryType = SpecialFieldTypes[iPrimaryField -
+                                             poSrcFDefn->GetFieldCount()];
+        }
+        else
+        {
+            continue;
+        }
+
+        const auto poSecondaryFieldDefn =
+            poJoinFDefn->GetFieldDefn(iSecondaryField);
+        if (poSecondaryFieldDefn->GetSubType() == OFSTBoolean)
+            continue;
+        swq_field_type eSecondaryType;
+        switch (poSecondaryFieldDefn->GetType())
+        {
+            case OFTInteger:
+                eSecondaryType = SWQ_INTEGER;
+                break;
+            case OFTInteger64:
+                eSecondaryType = SWQ_INTEGER64;
+                break;
+            case OFTReal:
+                eSecondaryType = SWQ_FLOAT;
+                break;
+            case OFTString:
+                eSecondaryType = SWQ_STRING;
+                break;
+            default:
+                continue;
+        }
+
+        // Integers and reals are compared as reals
+        const int nPrimaryClass = GetKeyClass(ePrimaryType);
+        const int nSecondaryClass = GetKeyClass(eSecondaryType);
+        OGRGenSQLJoinHashTable::KeyType eKeyType;
+        if (nPrimaryClass == 0 && nSecondaryClass == 0)
+            eKeyType = OGRGenSQLJoinHashTable::KeyType::INTEGER;
+        else if (nPrimaryClass >= 0 && nPrimaryClass <= 1 &&
+                 nSecondaryClass >= 0 && nSecondaryClass <= 1)
+            eKeyType = OGRGenSQLJoinHashTable::KeyType::REAL;
+        else if (nPrimaryClass == 2 && nSecondaryClass == 2)
+            eKeyType = OGRGenSQLJoinHashTable::KeyType::STRING;
+        else
+            continue;
+
+        auto poHashTable = std::make_unique<OGRGenSQLJoinHashTable>(
+            poJoinLayer, iPrimaryField, iSecondaryField, eKeyType,
+            nMaxMemory);
+        if (poHashTable->Build())
+        {
+            m_apoJoinHashTables[iJoin] = std::move(poHashTable);
+        }
+        else
+        {
+            CPLDebug("GenSQL",
+                     "Cannot build hash table for join on layer %s. "
+                     "Using attribute filters instead",
+                     poJoinLayer->GetName());
+        }
+    }
+}
+
 /************************************************************************/
 /*                          TranslateFeature()                          */
 /************************************************************************/
@@ -1494,6 +1963,9 @@ std::unique_ptr<OGRFeature> OGRGenSQLResultsLayer::TranslateFeature(
     /* -------------------------------------------------------------------- */
     /*      Fetch the corresponding features from any jointed tables.       */
     /* -------------------------------------------------------------------- */
+    if (psSelectInfo->join_count > 0 && !m_bJoinHashTablesInitialized)
+        InitializeJoinHashTables();
+
     for (int iJoin = 0; iJoin < psSelectInfo->join_count; iJoin++)
     {
         const swq_join_def *psJoinInfo = psSelectInfo->join_defs + iJoin;
@@ -1503,6 +1975,15 @@ std::unique_ptr<OGRFeature> OGRGenSQLResultsLayer::TranslateFeature(
         /* we have taken care of this */
         CPLAssert(psJoinInfo->secondary_table == iJoin + 1);
 
+        auto poHashTable = m_apoJoinHashTables.empty()
+                               ? nullptr
+                               : m_apoJoinHashTables[iJoin].get();
+        if (poHashTable && poHashTable->CanLookup(poSrcFeat))
+        {
+            apoFeatures.push_back(poHashTable->Lookup(poSrcFeat));
+            continue;
+        }
+
         OGRLayer *poJoinLayer = m_apoTableLayers[psJoinInfo->secondary_table];
 
         const std::string osFilter =
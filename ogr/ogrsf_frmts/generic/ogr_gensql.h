@@ -19,6 +19,7 @@
 #include "cpl_hash_set.h"
 #include "cpl_string.h"
 
+#include <memory>
 #include <vector>
 
 /*! @cond Doxygen_Suppress */
@@ -39,6 +40,7 @@
 /************************************************************************/
 
 class swq_select;
+class OGRGenSQLJoinHashTable;
 
 class OGRGenSQLResultsLayer final : public OGRLayer
 {
@@ -73,7 +75,13 @@ class OGRGenSQLResultsLayer final : public OGRLayer
     GIntBig m_nIteratedFeatures = -1;
     std::vector<std::string> m_aosDistinctList{};
 
+    // Hash tables of the secondary layers, indexed by join number. Null
+    // entries for joins resolved by attribute filtering.
+    std::vector<std::unique_ptr<OGRGenSQLJoinHashTable>> m_apoJoinHashTables{};
+    bool m_bJoinHashTablesInitialized = false;
+
     bool PrepareSummary();
+    void InitializeJoinHashTables();
 
     std::unique_ptr<OGRFeature> TranslateFeature(std::unique_ptr<OGRFeature>);
     void CreateOrderByIndex();
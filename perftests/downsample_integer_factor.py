@@ -1,6 +1,8 @@
 # SPDX-License-Identifier: MIT
 # Copyright 2020 Even Rouault
 
+import platform
+import sys
 import timeit
 
 from osgeo import gdal
@@ -237,3 +239,29 @@ print(
         "testCubic(4)", setup="from __main__ import testCubic", number=NITERS
     )
 )
+
+# Compare the AVX2 kernels selected at runtime with the SSE2 ones.
+# Note: GDAL_USE_AVX2=NO has no effect on non-x86_64 CPUs, on CPUs without
+# AVX2, and on builds of GDAL with AVX2 enabled at compile time.
+has_avx2 = platform.machine().lower() in ("x86_64", "amd64")
+if has_avx2 and sys.platform.startswith("linux"):
+    with open("/proc/cpuinfo") as f:
+        has_avx2 = " avx2" in f.read()
+if not has_avx2:
+    print("No AVX2 kernels selected at runtime: skipping AVX2 vs SSE2")
+isas = (("AVX2", "YES"), ("SSE2", "NO")) if has_avx2 else ()
+for isa, use_avx2 in isas:
+    with gdal.config_option("GDAL_USE_AVX2", use_avx2):
+        for test in ("testAverage", "testRMS", "testRMSUInt16", "testRMSFloat32"):
+            print(
+                "%s(2) [%s]: %.3f"
+                % (
+                    test,
+                    isa,
+                    timeit.timeit(
+                        "%s(2)" % test,
+                        setup="from __main__ import %s" % test,
+                        number=NITERS,
+                    ),
+                )
+            )
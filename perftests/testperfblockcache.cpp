@@ -0,0 +1,174 @@
+/******************************************************************************
+ *
+ * Project:  GDAL Core
+ * Purpose:  Test scalability of the global raster block cache with the
+ *           number of threads.
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "gdal_priv.h"
+#include "cpl_conv.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <thread>
+#include <vector>
+
+// Run with --config GDAL_BLOCK_CACHE_SHARDS <N> to compare the single-lock
+// block cache with the sharded one.
+
+/************************************************************************/
+/*                          BenchRasterBand                             */
+/************************************************************************/
+
+namespace
+{
+class BenchRasterBand final : public GDALRasterBand
+{
+  public:
+    BenchRasterBand(GDALDataset *poDSIn, int nSize, int nBlockSize)
+    {
+        poDS = poDSIn;
+        nBand = 1;
+        nRasterXSize = nSize;
+        nRasterYSize = nSize;
+        eDataType = GDT_Byte;
+        nBlockXSize = nBlockSize;
+        nBlockYSize = nBlockSize;
+    }
+
+    CPLErr IReadBlock(int nBlockXOff, int nBlockYOff, void *pData) override
+    {
+        memset(pData, (nBlockXOff + nBlockYOff) & 0xff,
+               static_cast<size_t>(nBlockXSize) * nBlockYSize);
+        return CE_None;
+    }
+
+    CPLErr IWriteBlock(int, int, void *) override
+    {
+        return CE_None;
+    }
+};
+
+class BenchDataset final : public GDALDataset
+{
+  public:
+    BenchDataset(int nSize, int nBlockSize)
+    {
+        nRasterXSize = nSize;
+        nRasterYSize = nSize;
+        eAccess = GA_Update;
+        SetBand(1, new BenchRasterBand(this, nSize, nBlockSize));
+    }
+};
+}  // namespace
+
+/************************************************************************/
+/*                               Usage()                                */
+/************************************************************************/
+
+static void Usage()
+{
+    printf("Usage: testperfblockcache [-threads <max_threads>] "
+           "[-iters <iters_per_thread>]\n");
+    printf("                          [-size <raster_size>] "
+           "[-blocksize <block_size>]\n");
+    printf("                          [-cachemax <bytes>] [-write]\n");
+    exit(1);
+}
+
+/************************************************************************/
+/*                               main()                                 */
+/************************************************************************/
+
+int main(int argc, char *argv[])
+{
+    argc = GDALGeneralCmdLineProcessor(argc, &argv, 0);
+    if (argc < 1)
+        exit(-argc);
+
+    int nMaxThreads = CPLGetNumCPUs();
+    int nIters = 1000 * 1000;
+    int nSize = 8192;
+    int nBlockSize = 64;
+    GIntBig nCacheMax = 32 * 1024 * 1024;
+    bool bWrite = false;
+    for (int iArg = 1; iArg < argc; ++iArg)
+    {
+        if (iArg + 1 < argc && strcmp(argv[iArg], "-threads") == 0)
+            nMaxThreads = std::max(1, atoi(argv[++iArg]));
+        else if (iArg + 1 < argc && strcmp(argv[iArg], "-iters") == 0)
+            nIters = std::max(1, atoi(argv[++iArg]));
+        else if (iArg + 1 < argc && strcmp(argv[iArg], "-size") == 0)
+            nSize = std::max(1, atoi(argv[++iArg]));
+        else if (iArg + 1 < argc && strcmp(argv[iArg], "-blocksize") == 0)
+            nBlockSize = std::max(1, atoi(argv[++iArg]));
+        else if (iArg + 1 < argc && strcmp(argv[iArg], "-cachemax") == 0)
+            nCacheMax = std::max<GIntBig>(1, CPLAtoGIntBig(argv[++iArg]));
+        else if (strcmp(argv[iArg], "-write") == 0)
+            bWrite = true;
+        else
+            Usage();
+    }
+
+    GDALSetCacheMax64(nCacheMax);
+
+    BenchDataset oDS(nSize, nBlockSize);
+    GDALRasterBand *poBand = oDS.GetRasterBand(1);
+    const int nBlocksPerRow = DIV_ROUND_UP(nSize, nBlockSize);
+    const GIntBig nTotalBlocks =
+        static_cast<GIntBig>(nBlocksPerRow) * nBlocksPerRow;
+    printf("Shards: %s, raster: %d x %d, block: %d x %d, blocks: " CPL_FRMT_GIB
+           ", cache max: " CPL_FRMT_GIB " bytes, mode: %s\n",
+           CPLGetConfigOption("GDAL_BLOCK_CACHE_SHARDS", "1"), nSize, nSize,
+           nBlockSize, nBlockSize, nTotalBlocks, nCacheMax,
+           bWrite ? "read/write" : "read");
+
+    for (int nThreads = 1; nThreads <= nMaxThreads; nThreads *= 2)
+    {
+        std::vector<std::thread> aoThreads;
+        const auto start = std::chrono::steady_clock::now();
+        for (int iThread = 0; iThread < nThreads; ++iThread)
+        {
+            aoThreads.emplace_back(
+                [poBand, nBlocksPerRow, nIters, bWrite, iThread]()
+                {
+                    std::mt19937 gen(iThread);
+                    std::uniform_int_distribution<int> dist(0,
+                                                            nBlocksPerRow - 1);
+                    for (int i = 0; i < nIters; ++i)
+                    {
+                        GDALRasterBlock *poBlock = poBand->GetLockedBlockRef(
+                            dist(gen), dist(gen), false);
+                        if (poBlock)
+                        {
+                            if (bWrite && (i % 16) == 0)
+                                poBlock->MarkDirty();
+                            poBlock->DropLock();
+                        }
+                    }
+                });
+        }
+        for (auto &oThread : aoThreads)
+            oThread.join();
+        const auto end = std::chrono::steady_clock::now();
+        const double dfSeconds =
+            std::chrono::duration<double>(end - start).count();
+        printf("Threads: %3d, elapsed: %7.3f s, throughput: %8.3f Mblocks/s\n",
+               nThreads, dfSeconds,
+               static_cast<double>(nThreads) * nIters / dfSeconds / 1e6);
+        poBand->FlushCache(false);
+    }
+
+    CSLDestroy(argv);
+
+    return 0;
+}
@@ -0,0 +1,194 @@
+/******************************************************************************
+ *
+ * Project:  GDAL Utilities
+ * Purpose:  Compare the vectorized and scalar code paths of gdaldem
+ *           hillshade, slope and aspect.
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "gdal_priv.h"
+#include "gdal_utils.h"
+#include "cpl_conv.h"
+#include "cpl_string.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+/************************************************************************/
+/*                           CreateSourceDEM()                          */
+/************************************************************************/
+
+static std::unique_ptr<GDALDataset> CreateSourceDEM(int nSize,
+                                                    GDALDataType eDT)
+{
+    auto poDriver = GetGDALDriverManager()->GetDriverByName("MEM");
+    std::unique_ptr<GDALDataset> poDS(
+        poDriver->Create("", nSize, nSize, 1, eDT, nullptr));
+    GDALGeoTransform gt;
+    gt[1] = 30;
+    gt[5] = -30;
+    poDS->SetGeoTransform(gt);
+
+    std::vector<float> afLine(nSize);
+    for (int iY = 0; iY < nSize; ++iY)
+    {
+        for (int iX = 0; iX < nSize; ++iX)
+        {
+            afLine[iX] = static_cast<float>(
+                1000 + 300 * std::sin(iX * 0.01) * std::cos(iY * 0.013) +
+                20 * std::sin(iX * 0.37 + iY * 0.23));
+        }
+        CPL_IGNORE_RET_VAL(poDS->GetRasterBand(1)->RasterIO(
+            GF_Write, 0, iY, nSize, 1, afLine.data(), nSize, 1, GDT_Float32, 0,
+            0, nullptr));
+    }
+    return poDS;
+}
+
+/************************************************************************/
+/*                               Run()                                  */
+/************************************************************************/
+
+static std::unique_ptr<GDALDataset> Run(GDALDataset *poSrcDS,
+                                        const char *pszProcessing,
+                                        const char *pszAlg, int nIters,
+                                        double &dfSeconds)
+{
+    CPLStringList aosOptions;
+    aosOptions.AddString("-of");
+    aosOptions.AddString("MEM");
+    aosOptions.AddString("-alg");
+    aosOptions.AddString(pszAlg);
+    // Different x and y resolutions to avoid the hillshade fast path
+    if (EQUAL(pszProcessing, "hillshade"))
+    {
+        aosOptions.AddString("-xscale");
+        aosOptions.AddString("1");
+        aosOptions.AddString("-yscale");
+        aosOptions.AddString("1.5");
+    }
+    GDALDEMProcessingOptions *psOptions =
+        GDALDEMProcessingOptionsNew(aosOptions.List(), nullptr);
+
+    std::unique_ptr<GDALDataset> poOutDS;
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < nIters; ++i)
+    {
+        poOutDS.reset(GDALDataset::FromHandle(GDALDEMProcessing(
+            "", GDALDataset::ToHandle(poSrcDS), pszProcessing, nullptr,
+            psOptions, nullptr)));
+    }
+    const auto end = std::chrono::steady_clock::now();
+    dfSeconds = std::chrono::duration<double>(end - start).count() / nIters;
+
+    GDALDEMProcessingOptionsFree(psOptions);
+    return poOutDS;
+}
+
+/************************************************************************/
+/*                           SameContent()                              */
+/************************************************************************/
+
+static bool SameContent(GDALDataset *poDS1, GDALDataset *poDS2)
+{
+    if (!poDS1 || !poDS2)
+        return false;
+    GDALRasterBand *poBand1 = poDS1->GetRasterBand(1);
+    GDALRasterBand *poBand2 = poDS2->GetRasterBand(1);
+    const int nXSize = poBand1->GetXSize();
+    const int nYSize = poBand1->GetYSize();
+    std::vector<float> afBuf1(nXSize);
+    std::vector<float> afBuf2(nXSize);
+    for (int iY = 0; iY < nYSize; ++iY)
+    {
+        if (poBand1->RasterIO(GF_Read, 0, iY, nXSize, 1, afBuf1.data(), nXSize,
+                              1, GDT_Float32, 0, 0, nullptr) != CE_None ||
+            poBand2->RasterIO(GF_Read, 0, iY, nXSize, 1, afBuf2.data(), nXSize,
+                              1, GDT_Float32, 0, 0, nullptr) != CE_None ||
+            memcmp(afBuf1.data(), afBuf2.data(),
+                   nXSize * sizeof(float)) != 0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                               Usage()                                */
+/************************************************************************/
+
+static void Usage()
+{
+    printf("Usage: testperfgdaldem [-size <raster_size>] [-iters <iters>]\n");
+    exit(1);
+}
+
+/************************************************************************/
+/*                               main()                                 */
+/************************************************************************/
+
+int main(int argc, char *argv[])
+{
+    GDALAllRegister();
+
+    argc = GDALGeneralCmdLineProcessor(argc, &argv, 0);
+    if (argc < 1)
+        exit(-argc);
+
+    int nSize = 4096;
+    int nIters = 3;
+    for (int iArg = 1; iArg < argc; ++iArg)
+    {
+        if (iArg + 1 < argc && strcmp(argv[iArg], "-size") == 0)
+            nSize = std::max(3, atoi(argv[++iArg]));
+        else if (iArg + 1 < argc && strcmp(argv[iArg], "-iters") == 0)
+            nIters = std::max(1, atoi(argv[++iArg]));
+        else
+            Usage();
+    }
+
+    int nRet = 0;
+    for (const GDALDataType eDT : {GDT_Float32, GDT_Int16, GDT_UInt16})
+    {
+        auto poSrcDS = CreateSourceDEM(nSize, eDT);
+        for (const char *pszProcessing : {"hillshade", "slope", "aspect"})
+        {
+            for (const char *pszAlg : {"Horn", "ZevenbergenThorne"})
+            {
+                double dfScalar = 0;
+                double dfVector = 0;
+                CPLSetConfigOption("GDAL_USE_SSE2", "NO");
+                auto poScalarDS = Run(poSrcDS.get(), pszProcessing, pszAlg,
+                                      nIters, dfScalar);
+                CPLSetConfigOption("GDAL_USE_SSE2", nullptr);
+                auto poVectorDS = Run(poSrcDS.get(), pszProcessing, pszAlg,
+                                      nIters, dfVector);
+                const bool bSame =
+                    SameContent(poScalarDS.get(), poVectorDS.get());
+                if (!bSame)
+                    nRet = 1;
+                printf("%-8s %-9s %-17s scalar: %7.3f s, vector: %7.3f s, "
+                       "speed-up: %5.2f, identical: %s\n",
+                       GDALGetDataTypeName(eDT), pszProcessing, pszAlg,
+                       dfScalar, dfVector, dfScalar / dfVector,
+                       bSame ? "yes" : "NO");
+            }
+        }
+    }
+
+    CSLDestroy(argv);
+    GDALDestroyDriverManager();
+
+    return nRet;
+}
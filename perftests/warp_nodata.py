@@ -0,0 +1,64 @@
+# SPDX-License-Identifier: MIT
+# Copyright 2026, GDAL contributors
+
+# Timings of warping with source and destination nodata (validity masks),
+# and with a source alpha band (density mask), compared with the
+# GWKRealCase() kernel used before the specialized kernels.
+
+import timeit
+
+from osgeo import gdal
+
+SIZE = 4096
+NITERS = 5
+
+datasets = {}
+for dt in (gdal.GDT_Byte, gdal.GDT_Int16, gdal.GDT_UInt16, gdal.GDT_Float32):
+    ds = gdal.GetDriverByName("MEM").Create("", SIZE, SIZE, 2, dt)
+    ds.SetGeoTransform([0, 1, 0, 0, 0, -1])
+    ds.GetRasterBand(1).Fill(127)
+    ds.GetRasterBand(2).Fill(255)
+    # Sprinkle some nodata and transparent pixels
+    for i in range(0, SIZE, 64):
+        for band in (1, 2):
+            ds.GetRasterBand(band).WriteRaster(
+                i, i, 16, 16, b"\0" * 16 * 16, buf_type=gdal.GDT_Byte
+            )
+    datasets[gdal.GetDataTypeName(dt)] = ds
+
+
+def testWarp(dt_name, resampling, alpha, fast_path):
+    gdal.Warp(
+        "",
+        datasets[dt_name],
+        format="MEM",
+        width=SIZE * 5 // 4,
+        height=SIZE * 5 // 4,
+        resampleAlg=resampling,
+        srcAlpha=alpha,
+        srcBands=None if alpha else [1],
+        srcNodata=None if alpha else 0,
+        dstNodata=0,
+        warpOptions=[] if fast_path else ["USE_MASKS_FAST_PATH=NO"],
+    )
+
+
+for dt_name in datasets:
+    for resampling in ("bilinear", "cubic"):
+        for alpha in (False, True):
+            for fast_path in (True, False):
+                print(
+                    "testWarp(%s, %s, %s)%s: %.3f"
+                    % (
+                        dt_name,
+                        resampling,
+                        "alpha" if alpha else "nodata",
+                        "" if fast_path else " [GWKRealCase]",
+                        timeit.timeit(
+                            "testWarp(%r, %r, %r, %r)"
+                            % (dt_name, resampling, alpha, fast_path),
+                            setup="from __main__ import testWarp",
+                            number=NITERS,
+                        ),
+                    )
+                )
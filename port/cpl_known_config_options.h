@@ -71,7 +71,7 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "CARTODB_MAX_CHUNK_SIZE", // from ogrcartotablelayer.cpp
    "CENTER_LONG", // from ogrct.cpp
    "CHECK_DISK_FREE_SPACE", // from gtiffdataset_write.cpp
-   "CHECK_WITH_INVERT_PROJ", // from gdaltransformer.cpp, gdalwarp_lib.cpp, gdalwarpoperation.cpp, ogrct.cpp
+   "CHECK_WITH_INVERT_PROJ", // from gdal_coordgrid.cpp, gdaltransformer.cpp, gdalwarp_lib.cpp, gdalwarpoperation.cpp, ogrct.cpp
    "COG_DELETE_TEMP_FILES", // from cogdriver.cpp
    "COG_TMP_COMPRESSION", // from cogdriver.cpp
    "COMPRESS_GEOM", // from ogrsqlitelayer.cpp
@@ -124,6 +124,7 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "CPL_VSI_MEM_MTIME", // from cpl_vsi_mem.cpp
    "CPL_VSIAZ_UNLINK_BATCH_SIZE", // from cpl_vsil_az.cpp
    "CPL_VSIGS_UNLINK_BATCH_SIZE", // from cpl_vsil_gs.cpp
+   "CPL_VSIL_ASYNC_READ_NUM_THREADS", // from cpl_vsil.cpp
    "CPL_VSIL_CURL_ADVISE_READ_TOTAL_BYTES_LIMIT", // from cpl_vsil_curl.cpp
    "CPL_VSIL_CURL_ALLOWED_EXTENSIONS", // from cpl_vsil_curl.cpp
    "CPL_VSIL_CURL_ALLOWED_FILENAME", // from cpl_vsil_curl.cpp
@@ -135,15 +136,26 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "CPL_VSIL_CURL_IGNORE_STORAGE_CLASSES", // from cpl_vsil_curl.cpp
    "CPL_VSIL_CURL_MAX_RANGES", // from cpl_vsil_curl.cpp
    "CPL_VSIL_CURL_NON_CACHED", // from cpl_vsil_curl.cpp
+   "CPL_VSIL_CURL_PERSISTENT_CACHE_DIR", // from cpl_vsil_curl_persistent_cache.cpp
+   "CPL_VSIL_CURL_PERSISTENT_CACHE_METADATA_TTL", // from cpl_vsil_curl_persistent_cache.cpp
+   "CPL_VSIL_CURL_PERSISTENT_CACHE_SIZE", // from cpl_vsil_curl_persistent_cache.cpp
+   "CPL_VSIL_CURL_READ_AHEAD", // from cpl_vsil_curl.cpp
+   "CPL_VSIL_CURL_READ_AHEAD_CHUNK_SIZE", // from cpl_vsil_curl.cpp
+   "CPL_VSIL_CURL_READ_AHEAD_MAX_CHUNKS", // from cpl_vsil_curl.cpp
    "CPL_VSIL_CURL_SLOW_GET_SIZE", // from cpl_vsil_curl.cpp, cpl_vsil_curl_streaming.cpp
    "CPL_VSIL_CURL_STREMAING_SIMULATED_CURL_ERROR", // from cpl_vsil_curl_streaming.cpp
    "CPL_VSIL_CURL_USE_HEAD", // from cpl_vsil_curl.cpp
    "CPL_VSIL_CURL_USE_S3_REDIRECT", // from cpl_vsil_curl.cpp
    "CPL_VSIL_DEFLATE_CHUNK_SIZE", // from cpl_minizip_zip.cpp, cpl_vsil_gzip.cpp
+   "CPL_VSIL_GZIP_INDEX_DIR", // from cpl_vsil_gzip.cpp
+   "CPL_VSIL_GZIP_NUM_THREADS", // from cpl_vsil_gzip.cpp
    "CPL_VSIL_GZIP_SAVE_INFO", // from cpl_vsil_gzip.cpp
+   "CPL_VSIL_GZIP_WRITE_INDEX", // from cpl_vsil_gzip.cpp
    "CPL_VSIL_GZIP_WRITE_PROPERTIES", // from cpl_vsil_gzip.cpp
    "CPL_VSIL_NETWORK_STATS_ENABLED", // from cpl_vsil_curl.cpp
    "CPL_VSIL_SHOW_NETWORK_STATS", // from cpl_vsil_curl.cpp
+   "CPL_VSIL_UPLOAD_NUM_THREADS", // from cpl_vsil_s3.cpp
+   "CPL_VSIL_USE_IO_URING", // from cpl_vsil_unix_stdio_64.cpp
    "CPL_VSIL_USE_TEMP_FILE_FOR_RANDOM_WRITE", // from cpl_vsil_s3.cpp, ogrgeopackagedatasource.cpp, ogrlibkmldatasource.cpp, ogrsqlitedatasource.cpp
    "CPL_VSIL_ZIP_ALLOWED_EXTENSIONS", // from cpl_vsil_gzip.cpp
    "CPL_VSIS3_CREATE_DIR_OBJECT", // from cpl_vsil_s3.cpp
@@ -224,6 +236,7 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "GDAL_BAG_BLOCK_SIZE", // from bagdataset.cpp
    "GDAL_BAG_MAX_SIZE_VARRES_MAP", // from bagdataset.cpp
    "GDAL_BAND_BLOCK_CACHE", // from gdalrasterband.cpp
+   "GDAL_BLOCK_CACHE_SHARDS", // from gdalrasterblock.cpp
    "GDAL_CACHE_DIRECTORY", // from gdal_misc.cpp
    "GDAL_CACHEMAX", // from gdalrasterblock.cpp, nearblack_bin.cpp
    "GDAL_CONFIG_FILE", // from cpl_conv.cpp
@@ -263,6 +276,7 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "GDAL_EXPRTK_MAX_VECTOR_LENGTH", // from vrtexpression_exprtk.cpp
    "GDAL_EXPRTK_TIMEOUT_SECONDS", // from vrtexpression_exprtk.cpp
    "GDAL_FILENAME_IS_UTF8", // from cpl_getexecpath.cpp, cpl_odbc.cpp, cpl_vsil_win32.cpp, cpl_vsisimple.cpp, cplgetsymbol.cpp, ecwcreatecopy.cpp, ecwdataset.cpp, gdalpython.cpp, netcdfdataset.cpp, netcdfmultidim.cpp, ogrxlsdatasource.cpp
+   "GDAL_FILLNODATA_BATCH_MAX_SIZE", // from rasterfill.cpp
    "GDAL_FORCE_CACHING", // from gdaldataset.cpp, gdalrasterband.cpp
    "GDAL_GCPS_TO_GEOTRANSFORM_APPROX_OK", // from gdal_misc.cpp
    "GDAL_GCPS_TO_GEOTRANSFORM_APPROX_THRESHOLD", // from gdal_misc.cpp
@@ -293,6 +307,7 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "GDAL_HTTP_MAX_RETRY", // from cpl_http.cpp
    "GDAL_HTTP_MAX_TOTAL_CONNECTIONS", // from cpl_vsil_curl.cpp
    "GDAL_HTTP_MERGE_CONSECUTIVE_RANGES", // from cpl_vsil_curl.cpp
+   "GDAL_HTTP_MERGE_RANGES_MAX_GAP", // from cpl_vsil_curl.cpp
    "GDAL_HTTP_MULTIPLEX", // from cpl_vsil_curl.cpp
    "GDAL_HTTP_MULTIRANGE", // from cpl_vsil_curl.cpp
    "GDAL_HTTP_NETRC", // from cpl_http.cpp
@@ -337,7 +352,7 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "GDAL_NETCDF_REPORT_EXTRA_DIM_VALUES", // from netcdfdataset.cpp
    "GDAL_NETCDF_VERIFY_DIMS", // from netcdfdataset.cpp
    "GDAL_NO_COSTLY_OVERVIEW", // from rasterio.cpp
-   "GDAL_NUM_THREADS", // from avifdataset.cpp, common.cpp, cpl_vsil_gzip.cpp, gdal_tps.cpp, gdalalgorithm.cpp, gdalgrid.cpp, gdalpansharpen.cpp, gdaltileindexdataset.cpp, gdalwarpkernel.cpp, gtiffdataset_write.cpp, jpegxl.cpp, libertiffdataset.cpp, ogr2ogr_lib.cpp, ogrmvtdataset.cpp, ogrparquetlayer.cpp, osm_parser.cpp, overview.cpp, rmfdataset.cpp, vrtdataset.cpp, zarr_array.cpp
+   "GDAL_NUM_THREADS", // from avifdataset.cpp, common.cpp, cpl_vsil_gzip.cpp, gdal_thread_pool.cpp, gdal_tps.cpp, gdalalgorithm.cpp, gdalgrid.cpp, gdalpansharpen.cpp, gdaltileindexdataset.cpp, gdalwarpkernel.cpp, gdalwarpoperation.cpp, gtiffdataset_write.cpp, jpegxl.cpp, libertiffdataset.cpp, ogr2ogr_lib.cpp, ogrmvtdataset.cpp, ogrparquetlayer.cpp, osm_parser.cpp, overview.cpp, rmfdataset.cpp, vrtdataset.cpp, zarr_array.cpp
    "GDAL_OGCAPI_TILEMATRIXSET_LIMITS", // from gdalogcapidataset.cpp
    "GDAL_ONE_BIG_READ", // from jp2kakdataset.cpp, jpipkakdataset.cpp, mrsiddataset.cpp, rawdataset.cpp, wcsdataset.cpp
    "GDAL_OPEN_AFTER_COPY", // from jpgdataset.cpp, pngdataset.cpp
@@ -347,6 +362,7 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "GDAL_OVR_CHUNK_MAX_SIZE_FOR_TEMP_FILE", // from overview.cpp
    "GDAL_OVR_CHUNKYSIZE", // from overview.cpp
    "GDAL_OVR_PROPAGATE_NODATA", // from overview.cpp
+   "GDAL_OVR_SINGLE_PASS", // from overview.cpp
    "GDAL_OVR_TEMP_DRIVER", // from overview.cpp
    "GDAL_PAM_ENABLE_MARK_DIRTY", // from gdalpamdataset.cpp
    "GDAL_PAM_ENABLED", // from gdalpamdataset.cpp
@@ -370,6 +386,7 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "GDAL_PDF_WRITE_GEOREF_ON_IMAGE", // from pdfcreatecopy.cpp
    "GDAL_PNG_SINGLE_BLOCK", // from pngdataset.cpp
    "GDAL_PNG_WHOLE_IMAGE_OPTIM", // from pngdataset.cpp
+   "GDAL_PROXIMITY_CHUNK_MAX_SIZE", // from gdalproximity.cpp
    "GDAL_PROXY_AUTH", // from cpl_http.cpp
    "GDAL_PYTHON_DRIVER_PATH", // from gdalpythondriverloader.cpp
    "GDAL_RASTER_PIPELINE_USE_GTIFF_FOR_TEMP_DATASET", // from gdalalg_raster_pipeline.cpp
@@ -403,9 +420,11 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "GDAL_TIFF_OVR_BLOCKSIZE", // from geotiff.cpp
    "GDAL_TRY_PDS3_WITH_VICAR", // from pdsdrivercore.cpp
    "GDAL_USE_AVX", // from gdalgrid.cpp
+   "GDAL_USE_AVX2", // from overview.cpp
    "GDAL_USE_GEOJP2", // from gdaljp2metadata.cpp
    "GDAL_USE_GMLJP2", // from gdaljp2metadata.cpp
    "GDAL_USE_SSE", // from gdalgrid.cpp
+   "GDAL_USE_SSE2", // from gdaldem_lib.cpp
    "GDAL_USE_SSSE3", // from cpl_cpu_features.cpp
    "GDAL_VALIDATE_CREATION_OPTIONS", // from gdaldataset.cpp, gdaldriver.cpp
    "GDAL_VRT_ENABLE_PYTHON", // from vrtderivedrasterband.cpp
@@ -420,6 +439,7 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "GDAL_XML_VALIDATION", // from ogrgmlasconf.cpp, ogrvrtdriver.cpp, pdfcreatefromcomposition.cpp
    "GDAL_ZARR_USE_OPTIMIZED_CODE_PATHS", // from zarr_array.cpp
    "GDALCUTLINE_SKIP_CONTAINMENT_TEST", // from gdalcutline.cpp
+   "GDALDEM_CHUNK_MAX_SIZE", // from gdaldem_lib.cpp
    "GDALWARP_DENSIFY_CUTLINE", // from gdalwarp_lib.cpp
    "GDALWARP_DUMP_WKT_TO_FILE", // from gdalwarp_lib.cpp
    "GDALWARP_IGNORE_BAD_CUTLINE", // from gdalwarp_lib.cpp
@@ -799,6 +819,8 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "OGR_SHAPE_PACK_IN_PLACE", // from ogrshapedatasource.cpp, ogrshapelayer.cpp
    "OGR_SHAPE_USE_VSIMEM_FOR_TEMP", // from ogrshapedatasource.cpp
    "OGR_SKIP", // from gdaldrivermanager.cpp
+   "OGR_SQL_JOIN_HASH_MAX_MEMORY", // from ogr_gensql.cpp
+   "OGR_SQL_JOIN_METHOD", // from ogr_gensql.cpp
    "OGR_SQL_LIKE_AS_ILIKE", // from ogrwfsfilter.cpp, swq_op_general.cpp
    "OGR_SQL_STRICT", // from swq.cpp
    "OGR_SQLITE_ALLOW_EXTERNAL_ACCESS", // from ogrsqlitesqlfunctionscommon.cpp
@@ -970,6 +992,7 @@ constexpr static const char* const apszKnownConfigOptions[] =
    "QHULL_LOG_TO_TEMP_FILE", // from delaunay.c
    "RAW_CHECK_FILE_SIZE", // from rawdataset.cpp
    "RAW_MEM_ALLOC_LIMIT_MB", // from rawdataset.cpp
+   "RAW_USE_MMAP", // from rawdataset.cpp
    "REPORT_COMPD_CS", // from dteddataset.cpp, srtmhgtdataset.cpp
    "RESTRICT_OUTPUT_DATASET_UPDATE", // from gdalwarp_lib.cpp
    "RL2_SHOW_ALL_PYRAMID_LEVELS", // from rasterlite2.cpp
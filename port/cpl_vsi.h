@@ -149,6 +149,15 @@ int CPL_DLL VSIFReadMultiRangeL(int nRanges, void **ppData,
                                 const vsi_l_offset *panOffsets,
                                 const size_t *panSizes,
                                 VSILFILE *) EXPERIMENTAL_CPL_WARN_UNUSED_RESULT;
+
+/** Callback of VSIFReadAsyncL(), called with the number of bytes read.
+ * @since GDAL 3.12
+ */
+typedef void (*VSIAsyncReadCallback)(size_t nBytesRead, void *pUserData);
+
+void CPL_DLL VSIFReadAsyncL(VSILFILE *fp, void *pBuffer, size_t nSize,
+                            vsi_l_offset nOffset,
+                            VSIAsyncReadCallback pfnCallback, void *pUserData);
 size_t CPL_DLL VSIFWriteL(const void *, size_t, size_t,
                           VSILFILE *) EXPERIMENTAL_CPL_WARN_UNUSED_RESULT;
 void CPL_DLL VSIFClearErrL(VSILFILE *);
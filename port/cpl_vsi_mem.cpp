@@ -29,6 +29,7 @@
 
 #include <algorithm>
 #include <atomic>
+#include <future>
 #include <map>
 #include <string>
 #include <utility>
@@ -180,6 +181,10 @@ class VSIMemHandle final : public VSIVirtualHandle
 
     size_t PRead(void * /*pBuffer*/, size_t /* nSize */,
                  vsi_l_offset /*nOffset*/) const override;
+
+    std::future<size_t> ReadAsync(void *pBuffer, size_t nSize,
+                                  vsi_l_offset nOffset,
+                                  AsyncReadCallback cbk) override;
 };
 
 /************************************************************************/
@@ -503,6 +508,24 @@ size_t VSIMemHandle::PRead(void *pBuffer, size_t nSize,
     return 0;
 }
 
+/************************************************************************/
+/*                             ReadAsync()                              */
+/************************************************************************/
+
+// The data is already in memory: dispatching the copy to another thread
+// would cost more than doing it.
+std::future<size_t> VSIMemHandle::ReadAsync(void *pBuffer, size_t nSize,
+                                            vsi_l_offset nOffset,
+                                            AsyncReadCallback cbk)
+{
+    const size_t nRead = PRead(pBuffer, nSize, nOffset);
+    if (cbk)
+        cbk(nRead);
+    std::promise<size_t> oPromise;
+    oPromise.set_value(nRead);
+    return oPromise.get_future();
+}
+
 /************************************************************************/
 /*                               Write()                                */
 /************************************************************************/
@@ -24,6 +24,8 @@
 #include "cpl_multiproc.h"
 
 #include <cstdint>
+#include <functional>
+#include <future>
 #include <map>
 #include <memory>
 #include <vector>
@@ -124,6 +126,15 @@ struct CPL_DLL VSIVirtualHandle
     virtual size_t PRead(void *pBuffer, size_t nSize,
                          vsi_l_offset nOffset) const;
 
+    /** Callback of ReadAsync(), called with the number of bytes read.
+     * @since GDAL 3.12
+     */
+    typedef std::function<void(size_t nBytesRead)> AsyncReadCallback;
+
+    virtual std::future<size_t> ReadAsync(void *pBuffer, size_t nSize,
+                                          vsi_l_offset nOffset,
+                                          AsyncReadCallback cbk);
+
     /** Ask current operations to be interrupted.
      * Implementations must be thread-safe, as this will typically be called
      * from another thread than the active one for this file.
@@ -25,6 +25,8 @@
 #endif
 
 #include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <limits>
 #include <map>
 #include <memory>
@@ -36,9 +38,11 @@
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
+#include "cpl_error_internal.h"
 #include "cpl_multiproc.h"
 #include "cpl_string.h"
 #include "cpl_vsi_virtual.h"
+#include "cpl_worker_thread_pool.h"
 #include "cpl_vsil_curl_class.h"
 
 // To avoid aliasing to GetDiskFreeSpace to GetDiskFreeSpaceA on Windows
@@ -1103,10 +1107,19 @@ int VSICopyFileRestartable(const char *pszSource, const char *pszTarget,
  *
  *     The OVERWRITE strategy (GDAL >= 3.2) will always overwrite the target
  *     file with the source one.
+ *
+ *     Since GDAL 3.12, MD5 checksums of local files computed for the ETAG
+ *     strategy are cached for the lifetime of the process, keyed by file name,
+ *     size and modification time, and are computed in parallel when
+ *     NUM_THREADS > 1.
  * </li>
- * <li>NUM_THREADS=integer. (GDAL >= 3.1) Number of threads to use for parallel
- * file copying. Only use for when /vsis3/, /vsigs/, /vsiaz/ or /vsiadls/ is in
- * source or target. The default is 10 since GDAL 3.3</li>
+ * <li>NUM_THREADS=integer or ALL_CPUS. (GDAL >= 3.1) Number of threads to use
+ * for parallel file copying. When /vsis3/, /vsigs/, /vsiaz/ or /vsiadls/ is in
+ * source or target, the default is 10 since GDAL 3.3, and the listing of the
+ * target directory is done concurrently with the one of the source directory
+ * since GDAL 3.12. Since GDAL 3.12, it is also honored for the other file
+ * systems when synchronizing directories: directories are then listed and
+ * files copied by a pool of worker threads. The default is 1 for them.</li>
  * <li>CHUNK_SIZE=integer. (GDAL >= 3.1) Maximum size of chunk (in bytes) to use
  * to split large objects when downloading them from /vsis3/, /vsigs/, /vsiaz/
  * or /vsiadls/ to local file system, or for upload to /vsis3/, /vsiaz/ or
@@ -1642,6 +1655,15 @@ int VSIStatExL(const char *pszFilename, VSIStatBufL *psStatBuf, int nFlags)
  * Note: this will be a subset of what pszDomain=HEADERS returns</li>
  * <li>ZIP: specific to /vsizip/: to obtain ZIP specific metadata, in particular
  * if a file is SOZIP-enabled (SOZIP_VALID=YES)</li>
+ * <li>STATISTICS: (GDAL >= 3.12) specific to network-like filesystems
+ * (/vsicurl/, /vsis3/, etc.): to get statistics on the ReadMultiRange()
+ * and AdviseRead() requests issued for the file since the last
+ * VSICurlClearCache() call (MULTI_RANGE_CALLS, RANGES, REQUESTS,
+ * REQUESTED_BYTES, DOWNLOADED_BYTES, IN_FLIGHT_REQUESTS,
+ * MAX_IN_FLIGHT_REQUESTS), on the read-ahead of sequential reads
+ * (READ_AHEAD_HITS, READ_AHEAD_MISSES, READ_AHEAD_REQUESTS,
+ * READ_AHEAD_CANCELLED_REQUESTS, READ_AHEAD_CHUNKS), and the latency and
+ * bandwidth estimated for its host (LATENCY_MS, BANDWIDTH_BYTES_PER_SEC)</li>
  * </ul>
  * @param papszOptions Unused. Should be set to NULL.
  *
@@ -2168,6 +2190,311 @@ int VSIFilesystemHandler::CopyFileRestartable(
                     pProgressData);
 }
 
+/************************************************************************/
+/*                          VSISyncScheduler                            */
+/************************************************************************/
+
+namespace
+{
+
+/** Parallel synchronization of a directory tree, used by
+ * VSIFilesystemHandler::Sync() when NUM_THREADS > 1.
+ *
+ * Listing a directory is a job that queues one job per sub-directory and
+ * one job per file to copy in the shared queue of a CPLWorkerThreadPool.
+ * Idle workers thus pick up whatever work is pending, be it listing or
+ * copying, which keeps all of them busy on unbalanced trees.
+ */
+class VSISyncScheduler
+{
+  public:
+    VSISyncScheduler(bool bRecursive, bool bOverwrite,
+                     CSLConstList papszOptions)
+        : m_bRecursive(bRecursive), m_bOverwrite(bOverwrite),
+          m_aosOptions(CSLDuplicate(papszOptions))
+    {
+    }
+
+    bool Run(const std::string &osSourceDir, const std::string &osTargetDir,
+             int nThreads, GDALProgressFunc pProgressFunc,
+             void *pProgressData);
+
+  private:
+    CPL_DISALLOW_COPY_ASSIGN(VSISyncScheduler)
+
+    const bool m_bRecursive;
+    const bool m_bOverwrite;
+    const CPLStringList m_aosOptions;
+
+    CPLWorkerThreadPool m_oPool{};
+    CPLErrorAccumulator m_oErrorAccumulator{};
+    std::atomic<bool> m_bStop{false};
+    std::atomic<int> m_nPendingJobs{0};
+
+    std::mutex m_oMutex{};
+    bool m_bError = false;            // protected by m_oMutex
+    int m_nFilesToCopy = 0;           // protected by m_oMutex
+    int m_nFilesCopied = 0;           // protected by m_oMutex
+    uint64_t m_nBytesToCopy = 0;      // protected by m_oMutex
+    uint64_t m_nBytesCopied = 0;      // protected by m_oMutex
+
+    void Submit(std::function<void()> task);
+    void SetError();
+    void ListDir(const std::string &osSourceDir,
+                 const std::string &osTargetDir);
+    void CopyOneFile(const std::string &osSource, const std::string &osTarget,
+                     const VSIDIREntry &oEntry);
+};
+
+/************************************************************************/
+/*                    VSISyncScheduler::Submit()                        */
+/************************************************************************/
+
+void VSISyncScheduler::Submit(std::function<void()> task)
+{
+    ++m_nPendingJobs;
+    const bool bOK = m_oPool.SubmitJob(
+        [this, task = std::move(task)]()
+        {
+            if (!m_bStop)
+            {
+                auto oAccumulator =
+                    m_oErrorAccumulator.InstallForCurrentScope();
+                CPL_IGNORE_RET_VAL(oAccumulator);
+                task();
+            }
+            --m_nPendingJobs;
+        });
+    if (!bOK)
+    {
+        --m_nPendingJobs;
+        SetError();
+    }
+}
+
+/************************************************************************/
+/*                   VSISyncScheduler::SetError()                       */
+/************************************************************************/
+
+void VSISyncScheduler::SetError()
+{
+    std::lock_guard oLock(m_oMutex);
+    m_bError = true;
+    m_bStop = true;
+}
+
+/************************************************************************/
+/*                    VSISyncScheduler::ListDir()                       */
+/************************************************************************/
+
+void VSISyncScheduler::ListDir(const std::string &osSourceDir,
+                               const std::string &osTargetDir)
+{
+    std::unique_ptr<VSIDIR, decltype(&VSICloseDir)> poDir(
+        VSIOpenDir(osSourceDir.c_str(), 0, nullptr), VSICloseDir);
+    if (!poDir)
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Cannot list %s",
+                 osSourceDir.c_str());
+        SetError();
+        return;
+    }
+
+    while (const auto psEntry = VSIGetNextDirEntry(poDir.get()))
+    {
+        if (m_bStop)
+            return;
+        if (strcmp(psEntry->pszName, ".") == 0 ||
+            strcmp(psEntry->pszName, "..") == 0)
+        {
+            continue;
+        }
+        std::string osSubSource(CPLFormFilenameSafe(
+            osSourceDir.c_str(), psEntry->pszName, nullptr));
+        std::string osSubTarget(CPLFormFilenameSafe(
+            osTargetDir.c_str(), psEntry->pszName, nullptr));
+
+        VSIDIREntry oEntry(*psEntry);
+        if (!oEntry.bModeKnown || !oEntry.bSizeKnown || !oEntry.bMTimeKnown)
+        {
+            VSIStatBufL sStat;
+            if (VSIStatL(osSubSource.c_str(), &sStat) != 0)
+            {
+                CPLError(CE_Failure, CPLE_FileIO, "Cannot stat %s",
+                         osSubSource.c_str());
+                SetError();
+                return;
+            }
+            oEntry.nMode = sStat.st_mode;
+            oEntry.nSize = sStat.st_size;
+            oEntry.nMTime = sStat.st_mtime;
+        }
+
+        if (VSI_ISDIR(oEntry.nMode))
+        {
+            // Create the target directory before any job may write into it
+            VSIStatBufL sStat;
+            if (VSIStatL(osSubTarget.c_str(), &sStat) != 0 &&
+                VSIMkdir(osSubTarget.c_str(), 0755) != 0)
+            {
+                CPLError(CE_Failure, CPLE_FileIO,
+                         "Cannot create directory %s", osSubTarget.c_str());
+                SetError();
+                return;
+            }
+            // Without RECURSIVE, only the first level sub-directories are
+            // created, as in the serial code path
+            if (m_bRecursive)
+            {
+                Submit(
+                    [this, osSubSource = std::move(osSubSource),
+                     osSubTarget = std::move(osSubTarget)]()
+                    { ListDir(osSubSource, osSubTarget); });
+            }
+        }
+        else
+        {
+            {
+                std::lock_guard oLock(m_oMutex);
+                ++m_nFilesToCopy;
+                m_nBytesToCopy += oEntry.nSize;
+            }
+            Submit(
+                [this, osSubSource = std::move(osSubSource),
+                 osSubTarget = std::move(osSubTarget),
+                 oEntry = std::move(oEntry)]()
+                { CopyOneFile(osSubSource, osSubTarget, oEntry); });
+        }
+    }
+}
+
+/************************************************************************/
+/*                  VSISyncScheduler::CopyOneFile()                     */
+/************************************************************************/
+
+void VSISyncScheduler::CopyOneFile(const std::string &osSource,
+                                   const std::string &osTarget,
+                                   const VSIDIREntry &oEntry)
+{
+    VSIStatBufL sTarget;
+    if (!m_bOverwrite && VSIStatL(osTarget.c_str(), &sTarget) == 0 &&
+        !VSI_ISDIR(sTarget.st_mode) &&
+        static_cast<vsi_l_offset>(sTarget.st_size) == oEntry.nSize &&
+        sTarget.st_mtime == oEntry.nMTime && oEntry.nMTime != 0)
+    {
+        CPLDebug("VSI",
+                 "%s and %s have same size and modification "
+                 "date. Skipping copying",
+                 osSource.c_str(), osTarget.c_str());
+        std::lock_guard oLock(m_oMutex);
+        ++m_nFilesCopied;
+        m_nBytesCopied += oEntry.nSize;
+        return;
+    }
+
+    struct ProgressData
+    {
+        VSISyncScheduler *poThis;
+        vsi_l_offset nFileSize;
+        uint64_t nReported;
+
+        static int CPL_STDCALL Func(double dfPct, const char *, void *pData)
+        {
+            auto psData = static_cast<ProgressData *>(pData);
+            const auto nDone = static_cast<uint64_t>(
+                dfPct * static_cast<double>(psData->nFileSize) + 0.5);
+            if (nDone > psData->nReported)
+            {
+                std::lock_guard oLock(psData->poThis->m_oMutex);
+                psData->poThis->m_nBytesCopied += nDone - psData->nReported;
+                psData->nReported = nDone;
+            }
+            return !psData->poThis->m_bStop;
+        }
+    };
+
+    ProgressData sProgressData{this, oEntry.nSize, 0};
+    if (VSICopyFile(osSource.c_str(), osTarget.c_str(), nullptr, oEntry.nSize,
+                    m_aosOptions.List(), ProgressData::Func,
+                    &sProgressData) != 0)
+    {
+        if (!m_bStop)
+        {
+            CPLError(CE_Failure, CPLE_FileIO, "Copying of %s to %s failed",
+                     osSource.c_str(), osTarget.c_str());
+        }
+        SetError();
+        return;
+    }
+
+    std::lock_guard oLock(m_oMutex);
+    ++m_nFilesCopied;
+    m_nBytesCopied += oEntry.nSize - std::min<uint64_t>(
+                                         oEntry.nSize, sProgressData.nReported);
+}
+
+/************************************************************************/
+/*                      VSISyncScheduler::Run()                         */
+/************************************************************************/
+
+bool VSISyncScheduler::Run(const std::string &osSourceDir,
+                           const std::string &osTargetDir, int nThreads,
+                           GDALProgressFunc pProgressFunc, void *pProgressData)
+{
+    if (!m_oPool.Setup(nThreads, nullptr, nullptr))
+        return false;
+
+    const auto tStart = std::chrono::steady_clock::now();
+    Submit([this, osSourceDir, osTargetDir]()
+           { ListDir(osSourceDir, osTargetDir); });
+
+    // Files keep being discovered while copying, so make sure the reported
+    // progress never goes backwards.
+    double dfLastPct = 0;
+    while (pProgressFunc && m_nPendingJobs > 0)
+    {
+        CPLSleep(0.1);
+
+        int nFilesToCopy, nFilesCopied;
+        uint64_t nBytesToCopy, nBytesCopied;
+        {
+            std::lock_guard oLock(m_oMutex);
+            nFilesToCopy = m_nFilesToCopy;
+            nFilesCopied = m_nFilesCopied;
+            nBytesToCopy = m_nBytesToCopy;
+            nBytesCopied = m_nBytesCopied;
+        }
+        const double dfElapsed = std::chrono::duration<double>(
+                                     std::chrono::steady_clock::now() - tStart)
+                                     .count();
+        dfLastPct = std::max(
+            dfLastPct, std::min(1.0, static_cast<double>(nBytesCopied) /
+                                         std::max<uint64_t>(1, nBytesToCopy)));
+        const std::string osMsg = CPLSPrintf(
+            "%d/%d files, %.1f MB/s", nFilesCopied, nFilesToCopy,
+            dfElapsed > 0 ? static_cast<double>(nBytesCopied) / 1e6 / dfElapsed
+                          : 0.0);
+        if (!m_bStop && !pProgressFunc(dfLastPct, osMsg.c_str(), pProgressData))
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "Interrupted by user");
+            SetError();
+        }
+    }
+    m_oPool.WaitCompletion();
+
+    m_oErrorAccumulator.ReplayErrors();
+
+    std::lock_guard oLock(m_oMutex);
+    CPLDebug("VSI", "Sync of %s: %d files processed, " CPL_FRMT_GUIB " bytes",
+             osSourceDir.c_str(), m_nFilesCopied,
+             static_cast<GUIntBig>(m_nBytesCopied));
+    if (!m_bError && pProgressFunc)
+        pProgressFunc(1.0, "", pProgressData);
+    return !m_bError;
+}
+
+}  // namespace
+
 /************************************************************************/
 /*                               Sync()                                 */
 /************************************************************************/
@@ -2184,6 +2511,10 @@ bool VSIFilesystemHandler::Sync(const char *pszSource, const char *pszTarget,
         *ppapszOutputs = nullptr;
     }
 
+    const bool bOverwrite = EQUAL(
+        CSLFetchNameValueDef(papszOptions, "SYNC_STRATEGY", "TIMESTAMP"),
+        "OVERWRITE");
+
     VSIStatBufL sSource;
     CPLString osSource(pszSource);
     CPLString osSourceWithoutSlash(pszSource);
@@ -2219,6 +2550,23 @@ bool VSIFilesystemHandler::Sync(const char *pszSource, const char *pszTarget,
             }
         }
 
+        const int nThreads = [papszOptions]()
+        {
+            const char *pszThreads =
+                CSLFetchNameValueDef(papszOptions, "NUM_THREADS", "1");
+            const int nVal = EQUAL(pszThreads, "ALL_CPUS") ? CPLGetNumCPUs()
+                                                           : atoi(pszThreads);
+            return std::max(1, std::min(128, nVal));
+        }();
+        if (nThreads > 1 && !CPLFetchBool(papszOptions, "STOP_ON_DIR", false))
+        {
+            VSISyncScheduler oScheduler(
+                CPLFetchBool(papszOptions, "RECURSIVE", true), bOverwrite,
+                papszOptions);
+            return oScheduler.Run(osSourceWithoutSlash, osTargetDir, nThreads,
+                                  pProgressFunc, pProgressData);
+        }
+
         if (!CPLFetchBool(papszOptions, "STOP_ON_DIR", false))
         {
             CPLStringList aosChildOptions(CSLDuplicate(papszOptions));
@@ -2278,7 +2626,7 @@ bool VSIFilesystemHandler::Sync(const char *pszSource, const char *pszTarget,
             bTargetIsFile = VSIStatL(osTarget.c_str(), &sTarget) == 0 &&
                             !CPL_TO_BOOL(VSI_ISDIR(sTarget.st_mode));
         }
-        if (bTargetIsFile)
+        if (bTargetIsFile && !bOverwrite)
         {
             if (sSource.st_size == sTarget.st_size &&
                 sSource.st_mtime == sTarget.st_mtime && sSource.st_mtime != 0)
@@ -3126,6 +3474,48 @@ int VSIFReadMultiRangeL(int nRanges, void **ppData,
     return fp->ReadMultiRange(nRanges, ppData, panOffsets, panSizes);
 }
 
+/************************************************************************/
+/*                          VSIFReadAsyncL()                            */
+/************************************************************************/
+
+/**
+ * \brief Start an asynchronous read of a range of bytes from file.
+ *
+ * Reads up to nSize bytes from the indicated file at offset nOffset into
+ * pBuffer, without waiting for the data to be available, and calls
+ * pfnCallback with the number of bytes read when done. The callback may be
+ * called from another thread than the calling one, or from the calling
+ * thread before this function returns. The current file offset is not
+ * affected.
+ *
+ * pBuffer must remain valid, and fp must not be closed, until the callback
+ * has been called.
+ *
+ * This method goes through the VSIFileHandler virtualization and may
+ * work on unusual filesystems such as in memory or /vsicurl/.
+ * See VSIVirtualHandle::ReadAsync() for the behavior of the various file
+ * systems.
+ *
+ * @param fp file handle opened with VSIFOpenL().
+ * @param pBuffer the buffer into which the data should be read (at least
+ * nSize bytes in size).
+ * @param nSize number of bytes to read.
+ * @param nOffset file offset from which to read.
+ * @param pfnCallback callback called on completion (must not be null).
+ * @param pUserData user data passed to pfnCallback.
+ *
+ * @since GDAL 3.12
+ */
+
+void VSIFReadAsyncL(VSILFILE *fp, void *pBuffer, size_t nSize,
+                    vsi_l_offset nOffset, VSIAsyncReadCallback pfnCallback,
+                    void *pUserData)
+{
+    fp->ReadAsync(pBuffer, nSize, nOffset,
+                  [pfnCallback, pUserData](size_t nBytesRead)
+                  { pfnCallback(nBytesRead, pUserData); });
+}
+
 /************************************************************************/
 /*                             VSIFWriteL()                             */
 /************************************************************************/
@@ -4215,6 +4605,44 @@ void VSIFileManager::RemoveHandler(const std::string &osPrefix)
         Get()->oHandlers.erase(osPrefix);
 }
 
+/************************************************************************/
+/*                      VSIGetAsyncReadThreadPool()                     */
+/************************************************************************/
+
+static std::mutex goAsyncReadThreadPoolMutex;
+static std::unique_ptr<CPLWorkerThreadPool> gpoAsyncReadThreadPool;
+
+/** Return the thread pool used by the default implementation of
+ * VSIVirtualHandle::ReadAsync(), or nullptr if it cannot be created.
+ */
+static CPLWorkerThreadPool *VSIGetAsyncReadThreadPool()
+{
+    std::lock_guard<std::mutex> oLock(goAsyncReadThreadPoolMutex);
+    if (!gpoAsyncReadThreadPool)
+    {
+        const char *pszThreads =
+            CPLGetConfigOption("CPL_VSIL_ASYNC_READ_NUM_THREADS", "ALL_CPUS");
+        const int nThreads = std::max(
+            1, EQUAL(pszThreads, "ALL_CPUS") ? CPLGetNumCPUs()
+                                             : atoi(pszThreads));
+        auto poPool = std::make_unique<CPLWorkerThreadPool>();
+        if (!poPool->Setup(nThreads, nullptr, nullptr))
+            return nullptr;
+        gpoAsyncReadThreadPool = std::move(poPool);
+    }
+    return gpoAsyncReadThreadPool.get();
+}
+
+/************************************************************************/
+/*                   VSIDestroyAsyncReadThreadPool()                    */
+/************************************************************************/
+
+static void VSIDestroyAsyncReadThreadPool()
+{
+    std::lock_guard<std::mutex> oLock(goAsyncReadThreadPoolMutex);
+    gpoAsyncReadThreadPool.reset();
+}
+
 /************************************************************************/
 /*                       VSICleanupFileManager()                        */
 /************************************************************************/
@@ -4222,6 +4650,8 @@ void VSIFileManager::RemoveHandler(const std::string &osPrefix)
 void VSICleanupFileManager()
 
 {
+    VSIDestroyAsyncReadThreadPool();
+
     if (poManager)
     {
         delete poManager;
@@ -4345,3 +4775,83 @@ size_t VSIVirtualHandle::PRead(CPL_UNUSED void *pBuffer,
 {
     return 0;
 }
+
+/************************************************************************/
+/*                             ReadAsync()                              */
+/************************************************************************/
+
+/** Start an asynchronous read operation.
+ *
+ * This methods reads into pBuffer up to nSize bytes starting at offset nOffset
+ * in the file, without waiting for the data to be available. The current file
+ * offset is not affected by this method.
+ *
+ * When the read completes, the callback, if not null, is called with the
+ * number of bytes read, possibly from another thread than the calling one,
+ * and then the returned future becomes ready with that same value. That
+ * number is less than nSize at end of file or in case of error.
+ *
+ * pBuffer must remain valid, and the handle must not be closed, until the
+ * read has completed. Several asynchronous reads may be pending at the same
+ * time on the same handle.
+ *
+ * The default implementation issues PRead() calls from a thread pool, whose
+ * size is controlled by the CPL_VSIL_ASYNC_READ_NUM_THREADS configuration
+ * option, when HasPRead() is true. Otherwise it reads synchronously,
+ * restoring the current file offset afterwards, and returns a ready future.
+ * /vsimem/ serves the read synchronously, and /vsicurl/ and related file
+ * systems run all pending reads of a handle concurrently from a single
+ * thread.
+ *
+ * @param pBuffer output buffer (must be at least nSize bytes large).
+ * @param nSize   number of bytes to read in the file.
+ * @param nOffset file offset from which to read.
+ * @param cbk     callback called on completion, or nullptr.
+ * @return a future of the number of bytes read.
+ * @since GDAL 3.12
+ */
+std::future<size_t> VSIVirtualHandle::ReadAsync(void *pBuffer, size_t nSize,
+                                                vsi_l_offset nOffset,
+                                                AsyncReadCallback cbk)
+{
+    auto poPromise = std::make_shared<std::promise<size_t>>();
+    auto oFuture = poPromise->get_future();
+
+    if (HasPRead())
+    {
+        auto poPool = VSIGetAsyncReadThreadPool();
+        if (poPool &&
+            poPool->SubmitJob(
+                [this, pBuffer, nSize, nOffset, cbk, poPromise]()
+                {
+                    size_t nRead = PRead(pBuffer, nSize, nOffset);
+                    if (nRead > nSize)  // error
+                        nRead = 0;
+                    if (cbk)
+                        cbk(nRead);
+                    poPromise->set_value(nRead);
+                }))
+        {
+            return oFuture;
+        }
+    }
+
+    size_t nRead = 0;
+    if (HasPRead())
+    {
+        nRead = PRead(pBuffer, nSize, nOffset);
+        if (nRead > nSize)  // error
+            nRead = 0;
+    }
+    else
+    {
+        const vsi_l_offset nCurOffset = Tell();
+        if (Seek(nOffset, SEEK_SET) == 0)
+            nRead = Read(pBuffer, 1, nSize);
+        Seek(nCurOffset, SEEK_SET);
+    }
+    if (cbk)
+        cbk(nRead);
+    poPromise->set_value(nRead);
+    return oFuture;
+}
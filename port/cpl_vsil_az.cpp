@@ -2419,7 +2419,10 @@ const char *VSIAzureFSHandler::GetOptions()
         "description='Whether to disable signing of requests' default='NO'/>"
         "  <Option name='VSIAZ_CHUNK_SIZE' type='int' "
         "description='Size in MB for chunks of files that are uploaded' "
-        "default='4' min='1' max='4'/>" +
+        "default='4' min='1' max='4'/>"
+        "  <Option name='CPL_VSIL_UPLOAD_NUM_THREADS' type='string' "
+        "description='Number of blocks uploaded in parallel when "
+        "BLOB_TYPE=BLOCK. Either an integer or ALL_CPUS' default='1'/>" +
         VSICurlFilesystemHandlerBase::GetOptionsStatic() + "</Options>");
     return osOptions.c_str();
 }
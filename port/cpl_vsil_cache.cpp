@@ -104,6 +104,13 @@ class VSICachedFile final : public VSIVirtualHandle
     {
         return m_poBase->PRead(pBuffer, nSize, nOffset);
     }
+
+    std::future<size_t> ReadAsync(void *pBuffer, size_t nSize,
+                                  vsi_l_offset nOffset,
+                                  AsyncReadCallback cbk) override
+    {
+        return m_poBase->ReadAsync(pBuffer, nSize, nOffset, std::move(cbk));
+    }
 };
 
 /************************************************************************/
@@ -501,7 +501,42 @@ VSICurlHandle::VSICurlHandle(VSICurlFilesystemHandlerBase *poFSIn,
     }
 
     m_bCached = poFSIn->AllowCachedDataFor(pszFilename);
-    poFS->GetCachedFileProp(m_pszURL, oFileProp);
+    m_bPersistentMetadataCache =
+        poFSIn->AllowPersistentMetadataCacheFor(pszFilename);
+    // Properties only known from a directory listing may lack the file size,
+    // that a HEAD request issued by another process may have retrieved.
+    FileProp oPersistentFileProp;
+    if ((!poFS->GetCachedFileProp(m_pszURL, oFileProp) ||
+         !oFileProp.bHasComputedFileSize) &&
+        m_bPersistentMetadataCache &&
+        VSICurlPersistentMetadataCacheGetFileProp(m_pszURL,
+                                                  oPersistentFileProp))
+    {
+        oFileProp = oPersistentFileProp;
+        poFS->SetCachedFileProp(m_pszURL, oFileProp);
+    }
+
+    m_bReadAhead = CPLTestBool(VSIGetPathSpecificOption(
+        pszFilename, "CPL_VSIL_CURL_READ_AHEAD", "NO"));
+    if (m_bReadAhead)
+    {
+        // Round the chunk size to a multiple of the download chunk size, so
+        // that read-ahead chunks can be split into cached regions
+        const size_t knDOWNLOAD_CHUNK_SIZE = VSICURLGetDownloadChunkSize();
+        const char *pszChunkSize = VSIGetPathSpecificOption(
+            pszFilename, "CPL_VSIL_CURL_READ_AHEAD_CHUNK_SIZE", "2097152");
+        const size_t nChunkSize =
+            static_cast<size_t>(std::min<unsigned long long>(
+                1024 * 1024 * 1024, std::strtoull(pszChunkSize, nullptr, 10)));
+        m_nReadAheadChunkSize =
+            std::max<size_t>(1, (nChunkSize + knDOWNLOAD_CHUNK_SIZE - 1) /
+                                    knDOWNLOAD_CHUNK_SIZE) *
+            knDOWNLOAD_CHUNK_SIZE;
+        m_nReadAheadMaxChunks = std::max(
+            1, atoi(VSIGetPathSpecificOption(
+                   pszFilename, "CPL_VSIL_CURL_READ_AHEAD_MAX_CHUNKS", "8")));
+        m_nReadAheadChunks = std::min(2, m_nReadAheadMaxChunks);
+    }
 }
 
 /************************************************************************/
@@ -510,6 +545,9 @@ VSICurlHandle::VSICurlHandle(VSICurlFilesystemHandlerBase *poFSIn,
 
 VSICurlHandle::~VSICurlHandle()
 {
+    StopAsyncRead();
+    StopReadAhead();
+
     if (m_oThreadAdviseRead.joinable())
     {
         m_oThreadAdviseRead.join();
@@ -591,6 +629,21 @@ int VSICurlHandle::Seek(vsi_l_offset nOffset, int nWhence)
         curOffset = GetFileSize(false) + nOffset;
     }
     bEOF = false;
+
+    if (m_bReadAhead)
+    {
+        // Cancel the read-ahead if we are seeking outside of its window
+        bool bCancel = false;
+        {
+            std::lock_guard<std::mutex> oLock(m_oMutexReadAhead);
+            bCancel = !m_aoReadAheadChunks.empty() &&
+                      (curOffset < m_aoReadAheadChunks.front()->nStartOffset ||
+                       curOffset > m_nReadAheadNextOffset);
+        }
+        if (bCancel)
+            CancelReadAhead();
+    }
+
     return 0;
 }
 
@@ -1633,6 +1686,8 @@ retry:
     if (mtime > 0)
         oFileProp.mTime = mtime;
     poFS->SetCachedFileProp(m_pszURL, oFileProp);
+    if (m_bPersistentMetadataCache)
+        VSICurlPersistentMetadataCachePutFileProp(m_pszURL, oFileProp);
 
     return oFileProp.fileSize;
 }
@@ -2138,6 +2193,13 @@ retry:
         return std::string();
     }
 
+    poFS->UpdateTransferModel(osURL, {hCurlHandle}, sWriteFuncData.nSize);
+
+    // Must be done before the parsing of Content-Range below, that alters
+    // the header buffer.
+    const bool bStoreInPersistentCache =
+        CanStoreInPersistentCache(sWriteFuncHeaderData.pBuffer, oFileProp);
+
     if (!oFileProp.bHasComputedFileSize && sWriteFuncHeaderData.pBuffer)
     {
         // Try to retrieve the filesize from the HTTP headers
@@ -2202,7 +2264,7 @@ retry:
     }
 
     DownloadRegionPostProcess(startOffset, nBlocks, sWriteFuncData.pBuffer,
-                              sWriteFuncData.nSize);
+                              sWriteFuncData.nSize, bStoreInPersistentCache);
 
     std::string osRet;
     osRet.assign(sWriteFuncData.pBuffer, sWriteFuncData.nSize);
@@ -2274,7 +2336,8 @@ void VSICurlHandle::UpdateRedirectInfo(
 
 void VSICurlHandle::DownloadRegionPostProcess(const vsi_l_offset startOffset,
                                               const int nBlocks,
-                                              const char *pBuffer, size_t nSize)
+                                              const char *pBuffer, size_t nSize,
+                                              bool bStoreInPersistentCache)
 {
     const int knDOWNLOAD_CHUNK_SIZE = VSICURLGetDownloadChunkSize();
     lastDownloadedOffset = startOffset + static_cast<vsi_l_offset>(nBlocks) *
@@ -2303,12 +2366,192 @@ void VSICurlHandle::DownloadRegionPostProcess(const vsi_l_offset startOffset,
         const size_t nChunkSize =
             std::min(static_cast<size_t>(knDOWNLOAD_CHUNK_SIZE), nSize);
         poFS->AddRegion(m_pszURL, l_startOffset, nChunkSize, pBuffer);
+        if (bStoreInPersistentCache)
+            VSICurlPersistentCachePut(m_pszURL, oFileProp, l_startOffset,
+                                      pBuffer, nChunkSize);
         l_startOffset += nChunkSize;
         pBuffer += nChunkSize;
         nSize -= nChunkSize;
     }
 }
 
+/************************************************************************/
+/*                          GetRangeFromCache()                         */
+/************************************************************************/
+
+// When the persistent cache is enabled, or bUseRegionCache is set, copy
+// [nOffset, nOffset + nSize[ into pBuffer from the chunks of the in-memory
+// region cache or of the persistent cache (if enabled), if all of them are
+// available. Chunks found in the persistent cache are added to the region
+// cache. If pBuffer is null, only make sure that the chunks are in the region
+// cache.
+// This is used by ReadMultiRange(), PRead(), AdviseRead() and ReadAsync(),
+// which download arbitrary ranges, whereas Read() works at the chunk level.
+bool VSICurlHandle::GetRangeFromCache(void *pBuffer, size_t nSize,
+                                      vsi_l_offset nOffset,
+                                      bool bUseRegionCache) const
+{
+    const bool bUsePersistentCache =
+        m_bCached && VSICurlPersistentCacheIsEnabled();
+    FileProp oCachedFileProp;
+    if (nSize == 0 || (!bUsePersistentCache && !bUseRegionCache) ||
+        !poFS->GetCachedFileProp(m_pszURL, oCachedFileProp) ||
+        !oCachedFileProp.bHasComputedFileSize ||
+        nOffset + nSize > oCachedFileProp.fileSize)
+    {
+        return false;
+    }
+
+    const int knDOWNLOAD_CHUNK_SIZE = VSICURLGetDownloadChunkSize();
+    const vsi_l_offset nEndOffset = nOffset + nSize;
+    vsi_l_offset nChunkOffset =
+        (nOffset / knDOWNLOAD_CHUNK_SIZE) * knDOWNLOAD_CHUNK_SIZE;
+    for (; nChunkOffset < nEndOffset; nChunkOffset += knDOWNLOAD_CHUNK_SIZE)
+    {
+        std::shared_ptr<std::string> psRegion =
+            poFS->GetRegion(m_pszURL, nChunkOffset);
+        if (psRegion == nullptr)
+        {
+            std::string osRegion;
+            if (!bUsePersistentCache ||
+                !VSICurlPersistentCacheGet(m_pszURL, oCachedFileProp,
+                                           nChunkOffset, osRegion))
+            {
+                return false;
+            }
+            poFS->AddRegion(m_pszURL, nChunkOffset, osRegion.size(),
+                            osRegion.data());
+            psRegion = std::make_shared<std::string>(std::move(osRegion));
+        }
+        const vsi_l_offset nCopyStart = std::max(nOffset, nChunkOffset);
+        const vsi_l_offset nCopyEnd = std::min(
+            nEndOffset, nChunkOffset + knDOWNLOAD_CHUNK_SIZE);
+        if (nCopyEnd > nChunkOffset + psRegion->size())
+            return false;
+        if (pBuffer)
+        {
+            memcpy(static_cast<GByte *>(pBuffer) + (nCopyStart - nOffset),
+                   psRegion->data() + (nCopyStart - nChunkOffset),
+                   static_cast<size_t>(nCopyEnd - nCopyStart));
+        }
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                     CanStoreInPersistentCache()                      */
+/************************************************************************/
+
+// Whether content downloaded by a GET request, whose response headers are
+// pszHeaders, can be stored into the persistent cache with oRefFileProp as
+// the validator of the remote object. The ETag, Last-Modified and total size
+// (from Content-Range) of the response must match it: otherwise the remote
+// object has been modified since its properties were retrieved, and its
+// cached properties are invalidated.
+bool VSICurlHandle::CanStoreInPersistentCache(
+    const char *pszHeaders, const FileProp &oRefFileProp) const
+{
+    if (!m_bCached || !VSICurlPersistentCacheIsEnabled())
+        return false;
+    if (pszHeaders == nullptr)
+        return true;
+
+    bool bMatch = true;
+    const CPLStringList aosHeaders(CSLTokenizeString2(pszHeaders, "\r\n", 0));
+    for (const char *pszHeader : aosHeaders)
+    {
+        // Only consider the last response, when redirections are followed
+        if (STARTS_WITH_CI(pszHeader, "HTTP/"))
+        {
+            bMatch = true;
+            continue;
+        }
+        char *pszKey = nullptr;
+        const char *pszValue = CPLParseNameValue(pszHeader, &pszKey);
+        if (pszKey && pszValue)
+        {
+            if (EQUAL(pszKey, "ETag"))
+            {
+                std::string osValue(pszValue);
+                if (osValue.size() >= 2 && osValue.front() == '"' &&
+                    osValue.back() == '"')
+                    osValue = osValue.substr(1, osValue.size() - 2);
+                if (!oRefFileProp.ETag.empty() && osValue != oRefFileProp.ETag)
+                    bMatch = false;
+            }
+            else if (EQUAL(pszKey, "Last-Modified") &&
+                     oRefFileProp.ETag.empty() && oRefFileProp.mTime > 0)
+            {
+                const GIntBig nMTime =
+                    VSICurlGetTimeStampFromRFC822DateTime(pszValue);
+                if (nMTime > 0 &&
+                    nMTime != static_cast<GIntBig>(oRefFileProp.mTime))
+                    bMatch = false;
+            }
+            else if (EQUAL(pszKey, "Content-Range") &&
+                     oRefFileProp.bHasComputedFileSize)
+            {
+                const char *pszSlash = strchr(pszValue, '/');
+                if (pszSlash && pszSlash[1] != '*' &&
+                    CPLScanUIntBig(pszSlash + 1,
+                                   static_cast<int>(strlen(pszSlash + 1))) !=
+                        oRefFileProp.fileSize)
+                    bMatch = false;
+            }
+        }
+        CPLFree(pszKey);
+    }
+
+    if (!bMatch)
+    {
+        CPLDebug(poFS->GetDebugKey(),
+                 "%s has been modified since its properties were retrieved. "
+                 "Not storing it in the persistent cache",
+                 m_pszURL);
+        poFS->InvalidateCachedData(m_pszURL);
+    }
+    return bMatch;
+}
+
+/************************************************************************/
+/*                      PutRangeInPersistentCache()                     */
+/************************************************************************/
+
+// Store the chunks entirely contained in the downloaded range
+// [nOffset, nOffset + nSize[ into the persistent cache, if enabled and if
+// the response headers pszHeaders match the cached properties.
+void VSICurlHandle::PutRangeInPersistentCache(const void *pData, size_t nSize,
+                                              vsi_l_offset nOffset,
+                                              const char *pszHeaders) const
+{
+    FileProp oCachedFileProp;
+    if (!m_bCached || !VSICurlPersistentCacheIsEnabled() ||
+        !poFS->GetCachedFileProp(m_pszURL, oCachedFileProp) ||
+        !oCachedFileProp.bHasComputedFileSize ||
+        !CanStoreInPersistentCache(pszHeaders, oCachedFileProp))
+    {
+        return;
+    }
+
+    const int knDOWNLOAD_CHUNK_SIZE = VSICURLGetDownloadChunkSize();
+    const vsi_l_offset nEndOffset = nOffset + nSize;
+    vsi_l_offset nChunkOffset =
+        ((nOffset + knDOWNLOAD_CHUNK_SIZE - 1) / knDOWNLOAD_CHUNK_SIZE) *
+        knDOWNLOAD_CHUNK_SIZE;
+    for (; nChunkOffset < nEndOffset; nChunkOffset += knDOWNLOAD_CHUNK_SIZE)
+    {
+        const vsi_l_offset nChunkEnd =
+            std::min(oCachedFileProp.fileSize,
+                     nChunkOffset + knDOWNLOAD_CHUNK_SIZE);
+        if (nChunkEnd > nEndOffset || nChunkEnd <= nChunkOffset)
+            break;
+        VSICurlPersistentCachePut(
+            m_pszURL, oCachedFileProp, nChunkOffset,
+            static_cast<const char *>(pData) + (nChunkOffset - nOffset),
+            static_cast<size_t>(nChunkEnd - nChunkOffset));
+    }
+}
+
 /************************************************************************/
 /*                                Read()                                */
 /************************************************************************/
@@ -2359,6 +2602,18 @@ size_t VSICurlHandle::Read(void *const pBufferIn, size_t const nSize,
         {
             osRegion = *psRegion;
         }
+        else if (m_bCached &&
+                 VSICurlPersistentCacheGet(m_pszURL, oFileProp,
+                                           nOffsetToDownload, osRegion))
+        {
+            poFS->AddRegion(m_pszURL, nOffsetToDownload, osRegion.size(),
+                            osRegion.data());
+        }
+        else if (m_bReadAhead &&
+                 GetReadAheadRegion(nOffsetToDownload, osRegion))
+        {
+            // Served by the read-ahead
+        }
         else
         {
             if (nOffsetToDownload == lastDownloadedOffset)
@@ -2455,253 +2710,771 @@ size_t VSICurlHandle::Read(void *const pBufferIn, size_t const nSize,
     return ret;
 }
 
+static CURLM *VSICURLMultiInit();
+
 /************************************************************************/
-/*                           ReadMultiRange()                           */
+/*                          ~ReadAheadChunk()                           */
 /************************************************************************/
 
-int VSICurlHandle::ReadMultiRange(int const nRanges, void **const ppData,
-                                  const vsi_l_offset *const panOffsets,
-                                  const size_t *const panSizes)
+VSICurlHandle::ReadAheadChunk::~ReadAheadChunk()
 {
-    if (bInterrupted && bStopOnInterruptUntilUninstall)
-        return FALSE;
+    if (hCurlHandle)
+    {
+        VSICURLResetHeaderAndWriterFunctions(hCurlHandle);
+        curl_easy_cleanup(hCurlHandle);
+    }
+    if (psHeaders)
+        curl_slist_free_all(psHeaders);
+    CPLFree(sWriteFuncData.pBuffer);
+    CPLFree(sWriteFuncHeaderData.pBuffer);
+}
 
-    poFS->GetCachedFileProp(m_pszURL, oFileProp);
-    if (oFileProp.eExists == EXIST_NO)
-        return -1;
+/************************************************************************/
+/*                          StartReadAhead()                            */
+/************************************************************************/
 
-    NetworkStatisticsFileSystem oContextFS(poFS->GetFSPrefix().c_str());
-    NetworkStatisticsFile oContextFile(m_osFilename.c_str());
-    NetworkStatisticsAction oContextAction("ReadMultiRange");
+/** Start reading ahead, in a background thread, chunks from nOffset.
+ *
+ * Must be called when no chunk is pending.
+ */
+void VSICurlHandle::StartReadAhead(vsi_l_offset nOffset)
+{
+    if (!m_hCurlMultiHandleForReadAhead)
+    {
+        m_hCurlMultiHandleForReadAhead = VSICURLMultiInit();
+#ifdef CURLPIPE_MULTIPLEX
+        if (CPLTestBool(CPLGetConfigOption("GDAL_HTTP_MULTIPLEX", "YES")))
+        {
+            curl_multi_setopt(m_hCurlMultiHandleForReadAhead,
+                              CURLMOPT_PIPELINING, CURLPIPE_MULTIPLEX);
+        }
+#endif
+    }
 
-    const char *pszMultiRangeStrategy =
-        CPLGetConfigOption("GDAL_HTTP_MULTIRANGE", "");
-    if (EQUAL(pszMultiRangeStrategy, "SINGLE_GET"))
     {
-        // Just in case someone needs it, but the interest of this mode is
-        // rather dubious now. We could probably remove it
-        return ReadMultiRangeSingleGet(nRanges, ppData, panOffsets, panSizes);
+        std::lock_guard<std::mutex> oLock(m_oMutexReadAhead);
+        CPLAssert(m_aoReadAheadChunks.empty());
+        m_nReadAheadNextOffset = nOffset;
     }
-    else if (nRanges == 1 || EQUAL(pszMultiRangeStrategy, "SERIAL"))
+
+    if (!m_oThreadReadAhead.joinable())
     {
-        return VSIVirtualHandle::ReadMultiRange(nRanges, ppData, panOffsets,
-                                                panSizes);
+        m_oThreadReadAhead = std::thread([this]() { ReadAheadThreadFunc(); });
     }
 
+    ScheduleReadAheadChunks();
+}
+
+/************************************************************************/
+/*                      ScheduleReadAheadChunks()                       */
+/************************************************************************/
+
+/** Queue new chunks after the last pending one, so that there are
+ * m_nReadAheadChunks of them ahead of the current position.
+ *
+ * The curl handles of the chunks are set up in the calling thread, so that
+ * the read-ahead thread does not need to call the (possibly not thread-safe)
+ * virtual methods that compute authentication headers.
+ */
+void VSICurlHandle::ScheduleReadAheadChunks()
+{
     UpdateQueryString();
 
     bool bHasExpired = false;
-
     CPLStringList aosHTTPOptions(m_aosHTTPOptions);
-    std::string osURL(GetRedirectURLIfValid(bHasExpired, aosHTTPOptions));
+    const std::string osURL(GetRedirectURLIfValid(bHasExpired, aosHTTPOptions));
     if (bHasExpired)
-    {
-        return VSIVirtualHandle::ReadMultiRange(nRanges, ppData, panOffsets,
-                                                panSizes);
-    }
+        return;
 
-    CURLM *hMultiHandle = poFS->GetCurlMultiHandleFor(osURL);
-#ifdef CURLPIPE_MULTIPLEX
-    // Enable HTTP/2 multiplexing (ignored if an older version of HTTP is
-    // used)
-    // Not that this does not enable HTTP/1.1 pipeling, which is not
-    // recommended for example by Google Cloud Storage.
-    // For HTTP/1.1, parallel connections work better since you can get
-    // results out of order.
-    if (CPLTestBool(CPLGetConfigOption("GDAL_HTTP_MULTIPLEX", "YES")))
+    size_t nPendingChunks = 0;
+    vsi_l_offset nNextOffset = 0;
+    int nChunks = 0;
     {
-        curl_multi_setopt(hMultiHandle, CURLMOPT_PIPELINING,
-                          CURLPIPE_MULTIPLEX);
+        std::lock_guard<std::mutex> oLock(m_oMutexReadAhead);
+        nPendingChunks = m_aoReadAheadChunks.size();
+        nNextOffset = m_nReadAheadNextOffset;
+        nChunks = m_nReadAheadChunks;
     }
-#endif
-
-    std::vector<CURL *> aHandles;
-    std::vector<WriteFuncStruct> asWriteFuncData(nRanges);
-    std::vector<WriteFuncStruct> asWriteFuncHeaderData(nRanges);
-    std::vector<char *> apszRanges;
-    std::vector<struct curl_slist *> aHeaders;
 
-    struct CurlErrBuffer
+    // Make sure to have enough requests in flight to cover the
+    // bandwidth-delay product of the connection.
+    const auto oModel = poFS->GetTransferModel(osURL);
+    if (oModel.dfBandwidth > 0)
     {
-        std::array<char, CURL_ERROR_SIZE + 1> szCurlErrBuf;
-    };
-
-    std::vector<CurlErrBuffer> asCurlErrors(nRanges);
+        const double dfBandwidthDelayProduct =
+            oModel.dfLatency * oModel.dfBandwidth;
+        nChunks = std::max(
+            nChunks,
+            1 + static_cast<int>(std::min(
+                    static_cast<double>(m_nReadAheadMaxChunks),
+                    std::ceil(dfBandwidthDelayProduct /
+                              static_cast<double>(m_nReadAheadChunkSize)))));
+    }
+    nChunks = std::min(nChunks, m_nReadAheadMaxChunks);
 
-    const bool bMergeConsecutiveRanges = CPLTestBool(
-        CPLGetConfigOption("GDAL_HTTP_MERGE_CONSECUTIVE_RANGES", "TRUE"));
+    const bool bMultiplex =
+        CPLTestBool(CPLGetConfigOption("GDAL_HTTP_MULTIPLEX", "YES"));
 
-    for (int i = 0, iRequest = 0; i < nRanges;)
+    std::vector<std::shared_ptr<ReadAheadChunk>> apoNewChunks;
+    while (nPendingChunks + apoNewChunks.size() <
+           static_cast<size_t>(nChunks))
     {
-        size_t nSize = 0;
-        int iNext = i;
-        // Identify consecutive ranges
-        while (bMergeConsecutiveRanges && iNext + 1 < nRanges &&
-               panOffsets[iNext] + panSizes[iNext] == panOffsets[iNext + 1])
+        poFS->GetCachedFileProp(m_pszURL, oFileProp);
+        if (oFileProp.bHasComputedFileSize &&
+            nNextOffset >= oFileProp.fileSize)
         {
-            nSize += panSizes[iNext];
-            iNext++;
+            break;
         }
-        nSize += panSizes[iNext];
 
-        if (nSize == 0)
+        auto poChunk = std::make_shared<ReadAheadChunk>();
+        poChunk->nStartOffset = nNextOffset;
+        poChunk->nSize = m_nReadAheadChunkSize;
+        if (oFileProp.bHasComputedFileSize &&
+            oFileProp.fileSize - nNextOffset < poChunk->nSize)
         {
-            i = iNext + 1;
-            continue;
+            poChunk->nSize =
+                static_cast<size_t>(oFileProp.fileSize - nNextOffset);
         }
 
         CURL *hCurlHandle = curl_easy_init();
-        aHandles.push_back(hCurlHandle);
-
-        // As the multi-range request is likely not the first one, we don't
-        // need to wait as we already know if pipelining is possible
-        // unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_PIPEWAIT, 1);
-
+        poChunk->hCurlHandle = hCurlHandle;
         struct curl_slist *headers = VSICurlSetOptions(
             hCurlHandle, osURL.c_str(), aosHTTPOptions.List());
 
-        VSICURLInitWriteFuncStruct(&asWriteFuncData[iRequest], this, pfnReadCbk,
-                                   pReadCbkUserData);
+        // Share a single HTTP/2 connection between all requests
+        if (bMultiplex)
+            unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_PIPEWAIT, 1);
+
+        VSICURLInitWriteFuncStruct(&poChunk->sWriteFuncData, nullptr, nullptr,
+                                   nullptr);
         unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_WRITEDATA,
-                                   &asWriteFuncData[iRequest]);
+                                   &poChunk->sWriteFuncData);
         unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_WRITEFUNCTION,
                                    VSICurlHandleWriteFunc);
 
-        VSICURLInitWriteFuncStruct(&asWriteFuncHeaderData[iRequest], nullptr,
+        VSICURLInitWriteFuncStruct(&poChunk->sWriteFuncHeaderData, nullptr,
                                    nullptr, nullptr);
         unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_HEADERDATA,
-                                   &asWriteFuncHeaderData[iRequest]);
+                                   &poChunk->sWriteFuncHeaderData);
         unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_HEADERFUNCTION,
                                    VSICurlHandleWriteFunc);
-        asWriteFuncHeaderData[iRequest].bIsHTTP = STARTS_WITH(m_pszURL, "http");
-        asWriteFuncHeaderData[iRequest].nStartOffset = panOffsets[i];
-
-        asWriteFuncHeaderData[iRequest].nEndOffset = panOffsets[i] + nSize - 1;
+        poChunk->sWriteFuncHeaderData.bIsHTTP = STARTS_WITH(m_pszURL, "http");
+        poChunk->sWriteFuncHeaderData.nStartOffset = poChunk->nStartOffset;
+        poChunk->sWriteFuncHeaderData.nEndOffset =
+            poChunk->nStartOffset + poChunk->nSize - 1;
 
         char rangeStr[512] = {};
         snprintf(rangeStr, sizeof(rangeStr), CPL_FRMT_GUIB "-" CPL_FRMT_GUIB,
-                 asWriteFuncHeaderData[iRequest].nStartOffset,
-                 asWriteFuncHeaderData[iRequest].nEndOffset);
+                 poChunk->sWriteFuncHeaderData.nStartOffset,
+                 poChunk->sWriteFuncHeaderData.nEndOffset);
 
         if (ENABLE_DEBUG)
-            CPLDebug(poFS->GetDebugKey(), "Downloading %s (%s)...", rangeStr,
-                     osURL.c_str());
+            CPLDebug(poFS->GetDebugKey(), "Reading ahead %s (%s)...",
+                     rangeStr, osURL.c_str());
 
-        if (asWriteFuncHeaderData[iRequest].bIsHTTP)
+        if (poChunk->sWriteFuncHeaderData.bIsHTTP)
         {
             // So it gets included in Azure signature
-            char *pszRange = CPLStrdup(CPLSPrintf("Range: bytes=%s", rangeStr));
-            apszRanges.push_back(pszRange);
-            headers = curl_slist_append(headers, pszRange);
+            headers = curl_slist_append(
+                headers, CPLSPrintf("Range: bytes=%s", rangeStr));
             unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_RANGE, nullptr);
         }
         else
         {
-            apszRanges.push_back(nullptr);
             unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_RANGE, rangeStr);
         }
 
-        asCurlErrors[iRequest].szCurlErrBuf[0] = '\0';
-        unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_ERRORBUFFER,
-                                   &asCurlErrors[iRequest].szCurlErrBuf[0]);
-
         headers = VSICurlMergeHeaders(headers, GetCurlHeaders("GET", headers));
         unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_HTTPHEADER, headers);
-        aHeaders.push_back(headers);
-        curl_multi_add_handle(hMultiHandle, hCurlHandle);
+        poChunk->psHeaders = headers;
 
-        i = iNext + 1;
-        iRequest++;
+        nNextOffset += poChunk->nSize;
+        apoNewChunks.push_back(std::move(poChunk));
     }
 
-    if (!aHandles.empty())
+    poFS->UpdateReadAheadStatistics(m_osFilename, osURL, 0, 0, 0, 0, nChunks);
+
+    if (apoNewChunks.empty())
+        return;
+
     {
-        VSICURLMultiPerform(hMultiHandle);
+        std::lock_guard<std::mutex> oLock(m_oMutexReadAhead);
+        for (auto &poChunk : apoNewChunks)
+            m_aoReadAheadChunks.push_back(std::move(poChunk));
+        m_nReadAheadNextOffset = nNextOffset;
     }
+    m_oCVReadAhead.notify_all();
+    curl_multi_wakeup(m_hCurlMultiHandleForReadAhead);
+}
 
-    int nRet = 0;
-    size_t iReq = 0;
-    int iRange = 0;
-    size_t nTotalDownloaded = 0;
-    for (; iReq < aHandles.size(); iReq++, iRange++)
+/************************************************************************/
+/*                          CancelReadAhead()                           */
+/************************************************************************/
+
+/** Forget about pending chunks, and abort their in-flight requests */
+void VSICurlHandle::CancelReadAhead()
+{
     {
-        while (iRange < nRanges && panSizes[iRange] == 0)
-        {
-            iRange++;
-        }
-        if (iRange == nRanges)
-            break;
+        std::lock_guard<std::mutex> oLock(m_oMutexReadAhead);
+        for (auto &poChunk : m_aoReadAheadChunks)
+            poChunk->bCancelled = true;
+        m_aoReadAheadChunks.clear();
+    }
+    if (m_hCurlMultiHandleForReadAhead)
+        curl_multi_wakeup(m_hCurlMultiHandleForReadAhead);
+}
 
-        long response_code = 0;
-        curl_easy_getinfo(aHandles[iReq], CURLINFO_HTTP_CODE, &response_code);
+/************************************************************************/
+/*                           StopReadAhead()                            */
+/************************************************************************/
 
-        if (ENABLE_DEBUG && asCurlErrors[iRange].szCurlErrBuf[0] != '\0')
+void VSICurlHandle::StopReadAhead()
+{
+    if (m_oThreadReadAhead.joinable())
+    {
         {
-            char rangeStr[512] = {};
-            snprintf(rangeStr, sizeof(rangeStr),
-                     CPL_FRMT_GUIB "-" CPL_FRMT_GUIB,
-                     asWriteFuncHeaderData[iReq].nStartOffset,
-                     asWriteFuncHeaderData[iReq].nEndOffset);
-
-            const char *pszErrorMsg = &asCurlErrors[iRange].szCurlErrBuf[0];
-            CPLDebug(poFS->GetDebugKey(),
-                     "ReadMultiRange(%s), %s: response_code=%d, msg=%s",
-                     osURL.c_str(), rangeStr, static_cast<int>(response_code),
-                     pszErrorMsg);
+            std::lock_guard<std::mutex> oLock(m_oMutexReadAhead);
+            m_bReadAheadStop = true;
         }
+        m_oCVReadAhead.notify_all();
+        curl_multi_wakeup(m_hCurlMultiHandleForReadAhead);
+        m_oThreadReadAhead.join();
+    }
+    m_aoReadAheadChunks.clear();
+    if (m_hCurlMultiHandleForReadAhead)
+    {
+        curl_multi_cleanup(m_hCurlMultiHandleForReadAhead);
+        m_hCurlMultiHandleForReadAhead = nullptr;
+    }
+}
 
-        if ((response_code != 206 && response_code != 225) ||
-            asWriteFuncHeaderData[iReq].nEndOffset + 1 !=
-                asWriteFuncHeaderData[iReq].nStartOffset +
-                    asWriteFuncData[iReq].nSize)
+/************************************************************************/
+/*                        ReadAheadThreadFunc()                         */
+/************************************************************************/
+
+void VSICurlHandle::ReadAheadThreadFunc()
+{
+    NetworkStatisticsFileSystem oContextFS(poFS->GetFSPrefix().c_str());
+    NetworkStatisticsFile oContextFile(m_osFilename.c_str());
+    NetworkStatisticsAction oContextAction("ReadAhead");
+
+    CURLM *hCurlMultiHandle = m_hCurlMultiHandleForReadAhead;
+    std::vector<std::shared_ptr<ReadAheadChunk>> apoInFlight;
+    while (true)
+    {
         {
-            char rangeStr[512] = {};
-            snprintf(rangeStr, sizeof(rangeStr),
-                     CPL_FRMT_GUIB "-" CPL_FRMT_GUIB,
-                     asWriteFuncHeaderData[iReq].nStartOffset,
-                     asWriteFuncHeaderData[iReq].nEndOffset);
+            std::unique_lock<std::mutex> oLock(m_oMutexReadAhead);
 
-            CPLError(CE_Failure, CPLE_AppDefined,
-                     "Request for %s failed with response_code=%ld", rangeStr,
-                     response_code);
-            nRet = -1;
-        }
-        else if (nRet == 0)
-        {
-            size_t nOffset = 0;
-            size_t nRemainingSize = asWriteFuncData[iReq].nSize;
-            nTotalDownloaded += nRemainingSize;
-            CPLAssert(iRange < nRanges);
-            while (true)
+            // Abort requests of chunks that are no longer needed
+            int nCancelledRequests = 0;
+            for (auto oIter = apoInFlight.begin(); oIter != apoInFlight.end();)
             {
-                if (nRemainingSize < panSizes[iRange])
+                if ((*oIter)->bCancelled || m_bReadAheadStop)
                 {
-                    nRet = -1;
-                    break;
+                    curl_multi_remove_handle(hCurlMultiHandle,
+                                             (*oIter)->hCurlHandle);
+                    ++nCancelledRequests;
+                    oIter = apoInFlight.erase(oIter);
+                }
+                else
+                {
+                    ++oIter;
                 }
+            }
+            if (m_bReadAheadStop)
+                break;
 
-                if (panSizes[iRange] > 0)
+            // Issue requests for new chunks
+            int nNewRequests = 0;
+            for (const auto &poChunk : m_aoReadAheadChunks)
+            {
+                if (!poChunk->bInFlight && !poChunk->bDone)
                 {
-                    memcpy(ppData[iRange],
-                           asWriteFuncData[iReq].pBuffer + nOffset,
-                           panSizes[iRange]);
+                    poChunk->bInFlight = true;
+                    curl_multi_add_handle(hCurlMultiHandle,
+                                          poChunk->hCurlHandle);
+                    apoInFlight.push_back(poChunk);
+                    ++nNewRequests;
                 }
+            }
+
+            if (nNewRequests || nCancelledRequests)
+            {
+                poFS->UpdateReadAheadStatistics(m_osFilename, m_pszURL, 0, 0,
+                                                nNewRequests,
+                                                nCancelledRequests, 0);
+            }
+
+            if (apoInFlight.empty())
+            {
+                m_oCVReadAhead.wait(
+                    oLock,
+                    [this]()
+                    {
+                        return m_bReadAheadStop ||
+                               std::any_of(
+                                   m_aoReadAheadChunks.begin(),
+                                   m_aoReadAheadChunks.end(),
+                                   [](const std::shared_ptr<ReadAheadChunk>
+                                          &poChunk)
+                                   {
+                                       return !poChunk->bInFlight &&
+                                              !poChunk->bDone;
+                                   });
+                    });
+                continue;
+            }
+        }
+
+        int still_running = 0;
+        void *old_handler = CPLHTTPIgnoreSigPipe();
+        while (curl_multi_perform(hCurlMultiHandle, &still_running) ==
+               CURLM_CALL_MULTI_PERFORM)
+        {
+            // loop
+        }
+        CPLHTTPRestoreSigPipeHandler(old_handler);
+
+        CURLMsg *msg;
+        int msgq = 0;
+        while ((msg = curl_multi_info_read(hCurlMultiHandle, &msgq)) !=
+               nullptr)
+        {
+            if (msg->msg != CURLMSG_DONE)
+                continue;
+            CURL *hCurlHandle = msg->easy_handle;
+            auto oIter = std::find_if(
+                apoInFlight.begin(), apoInFlight.end(),
+                [hCurlHandle](const std::shared_ptr<ReadAheadChunk> &poChunk)
+                { return poChunk->hCurlHandle == hCurlHandle; });
+            if (oIter == apoInFlight.end())
+                continue;
+            auto poChunk = *oIter;
+            apoInFlight.erase(oIter);
+            curl_multi_remove_handle(hCurlMultiHandle, hCurlHandle);
+
+            long response_code = 0;
+            curl_easy_getinfo(hCurlHandle, CURLINFO_HTTP_CODE, &response_code);
+
+            auto &sWriteFuncData = poChunk->sWriteFuncData;
+            NetworkStatisticsLogger::LogGET(sWriteFuncData.nSize);
+
+            std::string osData;
+            std::string osHeaders;
+            if ((response_code == 206 || response_code == 225) &&
+                sWriteFuncData.nSize == poChunk->nSize)
+            {
+                osData.assign(sWriteFuncData.pBuffer, sWriteFuncData.nSize);
+                if (poChunk->sWriteFuncHeaderData.pBuffer)
+                    osHeaders = poChunk->sWriteFuncHeaderData.pBuffer;
+                poFS->UpdateTransferModel(m_pszURL, {hCurlHandle},
+                                          sWriteFuncData.nSize);
+            }
+            else
+            {
+                // The reader will fall back to a regular download
+                CPLDebug(poFS->GetDebugKey(),
+                         "Read-ahead request at offset " CPL_FRMT_GUIB
+                         " failed with response_code=%ld",
+                         poChunk->nStartOffset, response_code);
+            }
+            CPLFree(sWriteFuncData.pBuffer);
+            sWriteFuncData.pBuffer = nullptr;
+
+            {
+                std::lock_guard<std::mutex> oLock(m_oMutexReadAhead);
+                poChunk->osData = std::move(osData);
+                poChunk->osHeaders = std::move(osHeaders);
+                poChunk->bInFlight = false;
+                poChunk->bDone = true;
+            }
+            m_oCVReadAhead.notify_all();
+        }
+
+        if (!apoInFlight.empty())
+            curl_multi_poll(hCurlMultiHandle, nullptr, 0, 1000, nullptr);
+    }
+}
+
+/************************************************************************/
+/*                        GetReadAheadRegion()                          */
+/************************************************************************/
+
+/** Return the content of the download chunk at nOffset from the read-ahead
+ * chunks, waiting for it to be downloaded if needed.
+ *
+ * Read-ahead is started when nOffset immediately follows the previously
+ * downloaded region, and cancelled when nOffset is outside of the window of
+ * pending chunks.
+ */
+bool VSICurlHandle::GetReadAheadRegion(vsi_l_offset nOffset,
+                                       std::string &osRegion)
+{
+    // The read callback must see all downloaded data
+    if (pfnReadCbk)
+        return false;
+
+    bool bInWindow = false;
+    bool bHasPendingChunks = false;
+    {
+        std::lock_guard<std::mutex> oLock(m_oMutexReadAhead);
+        // Forget about chunks that have been consumed
+        while (!m_aoReadAheadChunks.empty() &&
+               m_aoReadAheadChunks.front()->nStartOffset +
+                       m_aoReadAheadChunks.front()->nSize <=
+                   nOffset)
+        {
+            m_aoReadAheadChunks.pop_front();
+        }
+        bHasPendingChunks = !m_aoReadAheadChunks.empty();
+        bInWindow = bHasPendingChunks &&
+                    nOffset >= m_aoReadAheadChunks.front()->nStartOffset;
+    }
+
+    const bool bStart = !bInWindow && nOffset == lastDownloadedOffset;
+    if (!bInWindow)
+    {
+        if (bHasPendingChunks)
+            CancelReadAhead();
+        if (bStart)
+            StartReadAhead(nOffset);
+    }
+
+    std::shared_ptr<ReadAheadChunk> poChunk;
+    {
+        std::unique_lock<std::mutex> oLock(m_oMutexReadAhead);
+        if (!m_aoReadAheadChunks.empty() &&
+            nOffset >= m_aoReadAheadChunks.front()->nStartOffset)
+        {
+            poChunk = m_aoReadAheadChunks.front();
+            bool bWaited = false;
+            while (!poChunk->bDone)
+            {
+                bWaited = true;
+                m_oCVReadAhead.wait(oLock);
+            }
 
-                if (bMergeConsecutiveRanges && iRange + 1 < nRanges &&
-                    panOffsets[iRange] + panSizes[iRange] ==
-                        panOffsets[iRange + 1])
+            // Adjust the number of chunks to read ahead: if we had to wait,
+            // the network is not fast enough to keep up with the reader.
+            // If all chunks are already downloaded, we are reading too far.
+            if (!bStart)
+            {
+                if (bWaited)
                 {
-                    nOffset += panSizes[iRange];
-                    nRemainingSize -= panSizes[iRange];
-                    iRange++;
+                    m_nReadAheadChunks =
+                        std::min(m_nReadAheadChunks + 1, m_nReadAheadMaxChunks);
                 }
-                else
+                else if (static_cast<int>(m_aoReadAheadChunks.size()) >=
+                             m_nReadAheadChunks &&
+                         std::all_of(
+                             m_aoReadAheadChunks.begin(),
+                             m_aoReadAheadChunks.end(),
+                             [](const std::shared_ptr<ReadAheadChunk> &poIter)
+                             { return poIter->bDone; }))
                 {
-                    break;
+                    m_nReadAheadChunks = std::max(m_nReadAheadChunks - 1, 1);
                 }
             }
         }
+    }
+
+    if (!poChunk || poChunk->osData.size() != poChunk->nSize)
+    {
+        if (poChunk)
+            CancelReadAhead();
+        poFS->UpdateReadAheadStatistics(m_osFilename, m_pszURL, 0, 1, 0, 0, 0);
+        return false;
+    }
+
+    const size_t nOffsetInChunk =
+        static_cast<size_t>(nOffset - poChunk->nStartOffset);
+    osRegion.assign(poChunk->osData.data() + nOffsetInChunk,
+                    std::min(static_cast<size_t>(VSICURLGetDownloadChunkSize()),
+                             poChunk->nSize - nOffsetInChunk));
+    DownloadRegionPostProcess(
+        nOffset, 1, osRegion.data(), osRegion.size(),
+        CanStoreInPersistentCache(poChunk->osHeaders.c_str(), oFileProp));
+    poFS->UpdateReadAheadStatistics(m_osFilename, m_pszURL, 1, 0, 0, 0, 0);
+
+    // Keep enough chunks ahead of the current position
+    ScheduleReadAheadChunks();
+
+    return true;
+}
+
+/************************************************************************/
+/*                           ReadMultiRange()                           */
+/************************************************************************/
+
+int VSICurlHandle::ReadMultiRange(int const nRanges, void **const ppData,
+                                  const vsi_l_offset *const panOffsets,
+                                  const size_t *const panSizes)
+{
+    if (bInterrupted && bStopOnInterruptUntilUninstall)
+        return FALSE;
+
+    poFS->GetCachedFileProp(m_pszURL, oFileProp);
+    if (oFileProp.eExists == EXIST_NO)
+        return -1;
 
+    NetworkStatisticsFileSystem oContextFS(poFS->GetFSPrefix().c_str());
+    NetworkStatisticsFile oContextFile(m_osFilename.c_str());
+    NetworkStatisticsAction oContextAction("ReadMultiRange");
+
+    const char *pszMultiRangeStrategy =
+        CPLGetConfigOption("GDAL_HTTP_MULTIRANGE", "");
+    if (EQUAL(pszMultiRangeStrategy, "SINGLE_GET"))
+    {
+        // Just in case someone needs it, but the interest of this mode is
+        // rather dubious now. We could probably remove it
+        return ReadMultiRangeSingleGet(nRanges, ppData, panOffsets, panSizes);
+    }
+    else if (nRanges == 1 || EQUAL(pszMultiRangeStrategy, "SERIAL"))
+    {
+        return VSIVirtualHandle::ReadMultiRange(nRanges, ppData, panOffsets,
+                                                panSizes);
+    }
+
+    UpdateQueryString();
+
+    bool bHasExpired = false;
+
+    CPLStringList aosHTTPOptions(m_aosHTTPOptions);
+    std::string osURL(GetRedirectURLIfValid(bHasExpired, aosHTTPOptions));
+    if (bHasExpired)
+    {
+        return VSIVirtualHandle::ReadMultiRange(nRanges, ppData, panOffsets,
+                                                panSizes);
+    }
+
+    CURLM *hMultiHandle = poFS->GetCurlMultiHandleFor(osURL);
+    bool bMultiplex = false;
+#ifdef CURLPIPE_MULTIPLEX
+    // Enable HTTP/2 multiplexing (ignored if an older version of HTTP is
+    // used)
+    // Not that this does not enable HTTP/1.1 pipeling, which is not
+    // recommended for example by Google Cloud Storage.
+    // For HTTP/1.1, parallel connections work better since you can get
+    // results out of order.
+    if (CPLTestBool(CPLGetConfigOption("GDAL_HTTP_MULTIPLEX", "YES")))
+    {
+        bMultiplex = true;
+        curl_multi_setopt(hMultiHandle, CURLMOPT_PIPELINING,
+                          CURLPIPE_MULTIPLEX);
+    }
+#endif
+
+    // Group ranges that are consecutive, or separated by less than
+    // GDAL_HTTP_MERGE_RANGES_MAX_GAP bytes, in a single request.
+    struct Request
+    {
+        vsi_l_offset nStartOffset = 0;
+        vsi_l_offset nEndOffset = 0;  // exclusive
+        std::vector<int> anRanges{};
+    };
+
+    std::vector<Request> aoRequests;
+
+    const bool bMergeConsecutiveRanges = CPLTestBool(
+        CPLGetConfigOption("GDAL_HTTP_MERGE_CONSECUTIVE_RANGES", "TRUE"));
+    const size_t nMaxGap =
+        bMergeConsecutiveRanges ? poFS->GetMaxRangeGap(osURL) : 0;
+
+    // Ranges available in the region cache or in the persistent cache are
+    // not downloaded
+    std::vector<int> anSortedRanges;
+    for (int i = 0; i < nRanges; ++i)
+    {
+        if (panSizes[i] > 0 &&
+            !GetRangeFromCache(ppData[i], panSizes[i], panOffsets[i]))
+        {
+            anSortedRanges.push_back(i);
+        }
+    }
+    if (anSortedRanges.empty())
+        return 0;
+    std::stable_sort(anSortedRanges.begin(), anSortedRanges.end(),
+                     [panOffsets](int a, int b)
+                     { return panOffsets[a] < panOffsets[b]; });
+    size_t nRequestedBytes = 0;
+    for (const int i : anSortedRanges)
+    {
+        nRequestedBytes += panSizes[i];
+        const vsi_l_offset nEndOffset = panOffsets[i] + panSizes[i];
+        if (!aoRequests.empty() &&
+            ((bMergeConsecutiveRanges &&
+              panOffsets[i] == aoRequests.back().nEndOffset) ||
+             (nMaxGap > 0 && panOffsets[i] <= aoRequests.back().nEndOffset +
+                                                  nMaxGap)))
+        {
+            auto &oRequest = aoRequests.back();
+            oRequest.nEndOffset = std::max(oRequest.nEndOffset, nEndOffset);
+            oRequest.anRanges.push_back(i);
+        }
+        else
+        {
+            Request oRequest;
+            oRequest.nStartOffset = panOffsets[i];
+            oRequest.nEndOffset = nEndOffset;
+            oRequest.anRanges.push_back(i);
+            aoRequests.push_back(std::move(oRequest));
+        }
+    }
+
+    const size_t nRequests = aoRequests.size();
+    std::vector<CURL *> aHandles;
+    std::vector<WriteFuncStruct> asWriteFuncData(nRequests);
+    std::vector<WriteFuncStruct> asWriteFuncHeaderData(nRequests);
+    std::vector<char *> apszRanges;
+    std::vector<struct curl_slist *> aHeaders;
+
+    struct CurlErrBuffer
+    {
+        std::array<char, CURL_ERROR_SIZE + 1> szCurlErrBuf;
+    };
+
+    std::vector<CurlErrBuffer> asCurlErrors(nRequests);
+
+    for (size_t iRequest = 0; iRequest < nRequests; ++iRequest)
+    {
+        const auto &oRequest = aoRequests[iRequest];
+
+        CURL *hCurlHandle = curl_easy_init();
+        aHandles.push_back(hCurlHandle);
+
+        // Wait for the connection to the host to be established, and its
+        // ability to multiplex to be known, rather than opening a new
+        // connection per range, so that all requests share a single HTTP/2
+        // connection.
+        if (bMultiplex)
+            unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_PIPEWAIT, 1);
+
+        struct curl_slist *headers = VSICurlSetOptions(
+            hCurlHandle, osURL.c_str(), aosHTTPOptions.List());
+
+        VSICURLInitWriteFuncStruct(&asWriteFuncData[iRequest], this, pfnReadCbk,
+                                   pReadCbkUserData);
+        unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_WRITEDATA,
+                                   &asWriteFuncData[iRequest]);
+        unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_WRITEFUNCTION,
+                                   VSICurlHandleWriteFunc);
+
+        VSICURLInitWriteFuncStruct(&asWriteFuncHeaderData[iRequest], nullptr,
+                                   nullptr, nullptr);
+        unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_HEADERDATA,
+                                   &asWriteFuncHeaderData[iRequest]);
+        unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_HEADERFUNCTION,
+                                   VSICurlHandleWriteFunc);
+        asWriteFuncHeaderData[iRequest].bIsHTTP = STARTS_WITH(m_pszURL, "http");
+        asWriteFuncHeaderData[iRequest].nStartOffset = oRequest.nStartOffset;
+
+        asWriteFuncHeaderData[iRequest].nEndOffset = oRequest.nEndOffset - 1;
+
+        char rangeStr[512] = {};
+        snprintf(rangeStr, sizeof(rangeStr), CPL_FRMT_GUIB "-" CPL_FRMT_GUIB,
+                 asWriteFuncHeaderData[iRequest].nStartOffset,
+                 asWriteFuncHeaderData[iRequest].nEndOffset);
+
+        if (ENABLE_DEBUG)
+            CPLDebug(poFS->GetDebugKey(), "Downloading %s (%s)...", rangeStr,
+                     osURL.c_str());
+
+        if (asWriteFuncHeaderData[iRequest].bIsHTTP)
+        {
+            // So it gets included in Azure signature
+            char *pszRange = CPLStrdup(CPLSPrintf("Range: bytes=%s", rangeStr));
+            apszRanges.push_back(pszRange);
+            headers = curl_slist_append(headers, pszRange);
+            unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_RANGE, nullptr);
+        }
+        else
+        {
+            apszRanges.push_back(nullptr);
+            unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_RANGE, rangeStr);
+        }
+
+        asCurlErrors[iRequest].szCurlErrBuf[0] = '\0';
+        unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_ERRORBUFFER,
+                                   &asCurlErrors[iRequest].szCurlErrBuf[0]);
+
+        headers = VSICurlMergeHeaders(headers, GetCurlHeaders("GET", headers));
+        unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_HTTPHEADER, headers);
+        aHeaders.push_back(headers);
+        curl_multi_add_handle(hMultiHandle, hCurlHandle);
+    }
+
+    poFS->StartMultiRangeRequests(m_osFilename, osURL, nRanges,
+                                  static_cast<int>(nRequests), nRequestedBytes);
+
+    if (!aHandles.empty())
+    {
+        VSICURLMultiPerform(hMultiHandle);
+    }
+
+    int nRet = 0;
+    size_t nTotalDownloaded = 0;
+    for (size_t iReq = 0; iReq < nRequests; iReq++)
+    {
+        long response_code = 0;
+        curl_easy_getinfo(aHandles[iReq], CURLINFO_HTTP_CODE, &response_code);
+
+        if (ENABLE_DEBUG && asCurlErrors[iReq].szCurlErrBuf[0] != '\0')
+        {
+            char rangeStr[512] = {};
+            snprintf(rangeStr, sizeof(rangeStr),
+                     CPL_FRMT_GUIB "-" CPL_FRMT_GUIB,
+                     asWriteFuncHeaderData[iReq].nStartOffset,
+                     asWriteFuncHeaderData[iReq].nEndOffset);
+
+            const char *pszErrorMsg = &asCurlErrors[iReq].szCurlErrBuf[0];
+            CPLDebug(poFS->GetDebugKey(),
+                     "ReadMultiRange(%s), %s: response_code=%d, msg=%s",
+                     osURL.c_str(), rangeStr, static_cast<int>(response_code),
+                     pszErrorMsg);
+        }
+
+        nTotalDownloaded += asWriteFuncData[iReq].nSize;
+
+        if ((response_code != 206 && response_code != 225) ||
+            asWriteFuncHeaderData[iReq].nEndOffset + 1 !=
+                asWriteFuncHeaderData[iReq].nStartOffset +
+                    asWriteFuncData[iReq].nSize)
+        {
+            char rangeStr[512] = {};
+            snprintf(rangeStr, sizeof(rangeStr),
+                     CPL_FRMT_GUIB "-" CPL_FRMT_GUIB,
+                     asWriteFuncHeaderData[iReq].nStartOffset,
+                     asWriteFuncHeaderData[iReq].nEndOffset);
+
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Request for %s failed with response_code=%ld", rangeStr,
+                     response_code);
+            nRet = -1;
+        }
+        else if (nRet == 0)
+        {
+            for (const int iRange : aoRequests[iReq].anRanges)
+            {
+                memcpy(ppData[iRange],
+                       asWriteFuncData[iReq].pBuffer +
+                           static_cast<size_t>(panOffsets[iRange] -
+                                               aoRequests[iReq].nStartOffset),
+                       panSizes[iRange]);
+            }
+            PutRangeInPersistentCache(asWriteFuncData[iReq].pBuffer,
+                                      asWriteFuncData[iReq].nSize,
+                                      aoRequests[iReq].nStartOffset,
+                                      asWriteFuncHeaderData[iReq].pBuffer);
+        }
+    }
+
+    if (nRet == 0 && !aHandles.empty())
+        poFS->UpdateTransferModel(osURL, aHandles, nTotalDownloaded);
+    poFS->EndMultiRangeRequests(m_osFilename, static_cast<int>(nRequests),
+                                nTotalDownloaded);
+
+    for (size_t iReq = 0; iReq < nRequests; iReq++)
+    {
         curl_multi_remove_handle(hMultiHandle, aHandles[iReq]);
         VSICURLResetHeaderAndWriterFunctions(aHandles[iReq]);
         curl_easy_cleanup(aHandles[iReq]);
@@ -3150,6 +3923,9 @@ size_t VSICurlHandle::PRead(void *pBuffer, size_t nSize,
     NetworkStatisticsFile oContextFile(m_osFilename.c_str());
     NetworkStatisticsAction oContextAction("PRead");
 
+    if (GetRangeFromCache(pBuffer, nSize, nOffset))
+        return nSize;
+
     CPLStringList aosHTTPOptions(m_aosHTTPOptions);
     std::string osURL;
     {
@@ -3196,9 +3972,247 @@ size_t VSICurlHandle::PRead(void *pBuffer, size_t nSize,
     std::string osHeaderRange;
     if (sWriteFuncHeaderData.bIsHTTP)
     {
-        osHeaderRange = CPLSPrintf("Range: bytes=%s", rangeStr);
+        osHeaderRange = CPLSPrintf("Range: bytes=%s", rangeStr);
+        // So it gets included in Azure signature
+        headers = curl_slist_append(headers, osHeaderRange.data());
+        unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_RANGE, nullptr);
+    }
+    else
+    {
+        unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_RANGE, rangeStr);
+    }
+
+    std::array<char, CURL_ERROR_SIZE + 1> szCurlErrBuf;
+    szCurlErrBuf[0] = '\0';
+    unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_ERRORBUFFER,
+                               &szCurlErrBuf[0]);
+
+    {
+        std::lock_guard<std::mutex> oLock(m_oMutex);
+        auto newHeaders =
+            const_cast<VSICurlHandle *>(this)->GetCurlHeaders("GET", headers);
+        headers = VSICurlMergeHeaders(headers, newHeaders);
+    }
+    unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_HTTPHEADER, headers);
+
+    CURLM *hMultiHandle = poFS->GetCurlMultiHandleFor(osURL);
+    VSICURLMultiPerform(hMultiHandle, hCurlHandle, &m_bInterrupt);
+
+    {
+        std::lock_guard<std::mutex> oLock(m_oMutex);
+        const_cast<VSICurlHandle *>(this)->UpdateRedirectInfo(
+            hCurlHandle, sWriteFuncHeaderData);
+    }
+
+    long response_code = 0;
+    curl_easy_getinfo(hCurlHandle, CURLINFO_HTTP_CODE, &response_code);
+
+    if (ENABLE_DEBUG && szCurlErrBuf[0] != '\0')
+    {
+        const char *pszErrorMsg = &szCurlErrBuf[0];
+        CPLDebug(poFS->GetDebugKey(), "PRead(%s), %s: response_code=%d, msg=%s",
+                 osURL.c_str(), rangeStr, static_cast<int>(response_code),
+                 pszErrorMsg);
+    }
+
+    size_t nRet;
+    if ((response_code != 206 && response_code != 225) ||
+        sWriteFuncData.nSize == 0)
+    {
+        if (!m_bInterrupt)
+        {
+            CPLDebug(poFS->GetDebugKey(),
+                     "Request for %s failed with response_code=%ld", rangeStr,
+                     response_code);
+        }
+        nRet = static_cast<size_t>(-1);
+    }
+    else
+    {
+        nRet = std::min(sWriteFuncData.nSize, nSize);
+        if (nRet > 0)
+            memcpy(pBuffer, sWriteFuncData.pBuffer, nRet);
+        PutRangeInPersistentCache(sWriteFuncData.pBuffer, nRet, nOffset,
+                                  sWriteFuncHeaderData.pBuffer);
+    }
+
+    VSICURLResetHeaderAndWriterFunctions(hCurlHandle);
+    curl_easy_cleanup(hCurlHandle);
+    CPLFree(sWriteFuncData.pBuffer);
+    CPLFree(sWriteFuncHeaderData.pBuffer);
+    curl_slist_free_all(headers);
+
+    NetworkStatisticsLogger::LogGET(sWriteFuncData.nSize);
+
+#if 0
+    if( ENABLE_DEBUG )
+        CPLDebug(poFS->GetDebugKey(), "Download completed");
+#endif
+
+    return nRet;
+}
+
+/************************************************************************/
+/*                 AsyncReadRequest::~AsyncReadRequest()                */
+/************************************************************************/
+
+VSICurlHandle::AsyncReadRequest::~AsyncReadRequest()
+{
+    if (hCurlHandle)
+    {
+        VSICURLResetHeaderAndWriterFunctions(hCurlHandle);
+        curl_easy_cleanup(hCurlHandle);
+    }
+    if (psHeaders)
+        curl_slist_free_all(psHeaders);
+    CPLFree(sWriteFuncData.pBuffer);
+    CPLFree(sWriteFuncHeaderData.pBuffer);
+}
+
+/************************************************************************/
+/*                     AsyncReadRequest::Complete()                     */
+/************************************************************************/
+
+void VSICurlHandle::AsyncReadRequest::Complete(size_t nRead)
+{
+    if (cbk)
+        cbk(nRead);
+    oPromise.set_value(nRead);
+}
+
+/************************************************************************/
+/*                  AsyncReadRequest::ResetForRetry()                   */
+/************************************************************************/
+
+void VSICurlHandle::AsyncReadRequest::ResetForRetry()
+{
+    CPLFree(sWriteFuncData.pBuffer);
+    VSICURLInitWriteFuncStruct(&sWriteFuncData, nullptr, nullptr, nullptr);
+
+    const WriteFuncStruct sOldHeaderData = sWriteFuncHeaderData;
+    CPLFree(sWriteFuncHeaderData.pBuffer);
+    VSICURLInitWriteFuncStruct(&sWriteFuncHeaderData, nullptr, nullptr,
+                               nullptr);
+    sWriteFuncHeaderData.bIsHTTP = sOldHeaderData.bIsHTTP;
+    sWriteFuncHeaderData.nStartOffset = sOldHeaderData.nStartOffset;
+    sWriteFuncHeaderData.nEndOffset = sOldHeaderData.nEndOffset;
+    sWriteFuncHeaderData.bDetectRangeDownloadingError =
+        sOldHeaderData.bDetectRangeDownloadingError;
+
+    szCurlErrBuf[0] = '\0';
+}
+
+/************************************************************************/
+/*                             ReadAsync()                              */
+/************************************************************************/
+
+/** Queue a range request, that is run by a thread driving the requests of
+ * all pending asynchronous reads of this handle with a single curl multi
+ * handle.
+ *
+ * As for the read-ahead chunks, the curl handle is set up in the calling
+ * thread, so that the asynchronous thread does not need to call the
+ * (possibly not thread-safe) virtual methods that compute authentication
+ * headers. Failed requests are retried by the asynchronous thread according
+ * to GDAL_HTTP_MAX_RETRY and GDAL_HTTP_RETRY_DELAY.
+ */
+std::future<size_t> VSICurlHandle::ReadAsync(void *pBuffer, size_t nSize,
+                                             vsi_l_offset nOffset,
+                                             AsyncReadCallback cbk)
+{
+    auto poRequest = std::make_unique<AsyncReadRequest>(m_oRetryParameters);
+    poRequest->pBuffer = pBuffer;
+    poRequest->nSize = nSize;
+    poRequest->cbk = std::move(cbk);
+    auto oFuture = poRequest->oPromise.get_future();
+
+    poFS->GetCachedFileProp(m_pszURL, oFileProp);
+    if (oFileProp.eExists == EXIST_NO || nSize == 0 ||
+        (oFileProp.bHasComputedFileSize && nOffset >= oFileProp.fileSize))
+    {
+        poRequest->Complete(0);
+        return oFuture;
+    }
+    if (oFileProp.bHasComputedFileSize &&
+        oFileProp.fileSize - nOffset < poRequest->nSize)
+    {
+        poRequest->nSize = static_cast<size_t>(oFileProp.fileSize - nOffset);
+    }
+
+    if (GetRangeFromCache(pBuffer, poRequest->nSize, nOffset,
+                          /* bUseRegionCache = */ true))
+    {
+        poRequest->Complete(poRequest->nSize);
+        return oFuture;
+    }
+
+    CPLStringList aosHTTPOptions(m_aosHTTPOptions);
+    std::string osURL;
+    bool bHasExpired = false;
+    {
+        std::lock_guard<std::mutex> oLock(m_oMutex);
+        UpdateQueryString();
+        osURL = GetRedirectURLIfValid(bHasExpired, aosHTTPOptions);
+    }
+    if (bHasExpired)
+    {
+        // As ReadMultiRange(), let the synchronous code path, which goes
+        // through PRead(), deal with the expired redirect URL
+        return VSIVirtualHandle::ReadAsync(pBuffer, poRequest->nSize, nOffset,
+                                           std::move(poRequest->cbk));
+    }
+
+    CURL *hCurlHandle = curl_easy_init();
+    poRequest->hCurlHandle = hCurlHandle;
+    struct curl_slist *headers =
+        VSICurlSetOptions(hCurlHandle, osURL.c_str(), aosHTTPOptions.List());
+
+#ifdef CURLPIPE_MULTIPLEX
+    // Share a single HTTP/2 connection between all requests
+    if (CPLTestBool(CPLGetConfigOption("GDAL_HTTP_MULTIPLEX", "YES")))
+        unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_PIPEWAIT, 1);
+#endif
+
+    VSICURLInitWriteFuncStruct(&poRequest->sWriteFuncData, nullptr, nullptr,
+                               nullptr);
+    unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_WRITEDATA,
+                               &poRequest->sWriteFuncData);
+    unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_WRITEFUNCTION,
+                               VSICurlHandleWriteFunc);
+
+    VSICURLInitWriteFuncStruct(&poRequest->sWriteFuncHeaderData, nullptr,
+                               nullptr, nullptr);
+    unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_HEADERDATA,
+                               &poRequest->sWriteFuncHeaderData);
+    unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_HEADERFUNCTION,
+                               VSICurlHandleWriteFunc);
+    poRequest->sWriteFuncHeaderData.bIsHTTP = STARTS_WITH(m_pszURL, "http");
+    poRequest->sWriteFuncHeaderData.nStartOffset = nOffset;
+    poRequest->sWriteFuncHeaderData.nEndOffset =
+        nOffset + poRequest->nSize - 1;
+    // A server ignoring the Range header answers with a 200 status and the
+    // whole file, which AsyncReadThreadFunc() slices. Accept that as long as
+    // the file is not much larger than the requested range.
+    if (oFileProp.bHasComputedFileSize &&
+        oFileProp.fileSize / 10 <= poRequest->nSize)
+    {
+        poRequest->sWriteFuncHeaderData.bDetectRangeDownloadingError = false;
+    }
+
+    char rangeStr[512] = {};
+    snprintf(rangeStr, sizeof(rangeStr), CPL_FRMT_GUIB "-" CPL_FRMT_GUIB,
+             poRequest->sWriteFuncHeaderData.nStartOffset,
+             poRequest->sWriteFuncHeaderData.nEndOffset);
+
+    if (ENABLE_DEBUG)
+        CPLDebug(poFS->GetDebugKey(), "Downloading %s (%s) asynchronously...",
+                 rangeStr, osURL.c_str());
+
+    if (poRequest->sWriteFuncHeaderData.bIsHTTP)
+    {
         // So it gets included in Azure signature
-        headers = curl_slist_append(headers, osHeaderRange.data());
+        headers = curl_slist_append(headers,
+                                    CPLSPrintf("Range: bytes=%s", rangeStr));
         unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_RANGE, nullptr);
     }
     else
@@ -3206,72 +4220,218 @@ size_t VSICurlHandle::PRead(void *pBuffer, size_t nSize,
         unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_RANGE, rangeStr);
     }
 
-    std::array<char, CURL_ERROR_SIZE + 1> szCurlErrBuf;
-    szCurlErrBuf[0] = '\0';
     unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_ERRORBUFFER,
-                               &szCurlErrBuf[0]);
+                               poRequest->szCurlErrBuf);
 
     {
         std::lock_guard<std::mutex> oLock(m_oMutex);
-        auto newHeaders =
-            const_cast<VSICurlHandle *>(this)->GetCurlHeaders("GET", headers);
-        headers = VSICurlMergeHeaders(headers, newHeaders);
+        headers = VSICurlMergeHeaders(headers, GetCurlHeaders("GET", headers));
     }
     unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_HTTPHEADER, headers);
-
-    CURLM *hMultiHandle = poFS->GetCurlMultiHandleFor(osURL);
-    VSICURLMultiPerform(hMultiHandle, hCurlHandle, &m_bInterrupt);
+    poRequest->psHeaders = headers;
 
     {
-        std::lock_guard<std::mutex> oLock(m_oMutex);
-        const_cast<VSICurlHandle *>(this)->UpdateRedirectInfo(
-            hCurlHandle, sWriteFuncHeaderData);
+        std::lock_guard<std::mutex> oLock(m_oMutexAsyncRead);
+        if (!m_hCurlMultiHandleForAsyncRead)
+        {
+            m_hCurlMultiHandleForAsyncRead = VSICURLMultiInit();
+#ifdef CURLPIPE_MULTIPLEX
+            if (CPLTestBool(CPLGetConfigOption("GDAL_HTTP_MULTIPLEX", "YES")))
+            {
+                curl_multi_setopt(m_hCurlMultiHandleForAsyncRead,
+                                  CURLMOPT_PIPELINING, CURLPIPE_MULTIPLEX);
+            }
+#endif
+        }
+        m_apoAsyncReadQueue.push_back(std::move(poRequest));
+        if (!m_oThreadAsyncRead.joinable())
+        {
+            m_oThreadAsyncRead =
+                std::thread([this]() { AsyncReadThreadFunc(); });
+        }
     }
+    curl_multi_wakeup(m_hCurlMultiHandleForAsyncRead);
 
-    long response_code = 0;
-    curl_easy_getinfo(hCurlHandle, CURLINFO_HTTP_CODE, &response_code);
+    return oFuture;
+}
 
-    if (ENABLE_DEBUG && szCurlErrBuf[0] != '\0')
-    {
-        const char *pszErrorMsg = &szCurlErrBuf[0];
-        CPLDebug(poFS->GetDebugKey(), "PRead(%s), %s: response_code=%d, msg=%s",
-                 osURL.c_str(), rangeStr, static_cast<int>(response_code),
-                 pszErrorMsg);
-    }
+/************************************************************************/
+/*                           StopAsyncRead()                            */
+/************************************************************************/
 
-    size_t nRet;
-    if ((response_code != 206 && response_code != 225) ||
-        sWriteFuncData.nSize == 0)
+/** Wait for the completion of pending asynchronous reads, and stop the
+ * thread running them.
+ */
+void VSICurlHandle::StopAsyncRead()
+{
+    if (m_oThreadAsyncRead.joinable())
     {
-        if (!m_bInterrupt)
         {
-            CPLDebug(poFS->GetDebugKey(),
-                     "Request for %s failed with response_code=%ld", rangeStr,
-                     response_code);
+            std::lock_guard<std::mutex> oLock(m_oMutexAsyncRead);
+            m_bAsyncReadStop = true;
         }
-        nRet = static_cast<size_t>(-1);
+        curl_multi_wakeup(m_hCurlMultiHandleForAsyncRead);
+        m_oThreadAsyncRead.join();
     }
-    else
+    if (m_hCurlMultiHandleForAsyncRead)
     {
-        nRet = std::min(sWriteFuncData.nSize, nSize);
-        if (nRet > 0)
-            memcpy(pBuffer, sWriteFuncData.pBuffer, nRet);
+        curl_multi_cleanup(m_hCurlMultiHandleForAsyncRead);
+        m_hCurlMultiHandleForAsyncRead = nullptr;
     }
+}
 
-    VSICURLResetHeaderAndWriterFunctions(hCurlHandle);
-    curl_easy_cleanup(hCurlHandle);
-    CPLFree(sWriteFuncData.pBuffer);
-    CPLFree(sWriteFuncHeaderData.pBuffer);
-    curl_slist_free_all(headers);
+/************************************************************************/
+/*                        AsyncReadThreadFunc()                         */
+/************************************************************************/
 
-    NetworkStatisticsLogger::LogGET(sWriteFuncData.nSize);
+void VSICurlHandle::AsyncReadThreadFunc()
+{
+    NetworkStatisticsFileSystem oContextFS(poFS->GetFSPrefix().c_str());
+    NetworkStatisticsFile oContextFile(m_osFilename.c_str());
+    NetworkStatisticsAction oContextAction("ReadAsync");
 
-#if 0
-    if( ENABLE_DEBUG )
-        CPLDebug(poFS->GetDebugKey(), "Download completed");
-#endif
+    CURLM *hCurlMultiHandle = m_hCurlMultiHandleForAsyncRead;
+    std::map<CURL *, std::unique_ptr<AsyncReadRequest>> oMapInFlight;
+    // Failed requests waiting for their retry delay to expire
+    std::vector<std::unique_ptr<AsyncReadRequest>> apoToRetry;
+    while (true)
+    {
+        {
+            std::lock_guard<std::mutex> oLock(m_oMutexAsyncRead);
+            for (auto &poRequest : m_apoAsyncReadQueue)
+            {
+                curl_multi_add_handle(hCurlMultiHandle,
+                                      poRequest->hCurlHandle);
+                CURL *hCurlHandle = poRequest->hCurlHandle;
+                oMapInFlight[hCurlHandle] = std::move(poRequest);
+            }
+            m_apoAsyncReadQueue.clear();
+            // Pending requests are completed before stopping
+            if (m_bAsyncReadStop && oMapInFlight.empty() && apoToRetry.empty())
+                break;
+        }
 
-    return nRet;
+        const auto oNow = std::chrono::steady_clock::now();
+        for (auto oIter = apoToRetry.begin(); oIter != apoToRetry.end();)
+        {
+            if ((*oIter)->oRetryTime <= oNow)
+            {
+                CURL *hCurlHandle = (*oIter)->hCurlHandle;
+                curl_multi_add_handle(hCurlMultiHandle, hCurlHandle);
+                oMapInFlight[hCurlHandle] = std::move(*oIter);
+                oIter = apoToRetry.erase(oIter);
+            }
+            else
+            {
+                ++oIter;
+            }
+        }
+
+        int still_running = 0;
+        void *old_handler = CPLHTTPIgnoreSigPipe();
+        while (curl_multi_perform(hCurlMultiHandle, &still_running) ==
+               CURLM_CALL_MULTI_PERFORM)
+        {
+            // loop
+        }
+        CPLHTTPRestoreSigPipeHandler(old_handler);
+
+        CURLMsg *msg;
+        int msgq = 0;
+        while ((msg = curl_multi_info_read(hCurlMultiHandle, &msgq)) !=
+               nullptr)
+        {
+            if (msg->msg != CURLMSG_DONE)
+                continue;
+            CURL *hCurlHandle = msg->easy_handle;
+            const CURLcode eResult = msg->data.result;
+            auto oIter = oMapInFlight.find(hCurlHandle);
+            if (oIter == oMapInFlight.end())
+                continue;
+            auto poRequest = std::move(oIter->second);
+            oMapInFlight.erase(oIter);
+            curl_multi_remove_handle(hCurlMultiHandle, hCurlHandle);
+
+            long response_code = 0;
+            curl_easy_getinfo(hCurlHandle, CURLINFO_HTTP_CODE, &response_code);
+
+            const auto &sWriteFuncData = poRequest->sWriteFuncData;
+            const auto &sWriteFuncHeaderData = poRequest->sWriteFuncHeaderData;
+            NetworkStatisticsLogger::LogGET(sWriteFuncData.nSize);
+
+            const vsi_l_offset nOffset = sWriteFuncHeaderData.nStartOffset;
+            // A 200 status means that the server ignored the Range header,
+            // and sent the whole file
+            const bool bFullBody = response_code == 200 &&
+                                   eResult == CURLE_OK &&
+                                   !sWriteFuncHeaderData.bError;
+            size_t nRead = 0;
+            if (response_code == 206 || response_code == 225 || bFullBody)
+            {
+                const vsi_l_offset nBodyOffset = bFullBody ? 0 : nOffset;
+                const vsi_l_offset nBodyEnd =
+                    nBodyOffset + sWriteFuncData.nSize;
+                if (nBodyEnd > nOffset)
+                {
+                    nRead = static_cast<size_t>(std::min<vsi_l_offset>(
+                        nBodyEnd - nOffset, poRequest->nSize));
+                    memcpy(poRequest->pBuffer,
+                           sWriteFuncData.pBuffer +
+                               static_cast<size_t>(nOffset - nBodyOffset),
+                           nRead);
+                }
+                poFS->UpdateTransferModel(m_pszURL, {hCurlHandle},
+                                          sWriteFuncData.nSize);
+                PutRangeInPersistentCache(sWriteFuncData.pBuffer,
+                                          sWriteFuncData.nSize, nBodyOffset,
+                                          sWriteFuncHeaderData.pBuffer);
+            }
+            else if (!m_bInterrupt &&
+                     poRequest->oRetryContext.CanRetry(
+                         static_cast<int>(response_code),
+                         sWriteFuncData.pBuffer, poRequest->szCurlErrBuf))
+            {
+                const double dfDelay =
+                    poRequest->oRetryContext.GetCurrentDelay();
+                CPLError(CE_Warning, CPLE_AppDefined,
+                         "HTTP error code for %s range " CPL_FRMT_GUIB
+                         "-" CPL_FRMT_GUIB ": %d. Retrying again in %.1f secs",
+                         m_pszURL, nOffset, sWriteFuncHeaderData.nEndOffset,
+                         static_cast<int>(response_code), dfDelay);
+                poRequest->ResetForRetry();
+                poRequest->oRetryTime =
+                    std::chrono::steady_clock::now() +
+                    std::chrono::duration_cast<
+                        std::chrono::steady_clock::duration>(
+                        std::chrono::duration<double>(dfDelay));
+                apoToRetry.push_back(std::move(poRequest));
+                continue;
+            }
+            else if (!m_bInterrupt)
+            {
+                CPLDebug(poFS->GetDebugKey(),
+                         "Asynchronous request at offset " CPL_FRMT_GUIB
+                         " failed with response_code=%ld",
+                         nOffset, response_code);
+            }
+            poRequest->Complete(nRead);
+        }
+
+        // Wake up in time for the next retry
+        int nTimeoutMS = 1000;
+        const auto oNowAfter = std::chrono::steady_clock::now();
+        for (const auto &poRequest : apoToRetry)
+        {
+            const auto nRemainingMS =
+                std::chrono::duration_cast<std::chrono::milliseconds>(
+                    poRequest->oRetryTime - oNowAfter)
+                    .count();
+            nTimeoutMS = static_cast<int>(std::max<decltype(nRemainingMS)>(
+                0, std::min<decltype(nRemainingMS)>(nTimeoutMS,
+                                                    nRemainingMS + 1)));
+        }
+        curl_multi_poll(hCurlMultiHandle, nullptr, 0, nTimeoutMS, nullptr);
+    }
 }
 
 /************************************************************************/
@@ -3357,6 +4517,10 @@ void VSICurlHandle::AdviseRead(int nRanges, const vsi_l_offset *panOffsets,
 
     const bool bMergeConsecutiveRanges = CPLTestBool(
         CPLGetConfigOption("GDAL_HTTP_MERGE_CONSECUTIVE_RANGES", "TRUE"));
+    // Ranges separated by less than that are merged
+    constexpr size_t SIZE_COG_MARKERS = 2 * sizeof(uint32_t);
+    const size_t nMaxGap =
+        std::max(SIZE_COG_MARKERS, poFS->GetMaxRangeGap(l_osURL));
 
     try
     {
@@ -3366,11 +4530,10 @@ void VSICurlHandle::AdviseRead(int nRanges, const vsi_l_offset *panOffsets,
         {
             int iNext = i;
             // Identify consecutive ranges
-            constexpr size_t SIZE_COG_MARKERS = 2 * sizeof(uint32_t);
             auto nEndOffset = panOffsets[iNext] + panSizes[iNext];
             while (bMergeConsecutiveRanges && iNext + 1 < nRanges &&
                    panOffsets[iNext + 1] > panOffsets[iNext] &&
-                   panOffsets[iNext] + panSizes[iNext] + SIZE_COG_MARKERS >=
+                   panOffsets[iNext] + panSizes[iNext] + nMaxGap >=
                        panOffsets[iNext + 1] &&
                    panOffsets[iNext + 1] + panSizes[iNext + 1] > nEndOffset)
             {
@@ -3381,7 +4544,9 @@ void VSICurlHandle::AdviseRead(int nRanges, const vsi_l_offset *panOffsets,
             const size_t nSize =
                 static_cast<size_t>(nEndOffset - panOffsets[i]);
 
-            if (nSize == 0)
+            // Ranges available in the region cache or in the persistent
+            // cache will be served from the region cache by PRead()
+            if (nSize == 0 || GetRangeFromCache(nullptr, nSize, panOffsets[i]))
             {
                 i = iNext + 1;
                 continue;
@@ -3422,6 +4587,7 @@ void VSICurlHandle::AdviseRead(int nRanges, const vsi_l_offset *panOffsets,
         NetworkStatisticsFile oContextFile(m_osFilename.c_str());
         NetworkStatisticsAction oContextAction("AdviseRead");
 
+        bool bMultiplex = false;
 #ifdef CURLPIPE_MULTIPLEX
         // Enable HTTP/2 multiplexing (ignored if an older version of HTTP is
         // used)
@@ -3431,6 +4597,7 @@ void VSICurlHandle::AdviseRead(int nRanges, const vsi_l_offset *panOffsets,
         // results out of order.
         if (CPLTestBool(CPLGetConfigOption("GDAL_HTTP_MULTIPLEX", "YES")))
         {
+            bMultiplex = true;
             curl_multi_setopt(m_hCurlMultiHandleForAdviseRead,
                               CURLMOPT_PIPELINING, CURLPIPE_MULTIPLEX);
         }
@@ -3457,6 +4624,8 @@ void VSICurlHandle::AdviseRead(int nRanges, const vsi_l_offset *panOffsets,
                 m_aoAdviseReadRanges.size());
 
             std::map<CURL *, size_t> oMapHandleToIdx;
+            int nRequests = 0;
+            size_t nRequestedBytes = 0;
             for (size_t i = 0; i < m_aoAdviseReadRanges.size(); ++i)
             {
                 if (!m_aoAdviseReadRanges[i]->bToRetry)
@@ -3471,10 +4640,14 @@ void VSICurlHandle::AdviseRead(int nRanges, const vsi_l_offset *panOffsets,
                 CURL *hCurlHandle = curl_easy_init();
                 oMapHandleToIdx[hCurlHandle] = i;
                 aHandles.push_back(hCurlHandle);
+                ++nRequests;
+                nRequestedBytes += m_aoAdviseReadRanges[i]->nSize;
 
-                // As the multi-range request is likely not the first one, we don't
-                // need to wait as we already know if pipelining is possible
-                // unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_PIPEWAIT, 1);
+                // Share a single HTTP/2 connection between all requests,
+                // rather than opening a new connection per range
+                if (bMultiplex)
+                    unchecked_curl_easy_setopt(hCurlHandle, CURLOPT_PIPEWAIT,
+                                               1);
 
                 struct curl_slist *headers = VSICurlSetOptions(
                     hCurlHandle, osURL.c_str(), aosHTTPOptions.List());
@@ -3615,6 +4788,10 @@ void VSICurlHandle::AdviseRead(int nRanges, const vsi_l_offset *panOffsets,
                     memcpy(&m_aoAdviseReadRanges[iReq]->abyData[0],
                            asWriteFuncData[iReq].pBuffer, nSize);
                     m_aoAdviseReadRanges[iReq]->abyData.resize(nSize);
+                    PutRangeInPersistentCache(
+                        asWriteFuncData[iReq].pBuffer, nSize,
+                        m_aoAdviseReadRanges[iReq]->nStartOffset,
+                        asWriteFuncHeaderData[iReq].pBuffer);
 
                     nTotalDownloaded += nSize;
                 }
@@ -3630,6 +4807,10 @@ void VSICurlHandle::AdviseRead(int nRanges, const vsi_l_offset *panOffsets,
                 }
             };
 
+            poFS->StartMultiRangeRequests(m_osFilename, osURL, nRequests,
+                                          nRequests, nRequestedBytes);
+            const size_t nDownloadedBefore = nTotalDownloaded;
+
             int repeats = 0;
 
             void *old_handler = CPLHTTPIgnoreSigPipe();
@@ -3665,6 +4846,7 @@ void VSICurlHandle::AdviseRead(int nRanges, const vsi_l_offset *panOffsets,
 
             bool bRetry = false;
             double dfDelay = 0.0;
+            std::vector<CURL *> aCompletedHandles;
             for (size_t i = 0; i < m_aoAdviseReadRanges.size(); ++i)
             {
                 bool bReqDone;
@@ -3682,6 +4864,15 @@ void VSICurlHandle::AdviseRead(int nRanges, const vsi_l_offset *panOffsets,
                     dfDelay = std::max(dfDelay,
                                        m_aoAdviseReadRanges[i]->dfSleepDelay);
                 bRetry = bRetry || m_aoAdviseReadRanges[i]->bToRetry;
+                if (aHandles[i] && !m_aoAdviseReadRanges[i]->bToRetry)
+                    aCompletedHandles.push_back(aHandles[i]);
+            }
+            poFS->UpdateTransferModel(osURL, aCompletedHandles,
+                                      nTotalDownloaded - nDownloadedBefore);
+            poFS->EndMultiRangeRequests(m_osFilename, nRequests,
+                                        nTotalDownloaded - nDownloadedBefore);
+            for (size_t i = 0; i < m_aoAdviseReadRanges.size(); ++i)
+            {
                 if (aHandles[i])
                 {
                     curl_multi_remove_handle(m_hCurlMultiHandleForAdviseRead,
@@ -3888,6 +5079,71 @@ bool VSICurlFilesystemHandlerBase::AllowCachedDataFor(const char *pszFilename)
     return bCachedAllowed;
 }
 
+/************************************************************************/
+/*                  AllowPersistentMetadataCacheFor()                   */
+/************************************************************************/
+
+/** Whether the properties and directory listings of pszFilename may be
+ * stored in, and reused from, the persistent metadata cache.
+ *
+ * Those entries are keyed by the URL only, and are reused by any process
+ * sharing the cache directory without any request to the server, so that
+ * they would disclose what is behind credentials to processes that do not
+ * have them. They are thus restricted to /vsicurl/ files accessed
+ * anonymously: not to network file systems with authentication (/vsis3/,
+ * /vsigs/, /vsiaz/, etc.), nor to /vsicurl/ files accessed with HTTP
+ * authentication, custom headers, cookies, a client certificate, signed
+ * URLs or a .netrc file.
+ */
+bool VSICurlFilesystemHandlerBase::AllowPersistentMetadataCacheFor(
+    const char *pszFilename)
+{
+    if (!VSICurlPersistentMetadataCacheIsEnabled() ||
+        GetFSPrefix() != "/vsicurl/" || !AllowCachedDataFor(pszFilename))
+    {
+        return false;
+    }
+
+    CPLStringList aosHTTPOptions(CPLHTTPGetOptionsFromEnv(pszFilename));
+    bool bPlanetaryComputerURLSigning = false;
+    {
+        // Warnings are emitted when opening the file
+        CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+        VSICurlGetURLFromFilename(pszFilename, nullptr, nullptr, nullptr,
+                                  nullptr, nullptr, &aosHTTPOptions,
+                                  &bPlanetaryComputerURLSigning, nullptr);
+    }
+    if (bPlanetaryComputerURLSigning)
+        return false;
+    for (const char *pszOption :
+         {"USERPWD", "HTTPAUTH", "HTTP_BEARER", "HEADERS", "HEADER_FILE",
+          "COOKIE", "COOKIEFILE", "NETRC_FILE"})
+    {
+        if (aosHTTPOptions.FetchNameValue(pszOption))
+            return false;
+    }
+    if (CPLGetConfigOption("GDAL_HTTP_SSLCERT", nullptr))
+        return false;
+
+    // curl looks for a .netrc file in the home directory by default
+    if (aosHTTPOptions.FetchBool("NETRC", true))
+    {
+        const char *pszHomeDir = CPLGetHomeDir();
+        for (const char *pszNetrc : {".netrc", "_netrc"})
+        {
+            VSIStatBufL sStat;
+            if (pszHomeDir &&
+                VSIStatL(
+                    CPLFormFilenameSafe(pszHomeDir, pszNetrc, nullptr).c_str(),
+                    &sStat) == 0)
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
 /************************************************************************/
 /*                     GetCurlMultiHandleFor()                          */
 /************************************************************************/
@@ -3903,6 +5159,187 @@ CURLM *VSICurlFilesystemHandlerBase::GetCurlMultiHandleFor(
     return conn.hCurlMultiHandle;
 }
 
+/************************************************************************/
+/*                         VSICurlGetHostKey()                          */
+/************************************************************************/
+
+// Return the scheme://host[:port] part of a URL.
+static std::string VSICurlGetHostKey(const std::string &osURL)
+{
+    const auto nPosSchemeEnd = osURL.find("://");
+    if (nPosSchemeEnd == std::string::npos)
+        return osURL;
+    return osURL.substr(0, osURL.find('/', nPosSchemeEnd + strlen("://")));
+}
+
+/************************************************************************/
+/*                          GetTransferModel()                          */
+/************************************************************************/
+
+VSICurlFilesystemHandlerBase::TransferModel
+VSICurlFilesystemHandlerBase::GetTransferModel(const std::string &osURL)
+{
+    std::lock_guard<std::mutex> oLock(m_oMutexStatistics);
+    const auto oIter = m_oMapTransferModel.find(VSICurlGetHostKey(osURL));
+    if (oIter == m_oMapTransferModel.end())
+        return TransferModel();
+    return oIter->second;
+}
+
+/************************************************************************/
+/*                        UpdateTransferModel()                         */
+/************************************************************************/
+
+// Refine the transfer model of the host of osURL with the timings of
+// requests that have been run concurrently.
+void VSICurlFilesystemHandlerBase::UpdateTransferModel(
+    const std::string &osURL, const std::vector<CURL *> &ahCurlHandles,
+    size_t nDownloadedBytes)
+{
+    // Time from the sending of the request to the first byte of the response
+    double dfLatency = std::numeric_limits<double>::max();
+    double dfFirstByteTime = std::numeric_limits<double>::max();
+    double dfEndTime = 0;
+    for (CURL *hCurlHandle : ahCurlHandles)
+    {
+        curl_off_t nPreTransferTime = 0;
+        curl_off_t nStartTransferTime = 0;
+        curl_off_t nTotalTime = 0;
+        if (curl_easy_getinfo(hCurlHandle, CURLINFO_PRETRANSFER_TIME_T,
+                              &nPreTransferTime) != CURLE_OK ||
+            curl_easy_getinfo(hCurlHandle, CURLINFO_STARTTRANSFER_TIME_T,
+                              &nStartTransferTime) != CURLE_OK ||
+            curl_easy_getinfo(hCurlHandle, CURLINFO_TOTAL_TIME_T,
+                              &nTotalTime) != CURLE_OK ||
+            nStartTransferTime < nPreTransferTime ||
+            nTotalTime < nStartTransferTime)
+        {
+            return;
+        }
+        // Timings are in microsecond
+        dfLatency = std::min(
+            dfLatency,
+            static_cast<double>(nStartTransferTime - nPreTransferTime) * 1e-6);
+        dfFirstByteTime = std::min(
+            dfFirstByteTime, static_cast<double>(nStartTransferTime) * 1e-6);
+        dfEndTime = std::max(dfEndTime, static_cast<double>(nTotalTime) * 1e-6);
+    }
+    if (ahCurlHandles.empty())
+        return;
+
+    // Bandwidth measurements on small transfers are not meaningful
+    constexpr size_t MIN_BYTES_FOR_BANDWIDTH = 64 * 1024;
+    constexpr double MIN_DURATION_FOR_BANDWIDTH = 1e-3;
+    const double dfTransferDuration = dfEndTime - dfFirstByteTime;
+    double dfBandwidth = 0;
+    if (nDownloadedBytes >= MIN_BYTES_FOR_BANDWIDTH &&
+        dfTransferDuration >= MIN_DURATION_FOR_BANDWIDTH)
+    {
+        dfBandwidth =
+            static_cast<double>(nDownloadedBytes) / dfTransferDuration;
+    }
+
+    // Exponential moving average, to smooth out the variations between
+    // requests.
+    constexpr double WEIGHT_NEW = 0.25;
+    std::lock_guard<std::mutex> oLock(m_oMutexStatistics);
+    auto &oModel = m_oMapTransferModel[VSICurlGetHostKey(osURL)];
+    oModel.dfLatency = oModel.dfLatency == 0
+                           ? dfLatency
+                           : (1 - WEIGHT_NEW) * oModel.dfLatency +
+                                 WEIGHT_NEW * dfLatency;
+    if (dfBandwidth > 0)
+    {
+        oModel.dfBandwidth = oModel.dfBandwidth == 0
+                                 ? dfBandwidth
+                                 : (1 - WEIGHT_NEW) * oModel.dfBandwidth +
+                                       WEIGHT_NEW * dfBandwidth;
+    }
+}
+
+/************************************************************************/
+/*                          GetMaxRangeGap()                            */
+/************************************************************************/
+
+// Return the maximum number of bytes between two ranges for them to be
+// merged in a single request.
+size_t VSICurlFilesystemHandlerBase::GetMaxRangeGap(const std::string &osURL)
+{
+    const char *pszMaxGap =
+        CPLGetConfigOption("GDAL_HTTP_MERGE_RANGES_MAX_GAP", "0");
+    if (EQUAL(pszMaxGap, "AUTO"))
+    {
+        // Downloading the bytes of the gap is worth it if it takes less
+        // time than waiting for the response to an additional request.
+        constexpr double MAX_AUTO_GAP = 4 * 1024 * 1024;
+        const auto oModel = GetTransferModel(osURL);
+        return static_cast<size_t>(
+            std::min(oModel.dfLatency * oModel.dfBandwidth, MAX_AUTO_GAP));
+    }
+    return static_cast<size_t>(std::min<unsigned long long>(
+        std::numeric_limits<size_t>::max(),
+        std::strtoull(pszMaxGap, nullptr, 10)));
+}
+
+/************************************************************************/
+/*                       StartMultiRangeRequests()                      */
+/************************************************************************/
+
+void VSICurlFilesystemHandlerBase::StartMultiRangeRequests(
+    const std::string &osFilename, const std::string &osURL, int nRanges,
+    int nRequests, size_t nRequestedBytes)
+{
+    std::lock_guard<std::mutex> oLock(m_oMutexStatistics);
+    ReadStatistics oStats;
+    m_oCacheReadStatistics.tryGet(osFilename, oStats);
+    oStats.osHost = VSICurlGetHostKey(osURL);
+    oStats.nMultiRangeCalls++;
+    oStats.nRanges += nRanges;
+    oStats.nRequests += nRequests;
+    oStats.nRequestedBytes += static_cast<GIntBig>(nRequestedBytes);
+    oStats.nInFlightRequests += nRequests;
+    oStats.nMaxInFlightRequests =
+        std::max(oStats.nMaxInFlightRequests, oStats.nInFlightRequests);
+    m_oCacheReadStatistics.insert(osFilename, oStats);
+}
+
+/************************************************************************/
+/*                        EndMultiRangeRequests()                       */
+/************************************************************************/
+
+void VSICurlFilesystemHandlerBase::EndMultiRangeRequests(
+    const std::string &osFilename, int nRequests, size_t nDownloadedBytes)
+{
+    std::lock_guard<std::mutex> oLock(m_oMutexStatistics);
+    ReadStatistics oStats;
+    m_oCacheReadStatistics.tryGet(osFilename, oStats);
+    oStats.nInFlightRequests =
+        std::max(0, oStats.nInFlightRequests - nRequests);
+    oStats.nDownloadedBytes += static_cast<GIntBig>(nDownloadedBytes);
+    m_oCacheReadStatistics.insert(osFilename, oStats);
+}
+
+/************************************************************************/
+/*                      UpdateReadAheadStatistics()                     */
+/************************************************************************/
+
+void VSICurlFilesystemHandlerBase::UpdateReadAheadStatistics(
+    const std::string &osFilename, const std::string &osURL, int nHits,
+    int nMisses, int nRequests, int nCancelledRequests, int nChunks)
+{
+    std::lock_guard<std::mutex> oLock(m_oMutexStatistics);
+    ReadStatistics oStats;
+    m_oCacheReadStatistics.tryGet(osFilename, oStats);
+    oStats.osHost = VSICurlGetHostKey(osURL);
+    oStats.nReadAheadHits += nHits;
+    oStats.nReadAheadMisses += nMisses;
+    oStats.nReadAheadRequests += nRequests;
+    oStats.nReadAheadCancelledRequests += nCancelledRequests;
+    if (nChunks > 0)
+        oStats.nReadAheadChunks = nChunks;
+    m_oCacheReadStatistics.insert(osFilename, oStats);
+}
+
 /************************************************************************/
 /*                          GetRegionCache()                            */
 /************************************************************************/
@@ -3979,6 +5416,26 @@ bool VSICurlFilesystemHandlerBase::GetCachedFileProp(const char *pszURL,
     return false;
 }
 
+/************************************************************************/
+/*                      ListedFilePropsCollector                        */
+/************************************************************************/
+
+namespace
+{
+// While a thread lists a directory whose content is to be stored in the
+// persistent metadata cache, collects the file properties set by that
+// listing. This is per thread, since other threads may set file
+// properties of the same file system at the same time.
+struct ListedFilePropsCollector
+{
+    const VSICurlFilesystemHandlerBase *poFS;
+    std::vector<std::pair<std::string, FileProp>> *paoFileProps;
+};
+}  // namespace
+
+static thread_local ListedFilePropsCollector g_tls_listedFilePropsCollector{
+    nullptr, nullptr};
+
 /************************************************************************/
 /*                         SetCachedFileProp()                          */
 /************************************************************************/
@@ -3989,6 +5446,9 @@ void VSICurlFilesystemHandlerBase::SetCachedFileProp(const char *pszURL,
     CPLMutexHolder oHolder(&hMutex);
     oCacheFileProp.insert(std::string(pszURL), true);
     VSICURLSetCachedFileProp(pszURL, oFileProp);
+    if (g_tls_listedFilePropsCollector.poFS == this)
+        g_tls_listedFilePropsCollector.paoFileProps->emplace_back(pszURL,
+                                                                  oFileProp);
 }
 
 /************************************************************************/
@@ -4070,6 +5530,7 @@ void VSICurlFilesystemHandlerBase::InvalidateCachedData(const char *pszURL)
     CPLMutexHolder oHolder(&hMutex);
 
     oCacheFileProp.remove(std::string(pszURL));
+    VSICurlPersistentMetadataCacheInvalidate(pszURL, false);
 
     // Invalidate all cached regions for this URL
     std::list<FilenameOffsetPair> keysToRemove;
@@ -4108,6 +5569,12 @@ void VSICurlFilesystemHandlerBase::ClearCache()
     oCacheDirList.clear();
     nCachedFilesInDirList = 0;
 
+    {
+        std::lock_guard<std::mutex> oLock(m_oMutexStatistics);
+        m_oMapTransferModel.clear();
+        m_oCacheReadStatistics.clear();
+    }
+
     GetConnectionCache()[this].clear();
 }
 
@@ -4221,6 +5688,10 @@ const char *VSICurlFilesystemHandlerBase::GetActualURL(const char *pszFilename)
     "  <Option name='GDAL_HTTP_MERGE_CONSECUTIVE_RANGES' type='boolean' "      \
     "description='Whether to merge consecutive ranges in multirange "          \
     "requests' default='YES'/>"                                                \
+    "  <Option name='GDAL_HTTP_MERGE_RANGES_MAX_GAP' type='string' "           \
+    "description='Maximum number of bytes between two ranges for them to "     \
+    "be merged in a single request, or AUTO to derive it from the measured "   \
+    "latency and bandwidth' default='0'/>"                                     \
     "  <Option name='CPL_VSIL_CURL_NON_CACHED' type='string' "                 \
     "description='Colon-separated list of filenames whose content"             \
     "must not be cached across open attempts'/>"                               \
@@ -4251,6 +5722,15 @@ const char *VSICurlFilesystemHandlerBase::GetActualURL(const char *pszFilename)
     "  <Option name='CPL_VSIL_CURL_ADVISE_READ_TOTAL_BYTES_LIMIT' "            \
     "type='integer' description='Maximum number of bytes AdviseRead() is "     \
     "allowed to fetch at once' default='104857600'/>"                          \
+    "  <Option name='CPL_VSIL_CURL_READ_AHEAD' type='boolean' "                \
+    "description='Whether to download the next chunks of sequentially read "  \
+    "files in a background thread' default='NO'/>"                             \
+    "  <Option name='CPL_VSIL_CURL_READ_AHEAD_CHUNK_SIZE' type='integer' "     \
+    "description='Size in bytes of the chunks downloaded by the read-ahead' "  \
+    "default='2097152'/>"                                                      \
+    "  <Option name='CPL_VSIL_CURL_READ_AHEAD_MAX_CHUNKS' type='integer' "     \
+    "description='Maximum number of chunks downloaded ahead of the current "   \
+    "position' default='8'/>"                                                  \
     "  <Option name='GDAL_HTTP_MAX_CACHED_CONNECTIONS' type='integer' "        \
     "description='Maximum amount of connections that libcurl may keep alive "  \
     "in its connection cache after use'/>"                                     \
@@ -5526,18 +7006,44 @@ char **VSICurlFilesystemHandlerBase::ReadDirInternal(const char *pszDirname,
     CachedDirList cachedDirList;
     if (!GetCachedDirList(osDirname.c_str(), cachedDirList))
     {
-        cachedDirList.oFileList.Assign(GetFileList(osDirname.c_str(), nMaxFiles,
-                                                   &cachedDirList.bGotFileList),
-                                       true);
-        if (cachedDirList.bGotFileList && cachedDirList.oFileList.empty())
+        const bool bPersistentCache =
+            AllowPersistentMetadataCacheFor(osDirname.c_str());
+        const std::string osDirURL =
+            bPersistentCache ? GetURLFromFilename(osDirname) : std::string();
+        std::vector<std::pair<std::string, FileProp>> aoListedFileProps;
+        if (bPersistentCache &&
+            VSICurlPersistentMetadataCacheGetDirList(
+                osDirURL.c_str(), cachedDirList, aoListedFileProps))
         {
-            // To avoid an error to be reported
-            cachedDirList.oFileList.AddString(".");
+            for (auto &oIter : aoListedFileProps)
+                SetCachedFileProp(oIter.first.c_str(), oIter.second);
+            SetCachedDirList(osDirname.c_str(), cachedDirList);
         }
-        if (nMaxFiles <= 0 || cachedDirList.oFileList.size() < nMaxFiles)
+        else
         {
-            // Only cache content if we didn't hit the limitation
-            SetCachedDirList(osDirname.c_str(), cachedDirList);
+            const auto oOldCollector = g_tls_listedFilePropsCollector;
+            if (bPersistentCache)
+                g_tls_listedFilePropsCollector = {this, &aoListedFileProps};
+            cachedDirList.oFileList.Assign(
+                GetFileList(osDirname.c_str(), nMaxFiles,
+                            &cachedDirList.bGotFileList),
+                true);
+            g_tls_listedFilePropsCollector = oOldCollector;
+            if (cachedDirList.bGotFileList && cachedDirList.oFileList.empty())
+            {
+                // To avoid an error to be reported
+                cachedDirList.oFileList.AddString(".");
+            }
+            if (nMaxFiles <= 0 || cachedDirList.oFileList.size() < nMaxFiles)
+            {
+                // Only cache content if we didn't hit the limitation
+                SetCachedDirList(osDirname.c_str(), cachedDirList);
+                if (bPersistentCache && cachedDirList.bGotFileList)
+                {
+                    VSICurlPersistentMetadataCachePutDirList(
+                        osDirURL.c_str(), cachedDirList, aoListedFileProps);
+                }
+            }
         }
     }
 
@@ -5562,6 +7068,12 @@ void VSICurlFilesystemHandlerBase::InvalidateDirContent(
         nCachedFilesInDirList -= oCachedDirList.oFileList.size();
         oCacheDirList.remove(osDirname);
     }
+
+    if (VSICurlPersistentMetadataCacheIsEnabled())
+    {
+        VSICurlPersistentMetadataCacheInvalidate(
+            GetURLFromFilename(osDirname).c_str(), true);
+    }
 }
 
 /************************************************************************/
@@ -5597,6 +7109,50 @@ char **VSICurlFilesystemHandlerBase::GetFileMetadata(const char *pszFilename,
                                                      const char *pszDomain,
                                                      CSLConstList)
 {
+    if (pszDomain != nullptr && EQUAL(pszDomain, "STATISTICS"))
+    {
+        ReadStatistics oStats;
+        TransferModel oModel;
+        {
+            std::lock_guard<std::mutex> oLock(m_oMutexStatistics);
+            if (!m_oCacheReadStatistics.tryGet(pszFilename, oStats))
+                return nullptr;
+            const auto oIter = m_oMapTransferModel.find(oStats.osHost);
+            if (oIter != m_oMapTransferModel.end())
+                oModel = oIter->second;
+        }
+        CPLStringList aosMD;
+        aosMD.SetNameValue("MULTI_RANGE_CALLS",
+                           CPLSPrintf(CPL_FRMT_GIB, oStats.nMultiRangeCalls));
+        aosMD.SetNameValue("RANGES", CPLSPrintf(CPL_FRMT_GIB, oStats.nRanges));
+        aosMD.SetNameValue("REQUESTS",
+                           CPLSPrintf(CPL_FRMT_GIB, oStats.nRequests));
+        aosMD.SetNameValue("REQUESTED_BYTES",
+                           CPLSPrintf(CPL_FRMT_GIB, oStats.nRequestedBytes));
+        aosMD.SetNameValue("DOWNLOADED_BYTES",
+                           CPLSPrintf(CPL_FRMT_GIB, oStats.nDownloadedBytes));
+        aosMD.SetNameValue("IN_FLIGHT_REQUESTS",
+                           CPLSPrintf("%d", oStats.nInFlightRequests));
+        aosMD.SetNameValue("MAX_IN_FLIGHT_REQUESTS",
+                           CPLSPrintf("%d", oStats.nMaxInFlightRequests));
+        aosMD.SetNameValue("READ_AHEAD_HITS",
+                           CPLSPrintf(CPL_FRMT_GIB, oStats.nReadAheadHits));
+        aosMD.SetNameValue("READ_AHEAD_MISSES",
+                           CPLSPrintf(CPL_FRMT_GIB, oStats.nReadAheadMisses));
+        aosMD.SetNameValue("READ_AHEAD_REQUESTS",
+                           CPLSPrintf(CPL_FRMT_GIB, oStats.nReadAheadRequests));
+        aosMD.SetNameValue(
+            "READ_AHEAD_CANCELLED_REQUESTS",
+            CPLSPrintf(CPL_FRMT_GIB, oStats.nReadAheadCancelledRequests));
+        aosMD.SetNameValue("READ_AHEAD_CHUNKS",
+                           CPLSPrintf("%d", oStats.nReadAheadChunks));
+        aosMD.SetNameValue("LATENCY_MS",
+                           CPLSPrintf("%.3f", oModel.dfLatency * 1000));
+        aosMD.SetNameValue("BANDWIDTH_BYTES_PER_SEC",
+                           CPLSPrintf("%.0f", oModel.dfBandwidth));
+        return aosMD.StealList();
+    }
+
     if (pszDomain == nullptr || !EQUAL(pszDomain, "HEADERS"))
         return nullptr;
     std::unique_ptr<VSICurlHandle> poHandle(CreateFileHandle(pszFilename));
@@ -5997,6 +7553,40 @@ void NetworkStatisticsLogger::LogDELETE()
     }
 }
 
+void NetworkStatisticsLogger::LogPersistentCacheHitHEAD()
+{
+    if (!IsEnabled())
+        return;
+    std::lock_guard<std::mutex> oLock(gInstance.m_mutex);
+    for (auto counters : gInstance.GetCountersForContext())
+    {
+        counters->nPersistentCacheHitHEAD++;
+    }
+}
+
+void NetworkStatisticsLogger::LogPersistentCacheHitLIST()
+{
+    if (!IsEnabled())
+        return;
+    std::lock_guard<std::mutex> oLock(gInstance.m_mutex);
+    for (auto counters : gInstance.GetCountersForContext())
+    {
+        counters->nPersistentCacheHitLIST++;
+    }
+}
+
+void NetworkStatisticsLogger::LogPersistentCacheHitGET(size_t nBytes)
+{
+    if (!IsEnabled())
+        return;
+    std::lock_guard<std::mutex> oLock(gInstance.m_mutex);
+    for (auto counters : gInstance.GetCountersForContext())
+    {
+        counters->nPersistentCacheHitGET++;
+        counters->nPersistentCacheHitGETBytes += nBytes;
+    }
+}
+
 void NetworkStatisticsLogger::Reset()
 {
     std::lock_guard<std::mutex> oLock(gInstance.m_mutex);
@@ -6026,6 +7616,22 @@ void NetworkStatisticsLogger::Stats::AsJSON(CPLJSONObject &oJSON) const
     if (counters.nDELETE)
         oMethods.Add("DELETE/count", counters.nDELETE);
     oJSON.Add("methods", oMethods);
+    // Requests avoided thanks to CPL_VSIL_CURL_PERSISTENT_CACHE_DIR
+    if (counters.nPersistentCacheHitHEAD || counters.nPersistentCacheHitLIST ||
+        counters.nPersistentCacheHitGET)
+    {
+        CPLJSONObject oAvoided;
+        if (counters.nPersistentCacheHitHEAD)
+            oAvoided.Add("HEAD/count", counters.nPersistentCacheHitHEAD);
+        if (counters.nPersistentCacheHitLIST)
+            oAvoided.Add("LIST/count", counters.nPersistentCacheHitLIST);
+        if (counters.nPersistentCacheHitGET)
+            oAvoided.Add("GET/count", counters.nPersistentCacheHitGET);
+        if (counters.nPersistentCacheHitGETBytes)
+            oAvoided.Add("GET/downloaded_bytes",
+                         counters.nPersistentCacheHitGETBytes);
+        oJSON.Add("avoided_by_persistent_cache", oAvoided);
+    }
     CPLJSONObject oFiles;
     bool bFilesAdded = false;
     for (const auto &kv : children)
@@ -25,10 +25,15 @@
 #include "cpl_mem_cache.h"
 
 #include "cpl_curl_priv.h"
+#include "cpl_error_internal.h"
+#include "cpl_worker_thread_pool.h"
 
 #include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <deque>
+#include <future>
 #include <set>
 #include <map>
 #include <memory>
@@ -213,6 +218,38 @@ class VSICurlFilesystemHandlerBase : public VSIFilesystemHandler
     std::map<std::string, std::unique_ptr<RegionInDownload>>
         m_oMapRegionInDownload{};
 
+  public:
+    // Estimated characteristics of the transfers with a host, used to decide
+    // whether close ranges are worth being merged in a single request.
+    struct TransferModel
+    {
+        double dfLatency = 0;    // in second, until the first byte
+        double dfBandwidth = 0;  // in byte/second
+    };
+
+    // Statistics on the reads of a file.
+    struct ReadStatistics
+    {
+        std::string osHost{};
+        GIntBig nMultiRangeCalls = 0;
+        GIntBig nRanges = 0;
+        GIntBig nRequests = 0;
+        GIntBig nRequestedBytes = 0;
+        GIntBig nDownloadedBytes = 0;
+        int nInFlightRequests = 0;
+        int nMaxInFlightRequests = 0;
+        GIntBig nReadAheadHits = 0;
+        GIntBig nReadAheadMisses = 0;
+        GIntBig nReadAheadRequests = 0;
+        GIntBig nReadAheadCancelledRequests = 0;
+        int nReadAheadChunks = 0;
+    };
+
+  private:
+    std::mutex m_oMutexStatistics{};
+    std::map<std::string, TransferModel> m_oMapTransferModel{};
+    lru11::Cache<std::string, ReadStatistics> m_oCacheReadStatistics{1024, 0};
+
   protected:
     CPLMutex *hMutex = nullptr;
 
@@ -272,6 +309,7 @@ class VSICurlFilesystemHandlerBase : public VSIFilesystemHandler
 
     virtual std::string GetFSPrefix() const = 0;
     virtual bool AllowCachedDataFor(const char *pszFilename);
+    bool AllowPersistentMetadataCacheFor(const char *pszFilename);
 
     virtual bool IsLocal(const char * /* pszPath */) override
     {
@@ -310,6 +348,22 @@ class VSICurlFilesystemHandlerBase : public VSIFilesystemHandler
 
     CURLM *GetCurlMultiHandleFor(const std::string &osURL);
 
+    TransferModel GetTransferModel(const std::string &osURL);
+    void UpdateTransferModel(const std::string &osURL,
+                             const std::vector<CURL *> &ahCurlHandles,
+                             size_t nDownloadedBytes);
+    size_t GetMaxRangeGap(const std::string &osURL);
+
+    void StartMultiRangeRequests(const std::string &osFilename,
+                                 const std::string &osURL, int nRanges,
+                                 int nRequests, size_t nRequestedBytes);
+    void EndMultiRangeRequests(const std::string &osFilename, int nRequests,
+                               size_t nDownloadedBytes);
+    void UpdateReadAheadStatistics(const std::string &osFilename,
+                                   const std::string &osURL, int nHits,
+                                   int nMisses, int nRequests,
+                                   int nCancelledRequests, int nChunks);
+
     virtual void ClearCache();
     virtual void PartialClearCache(const char *pszFilename);
 
@@ -358,6 +412,7 @@ class VSICurlHandle : public VSIVirtualHandle
     VSICurlFilesystemHandlerBase *poFS = nullptr;
 
     bool m_bCached = true;
+    bool m_bPersistentMetadataCache = false;
 
     mutable FileProp oFileProp{};
 
@@ -382,7 +437,15 @@ class VSICurlHandle : public VSIVirtualHandle
 
     void DownloadRegionPostProcess(const vsi_l_offset startOffset,
                                    const int nBlocks, const char *pBuffer,
-                                   size_t nSize);
+                                   size_t nSize, bool bStoreInPersistentCache);
+
+    bool GetRangeFromCache(void *pBuffer, size_t nSize, vsi_l_offset nOffset,
+                           bool bUseRegionCache = false) const;
+    bool CanStoreInPersistentCache(const char *pszHeaders,
+                                   const FileProp &oRefFileProp) const;
+    void PutRangeInPersistentCache(const void *pData, size_t nSize,
+                                   vsi_l_offset nOffset,
+                                   const char *pszHeaders) const;
 
   private:
     vsi_l_offset curOffset = 0;
@@ -442,6 +505,97 @@ class VSICurlHandle : public VSIVirtualHandle
     std::thread m_oThreadAdviseRead{};
     CURLM *m_hCurlMultiHandleForAdviseRead = nullptr;
 
+    // Used by the read-ahead of sequential reads
+    struct ReadAheadChunk
+    {
+        vsi_l_offset nStartOffset = 0;
+        size_t nSize = 0;
+        bool bInFlight = false;
+        bool bDone = false;
+        bool bCancelled = false;
+        std::string osData{};
+        std::string osHeaders{};
+        CURL *hCurlHandle = nullptr;
+        struct curl_slist *psHeaders = nullptr;
+        WriteFuncStruct sWriteFuncData{};
+        WriteFuncStruct sWriteFuncHeaderData{};
+
+        ReadAheadChunk() = default;
+        ~ReadAheadChunk();
+
+        ReadAheadChunk(const ReadAheadChunk &) = delete;
+        ReadAheadChunk &operator=(const ReadAheadChunk &) = delete;
+        ReadAheadChunk(ReadAheadChunk &&) = delete;
+        ReadAheadChunk &operator=(ReadAheadChunk &&) = delete;
+    };
+
+    bool m_bReadAhead = false;
+    size_t m_nReadAheadChunkSize = 0;
+    int m_nReadAheadMaxChunks = 0;
+    // Number of chunks to keep ahead of the current position, adjusted
+    // depending on whether the reader has to wait for them or not
+    int m_nReadAheadChunks = 0;
+    // Protects the members below, which are shared with the read-ahead thread
+    std::mutex m_oMutexReadAhead{};
+    std::condition_variable m_oCVReadAhead{};
+    // Contiguous chunks, in increasing offset order
+    std::deque<std::shared_ptr<ReadAheadChunk>> m_aoReadAheadChunks{};
+    vsi_l_offset m_nReadAheadNextOffset = 0;
+    bool m_bReadAheadStop = false;
+    std::thread m_oThreadReadAhead{};
+    CURLM *m_hCurlMultiHandleForReadAhead = nullptr;
+
+    void StartReadAhead(vsi_l_offset nOffset);
+    void ScheduleReadAheadChunks();
+    void CancelReadAhead();
+    void StopReadAhead();
+    bool GetReadAheadRegion(vsi_l_offset nOffset, std::string &osRegion);
+    void ReadAheadThreadFunc();
+
+    // Used by ReadAsync()
+    struct AsyncReadRequest
+    {
+        void *pBuffer = nullptr;
+        size_t nSize = 0;
+        AsyncReadCallback cbk{};
+        std::promise<size_t> oPromise{};
+        CURL *hCurlHandle = nullptr;
+        struct curl_slist *psHeaders = nullptr;
+        WriteFuncStruct sWriteFuncData{};
+        WriteFuncStruct sWriteFuncHeaderData{};
+        char szCurlErrBuf[CURL_ERROR_SIZE + 1] = {};
+        CPLHTTPRetryContext oRetryContext;
+        // Time at which a failed request can be resubmitted
+        std::chrono::steady_clock::time_point oRetryTime{};
+
+        explicit AsyncReadRequest(
+            const CPLHTTPRetryParameters &oRetryParameters)
+            : oRetryContext(oRetryParameters)
+        {
+        }
+
+        ~AsyncReadRequest();
+
+        void Complete(size_t nRead);
+        void ResetForRetry();
+
+        AsyncReadRequest(const AsyncReadRequest &) = delete;
+        AsyncReadRequest &operator=(const AsyncReadRequest &) = delete;
+        AsyncReadRequest(AsyncReadRequest &&) = delete;
+        AsyncReadRequest &operator=(AsyncReadRequest &&) = delete;
+    };
+
+    // Protects the members below, which are shared with the async thread
+    std::mutex m_oMutexAsyncRead{};
+    // Requests submitted, but not yet handed to the curl multi handle
+    std::vector<std::unique_ptr<AsyncReadRequest>> m_apoAsyncReadQueue{};
+    bool m_bAsyncReadStop = false;
+    std::thread m_oThreadAsyncRead{};
+    CURLM *m_hCurlMultiHandleForAsyncRead = nullptr;
+
+    void StopAsyncRead();
+    void AsyncReadThreadFunc();
+
   protected:
     virtual struct curl_slist *
     GetCurlHeaders(const std::string & /*osVerb*/,
@@ -513,6 +667,10 @@ class VSICurlHandle : public VSIVirtualHandle
     size_t PRead(void *pBuffer, size_t nSize,
                  vsi_l_offset nOffset) const override;
 
+    std::future<size_t> ReadAsync(void *pBuffer, size_t nSize,
+                                  vsi_l_offset nOffset,
+                                  AsyncReadCallback cbk) override;
+
     void AdviseRead(int nRanges, const vsi_l_offset *panOffsets,
                     const size_t *panSizes) override;
 
@@ -598,6 +756,8 @@ class IVSIS3LikeFSHandler : public VSICurlFilesystemHandlerBaseWritable
 {
     CPL_DISALLOW_COPY_ASSIGN(IVSIS3LikeFSHandler)
 
+    friend class VSIMultipartWriteHandle;
+
     virtual int MkdirInternal(const char *pszDirname, long nMode,
                               bool bDoStatCheck);
 
@@ -839,7 +999,21 @@ class VSIMultipartWriteHandle final : public VSIVirtualHandle
 
     WriteFuncStruct m_sWriteFuncHeaderData{};
 
+    // Parallel upload of parts, when m_nMaxThreads > 1. At most
+    // m_nMaxThreads parts are in flight, plus the one being filled.
+    int m_nMaxThreads = 1;
+    std::unique_ptr<CPLWorkerThreadPool> m_poThreadPool{};
+    std::unique_ptr<CPLErrorAccumulator> m_poErrorAccumulator{};
+    std::mutex m_oMutexParts{};
+    std::condition_variable m_oCVParts{};
+    int m_nAllocatedBuffers = 0;
+    std::vector<GByte *> m_apabyFreeBuffers{};  // protected by m_oMutexParts
+    int m_nPendingParts = 0;                    // protected by m_oMutexParts
+    bool m_bPartUploadError = false;            // protected by m_oMutexParts
+
     bool UploadPart();
+    bool SubmitPartUpload(vsi_l_offset nPosition);
+    bool WaitForPendingParts();
     bool DoSinglePartPUT();
 
     void InvalidateParentDirectory();
@@ -1108,6 +1282,10 @@ class NetworkStatisticsLogger
         GIntBig nPUTUploadedBytes = 0;
         GIntBig nPOSTDownloadedBytes = 0;
         GIntBig nPOSTUploadedBytes = 0;
+        GIntBig nPersistentCacheHitHEAD = 0;
+        GIntBig nPersistentCacheHitLIST = 0;
+        GIntBig nPersistentCacheHitGET = 0;
+        GIntBig nPersistentCacheHitGETBytes = 0;
     };
 
     enum class ContextPathType
@@ -1187,6 +1365,12 @@ class NetworkStatisticsLogger
 
     static void LogDELETE();
 
+    static void LogPersistentCacheHitHEAD();
+
+    static void LogPersistentCacheHitLIST();
+
+    static void LogPersistentCacheHitGET(size_t nBytes);
+
     static void Reset();
 
     static std::string GetReportAsSerializedJSON();
@@ -1253,6 +1437,33 @@ void VSICURLInvalidateCachedFileProp(const char *pszURL);
 void VSICURLInvalidateCachedFilePropPrefix(const char *pszURL);
 void VSICURLDestroyCacheFileProp();
 
+// Persistent on-disk cache of downloaded regions (if
+// CPL_VSIL_CURL_PERSISTENT_CACHE_DIR is set)
+bool VSICurlPersistentCacheIsEnabled();
+bool VSICurlPersistentCacheGet(const char *pszURL,
+                               const cpl::FileProp &oFileProp,
+                               vsi_l_offset nOffset, std::string &osData);
+void VSICurlPersistentCachePut(const char *pszURL,
+                               const cpl::FileProp &oFileProp,
+                               vsi_l_offset nOffset, const char *pData,
+                               size_t nSize);
+
+// Persistent on-disk cache of file properties and directory listings (if
+// CPL_VSIL_CURL_PERSISTENT_CACHE_METADATA_TTL is also set)
+bool VSICurlPersistentMetadataCacheIsEnabled();
+bool VSICurlPersistentMetadataCacheGetFileProp(const char *pszURL,
+                                               cpl::FileProp &oFileProp);
+void VSICurlPersistentMetadataCachePutFileProp(const char *pszURL,
+                                               const cpl::FileProp &oFileProp);
+bool VSICurlPersistentMetadataCacheGetDirList(
+    const char *pszURL, cpl::CachedDirList &oCachedDirList,
+    std::vector<std::pair<std::string, cpl::FileProp>> &aoFileProps);
+void VSICurlPersistentMetadataCachePutDirList(
+    const char *pszURL, const cpl::CachedDirList &oCachedDirList,
+    const std::vector<std::pair<std::string, cpl::FileProp>> &aoFileProps);
+void VSICurlPersistentMetadataCacheInvalidate(const char *pszURL,
+                                              bool bDirList);
+
 void VSICURLMultiCleanup(CURLM *hCurlMultiHandle);
 
 //! @endcond
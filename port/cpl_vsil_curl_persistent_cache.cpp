@@ -0,0 +1,721 @@
+/******************************************************************************
+ *
+ * Project:  CPL - Common Portability Library
+ * Purpose:  Persistent on-disk cache of regions downloaded by /vsicurl/ and
+ *           related file systems, shared between processes.
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "cpl_port.h"
+#include "cpl_vsil_curl_class.h"
+
+#ifdef HAVE_CURL
+
+#include "cpl_conv.h"
+#include "cpl_json.h"
+#include "cpl_multiproc.h"
+#include "cpl_sha256.h"
+#include "cpl_string.h"
+#include "cpl_vsi.h"
+
+#include <algorithm>
+#include <ctime>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+//! @cond Doxygen_Suppress
+#ifndef DOXYGEN_SKIP
+
+/*
+ * Each cached chunk is stored in its own file, whose name is the SHA256
+ * hash of the URL, of the validator of the remote object (its size and
+ * ETag, or size and last modification time) and of the offset of the
+ * chunk. A modified remote object thus never hits stale chunks. Downloaded
+ * content is only stored when the ETag, Last-Modified and total size
+ * returned by the GET request match that validator, so that content of a
+ * new version of the object is never stored under the key of a previous
+ * one, when its properties come from a stale cache. Chunk files are
+ * written to a temporary file which is then renamed, so that concurrent
+ * readers, possibly in other processes, never see partial content. The
+ * directory itself is the index: no lock is needed.
+ *
+ * The modification time of chunk files is used to evict the least recently
+ * used ones when the total size of the cache exceeds its maximum size.
+ * Chunk files that are read are rewritten when their modification time is
+ * older than TOUCH_DELAY_SEC.
+ *
+ * Chunk file layout:
+ * - 8 bytes: PERSISTENT_CACHE_MAGIC
+ * - 4 bytes: size of the key, as a little-endian uint32
+ * - the key (URL, validator and offset), to detect hash collisions
+ * - the chunk data
+ *
+ * When CPL_VSIL_CURL_PERSISTENT_CACHE_METADATA_TTL is set, the results of
+ * HEAD requests (file properties) and of directory listings are also stored,
+ * with the same layout, in the "metadata" subdirectory. Their data is a JSON
+ * document. They cannot be validated against the remote object, so they are
+ * considered valid only during TTL seconds after having been written, and
+ * they are not accounted in the maximum size of the cache. Expired entries
+ * are removed when found by a lookup, and by a periodic sweep.
+ * VSICurlClearCache() does not affect them, since other processes may
+ * rely on them, but modifications made through GDAL remove them.
+ *
+ * Trust model: entries are keyed by the URL only, and a metadata entry is
+ * reused without any request to the server, so that it would disclose the
+ * existence, properties and listings of objects protected by credentials to
+ * any process sharing the cache directory. Metadata is thus only cached for
+ * /vsicurl/ files accessed without authentication
+ * (see VSICurlFilesystemHandlerBase::AllowPersistentMetadataCacheFor()).
+ * Chunks are only reused after a request to the server has returned a
+ * matching validator, which requires the same access rights. The cache
+ * directory should nevertheless only be shared by processes that are
+ * trusted to access the same data.
+ */
+
+constexpr const char PERSISTENT_CACHE_MAGIC[] = "GDALVCC1";
+constexpr size_t PERSISTENT_CACHE_MAGIC_SIZE = 8;
+constexpr size_t PERSISTENT_CACHE_HEADER_SIZE =
+    PERSISTENT_CACHE_MAGIC_SIZE + sizeof(uint32_t);
+
+constexpr int TOUCH_DELAY_SEC = 600;
+constexpr int STALE_TMP_FILE_DELAY_SEC = 3600;
+constexpr int METADATA_SWEEP_INTERVAL = 10000;
+
+/************************************************************************/
+/*                      GetPersistentCacheDir()                         */
+/************************************************************************/
+
+static std::string GetPersistentCacheDir()
+{
+    return CPLGetConfigOption("CPL_VSIL_CURL_PERSISTENT_CACHE_DIR", "");
+}
+
+/************************************************************************/
+/*                    GetPersistentCacheMaxSize()                       */
+/************************************************************************/
+
+static GIntBig GetPersistentCacheMaxSize()
+{
+    constexpr GIntBig DEFAULT_MAX_SIZE = 1024 * 1024 * 1024;
+    const char *pszSize =
+        CPLGetConfigOption("CPL_VSIL_CURL_PERSISTENT_CACHE_SIZE", nullptr);
+    GIntBig nSize = DEFAULT_MAX_SIZE;
+    if (pszSize && CPLParseMemorySize(pszSize, &nSize, nullptr) != CE_None)
+    {
+        CPLError(CE_Warning, CPLE_AppDefined,
+                 "Could not parse value for "
+                 "CPL_VSIL_CURL_PERSISTENT_CACHE_SIZE. "
+                 "Using default value of " CPL_FRMT_GIB " instead.",
+                 DEFAULT_MAX_SIZE);
+        nSize = DEFAULT_MAX_SIZE;
+    }
+    return std::max<GIntBig>(nSize, VSICURLGetDownloadChunkSize());
+}
+
+/************************************************************************/
+/*                           GetChunkKey()                              */
+/************************************************************************/
+
+static bool GetChunkKey(const char *pszURL, const cpl::FileProp &oFileProp,
+                        vsi_l_offset nOffset, std::string &osKey)
+{
+    if (!oFileProp.bHasComputedFileSize || oFileProp.bIsDirectory)
+        return false;
+
+    osKey = pszURL;
+    osKey += CPLSPrintf("\nsize=" CPL_FRMT_GUIB,
+                        static_cast<GUIntBig>(oFileProp.fileSize));
+    if (!oFileProp.ETag.empty())
+    {
+        osKey += ";etag=";
+        osKey += oFileProp.ETag;
+    }
+    else if (oFileProp.mTime > 0)
+    {
+        osKey += CPLSPrintf(";mtime=" CPL_FRMT_GIB,
+                            static_cast<GIntBig>(oFileProp.mTime));
+    }
+    else
+    {
+        // No way to detect modifications of the remote object
+        return false;
+    }
+    osKey += CPLSPrintf("\nchunk_size=%d\noffset=" CPL_FRMT_GUIB,
+                        VSICURLGetDownloadChunkSize(),
+                        static_cast<GUIntBig>(nOffset));
+    return true;
+}
+
+/************************************************************************/
+/*                         GetChunkFilename()                           */
+/************************************************************************/
+
+static std::string GetChunkFilename(const std::string &osDir,
+                                    const std::string &osKey)
+{
+    GByte abyHash[CPL_SHA256_HASH_SIZE];
+    CPL_SHA256(osKey.data(), osKey.size(), abyHash);
+    char *pszHex = CPLBinaryToHex(CPL_SHA256_HASH_SIZE, abyHash);
+    const std::string osHex(pszHex);
+    CPLFree(pszHex);
+    return CPLFormFilenameSafe(
+        CPLFormFilenameSafe(osDir.c_str(), osHex.substr(0, 2).c_str(), nullptr)
+            .c_str(),
+        osHex.c_str(), nullptr);
+}
+
+/************************************************************************/
+/*                          WriteChunkFile()                            */
+/************************************************************************/
+
+static bool WriteChunkFile(const std::string &osFilename,
+                           const std::string &osKey, const char *pData,
+                           size_t nSize)
+{
+    const std::string osTmpFilename =
+        CPLSPrintf("%s.%d." CPL_FRMT_GIB ".tmp", osFilename.c_str(),
+                   CPLGetCurrentProcessID(), CPLGetPID());
+    VSILFILE *fp = VSIFOpenL(osTmpFilename.c_str(), "wb");
+    if (fp == nullptr)
+    {
+        VSIMkdirRecursive(CPLGetPathSafe(osFilename.c_str()).c_str(), 0755);
+        fp = VSIFOpenL(osTmpFilename.c_str(), "wb");
+        if (fp == nullptr)
+            return false;
+    }
+
+    uint32_t nKeySize = static_cast<uint32_t>(osKey.size());
+    CPL_LSBPTR32(&nKeySize);
+    bool bOK =
+        VSIFWriteL(PERSISTENT_CACHE_MAGIC, PERSISTENT_CACHE_MAGIC_SIZE, 1,
+                   fp) == 1 &&
+        VSIFWriteL(&nKeySize, sizeof(nKeySize), 1, fp) == 1 &&
+        VSIFWriteL(osKey.data(), 1, osKey.size(), fp) == osKey.size() &&
+        VSIFWriteL(pData, 1, nSize, fp) == nSize;
+    bOK = VSIFCloseL(fp) == 0 && bOK;
+
+    // Readers either see the previous version of the file or the new one.
+    if (!bOK || VSIRename(osTmpFilename.c_str(), osFilename.c_str()) != 0)
+    {
+        VSIUnlink(osTmpFilename.c_str());
+        return false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                         EvictChunkFiles()                            */
+/************************************************************************/
+
+static void EvictChunkFiles(const std::string &osDir, GIntBig nMaxSize)
+{
+    struct ChunkFile
+    {
+        std::string osFilename;
+        GIntBig nMTime;
+        GIntBig nSize;
+    };
+
+    std::vector<ChunkFile> asFiles;
+    GIntBig nTotalSize = 0;
+    const GIntBig nNow = static_cast<GIntBig>(time(nullptr));
+
+    VSIDIR *psDir = VSIOpenDir(osDir.c_str(), 1, nullptr);
+    if (psDir == nullptr)
+        return;
+    while (const VSIDIREntry *psEntry = VSIGetNextDirEntry(psDir))
+    {
+        if (!psEntry->bModeKnown || !VSI_ISREG(psEntry->nMode) ||
+            !psEntry->bSizeKnown || !psEntry->bMTimeKnown)
+        {
+            continue;
+        }
+        const std::string osFilename =
+            CPLFormFilenameSafe(osDir.c_str(), psEntry->pszName, nullptr);
+        const char *pszBasename = CPLGetFilename(psEntry->pszName);
+        if (cpl::ends_with(std::string(pszBasename), ".tmp"))
+        {
+            // Left behind by a killed process
+            if (psEntry->nMTime < nNow - STALE_TMP_FILE_DELAY_SEC)
+                VSIUnlink(osFilename.c_str());
+            continue;
+        }
+        if (strlen(pszBasename) != 2 * CPL_SHA256_HASH_SIZE)
+            continue;
+        const GIntBig nSize = static_cast<GIntBig>(psEntry->nSize);
+        asFiles.push_back(ChunkFile{osFilename, psEntry->nMTime, nSize});
+        nTotalSize += nSize;
+    }
+    VSICloseDir(psDir);
+
+    if (nTotalSize <= nMaxSize)
+        return;
+
+    // Evict least recently used chunks, until we are 10% below the limit
+    std::sort(asFiles.begin(), asFiles.end(),
+              [](const ChunkFile &a, const ChunkFile &b)
+              { return a.nMTime < b.nMTime; });
+    const GIntBig nTargetSize = nMaxSize / 10 * 9;
+    int nEvicted = 0;
+    for (const auto &sFile : asFiles)
+    {
+        if (nTotalSize <= nTargetSize)
+            break;
+        // Failure can be due to another process having evicted it already
+        VSIUnlink(sFile.osFilename.c_str());
+        nTotalSize -= sFile.nSize;
+        ++nEvicted;
+    }
+    CPLDebug("VSICURL", "Persistent cache %s: %d chunk files evicted",
+             osDir.c_str(), nEvicted);
+}
+
+/************************************************************************/
+/*                        RegisterChunkWrite()                          */
+/*                                                                      */
+/*      Check the size of the cache when this process has written       */
+/*      more than 10% of the maximum size since the last check, as      */
+/*      well as at the first write.                                     */
+/************************************************************************/
+
+static void RegisterChunkWrite(const std::string &osDir, size_t nSize)
+{
+    static std::mutex oMutex;
+    static std::string osLastDir;
+    static GIntBig nBytesWritten = 0;
+
+    const GIntBig nMaxSize = GetPersistentCacheMaxSize();
+    {
+        std::lock_guard<std::mutex> oLock(oMutex);
+        if (osDir == osLastDir)
+        {
+            nBytesWritten += static_cast<GIntBig>(nSize);
+            if (nBytesWritten < nMaxSize / 10)
+                return;
+        }
+        osLastDir = osDir;
+        nBytesWritten = 0;
+    }
+
+    static std::mutex oEvictionMutex;
+    std::unique_lock<std::mutex> oLock(oEvictionMutex, std::try_to_lock);
+    if (oLock.owns_lock())
+        EvictChunkFiles(osDir, nMaxSize);
+}
+
+/************************************************************************/
+/*                          ReadCacheFile()                             */
+/************************************************************************/
+
+static bool ReadCacheFile(const std::string &osFilename,
+                          const std::string &osKey, size_t nMaxDataSize,
+                          std::string &osData, GIntBig &nMTime)
+{
+    VSIStatBufL sStat;
+    if (VSIStatL(osFilename.c_str(), &sStat) != 0 ||
+        static_cast<size_t>(sStat.st_size) <
+            PERSISTENT_CACHE_HEADER_SIZE + osKey.size() ||
+        static_cast<size_t>(sStat.st_size) >
+            PERSISTENT_CACHE_HEADER_SIZE + osKey.size() + nMaxDataSize)
+    {
+        return false;
+    }
+    nMTime = static_cast<GIntBig>(sStat.st_mtime);
+
+    VSILFILE *fp = VSIFOpenL(osFilename.c_str(), "rb");
+    if (fp == nullptr)
+        return false;
+    std::string osContent;
+    osContent.resize(static_cast<size_t>(sStat.st_size));
+    const bool bReadOK =
+        VSIFReadL(&osContent[0], 1, osContent.size(), fp) == osContent.size();
+    VSIFCloseL(fp);
+
+    uint32_t nKeySize = 0;
+    if (bReadOK)
+    {
+        memcpy(&nKeySize, osContent.data() + PERSISTENT_CACHE_MAGIC_SIZE,
+               sizeof(nKeySize));
+        CPL_LSBPTR32(&nKeySize);
+    }
+    if (!bReadOK ||
+        memcmp(osContent.data(), PERSISTENT_CACHE_MAGIC,
+               PERSISTENT_CACHE_MAGIC_SIZE) != 0 ||
+        nKeySize != osKey.size() ||
+        memcmp(osContent.data() + PERSISTENT_CACHE_HEADER_SIZE, osKey.data(),
+               osKey.size()) != 0)
+    {
+        CPLDebug("VSICURL", "Invalid persistent cache file %s",
+                 osFilename.c_str());
+        return false;
+    }
+
+    osData = osContent.substr(PERSISTENT_CACHE_HEADER_SIZE + osKey.size());
+    return true;
+}
+
+/************************************************************************/
+/*                   VSICurlPersistentCacheIsEnabled()                  */
+/************************************************************************/
+
+bool VSICurlPersistentCacheIsEnabled()
+{
+    return !GetPersistentCacheDir().empty();
+}
+
+/************************************************************************/
+/*                     VSICurlPersistentCacheGet()                      */
+/************************************************************************/
+
+bool VSICurlPersistentCacheGet(const char *pszURL,
+                               const cpl::FileProp &oFileProp,
+                               vsi_l_offset nOffset, std::string &osData)
+{
+    const std::string osDir = GetPersistentCacheDir();
+    std::string osKey;
+    if (osDir.empty() || !GetChunkKey(pszURL, oFileProp, nOffset, osKey))
+        return false;
+    const std::string osFilename = GetChunkFilename(osDir, osKey);
+
+    GIntBig nMTime = 0;
+    if (!ReadCacheFile(osFilename, osKey,
+                       static_cast<size_t>(VSICURLGetDownloadChunkSize()),
+                       osData, nMTime))
+    {
+        return false;
+    }
+    cpl::NetworkStatisticsLogger::LogPersistentCacheHitGET(osData.size());
+
+    if (nMTime < static_cast<GIntBig>(time(nullptr)) - TOUCH_DELAY_SEC)
+    {
+        WriteChunkFile(osFilename, osKey, osData.data(), osData.size());
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                     VSICurlPersistentCachePut()                      */
+/************************************************************************/
+
+void VSICurlPersistentCachePut(const char *pszURL,
+                               const cpl::FileProp &oFileProp,
+                               vsi_l_offset nOffset, const char *pData,
+                               size_t nSize)
+{
+    const std::string osDir = GetPersistentCacheDir();
+    std::string osKey;
+    if (osDir.empty() || !GetChunkKey(pszURL, oFileProp, nOffset, osKey))
+        return;
+    const std::string osFilename = GetChunkFilename(osDir, osKey);
+
+    VSIStatBufL sStat;
+    if (VSIStatL(osFilename.c_str(), &sStat) == 0)
+        return;
+
+    if (WriteChunkFile(osFilename, osKey, pData, nSize))
+        RegisterChunkWrite(osDir,
+                           PERSISTENT_CACHE_HEADER_SIZE + osKey.size() + nSize);
+}
+
+/************************************************************************/
+/*                      GetMetadataCacheDir()                           */
+/*                                                                      */
+/*      Returns an empty string if the metadata cache is disabled.      */
+/************************************************************************/
+
+static std::string GetMetadataCacheDir(int &nTTL)
+{
+    nTTL = atoi(
+        CPLGetConfigOption("CPL_VSIL_CURL_PERSISTENT_CACHE_METADATA_TTL", "0"));
+    const std::string osDir = GetPersistentCacheDir();
+    if (nTTL <= 0 || osDir.empty())
+        return std::string();
+    return CPLFormFilenameSafe(osDir.c_str(), "metadata", nullptr);
+}
+
+/************************************************************************/
+/*                    VSICurlPersistentMetadataCacheIsEnabled()         */
+/************************************************************************/
+
+bool VSICurlPersistentMetadataCacheIsEnabled()
+{
+    int nTTL = 0;
+    return !GetMetadataCacheDir(nTTL).empty();
+}
+
+/************************************************************************/
+/*                         SweepMetadataFiles()                         */
+/************************************************************************/
+
+static void SweepMetadataFiles(const std::string &osDir, int nTTL)
+{
+    const GIntBig nNow = static_cast<GIntBig>(time(nullptr));
+    int nRemoved = 0;
+    VSIDIR *psDir = VSIOpenDir(osDir.c_str(), 1, nullptr);
+    if (psDir == nullptr)
+        return;
+    while (const VSIDIREntry *psEntry = VSIGetNextDirEntry(psDir))
+    {
+        if (!psEntry->bModeKnown || !VSI_ISREG(psEntry->nMode) ||
+            !psEntry->bMTimeKnown)
+        {
+            continue;
+        }
+        const bool bIsTmp =
+            cpl::ends_with(std::string(psEntry->pszName), ".tmp");
+        if (psEntry->nMTime <
+            nNow - (bIsTmp ? STALE_TMP_FILE_DELAY_SEC : nTTL))
+        {
+            VSIUnlink(
+                CPLFormFilenameSafe(osDir.c_str(), psEntry->pszName, nullptr)
+                    .c_str());
+            ++nRemoved;
+        }
+    }
+    VSICloseDir(psDir);
+    CPLDebug("VSICURL", "Persistent metadata cache %s: %d files removed",
+             osDir.c_str(), nRemoved);
+}
+
+/************************************************************************/
+/*                      RegisterMetadataWrite()                         */
+/*                                                                      */
+/*      Sweep expired entries at the first write of this process, and   */
+/*      then every METADATA_SWEEP_INTERVAL writes.                      */
+/************************************************************************/
+
+static void RegisterMetadataWrite(const std::string &osDir, int nTTL)
+{
+    static std::mutex oMutex;
+    static std::string osLastDir;
+    static int nWrites = 0;
+    {
+        std::lock_guard<std::mutex> oLock(oMutex);
+        if (osDir == osLastDir && ++nWrites < METADATA_SWEEP_INTERVAL)
+            return;
+        osLastDir = osDir;
+        nWrites = 0;
+    }
+
+    static std::mutex oSweepMutex;
+    std::unique_lock<std::mutex> oLock(oSweepMutex, std::try_to_lock);
+    if (oLock.owns_lock())
+        SweepMetadataFiles(osDir, nTTL);
+}
+
+/************************************************************************/
+/*                          GetMetadataKey()                            */
+/************************************************************************/
+
+static std::string GetMetadataKey(const std::string &osURL,
+                                  const char *pszKind)
+{
+    return std::string(pszKind).append("\n").append(osURL);
+}
+
+/************************************************************************/
+/*                         GetMetadataEntry()                           */
+/************************************************************************/
+
+static bool GetMetadataEntry(const std::string &osURL, const char *pszKind,
+                             CPLJSONObject &oRoot)
+{
+    int nTTL = 0;
+    const std::string osDir = GetMetadataCacheDir(nTTL);
+    if (osDir.empty())
+        return false;
+    const std::string osKey = GetMetadataKey(osURL, pszKind);
+    const std::string osFilename = GetChunkFilename(osDir, osKey);
+
+    // Arbitrary limit. Listings of very large directories are not cached
+    // by VSICurlFilesystemHandlerBase anyway.
+    constexpr size_t MAX_METADATA_SIZE = 100 * 1024 * 1024;
+    std::string osData;
+    GIntBig nMTime = 0;
+    if (!ReadCacheFile(osFilename, osKey, MAX_METADATA_SIZE, osData, nMTime))
+        return false;
+    if (nMTime < static_cast<GIntBig>(time(nullptr)) - nTTL)
+    {
+        VSIUnlink(osFilename.c_str());
+        return false;
+    }
+    CPLJSONDocument oDoc;
+    if (!oDoc.LoadMemory(osData))
+        return false;
+    oRoot = oDoc.GetRoot();
+    return true;
+}
+
+/************************************************************************/
+/*                         PutMetadataEntry()                           */
+/************************************************************************/
+
+static void PutMetadataEntry(const std::string &osURL, const char *pszKind,
+                             const CPLJSONObject &oRoot)
+{
+    int nTTL = 0;
+    const std::string osDir = GetMetadataCacheDir(nTTL);
+    if (osDir.empty())
+        return;
+    const std::string osKey = GetMetadataKey(osURL, pszKind);
+    const std::string osData = oRoot.Format(CPLJSONObject::PrettyFormat::Plain);
+    if (WriteChunkFile(GetChunkFilename(osDir, osKey), osKey, osData.data(),
+                       osData.size()))
+    {
+        RegisterMetadataWrite(osDir, nTTL);
+    }
+}
+
+/************************************************************************/
+/*                        RemoveMetadataEntry()                         */
+/************************************************************************/
+
+static void RemoveMetadataEntry(const std::string &osURL, const char *pszKind)
+{
+    int nTTL = 0;
+    const std::string osDir = GetMetadataCacheDir(nTTL);
+    if (osDir.empty())
+        return;
+    const std::string osKey = GetMetadataKey(osURL, pszKind);
+    VSIUnlink(GetChunkFilename(osDir, osKey).c_str());
+}
+
+/************************************************************************/
+/*                       FileProp serialization                         */
+/************************************************************************/
+
+constexpr const char *FILE_PROP_KIND = "fileprop";
+constexpr const char *DIR_LIST_KIND = "dirlist";
+
+static CPLJSONObject FilePropToJSON(const cpl::FileProp &oFileProp)
+{
+    CPLJSONObject oObj;
+    oObj.Add("exists", oFileProp.eExists == cpl::EXIST_YES);
+    oObj.Add("http_code", oFileProp.nHTTPCode);
+    oObj.Add("size", static_cast<uint64_t>(oFileProp.fileSize));
+    oObj.Add("mtime", static_cast<GInt64>(oFileProp.mTime));
+    oObj.Add("has_computed_size", oFileProp.bHasComputedFileSize);
+    oObj.Add("is_dir", oFileProp.bIsDirectory);
+    oObj.Add("is_azure_folder", oFileProp.bIsAzureFolder);
+    oObj.Add("mode", oFileProp.nMode);
+    oObj.Add("etag", oFileProp.ETag);
+    return oObj;
+}
+
+static void FilePropFromJSON(const CPLJSONObject &oObj,
+                             cpl::FileProp &oFileProp)
+{
+    oFileProp.eExists =
+        oObj.GetBool("exists") ? cpl::EXIST_YES : cpl::EXIST_NO;
+    oFileProp.nHTTPCode = oObj.GetInteger("http_code");
+    oFileProp.fileSize = static_cast<vsi_l_offset>(oObj.GetLong("size"));
+    oFileProp.mTime = static_cast<time_t>(oObj.GetLong("mtime"));
+    oFileProp.bHasComputedFileSize = oObj.GetBool("has_computed_size");
+    oFileProp.bIsDirectory = oObj.GetBool("is_dir");
+    oFileProp.bIsAzureFolder = oObj.GetBool("is_azure_folder");
+    oFileProp.nMode = oObj.GetInteger("mode");
+    oFileProp.ETag = oObj.GetString("etag");
+}
+
+/************************************************************************/
+/*               VSICurlPersistentMetadataCacheGetFileProp()            */
+/************************************************************************/
+
+bool VSICurlPersistentMetadataCacheGetFileProp(const char *pszURL,
+                                               cpl::FileProp &oFileProp)
+{
+    CPLJSONObject oRoot;
+    if (!GetMetadataEntry(pszURL, FILE_PROP_KIND, oRoot))
+        return false;
+    FilePropFromJSON(oRoot, oFileProp);
+    cpl::NetworkStatisticsLogger::LogPersistentCacheHitHEAD();
+    return true;
+}
+
+/************************************************************************/
+/*               VSICurlPersistentMetadataCachePutFileProp()            */
+/************************************************************************/
+
+void VSICurlPersistentMetadataCachePutFileProp(const char *pszURL,
+                                               const cpl::FileProp &oFileProp)
+{
+    // Only cache definitive answers: a 403 for example could be solved
+    // by other credentials.
+    if (oFileProp.eExists == cpl::EXIST_YES ||
+        (oFileProp.eExists == cpl::EXIST_NO && oFileProp.nHTTPCode == 404))
+    {
+        PutMetadataEntry(pszURL, FILE_PROP_KIND, FilePropToJSON(oFileProp));
+    }
+}
+
+/************************************************************************/
+/*               VSICurlPersistentMetadataCacheGetDirList()             */
+/************************************************************************/
+
+bool VSICurlPersistentMetadataCacheGetDirList(
+    const char *pszURL, cpl::CachedDirList &oCachedDirList,
+    std::vector<std::pair<std::string, cpl::FileProp>> &aoFileProps)
+{
+    CPLJSONObject oRoot;
+    if (!GetMetadataEntry(pszURL, DIR_LIST_KIND, oRoot))
+        return false;
+    oCachedDirList.bGotFileList = oRoot.GetBool("got_file_list");
+    oCachedDirList.oFileList.Clear();
+    for (const auto &oName : oRoot.GetArray("files"))
+        oCachedDirList.oFileList.AddString(oName.ToString().c_str());
+    aoFileProps.clear();
+    for (const auto &oObj : oRoot.GetArray("file_props"))
+    {
+        cpl::FileProp oFileProp;
+        FilePropFromJSON(oObj, oFileProp);
+        aoFileProps.emplace_back(oObj.GetString("url"), std::move(oFileProp));
+    }
+    cpl::NetworkStatisticsLogger::LogPersistentCacheHitLIST();
+    return true;
+}
+
+/************************************************************************/
+/*               VSICurlPersistentMetadataCachePutDirList()             */
+/************************************************************************/
+
+void VSICurlPersistentMetadataCachePutDirList(
+    const char *pszURL, const cpl::CachedDirList &oCachedDirList,
+    const std::vector<std::pair<std::string, cpl::FileProp>> &aoFileProps)
+{
+    CPLJSONObject oRoot;
+    oRoot.Add("got_file_list", oCachedDirList.bGotFileList);
+    CPLJSONArray oFiles;
+    for (const char *pszName : oCachedDirList.oFileList)
+        oFiles.Add(pszName);
+    oRoot.Add("files", oFiles);
+    CPLJSONArray oFileProps;
+    for (const auto &oIter : aoFileProps)
+    {
+        CPLJSONObject oObj = FilePropToJSON(oIter.second);
+        oObj.Add("url", oIter.first);
+        oFileProps.Add(oObj);
+    }
+    oRoot.Add("file_props", oFileProps);
+    PutMetadataEntry(pszURL, DIR_LIST_KIND, oRoot);
+}
+
+/************************************************************************/
+/*               VSICurlPersistentMetadataCacheInvalidate()             */
+/************************************************************************/
+
+void VSICurlPersistentMetadataCacheInvalidate(const char *pszURL,
+                                              bool bDirList)
+{
+    RemoveMetadataEntry(pszURL, bDirList ? DIR_LIST_KIND : FILE_PROP_KIND);
+}
+
+#endif  // DOXYGEN_SKIP
+//! @endcond
+
+#endif  // HAVE_CURL
@@ -254,7 +254,10 @@ const char *VSIGSFSHandler::GetOptions()
             .append(CPLSPrintf("%d", GetMinimumPartSizeInMiB()))
             .append("' max='")
             .append(CPLSPrintf("%d", GetMaximumPartSizeInMiB()))
-            .append("'/>")
+            .append("'/>"
+                    "  <Option name='CPL_VSIL_UPLOAD_NUM_THREADS' "
+                    "type='string' description='Number of parts uploaded in "
+                    "parallel. Either an integer or ALL_CPUS' default='1'/>")
             .append(VSICurlFilesystemHandlerBase::GetOptionsStatic())
             .append("</Options>"));
     return osOptions.c_str();
@@ -82,6 +82,7 @@
 #endif
 
 #include <algorithm>
+#include <condition_variable>
 #include <iterator>
 #include <limits>
 #include <list>
@@ -96,6 +97,7 @@
 #include "cpl_minizip_ioapi.h"
 #include "cpl_minizip_unzip.h"
 #include "cpl_multiproc.h"
+#include "cpl_sha256.h"
 #include "cpl_string.h"
 #include "cpl_time.h"
 #include "cpl_vsi_virtual.h"
@@ -2959,6 +2961,1347 @@ vsi_l_offset VSIGZipWriteHandle::Tell()
     return nCurOffset;
 }
 
+/************************************************************************/
+/* ==================================================================== */
+/*                       VSIGZipIndexedHandle                           */
+/* ==================================================================== */
+/************************************************************************/
+
+// Reader of .gz files that maintains an index of access points in the
+// deflate stream, in the spirit of zlib's examples/zran.c, so that the spans
+// between two consecutive access points can be decompressed independently,
+// and thus in parallel.
+//
+// For files made of independent blocks, as written by VSIGZipWriteHandleMT
+// (that is with GDAL_NUM_THREADS set) or "pigz --independent", access points
+// are found by looking for the markers emitted at each Z_FULL_FLUSH, without
+// having to decompress, so the whole file can be decompressed in parallel.
+// For other files, the index is built while decompressing sequentially, and
+// is used for parallel decompression once complete, that is when data is read
+// again, or when the index has been persisted in a .gzidx file.
+//
+// If something unexpected is met (concatenated .gz members, trailing data),
+// reading is delegated to a VSIGZipHandle.
+
+class VSIGZipIndexedHandle final : public VSIVirtualHandle
+{
+    CPL_DISALLOW_COPY_ASSIGN(VSIGZipIndexedHandle)
+
+    static constexpr vsi_l_offset UNKNOWN_OFFSET =
+        std::numeric_limits<vsi_l_offset>::max();
+
+    // Size of uncompressed data between access points created while
+    // decompressing sequentially.
+    static constexpr size_t SPAN_SIZE = 4 * 1024 * 1024;
+    // Size of the deflate sliding window.
+    static constexpr size_t WINDOW_SIZE = 32768;
+    // Minimum and maximum size of compressed data between access points in
+    // a file made of independent blocks.
+    static constexpr size_t MIN_INDEPENDENT_SPAN_SIZE = 256 * 1024;
+    static constexpr size_t MAX_INDEPENDENT_SPAN_SIZE = 4 * 1024 * 1024;
+    // Maximum size of uncompressed data of a span whose size is not known.
+    static constexpr size_t MAX_UNKNOWN_SPAN_SIZE = 64 * 1024 * 1024;
+
+    struct AccessPoint
+    {
+        // Offset of the first byte after the access point
+        vsi_l_offset nCompressedOffset = 0;
+        // Number of bits of the byte before nCompressedOffset that belong to
+        // the data after the access point (0 to 7)
+        int nBits = 0;
+        vsi_l_offset nUncompressedOffset = UNKNOWN_OFFSET;
+        // Up to 32 KB of uncompressed data preceding the access point.
+        // Empty for independent blocks.
+        std::string osWindow{};
+        // CRC32 of the uncompressed data of the span starting at this point
+        bool bHasCRC = false;
+        uLong nCRC = 0;
+    };
+
+    struct Span
+    {
+        // Input
+        vsi_l_offset nInputOffset = 0;
+        std::string osInput{};
+        int nBits = 0;
+        std::string osWindow{};
+        vsi_l_offset nExpectedSize = UNKNOWN_OFFSET;
+
+        // Output
+        bool bDone = false;  // protected by m_oMutex
+        bool bOK = false;
+        bool bIOError = false;
+        bool bStreamEnd = false;
+        vsi_l_offset nDeflateEnd = 0;
+        std::string osData{};
+        uLong nCRC = 0;
+
+        bool bProcessed = false;
+    };
+
+    std::string m_osBaseFilename{};
+    VSIVirtualHandle *m_poBaseHandle = nullptr;
+    vsi_l_offset m_nCompressedSize = 0;
+    GIntBig m_nMTime = 0;
+    int m_nThreads = 1;
+    bool m_bWriteIndex = false;
+
+    std::vector<AccessPoint> m_aoPoints{};
+    bool m_bAllPointsKnown = false;
+    vsi_l_offset m_nDeflateEnd = UNKNOWN_OFFSET;
+    vsi_l_offset m_nUncompressedSize = UNKNOWN_OFFSET;
+    bool m_bIndexLoaded = false;
+
+    // Whether access points are looked for with Z_FULL_FLUSH markers
+    bool m_bIndependentBlocks = true;
+    // Compressed data after the last access point, while looking for the
+    // next one
+    std::string m_osScanBuffer{};
+    size_t m_nScanSearchFrom = 0;
+    std::map<size_t, std::string> m_oMapScannedInput{};
+
+    std::mutex m_oMutex{};
+    std::condition_variable m_oCV{};
+    std::map<size_t, std::shared_ptr<Span>> m_oMapSpans{};
+    std::unique_ptr<CPLWorkerThreadPool> m_poPool{};
+    std::unique_ptr<CPLJobQueue> m_poJobQueue{};
+
+    vsi_l_offset m_nCurPos = 0;
+    bool m_bEOF = false;
+    bool m_bError = false;
+    std::unique_ptr<VSIGZipHandle> m_poFallbackHandle{};
+
+    VSIGZipIndexedHandle(const char *pszBaseFilename,
+                         VSIVirtualHandle *poBaseHandle,
+                         vsi_l_offset nDataStart, int nThreads,
+                         bool bWriteIndex);
+
+    std::string GetIndexFilename() const;
+    bool LoadIndex();
+    void SaveIndex();
+
+    size_t GetReadAheadCount() const
+    {
+        return 2 * static_cast<size_t>(m_nThreads);
+    }
+
+    bool IsSpanDecodable(size_t iSpan) const
+    {
+        return iSpan + 1 < m_aoPoints.size() ||
+               (m_bAllPointsKnown && iSpan + 1 == m_aoPoints.size());
+    }
+
+    size_t FindSpan(vsi_l_offset nOffset) const;
+    bool ScanNextPoint();
+    std::shared_ptr<Span> PrepareSpan(size_t iSpan);
+    void SubmitSpan(size_t iSpan);
+    static void DecodeSpan(Span &oSpan);
+    std::shared_ptr<Span> DecodeSpanSequentially(size_t iSpan);
+    std::shared_ptr<Span> GetSpan(size_t iSpan);
+    bool ProcessDecodedSpan(size_t iSpan, Span &oSpan);
+    void CheckCRC();
+    void WaitPendingSpans();
+    void SwitchToSequential(size_t iRestartPoint);
+    bool SwitchToFallback();
+
+  public:
+    ~VSIGZipIndexedHandle() override;
+
+    static VSIGZipIndexedHandle *Open(const char *pszBaseFilename,
+                                      int nThreads, bool bWriteIndex);
+
+    int Seek(vsi_l_offset nOffset, int nWhence) override;
+    vsi_l_offset Tell() override;
+    size_t Read(void *pBuffer, size_t nSize, size_t nMemb) override;
+
+    size_t Write(const void *, size_t, size_t) override
+    {
+        return 0;
+    }
+
+    int Eof() override;
+    int Error() override;
+    void ClearErr() override;
+    int Close() override;
+};
+
+constexpr char GZIP_INDEX_SIGNATURE[] = "GDALGZI1";
+
+/************************************************************************/
+/*                       VSIGZipGetHeaderSize()                         */
+/************************************************************************/
+
+// Return the size of the gzip header, or 0 if it is invalid.
+static vsi_l_offset VSIGZipGetHeaderSize(VSIVirtualHandle *poHandle)
+{
+    GByte abyHeader[10];
+    if (poHandle->Seek(0, SEEK_SET) != 0 ||
+        poHandle->Read(abyHeader, 1, sizeof(abyHeader)) != sizeof(abyHeader) ||
+        abyHeader[0] != gz_magic[0] || abyHeader[1] != gz_magic[1] ||
+        abyHeader[2] != Z_DEFLATED || (abyHeader[3] & RESERVED) != 0)
+    {
+        return 0;
+    }
+    const int nFlags = abyHeader[3];
+    vsi_l_offset nSize = sizeof(abyHeader);
+    if (nFlags & EXTRA_FIELD)
+    {
+        GByte abyLen[2];
+        if (poHandle->Read(abyLen, 1, 2) != 2)
+            return 0;
+        nSize += 2 + (abyLen[0] | (abyLen[1] << 8));
+        if (poHandle->Seek(nSize, SEEK_SET) != 0)
+            return 0;
+    }
+    for (const int nFlag : {ORIG_NAME, COMMENT})
+    {
+        if (nFlags & nFlag)
+        {
+            // Skip zero-terminated string
+            GByte byChar = 1;
+            while (byChar != 0)
+            {
+                if (poHandle->Read(&byChar, 1, 1) != 1)
+                    return 0;
+                ++nSize;
+            }
+        }
+    }
+    if (nFlags & HEAD_CRC)
+        nSize += 2;
+    return nSize;
+}
+
+/************************************************************************/
+/*                       VSIGZipIndexedHandle()                         */
+/************************************************************************/
+
+VSIGZipIndexedHandle::VSIGZipIndexedHandle(const char *pszBaseFilename,
+                                           VSIVirtualHandle *poBaseHandle,
+                                           vsi_l_offset nDataStart,
+                                           int nThreads, bool bWriteIndex)
+    : m_osBaseFilename(pszBaseFilename), m_poBaseHandle(poBaseHandle),
+      m_nThreads(nThreads), m_bWriteIndex(bWriteIndex)
+{
+    m_poBaseHandle->Seek(0, SEEK_END);
+    m_nCompressedSize = m_poBaseHandle->Tell();
+
+    VSIStatBufL sStat;
+    if (VSIStatL(pszBaseFilename, &sStat) == 0)
+        m_nMTime = static_cast<GIntBig>(sStat.st_mtime);
+
+    AccessPoint oFirstPoint;
+    oFirstPoint.nCompressedOffset = nDataStart;
+    oFirstPoint.nUncompressedOffset = 0;
+    m_aoPoints.push_back(std::move(oFirstPoint));
+}
+
+/************************************************************************/
+/*                       ~VSIGZipIndexedHandle()                        */
+/************************************************************************/
+
+VSIGZipIndexedHandle::~VSIGZipIndexedHandle()
+{
+    VSIGZipIndexedHandle::Close();
+}
+
+/************************************************************************/
+/*                                Open()                                */
+/************************************************************************/
+
+VSIGZipIndexedHandle *VSIGZipIndexedHandle::Open(const char *pszBaseFilename,
+                                                 int nThreads,
+                                                 bool bWriteIndex)
+{
+    VSIFilesystemHandler *poFSHandler =
+        VSIFileManager::GetHandler(pszBaseFilename);
+    VSIVirtualHandle *poBaseHandle = poFSHandler->Open(pszBaseFilename, "rb");
+    if (poBaseHandle == nullptr)
+        return nullptr;
+
+    const vsi_l_offset nDataStart = VSIGZipGetHeaderSize(poBaseHandle);
+    if (nDataStart == 0)
+    {
+        poBaseHandle->Close();
+        delete poBaseHandle;
+        return nullptr;
+    }
+
+    auto poHandle = new VSIGZipIndexedHandle(pszBaseFilename, poBaseHandle,
+                                             nDataStart, nThreads, bWriteIndex);
+    poHandle->LoadIndex();
+    return poHandle;
+}
+
+/************************************************************************/
+/*                          GetIndexFilename()                          */
+/************************************************************************/
+
+std::string VSIGZipIndexedHandle::GetIndexFilename() const
+{
+    const char *pszIndexDir =
+        CPLGetConfigOption("CPL_VSIL_GZIP_INDEX_DIR", nullptr);
+    if (pszIndexDir && pszIndexDir[0])
+    {
+        // Add a hash of the full filename, to distinguish files with the
+        // same name in different directories.
+        GByte abyHash[CPL_SHA256_HASH_SIZE];
+        CPL_SHA256(m_osBaseFilename.data(), m_osBaseFilename.size(), abyHash);
+        char *pszHex = CPLBinaryToHex(8, abyHash);
+        const std::string osFilename = std::string(CPLGetFilename(
+                                           m_osBaseFilename.c_str())) +
+                                       '.' + pszHex + ".gzidx";
+        CPLFree(pszHex);
+        return CPLFormFilenameSafe(pszIndexDir, osFilename.c_str(), nullptr);
+    }
+    return m_osBaseFilename + ".gzidx";
+}
+
+/************************************************************************/
+/*                             LoadIndex()                              */
+/************************************************************************/
+
+bool VSIGZipIndexedHandle::LoadIndex()
+{
+    const std::string osIndexFilename = GetIndexFilename();
+    std::string osIndex;
+    {
+        CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+        VSILFILE *fp = VSIFOpenL(osIndexFilename.c_str(), "rb");
+        if (fp == nullptr)
+            return false;
+        VSIFSeekL(fp, 0, SEEK_END);
+        const vsi_l_offset nSize = VSIFTellL(fp);
+        if (nSize < 100 * 1024 * 1024)
+        {
+            osIndex.resize(static_cast<size_t>(nSize));
+            VSIFSeekL(fp, 0, SEEK_SET);
+            if (VSIFReadL(&osIndex[0], 1, osIndex.size(), fp) != osIndex.size())
+                osIndex.clear();
+        }
+        VSIFCloseL(fp);
+    }
+
+    size_t nPos = 0;
+    const auto ReadBytes = [&osIndex, &nPos](void *pDst, size_t nBytes)
+    {
+        if (nBytes > osIndex.size() - nPos)
+            return false;
+        memcpy(pDst, osIndex.data() + nPos, nBytes);
+        nPos += nBytes;
+        return true;
+    };
+    const auto ReadUInt64 = [&ReadBytes](uint64_t &nVal)
+    {
+        if (!ReadBytes(&nVal, sizeof(nVal)))
+            return false;
+        CPL_LSBPTR64(&nVal);
+        return true;
+    };
+    const auto ReadUInt32 = [&ReadBytes](uint32_t &nVal)
+    {
+        if (!ReadBytes(&nVal, sizeof(nVal)))
+            return false;
+        CPL_LSBPTR32(&nVal);
+        return true;
+    };
+
+    const auto Invalid = [&osIndexFilename]()
+    {
+        CPLDebug("GZIP", "Ignoring invalid or outdated index %s",
+                 osIndexFilename.c_str());
+        return false;
+    };
+
+    char szSignature[sizeof(GZIP_INDEX_SIGNATURE) - 1];
+    uint64_t nCompressedSize = 0;
+    uint64_t nMTime = 0;
+    uint64_t nUncompressedSize = 0;
+    uint64_t nDeflateEnd = 0;
+    uint32_t nPoints = 0;
+    if (!ReadBytes(szSignature, sizeof(szSignature)) ||
+        memcmp(szSignature, GZIP_INDEX_SIGNATURE, sizeof(szSignature)) != 0 ||
+        !ReadUInt64(nCompressedSize) || !ReadUInt64(nMTime) ||
+        !ReadUInt64(nUncompressedSize) || !ReadUInt64(nDeflateEnd) ||
+        !ReadUInt32(nPoints) || nCompressedSize != m_nCompressedSize ||
+        static_cast<GIntBig>(nMTime) != m_nMTime || nPoints == 0 ||
+        nDeflateEnd > nCompressedSize)
+    {
+        return Invalid();
+    }
+
+    std::vector<AccessPoint> aoPoints;
+    for (uint32_t i = 0; i < nPoints; ++i)
+    {
+        AccessPoint oPoint;
+        uint64_t nCompressedOffset = 0;
+        GByte nBits = 0;
+        GByte bHasCRC = 0;
+        uint32_t nCRC = 0;
+        uint64_t nUncompressedOffset = 0;
+        uint32_t nWindowCompressedSize = 0;
+        if (!ReadUInt64(nCompressedOffset) || !ReadBytes(&nBits, 1) ||
+            !ReadUInt64(nUncompressedOffset) || !ReadBytes(&bHasCRC, 1) ||
+            !ReadUInt32(nCRC) || !ReadUInt32(nWindowCompressedSize) ||
+            nWindowCompressedSize > osIndex.size() - nPos || nBits > 7 ||
+            nCompressedOffset > nDeflateEnd ||
+            nUncompressedOffset > nUncompressedSize ||
+            (i == 0 ? (nCompressedOffset != m_aoPoints[0].nCompressedOffset ||
+                       nBits != 0 || nUncompressedOffset != 0)
+                    : (nCompressedOffset <=
+                           aoPoints.back().nCompressedOffset ||
+                       nUncompressedOffset <=
+                           aoPoints.back().nUncompressedOffset)))
+        {
+            return Invalid();
+        }
+        oPoint.nCompressedOffset = nCompressedOffset;
+        oPoint.nBits = nBits;
+        oPoint.nUncompressedOffset = nUncompressedOffset;
+        oPoint.bHasCRC = bHasCRC != 0;
+        oPoint.nCRC = nCRC;
+        if (nWindowCompressedSize > 0)
+        {
+            oPoint.osWindow.resize(WINDOW_SIZE);
+            size_t nWindowSize = 0;
+            if (CPLZLibInflate(osIndex.data() + nPos, nWindowCompressedSize,
+                               &oPoint.osWindow[0], oPoint.osWindow.size(),
+                               &nWindowSize) == nullptr)
+            {
+                return Invalid();
+            }
+            oPoint.osWindow.resize(nWindowSize);
+            nPos += nWindowCompressedSize;
+        }
+        aoPoints.push_back(std::move(oPoint));
+    }
+
+    CPLDebug("GZIP", "Using index %s with %u access points",
+             osIndexFilename.c_str(), nPoints);
+    m_aoPoints = std::move(aoPoints);
+    m_bAllPointsKnown = true;
+    m_nUncompressedSize = nUncompressedSize;
+    m_nDeflateEnd = nDeflateEnd;
+    m_bIndexLoaded = true;
+    return true;
+}
+
+/************************************************************************/
+/*                             SaveIndex()                              */
+/************************************************************************/
+
+void VSIGZipIndexedHandle::SaveIndex()
+{
+    std::string osIndex(GZIP_INDEX_SIGNATURE, sizeof(GZIP_INDEX_SIGNATURE) - 1);
+    const auto AppendUInt64 = [&osIndex](uint64_t nVal)
+    {
+        CPL_LSBPTR64(&nVal);
+        osIndex.append(reinterpret_cast<const char *>(&nVal), sizeof(nVal));
+    };
+    const auto AppendUInt32 = [&osIndex](uint32_t nVal)
+    {
+        CPL_LSBPTR32(&nVal);
+        osIndex.append(reinterpret_cast<const char *>(&nVal), sizeof(nVal));
+    };
+
+    AppendUInt64(m_nCompressedSize);
+    AppendUInt64(static_cast<uint64_t>(m_nMTime));
+    AppendUInt64(m_nUncompressedSize);
+    AppendUInt64(m_nDeflateEnd);
+    AppendUInt32(static_cast<uint32_t>(m_aoPoints.size()));
+    for (const auto &oPoint : m_aoPoints)
+    {
+        AppendUInt64(oPoint.nCompressedOffset);
+        osIndex += static_cast<char>(oPoint.nBits);
+        AppendUInt64(oPoint.nUncompressedOffset);
+        osIndex += static_cast<char>(oPoint.bHasCRC ? 1 : 0);
+        AppendUInt32(static_cast<uint32_t>(oPoint.nCRC));
+        if (oPoint.osWindow.empty())
+        {
+            AppendUInt32(0);
+        }
+        else
+        {
+            size_t nCompressedSize = 0;
+            void *pCompressed =
+                CPLZLibDeflate(oPoint.osWindow.data(), oPoint.osWindow.size(),
+                               -1, nullptr, 0, &nCompressedSize);
+            if (pCompressed == nullptr)
+                return;
+            AppendUInt32(static_cast<uint32_t>(nCompressedSize));
+            osIndex.append(static_cast<const char *>(pCompressed),
+                           nCompressedSize);
+            VSIFree(pCompressed);
+        }
+    }
+
+    // Write to a temporary file first, so that concurrent readers never
+    // see a partial index.
+    const std::string osIndexFilename = GetIndexFilename();
+    const std::string osTmpFilename = osIndexFilename + ".tmp";
+    CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+    VSILFILE *fp = VSIFOpenL(osTmpFilename.c_str(), "wb");
+    if (fp == nullptr)
+    {
+        CPLDebug("GZIP", "Cannot create %s", osTmpFilename.c_str());
+        return;
+    }
+    const bool bOK =
+        VSIFWriteL(osIndex.data(), 1, osIndex.size(), fp) == osIndex.size();
+    if (VSIFCloseL(fp) == 0 && bOK &&
+        VSIRename(osTmpFilename.c_str(), osIndexFilename.c_str()) == 0)
+    {
+        CPLDebug("GZIP", "Index %s written with %u access points",
+                 osIndexFilename.c_str(),
+                 static_cast<unsigned>(m_aoPoints.size()));
+    }
+    else
+    {
+        VSIUnlink(osTmpFilename.c_str());
+    }
+}
+
+/************************************************************************/
+/*                              FindSpan()                              */
+/************************************************************************/
+
+// Return the index of the last access point, of known uncompressed offset,
+// that is not after nOffset.
+size_t VSIGZipIndexedHandle::FindSpan(vsi_l_offset nOffset) const
+{
+    // Access points of unknown uncompressed offset are at the end, and
+    // UNKNOWN_OFFSET is greater than any offset.
+    const auto oIter = std::upper_bound(
+        m_aoPoints.begin(), m_aoPoints.end(), nOffset,
+        [](vsi_l_offset nVal, const AccessPoint &oPoint)
+        { return nVal < oPoint.nUncompressedOffset; });
+    return static_cast<size_t>(oIter - m_aoPoints.begin()) - 1;
+}
+
+/************************************************************************/
+/*                           ScanNextPoint()                            */
+/************************************************************************/
+
+// Look for the next access point after the last one, in a file made of
+// independent blocks, without decompressing.
+// Returns true if an access point has been added, or if the end of the file
+// has been reached.
+bool VSIGZipIndexedHandle::ScanNextPoint()
+{
+    // Z_SYNC_FLUSH followed by Z_FULL_FLUSH, as emitted by
+    // VSIGZipWriteHandleMT after each chunk. The data after it does not
+    // reference data before it.
+    constexpr char achMarker[] = {'\x00', '\x00', '\xFF', '\xFF', '\x00',
+                                  '\x00', '\x00', '\xFF', '\xFF'};
+    constexpr size_t MARKER_SIZE = sizeof(achMarker);
+
+    const size_t iLast = m_aoPoints.size() - 1;
+    const vsi_l_offset nStart = m_aoPoints[iLast].nCompressedOffset;
+    while (true)
+    {
+        const size_t nSearchFrom = std::max(
+            m_nScanSearchFrom, MIN_INDEPENDENT_SPAN_SIZE - MARKER_SIZE);
+        if (m_osScanBuffer.size() >= nSearchFrom + MARKER_SIZE)
+        {
+            const auto oIter = std::search(
+                m_osScanBuffer.begin() + nSearchFrom, m_osScanBuffer.end(),
+                std::begin(achMarker), std::end(achMarker));
+            if (oIter != m_osScanBuffer.end())
+            {
+                const size_t nEnd = static_cast<size_t>(
+                                        oIter - m_osScanBuffer.begin()) +
+                                    MARKER_SIZE;
+                m_oMapScannedInput[iLast] = m_osScanBuffer.substr(0, nEnd);
+                m_osScanBuffer.erase(0, nEnd);
+                m_nScanSearchFrom = 0;
+
+                AccessPoint oPoint;
+                oPoint.nCompressedOffset = nStart + nEnd;
+                m_aoPoints.push_back(std::move(oPoint));
+                return true;
+            }
+            m_nScanSearchFrom = m_osScanBuffer.size() - (MARKER_SIZE - 1);
+        }
+
+        if (m_osScanBuffer.size() >= MAX_INDEPENDENT_SPAN_SIZE)
+        {
+            CPLDebug("GZIP",
+                     "%s: no independent block marker found after "
+                     "offset " CPL_FRMT_GUIB
+                     ". Switching to sequential decompression",
+                     m_osBaseFilename.c_str(), static_cast<GUIntBig>(nStart));
+            SwitchToSequential(iLast);
+            return false;
+        }
+
+        const size_t nOldSize = m_osScanBuffer.size();
+        const vsi_l_offset nReadOffset = nStart + nOldSize;
+        const size_t nToRead = static_cast<size_t>(
+            std::min(static_cast<vsi_l_offset>(MIN_INDEPENDENT_SPAN_SIZE),
+                     m_nCompressedSize - std::min(m_nCompressedSize,
+                                                  nReadOffset)));
+        if (nToRead == 0)
+        {
+            // The last span extends up to the end of the file.
+            m_oMapScannedInput[iLast] = std::move(m_osScanBuffer);
+            m_osScanBuffer.clear();
+            m_nScanSearchFrom = 0;
+            m_bAllPointsKnown = true;
+            return true;
+        }
+        m_osScanBuffer.resize(nOldSize + nToRead);
+        if (m_poBaseHandle->Seek(nReadOffset, SEEK_SET) != 0 ||
+            m_poBaseHandle->Read(&m_osScanBuffer[nOldSize], 1, nToRead) !=
+                nToRead)
+        {
+            CPLError(CE_Failure, CPLE_FileIO, "%s: cannot read " CPL_FRMT_GUIB,
+                     m_osBaseFilename.c_str(),
+                     static_cast<GUIntBig>(nReadOffset));
+            m_osScanBuffer.resize(nOldSize);
+            m_bError = true;
+            return false;
+        }
+    }
+}
+
+/************************************************************************/
+/*                            PrepareSpan()                             */
+/************************************************************************/
+
+// Gather the compressed data and state needed to decompress a span.
+std::shared_ptr<VSIGZipIndexedHandle::Span>
+VSIGZipIndexedHandle::PrepareSpan(size_t iSpan)
+{
+    auto poSpan = std::make_shared<Span>();
+    const AccessPoint &oPoint = m_aoPoints[iSpan];
+    const bool bLast = iSpan + 1 == m_aoPoints.size();
+    poSpan->nBits = oPoint.nBits;
+    poSpan->osWindow = oPoint.osWindow;
+    poSpan->nInputOffset = oPoint.nCompressedOffset - (oPoint.nBits ? 1 : 0);
+    const vsi_l_offset nNextUncompressedOffset =
+        bLast ? m_nUncompressedSize
+              : m_aoPoints[iSpan + 1].nUncompressedOffset;
+    if (oPoint.nUncompressedOffset != UNKNOWN_OFFSET &&
+        nNextUncompressedOffset != UNKNOWN_OFFSET)
+    {
+        poSpan->nExpectedSize =
+            nNextUncompressedOffset - oPoint.nUncompressedOffset;
+    }
+
+    auto oIter = m_oMapScannedInput.find(iSpan);
+    if (oIter != m_oMapScannedInput.end())
+    {
+        poSpan->osInput = std::move(oIter->second);
+        m_oMapScannedInput.erase(oIter);
+        return poSpan;
+    }
+
+    const vsi_l_offset nInputEnd =
+        bLast ? m_nCompressedSize : m_aoPoints[iSpan + 1].nCompressedOffset;
+    const vsi_l_offset nInputSize =
+        nInputEnd - std::min(nInputEnd, poSpan->nInputOffset);
+    if (nInputSize > static_cast<vsi_l_offset>(INT_MAX))
+    {
+        poSpan->bIOError = true;
+        poSpan->bDone = true;
+        return poSpan;
+    }
+    try
+    {
+        poSpan->osInput.resize(static_cast<size_t>(nInputSize));
+    }
+    catch (const std::exception &)
+    {
+        poSpan->bIOError = true;
+        poSpan->bDone = true;
+        return poSpan;
+    }
+    if (m_poBaseHandle->Seek(poSpan->nInputOffset, SEEK_SET) != 0 ||
+        m_poBaseHandle->Read(&poSpan->osInput[0], 1, poSpan->osInput.size()) !=
+            poSpan->osInput.size())
+    {
+        poSpan->bIOError = true;
+        poSpan->bDone = true;
+    }
+    return poSpan;
+}
+
+/************************************************************************/
+/*                            DecodeSpan()                              */
+/************************************************************************/
+
+// Decompress a span. Thread-safe.
+void VSIGZipIndexedHandle::DecodeSpan(Span &oSpan)
+{
+    z_stream sStream;
+    memset(&sStream, 0, sizeof(sStream));
+    if (inflateInit2(&sStream, -MAX_WBITS) != Z_OK)
+        return;
+
+    const Bytef *pabyInput =
+        reinterpret_cast<const Bytef *>(oSpan.osInput.data());
+    size_t nInputSize = oSpan.osInput.size();
+    if (oSpan.nBits)
+    {
+        if (nInputSize == 0)
+        {
+            inflateEnd(&sStream);
+            return;
+        }
+        inflatePrime(&sStream, oSpan.nBits, pabyInput[0] >> (8 - oSpan.nBits));
+        ++pabyInput;
+        --nInputSize;
+    }
+    if (!oSpan.osWindow.empty())
+    {
+        inflateSetDictionary(
+            &sStream, reinterpret_cast<const Bytef *>(oSpan.osWindow.data()),
+            static_cast<uInt>(oSpan.osWindow.size()));
+    }
+    sStream.next_in = const_cast<Bytef *>(pabyInput);
+    sStream.avail_in = static_cast<uInt>(nInputSize);
+
+    const bool bKnownSize = oSpan.nExpectedSize != UNKNOWN_OFFSET;
+    // One extra byte to detect spans larger than expected
+    const size_t nMaxSize = bKnownSize
+                                ? static_cast<size_t>(oSpan.nExpectedSize) + 1
+                                : MAX_UNKNOWN_SPAN_SIZE;
+    std::string &osData = oSpan.osData;
+    size_t nOut = 0;
+    int ret = Z_OK;
+    try
+    {
+        osData.resize(bKnownSize ? nMaxSize
+                                 : std::min(nMaxSize, 4 * nInputSize + 1));
+        while (true)
+        {
+            if (nOut == osData.size())
+            {
+                if (osData.size() >= nMaxSize)
+                    break;
+                osData.resize(std::min(nMaxSize, 2 * osData.size()));
+            }
+            sStream.next_out = reinterpret_cast<Bytef *>(&osData[nOut]);
+            sStream.avail_out = static_cast<uInt>(std::min(
+                osData.size() - nOut,
+                static_cast<size_t>(std::numeric_limits<uInt>::max())));
+            const uInt nAvailOutBefore = sStream.avail_out;
+            // Z_BLOCK makes inflate() return at the end of each deflate block
+            ret = inflate(&sStream, Z_BLOCK);
+            nOut += nAvailOutBefore - sStream.avail_out;
+            if (ret != Z_OK)
+                break;
+            if (sStream.avail_in == 0 && (sStream.data_type & 128) != 0)
+                break;
+        }
+    }
+    catch (const std::exception &)
+    {
+        ret = Z_MEM_ERROR;
+    }
+
+    oSpan.bStreamEnd = ret == Z_STREAM_END;
+    oSpan.nDeflateEnd = oSpan.nInputOffset + oSpan.osInput.size() -
+                        sStream.avail_in;
+    if (bKnownSize)
+    {
+        oSpan.bOK = (ret == Z_OK || ret == Z_STREAM_END) &&
+                    nOut == oSpan.nExpectedSize;
+    }
+    else
+    {
+        // The span must end at the end of the deflate stream, or exactly
+        // at a byte aligned block boundary that is not the last block.
+        oSpan.bOK = ret == Z_STREAM_END ||
+                    (ret == Z_OK && sStream.avail_in == 0 &&
+                     (sStream.data_type & 128) != 0 &&
+                     (sStream.data_type & (64 | 7)) == 0);
+    }
+    inflateEnd(&sStream);
+
+    oSpan.osInput.clear();
+    oSpan.osInput.shrink_to_fit();
+    if (oSpan.bOK)
+    {
+        osData.resize(nOut);
+        oSpan.nCRC = crc32(0L, reinterpret_cast<const Bytef *>(osData.data()),
+                           static_cast<uInt>(nOut));
+    }
+    else
+    {
+        osData.clear();
+    }
+}
+
+/************************************************************************/
+/*                     DecodeSpanSequentially()                         */
+/************************************************************************/
+
+// Decompress the span starting at the last access point, which is not
+// followed by a known access point, and create the next access point
+// after SPAN_SIZE bytes of uncompressed data, as done by zlib's zran.c.
+std::shared_ptr<VSIGZipIndexedHandle::Span>
+VSIGZipIndexedHandle::DecodeSpanSequentially(size_t iSpan)
+{
+    CPLAssert(iSpan + 1 == m_aoPoints.size());
+    auto poSpan = std::make_shared<Span>();
+    poSpan->bDone = true;
+    const AccessPoint &oPoint = m_aoPoints[iSpan];
+
+    z_stream sStream;
+    memset(&sStream, 0, sizeof(sStream));
+    if (inflateInit2(&sStream, -MAX_WBITS) != Z_OK)
+        return poSpan;
+
+    std::vector<Bytef> abyInput(Z_BUFSIZE);
+    vsi_l_offset nReadOffset =
+        oPoint.nCompressedOffset - (oPoint.nBits ? 1 : 0);
+    poSpan->nInputOffset = nReadOffset;
+    if (m_poBaseHandle->Seek(nReadOffset, SEEK_SET) != 0)
+    {
+        poSpan->bIOError = true;
+        inflateEnd(&sStream);
+        return poSpan;
+    }
+    if (oPoint.nBits)
+    {
+        GByte byVal = 0;
+        if (m_poBaseHandle->Read(&byVal, 1, 1) != 1)
+        {
+            poSpan->bIOError = true;
+            inflateEnd(&sStream);
+            return poSpan;
+        }
+        ++nReadOffset;
+        inflatePrime(&sStream, oPoint.nBits, byVal >> (8 - oPoint.nBits));
+    }
+    if (!oPoint.osWindow.empty())
+    {
+        inflateSetDictionary(
+            &sStream, reinterpret_cast<const Bytef *>(oPoint.osWindow.data()),
+            static_cast<uInt>(oPoint.osWindow.size()));
+    }
+
+    std::string &osData = poSpan->osData;
+    size_t nOut = 0;
+    int ret = Z_OK;
+    try
+    {
+        osData.resize(SPAN_SIZE + Z_BUFSIZE);
+        while (true)
+        {
+            if (sStream.avail_in == 0)
+            {
+                const size_t nRead =
+                    m_poBaseHandle->Read(abyInput.data(), 1, abyInput.size());
+                if (nRead == 0)
+                {
+                    poSpan->bIOError = true;
+                    break;
+                }
+                nReadOffset += nRead;
+                sStream.next_in = abyInput.data();
+                sStream.avail_in = static_cast<uInt>(nRead);
+            }
+            if (osData.size() - nOut < static_cast<size_t>(Z_BUFSIZE))
+                osData.resize(osData.size() + SPAN_SIZE);
+            sStream.next_out = reinterpret_cast<Bytef *>(&osData[nOut]);
+            sStream.avail_out = static_cast<uInt>(osData.size() - nOut);
+            const uInt nAvailOutBefore = sStream.avail_out;
+            ret = inflate(&sStream, Z_BLOCK);
+            nOut += nAvailOutBefore - sStream.avail_out;
+            if (ret == Z_STREAM_END)
+            {
+                poSpan->bOK = true;
+                poSpan->bStreamEnd = true;
+                poSpan->nDeflateEnd = nReadOffset - sStream.avail_in;
+                break;
+            }
+            if (ret != Z_OK && ret != Z_BUF_ERROR)
+                break;
+            if (nOut >= SPAN_SIZE && (sStream.data_type & 128) != 0 &&
+                (sStream.data_type & 64) == 0)
+            {
+                AccessPoint oNewPoint;
+                oNewPoint.nCompressedOffset = nReadOffset - sStream.avail_in;
+                oNewPoint.nBits = sStream.data_type & 7;
+                oNewPoint.nUncompressedOffset =
+                    oPoint.nUncompressedOffset + nOut;
+                oNewPoint.osWindow.assign(osData.data() + nOut - WINDOW_SIZE,
+                                          WINDOW_SIZE);
+                m_aoPoints.push_back(std::move(oNewPoint));
+                poSpan->bOK = true;
+                break;
+            }
+        }
+    }
+    catch (const std::exception &)
+    {
+        poSpan->bOK = false;
+    }
+    inflateEnd(&sStream);
+
+    if (poSpan->bOK)
+    {
+        osData.resize(nOut);
+        poSpan->nCRC =
+            crc32(0L, reinterpret_cast<const Bytef *>(osData.data()),
+                  static_cast<uInt>(nOut));
+    }
+    else
+    {
+        osData.clear();
+    }
+    return poSpan;
+}
+
+/************************************************************************/
+/*                             SubmitSpan()                             */
+/************************************************************************/
+
+void VSIGZipIndexedHandle::SubmitSpan(size_t iSpan)
+{
+    auto poSpan = PrepareSpan(iSpan);
+    m_oMapSpans[iSpan] = poSpan;
+    if (poSpan->bDone)
+        return;
+
+    if (m_nThreads > 1 && !m_poPool)
+    {
+        m_poPool = std::make_unique<CPLWorkerThreadPool>();
+        if (m_poPool->Setup(m_nThreads, nullptr, nullptr, false))
+            m_poJobQueue = m_poPool->CreateJobQueue();
+        else
+            m_poPool.reset();
+    }
+    if (m_poJobQueue)
+    {
+        m_poJobQueue->SubmitJob(
+            [this, poSpan]()
+            {
+                DecodeSpan(*poSpan);
+                std::lock_guard<std::mutex> oLock(m_oMutex);
+                poSpan->bDone = true;
+                m_oCV.notify_all();
+            });
+    }
+    else
+    {
+        DecodeSpan(*poSpan);
+        poSpan->bDone = true;
+    }
+}
+
+/************************************************************************/
+/*                          WaitPendingSpans()                          */
+/************************************************************************/
+
+void VSIGZipIndexedHandle::WaitPendingSpans()
+{
+    if (m_poJobQueue)
+        m_poJobQueue->WaitCompletion();
+}
+
+/************************************************************************/
+/*                        SwitchToSequential()                          */
+/************************************************************************/
+
+// Called when the file turns out not to be made of independent blocks, at
+// least after iRestartPoint.
+void VSIGZipIndexedHandle::SwitchToSequential(size_t iRestartPoint)
+{
+    WaitPendingSpans();
+    m_oMapSpans.erase(m_oMapSpans.lower_bound(iRestartPoint),
+                      m_oMapSpans.end());
+    m_aoPoints.resize(iRestartPoint + 1);
+    m_aoPoints.back().bHasCRC = false;
+    m_bAllPointsKnown = false;
+    m_bIndependentBlocks = false;
+    m_osScanBuffer.clear();
+    m_nScanSearchFrom = 0;
+    m_oMapScannedInput.clear();
+}
+
+/************************************************************************/
+/*                         SwitchToFallback()                           */
+/************************************************************************/
+
+bool VSIGZipIndexedHandle::SwitchToFallback()
+{
+    CPLDebug("GZIP", "%s: using a sequential reader",
+             m_osBaseFilename.c_str());
+    WaitPendingSpans();
+    m_oMapSpans.clear();
+    m_bWriteIndex = false;
+
+    VSIFilesystemHandler *poFSHandler =
+        VSIFileManager::GetHandler(m_osBaseFilename.c_str());
+    VSIVirtualHandle *poBaseHandle =
+        poFSHandler->Open(m_osBaseFilename.c_str(), "rb");
+    if (poBaseHandle == nullptr)
+    {
+        m_bError = true;
+        return false;
+    }
+    auto poHandle = std::make_unique<VSIGZipHandle>(poBaseHandle,
+                                                    m_osBaseFilename.c_str());
+    if (!poHandle->IsInitOK() || poHandle->Seek(m_nCurPos, SEEK_SET) != 0)
+    {
+        m_bError = true;
+        return false;
+    }
+    m_poFallbackHandle = std::move(poHandle);
+    return true;
+}
+
+/************************************************************************/
+/*                         ProcessDecodedSpan()                         */
+/************************************************************************/
+
+// Update the index with the result of the decompression of a span.
+// Returns false if the span cannot be used.
+bool VSIGZipIndexedHandle::ProcessDecodedSpan(size_t iSpan, Span &oSpan)
+{
+    if (oSpan.bProcessed)
+        return true;
+    oSpan.bProcessed = true;
+
+    const bool bLast = m_bAllPointsKnown && iSpan + 1 == m_aoPoints.size();
+    if (!oSpan.bIOError && (!oSpan.bOK || oSpan.bStreamEnd != bLast) &&
+        m_bIndependentBlocks && !m_bIndexLoaded)
+    {
+        // Either the access point at the start of the span does not
+        // actually start an independent block, or the one at the end is not
+        // a valid access point. Start again from the previous access point,
+        // whose span has been successfully decompressed.
+        CPLDebug("GZIP",
+                 "%s: invalid independent block at offset " CPL_FRMT_GUIB
+                 ". Switching to sequential decompression",
+                 m_osBaseFilename.c_str(),
+                 static_cast<GUIntBig>(m_aoPoints[iSpan].nCompressedOffset));
+        SwitchToSequential(iSpan > 0 ? iSpan - 1 : 0);
+        return false;
+    }
+    if (oSpan.bIOError || !oSpan.bOK)
+    {
+        CPLError(CE_Failure, CPLE_FileIO,
+                 "%s: error while decompressing data at offset " CPL_FRMT_GUIB
+                 "%s",
+                 m_osBaseFilename.c_str(),
+                 static_cast<GUIntBig>(oSpan.nInputOffset),
+                 m_bIndexLoaded ? ". The index file might be outdated" : "");
+        m_bError = true;
+        return false;
+    }
+
+    AccessPoint &oPoint = m_aoPoints[iSpan];
+    if (oPoint.bHasCRC && oPoint.nCRC != oSpan.nCRC)
+    {
+        CPLError(CE_Failure, CPLE_FileIO,
+                 "%s: CRC error on data at offset " CPL_FRMT_GUIB,
+                 m_osBaseFilename.c_str(),
+                 static_cast<GUIntBig>(oSpan.nInputOffset));
+        m_bError = true;
+        return false;
+    }
+    oPoint.bHasCRC = true;
+    oPoint.nCRC = oSpan.nCRC;
+
+    const vsi_l_offset nSpanEnd =
+        oPoint.nUncompressedOffset + oSpan.osData.size();
+    if (oSpan.bStreamEnd)
+    {
+        m_bAllPointsKnown = true;
+        m_aoPoints.resize(iSpan + 1);
+        m_nUncompressedSize = nSpanEnd;
+        m_nDeflateEnd = oSpan.nDeflateEnd;
+        // Anything else than the 8 byte trailer is handled by VSIGZipHandle
+        if (m_nCompressedSize != m_nDeflateEnd + 8)
+            return SwitchToFallback();
+        CheckCRC();
+    }
+    else
+    {
+        m_aoPoints[iSpan + 1].nUncompressedOffset = nSpanEnd;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                             CheckCRC()                               */
+/************************************************************************/
+
+// Check the CRC of the whole uncompressed data against the trailer, if the
+// CRC of all spans is known.
+void VSIGZipIndexedHandle::CheckCRC()
+{
+    uLong nCRC = crc32(0L, nullptr, 0);
+    for (size_t i = 0; i < m_aoPoints.size(); ++i)
+    {
+        if (!m_aoPoints[i].bHasCRC)
+            return;
+        const vsi_l_offset nSpanSize =
+            (i + 1 < m_aoPoints.size() ? m_aoPoints[i + 1].nUncompressedOffset
+                                       : m_nUncompressedSize) -
+            m_aoPoints[i].nUncompressedOffset;
+        nCRC = crc32_combine(nCRC, m_aoPoints[i].nCRC,
+                             static_cast<z_off_t>(nSpanSize));
+    }
+
+    GByte abyTrailer[8];
+    if (m_poBaseHandle->Seek(m_nDeflateEnd, SEEK_SET) != 0 ||
+        m_poBaseHandle->Read(abyTrailer, 1, sizeof(abyTrailer)) !=
+            sizeof(abyTrailer))
+    {
+        return;
+    }
+    uint32_t nExpectedCRC = 0;
+    memcpy(&nExpectedCRC, abyTrailer, sizeof(nExpectedCRC));
+    CPL_LSBPTR32(&nExpectedCRC);
+    uint32_t nExpectedSize = 0;
+    memcpy(&nExpectedSize, abyTrailer + 4, sizeof(nExpectedSize));
+    CPL_LSBPTR32(&nExpectedSize);
+    if (static_cast<uint32_t>(nCRC) != nExpectedCRC ||
+        static_cast<uint32_t>(m_nUncompressedSize) != nExpectedSize)
+    {
+        CPLError(CE_Failure, CPLE_FileIO,
+                 "%s: CRC or size mismatch between computed value and trailer",
+                 m_osBaseFilename.c_str());
+        m_bError = true;
+    }
+}
+
+/************************************************************************/
+/*                              GetSpan()                               */
+/************************************************************************/
+
+// Return the decompressed data of a span, after having queued the
+// decompression of the following ones.
+// Returns nullptr if the span cannot be used, in which case m_bError is set
+// if this is a fatal error, and the caller should retry otherwise.
+std::shared_ptr<VSIGZipIndexedHandle::Span>
+VSIGZipIndexedHandle::GetSpan(size_t iSpan)
+{
+    std::shared_ptr<Span> poSpan;
+    auto oIter = m_oMapSpans.find(iSpan);
+    if (oIter != m_oMapSpans.end())
+    {
+        poSpan = oIter->second;
+    }
+    else if (!IsSpanDecodable(iSpan) && !m_bIndependentBlocks)
+    {
+        poSpan = DecodeSpanSequentially(iSpan);
+        m_oMapSpans[iSpan] = poSpan;
+    }
+
+    const size_t nReadAhead = GetReadAheadCount();
+    for (size_t i = iSpan; i < iSpan + nReadAhead; ++i)
+    {
+        if (!IsSpanDecodable(i) &&
+            (!m_bIndependentBlocks || m_bAllPointsKnown || !ScanNextPoint() ||
+             !IsSpanDecodable(i)))
+        {
+            break;
+        }
+        if (m_oMapSpans.find(i) == m_oMapSpans.end())
+            SubmitSpan(i);
+    }
+
+    if (!poSpan)
+    {
+        oIter = m_oMapSpans.find(iSpan);
+        if (oIter == m_oMapSpans.end())
+            // Either an error, or the decompression mode has changed
+            return nullptr;
+        poSpan = oIter->second;
+    }
+
+    {
+        std::unique_lock<std::mutex> oLock(m_oMutex);
+        m_oCV.wait(oLock, [&poSpan] { return poSpan->bDone; });
+
+        // Discard decompressed spans that are no longer needed
+        for (oIter = m_oMapSpans.begin(); oIter != m_oMapSpans.end();)
+        {
+            if ((oIter->first + 1 < iSpan ||
+                 oIter->first >= iSpan + nReadAhead) &&
+                oIter->second->bDone)
+            {
+                oIter = m_oMapSpans.erase(oIter);
+            }
+            else
+            {
+                ++oIter;
+            }
+        }
+    }
+
+    if (!ProcessDecodedSpan(iSpan, *poSpan))
+        return nullptr;
+    return poSpan;
+}
+
+/************************************************************************/
+/*                                Read()                                */
+/************************************************************************/
+
+size_t VSIGZipIndexedHandle::Read(void *pBuffer, size_t nSize, size_t nMemb)
+{
+    if (m_poFallbackHandle)
+        return m_poFallbackHandle->Read(pBuffer, nSize, nMemb);
+    if (nSize == 0 || nMemb == 0 || m_bError)
+        return 0;
+
+    const size_t nToRead = nSize * nMemb;
+    GByte *pabyDst = static_cast<GByte *>(pBuffer);
+    size_t nRead = 0;
+    while (nRead < nToRead)
+    {
+        if (m_nCurPos >= m_nUncompressedSize)
+        {
+            m_bEOF = true;
+            break;
+        }
+        const size_t iSpan = FindSpan(m_nCurPos);
+        const auto poSpan = GetSpan(iSpan);
+        if (m_poFallbackHandle)
+        {
+            nRead += m_poFallbackHandle->Read(pabyDst + nRead, 1,
+                                              nToRead - nRead);
+            break;
+        }
+        if (!poSpan)
+        {
+            if (m_bError)
+                break;
+            continue;
+        }
+
+        const vsi_l_offset nOffsetInSpan =
+            m_nCurPos - m_aoPoints[iSpan].nUncompressedOffset;
+        if (nOffsetInSpan >= poSpan->osData.size())
+        {
+            // Continue with next span, whose uncompressed offset is now known
+            continue;
+        }
+        const size_t nAvailable = std::min(
+            poSpan->osData.size() - static_cast<size_t>(nOffsetInSpan),
+            nToRead - nRead);
+        memcpy(pabyDst + nRead,
+               poSpan->osData.data() + static_cast<size_t>(nOffsetInSpan),
+               nAvailable);
+        nRead += nAvailable;
+        m_nCurPos += nAvailable;
+    }
+    return nRead / nSize;
+}
+
+/************************************************************************/
+/*                                Seek()                                */
+/************************************************************************/
+
+int VSIGZipIndexedHandle::Seek(vsi_l_offset nOffset, int nWhence)
+{
+    if (m_poFallbackHandle)
+        return m_poFallbackHandle->Seek(nOffset, nWhence);
+
+    m_bEOF = false;
+    if (nWhence == SEEK_SET)
+    {
+        m_nCurPos = nOffset;
+    }
+    else if (nWhence == SEEK_CUR)
+    {
+        m_nCurPos += nOffset;
+    }
+    else
+    {
+        // Decompress up to the end to get the uncompressed size
+        while (m_nUncompressedSize == UNKNOWN_OFFSET && !m_bError)
+        {
+            GetSpan(FindSpan(UNKNOWN_OFFSET - 1));
+            if (m_poFallbackHandle)
+                return m_poFallbackHandle->Seek(nOffset, nWhence);
+        }
+        if (m_bError)
+            return -1;
+        m_nCurPos = m_nUncompressedSize + nOffset;
+    }
+    return 0;
+}
+
+/************************************************************************/
+/*                                Tell()                                */
+/************************************************************************/
+
+vsi_l_offset VSIGZipIndexedHandle::Tell()
+{
+    if (m_poFallbackHandle)
+        return m_poFallbackHandle->Tell();
+    return m_nCurPos;
+}
+
+/************************************************************************/
+/*                                Eof()                                 */
+/************************************************************************/
+
+int VSIGZipIndexedHandle::Eof()
+{
+    if (m_poFallbackHandle)
+        return m_poFallbackHandle->Eof();
+    return m_bEOF;
+}
+
+/************************************************************************/
+/*                               Error()                                */
+/************************************************************************/
+
+int VSIGZipIndexedHandle::Error()
+{
+    if (m_poFallbackHandle)
+        return m_poFallbackHandle->Error();
+    return m_bError;
+}
+
+/************************************************************************/
+/*                              ClearErr()                              */
+/************************************************************************/
+
+void VSIGZipIndexedHandle::ClearErr()
+{
+    if (m_poFallbackHandle)
+        m_poFallbackHandle->ClearErr();
+    m_bEOF = false;
+    m_bError = false;
+}
+
+/************************************************************************/
+/*                               Close()                                */
+/************************************************************************/
+
+int VSIGZipIndexedHandle::Close()
+{
+    if (!m_poBaseHandle)
+        return 0;
+
+    WaitPendingSpans();
+    m_oMapSpans.clear();
+
+    if (m_bWriteIndex && !m_bIndexLoaded && !m_bError &&
+        !m_poFallbackHandle && m_nUncompressedSize != UNKNOWN_OFFSET &&
+        m_aoPoints.size() > 1)
+    {
+        SaveIndex();
+    }
+
+    int nRet = m_poBaseHandle->Close();
+    delete m_poBaseHandle;
+    m_poBaseHandle = nullptr;
+    if (m_poFallbackHandle && m_poFallbackHandle->Close() != 0)
+        nRet = -1;
+    return nRet;
+}
+
 /************************************************************************/
 /* ==================================================================== */
 /*                       VSIGZipFilesystemHandler                       */
@@ -3066,6 +4409,28 @@ VSIGZipFilesystemHandler::Open(const char *pszFilename, const char *pszAccess,
     /*      Otherwise we are in the read access case.                       */
     /* -------------------------------------------------------------------- */
 
+    // Use the indexed reader if parallel decompression or a persistent index
+    // is requested.
+    const char *pszThreads =
+        CPLGetConfigOption("CPL_VSIL_GZIP_NUM_THREADS", nullptr);
+    int nThreads = 1;
+    if (pszThreads)
+    {
+        nThreads = EQUAL(pszThreads, "ALL_CPUS") ? CPLGetNumCPUs()
+                                                 : atoi(pszThreads);
+        nThreads = std::max(1, std::min(128, nThreads));
+    }
+    const bool bWriteIndex =
+        CPLTestBool(CPLGetConfigOption("CPL_VSIL_GZIP_WRITE_INDEX", "NO"));
+    const char *pszIndexDir =
+        CPLGetConfigOption("CPL_VSIL_GZIP_INDEX_DIR", nullptr);
+    if (nThreads > 1 || bWriteIndex || (pszIndexDir && pszIndexDir[0]))
+    {
+        // coverity[tainted_data]
+        return VSIGZipIndexedHandle::Open(pszFilename + strlen("/vsigzip/"),
+                                          nThreads, bWriteIndex);
+    }
+
     VSIGZipHandle *poGZIPHandle = OpenGZipReadOnly(pszFilename, pszAccess);
     if (poGZIPHandle)
         // Wrap the VSIGZipHandle inside a buffered reader that will
@@ -3281,6 +4646,14 @@ const char *VSIGZipFilesystemHandler::GetOptions()
            "  <Option name='CPL_VSIL_DEFLATE_CHUNK_SIZE' type='string' "
            "description='Chunk of uncompressed data for parallelization. "
            "Use K(ilobytes) or M(egabytes) suffix' default='1M'/>"
+           "  <Option name='CPL_VSIL_GZIP_NUM_THREADS' type='string' "
+           "description='Number of threads for decompression. Either a "
+           "integer or ALL_CPUS' default='1'/>"
+           "  <Option name='CPL_VSIL_GZIP_WRITE_INDEX' type='boolean' "
+           "description='Whether to save the index of access points of the "
+           "file in a .gzidx file' default='NO'/>"
+           "  <Option name='CPL_VSIL_GZIP_INDEX_DIR' type='string' "
+           "description='Directory where to read and write .gzidx files'/>"
            "</Options>";
 }
 
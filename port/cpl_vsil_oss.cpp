@@ -175,7 +175,10 @@ const char *VSIOSSFSHandler::GetOptions()
         "  <Option name='VSIOSS_CHUNK_SIZE' type='int' "
         "description='Size in MB for chunks of files that are uploaded. The"
         "default value of 50 MB allows for files up to 500 GB each' "
-        "default='50' min='1' max='1000'/>" +
+        "default='50' min='1' max='1000'/>"
+        "  <Option name='CPL_VSIL_UPLOAD_NUM_THREADS' type='string' "
+        "description='Number of parts uploaded in parallel. Either an "
+        "integer or ALL_CPUS' default='1'/>" +
         VSICurlFilesystemHandlerBase::GetOptionsStatic() + "</Options>");
     return osOptions.c_str();
 }
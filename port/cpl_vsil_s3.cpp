@@ -24,9 +24,11 @@
 #include <errno.h>
 
 #include <algorithm>
+#include <chrono>
 #include <condition_variable>
 #include <functional>
 #include <set>
+#include <thread>
 #include <limits>
 #include <map>
 #include <memory>
@@ -784,6 +786,17 @@ VSIMultipartWriteHandle::VSIMultipartWriteHandle(
                  "Cannot allocate working buffer for %s",
                  m_poFS->GetFSPrefix().c_str());
     }
+    m_nAllocatedBuffers = 1;
+
+    if (poFS->SupportsParallelMultipartUpload())
+    {
+        const char *pszThreads = VSIGetPathSpecificOption(
+            pszFilename, "CPL_VSIL_UPLOAD_NUM_THREADS", "1");
+        const int nThreads = EQUAL(pszThreads, "ALL_CPUS")
+                                 ? CPLGetNumCPUs()
+                                 : atoi(pszThreads);
+        m_nMaxThreads = std::max(1, std::min(64, nThreads));
+    }
 }
 
 /************************************************************************/
@@ -854,8 +867,11 @@ size_t IVSIS3LikeFSHandlerWithMultipartUpload::GetUploadChunkSizeInBytes(
 VSIMultipartWriteHandle::~VSIMultipartWriteHandle()
 {
     VSIMultipartWriteHandle::Close();
+    m_poThreadPool.reset();
     delete m_poS3HandleHelper;
     CPLFree(m_pabyBuffer);
+    for (GByte *pabyBuffer : m_apabyFreeBuffers)
+        CPLFree(pabyBuffer);
     CPLFree(m_sWriteFuncHeaderData.pBuffer);
 }
 
@@ -1025,11 +1041,14 @@ bool VSIMultipartWriteHandle::UploadPart()
                  m_poFS->GetDebugKey());
         return false;
     }
+    const vsi_l_offset nPosition =
+        static_cast<vsi_l_offset>(m_nBufferSize) * (m_nPartNumber - 1);
+    if (m_nMaxThreads > 1)
+        return SubmitPartUpload(nPosition);
+
     const std::string osEtag = m_poFS->UploadPart(
-        m_osFilename, m_nPartNumber, m_osUploadID,
-        static_cast<vsi_l_offset>(m_nBufferSize) * (m_nPartNumber - 1),
-        m_pabyBuffer, m_nBufferOff, m_poS3HandleHelper, m_oRetryParameters,
-        nullptr);
+        m_osFilename, m_nPartNumber, m_osUploadID, nPosition, m_pabyBuffer,
+        m_nBufferOff, m_poS3HandleHelper, m_oRetryParameters, nullptr);
     m_nBufferOff = 0;
     if (!osEtag.empty())
     {
@@ -1038,6 +1057,130 @@ bool VSIMultipartWriteHandle::UploadPart()
     return !osEtag.empty();
 }
 
+/************************************************************************/
+/*                         SubmitPartUpload()                           */
+/************************************************************************/
+
+/** Queue the upload of the current buffer as part m_nPartNumber, and make
+ * m_pabyBuffer point to a free buffer, waiting for a part upload to finish
+ * if m_nMaxThreads parts are already in flight.
+ */
+bool VSIMultipartWriteHandle::SubmitPartUpload(vsi_l_offset nPosition)
+{
+    if (!m_poThreadPool)
+    {
+        auto poThreadPool = std::make_unique<CPLWorkerThreadPool>();
+        if (!poThreadPool->Setup(m_nMaxThreads, nullptr, nullptr))
+            return false;
+        m_poThreadPool = std::move(poThreadPool);
+        m_poErrorAccumulator = std::make_unique<CPLErrorAccumulator>();
+    }
+
+    // UploadPart() sets query parameters on the handle helper, so each
+    // part needs its own one.
+    std::shared_ptr<IVSIS3LikeHandleHelper> poHandleHelper(
+        m_poFS->CreateHandleHelper(
+            m_osFilename.c_str() + m_poFS->GetFSPrefix().size(), false));
+    if (!poHandleHelper)
+        return false;
+
+    GByte *pabyBuffer = m_pabyBuffer;
+    const size_t nSize = m_nBufferOff;
+    const int nPartNumber = m_nPartNumber;
+    CPLErrorAccumulator *poErrorAccumulator = m_poErrorAccumulator.get();
+    {
+        std::lock_guard oLock(m_oMutexParts);
+        m_aosEtags.resize(nPartNumber);
+        ++m_nPendingParts;
+    }
+    m_pabyBuffer = nullptr;
+    m_nBufferOff = 0;
+
+    const auto task = [this, poHandleHelper, pabyBuffer, nSize, nPartNumber,
+                       nPosition, poErrorAccumulator]()
+    {
+        std::string osEtag;
+        {
+            auto oAccumulator = poErrorAccumulator->InstallForCurrentScope();
+            CPL_IGNORE_RET_VAL(oAccumulator);
+            osEtag = m_poFS->UploadPart(m_osFilename, nPartNumber, m_osUploadID,
+                                        nPosition, pabyBuffer, nSize,
+                                        poHandleHelper.get(),
+                                        m_oRetryParameters, nullptr);
+        }
+
+        std::lock_guard oLock(m_oMutexParts);
+        if (osEtag.empty())
+            m_bPartUploadError = true;
+        else
+            m_aosEtags[nPartNumber - 1] = std::move(osEtag);
+        m_apabyFreeBuffers.push_back(pabyBuffer);
+        --m_nPendingParts;
+        m_oCVParts.notify_all();
+    };
+    if (!m_poThreadPool->SubmitJob(task))
+    {
+        std::lock_guard oLock(m_oMutexParts);
+        m_apabyFreeBuffers.push_back(pabyBuffer);
+        --m_nPendingParts;
+        m_bPartUploadError = true;
+    }
+
+    // No need for a new buffer when flushing the last part from Close()
+    if (m_bClosed)
+        return WaitForPendingParts();
+
+    {
+        std::unique_lock oLock(m_oMutexParts);
+        if (m_apabyFreeBuffers.empty() && !m_bPartUploadError &&
+            m_nAllocatedBuffers <= m_nMaxThreads)
+        {
+            // Allocation failure is not fatal: we will just wait for a
+            // buffer to be released.
+            GByte *pabyNewBuffer =
+                static_cast<GByte *>(VSI_MALLOC_VERBOSE(m_nBufferSize));
+            if (pabyNewBuffer)
+            {
+                ++m_nAllocatedBuffers;
+                m_apabyFreeBuffers.push_back(pabyNewBuffer);
+            }
+        }
+        while (m_apabyFreeBuffers.empty())
+            m_oCVParts.wait(oLock);
+        m_pabyBuffer = m_apabyFreeBuffers.back();
+        m_apabyFreeBuffers.pop_back();
+        if (!m_bPartUploadError)
+            return true;
+    }
+
+    // Surface the errors of the failed part(s) now
+    WaitForPendingParts();
+    return false;
+}
+
+/************************************************************************/
+/*                        WaitForPendingParts()                         */
+/************************************************************************/
+
+bool VSIMultipartWriteHandle::WaitForPendingParts()
+{
+    if (!m_poThreadPool)
+        return true;
+
+    bool bRet;
+    {
+        std::unique_lock oLock(m_oMutexParts);
+        while (m_nPendingParts > 0)
+            m_oCVParts.wait(oLock);
+        bRet = !m_bPartUploadError;
+    }
+
+    // Replay warnings and errors emitted by worker threads
+    m_poErrorAccumulator->ReplayErrors();
+    m_poErrorAccumulator = std::make_unique<CPLErrorAccumulator>();
+    return bRet;
+}
+
 std::string IVSIS3LikeFSHandlerWithMultipartUpload::UploadPart(
     const std::string &osFilename, int nPartNumber,
     const std::string &osUploadID, vsi_l_offset /* nPosition */,
@@ -1741,15 +1884,26 @@ int VSIMultipartWriteHandle::Close()
         }
         else
         {
-            if (m_bError)
+            const bool bWriteError = m_bError;
+            bool bUploadOK = !bWriteError;
+            if (bUploadOK && m_nBufferOff > 0 && !UploadPart())
+                bUploadOK = false;
+            // Parts still in flight must be done before aborting or
+            // completing the upload
+            if (!WaitForPendingParts())
+                bUploadOK = false;
+
+            if (!bUploadOK)
             {
+                // Keep the historical return code when the error was
+                // already reported by Write()
+                if (!bWriteError)
+                    nRet = -1;
                 if (!m_poFS->AbortMultipart(m_osFilename, m_osUploadID,
                                             m_poS3HandleHelper,
                                             m_oRetryParameters))
                     nRet = -1;
             }
-            else if (m_nBufferOff > 0 && !UploadPart())
-                nRet = -1;
             else if (m_poFS->CompleteMultipart(
                          m_osFilename, m_osUploadID, m_aosEtags, m_nCurOffset,
                          m_poS3HandleHelper, m_oRetryParameters))
@@ -1979,7 +2133,10 @@ const char *VSIS3FSHandler::GetOptions()
             .append(CPLSPrintf("%d", GetMinimumPartSizeInMiB()))
             .append("' max='")
             .append(CPLSPrintf("%d", GetMaximumPartSizeInMiB()))
-            .append("'/>")
+            .append("'/>"
+                    "  <Option name='CPL_VSIL_UPLOAD_NUM_THREADS' "
+                    "type='string' description='Number of parts uploaded in "
+                    "parallel. Either an integer or ALL_CPUS' default='1'/>")
             .append(VSICurlFilesystemHandlerBase::GetOptionsStatic())
             .append("</Options>"));
     return osOptions.c_str();
@@ -3375,6 +3532,43 @@ static std::string ComputeMD5OfLocalFile(VSILFILE *fp)
     return hhash;
 }
 
+/************************************************************************/
+/*                    ComputeMD5OfLocalFileCached()                     */
+/************************************************************************/
+
+/** Same as ComputeMD5OfLocalFile(), but caches the result per filename,
+ * size and modification time, so that repeated ETAG synchronizations of
+ * the same tree in a process do not read again unchanged files.
+ */
+static std::string ComputeMD5OfLocalFileCached(const char *pszFilename,
+                                               VSILFILE *fp)
+{
+    static std::mutex goMutex;
+    static lru11::Cache<std::string, std::string> goCache(100 * 1000);
+
+    std::string osKey;
+    VSIStatBufL sStat;
+    if (VSIStatL(pszFilename, &sStat) == 0)
+    {
+        osKey = CPLSPrintf(CPL_FRMT_GUIB "|" CPL_FRMT_GIB "|",
+                           static_cast<GUIntBig>(sStat.st_size),
+                           static_cast<GIntBig>(sStat.st_mtime));
+        osKey += pszFilename;
+        std::lock_guard oLock(goMutex);
+        std::string osMD5;
+        if (goCache.tryGet(osKey, osMD5))
+            return osMD5;
+    }
+
+    std::string osMD5 = ComputeMD5OfLocalFile(fp);
+    if (!osKey.empty())
+    {
+        std::lock_guard oLock(goMutex);
+        goCache.insert(osKey, osMD5);
+    }
+    return osMD5;
+}
+
 /************************************************************************/
 /*                           CopyFile()                                 */
 /************************************************************************/
@@ -4063,7 +4257,8 @@ bool IVSIS3LikeFSHandler::Sync(const char *pszSource, const char *pszTarget,
                 VSILFILE *fpOutAsIn = VSIFOpenExL(l_pszTarget, "rb", TRUE);
                 if (fpOutAsIn)
                 {
-                    std::string md5 = ComputeMD5OfLocalFile(fpOutAsIn);
+                    std::string md5 =
+                        ComputeMD5OfLocalFileCached(l_pszTarget, fpOutAsIn);
                     VSIFCloseL(fpOutAsIn);
                     if (getETAGSourceFile(l_pszSource) == md5)
                     {
@@ -4112,8 +4307,9 @@ bool IVSIS3LikeFSHandler::Sync(const char *pszSource, const char *pszTarget,
             case SyncStrategy::ETAG:
             {
                 l_fpIn = VSIFOpenExL(l_pszSource, "rb", TRUE);
-                if (l_fpIn && getETAGTargetFile(l_pszTarget) ==
-                                  ComputeMD5OfLocalFile(l_fpIn))
+                if (l_fpIn &&
+                    getETAGTargetFile(l_pszTarget) ==
+                        ComputeMD5OfLocalFileCached(l_pszSource, l_fpIn))
                 {
                     CPLDebug(GetDebugKey(), "%s has already same content as %s",
                              l_pszTarget, l_pszSource);
@@ -4295,13 +4491,23 @@ bool IVSIS3LikeFSHandler::Sync(const char *pszSource, const char *pszTarget,
                 return false;
         }
 
-        auto poTargetDir = std::unique_ptr<VSIDIR>(
-            VSIOpenDir(osTargetDir.c_str(), bRecursive ? -1 : 0, nullptr));
+        // Enumerate existing target files and directories
         std::set<std::string> oSetTargetSubdirs;
         std::map<std::string, VSIDIREntry> oMapExistingTargetFiles;
-        // Enumerate existing target files and directories
-        if (poTargetDir)
+        bool bTargetDirListed = false;
+        CPLErrorAccumulator oTargetListingErrors;
+        const auto ListTargetDir =
+            [&oSetTargetSubdirs, &oMapExistingTargetFiles, &bTargetDirListed,
+             &oTargetListingErrors, &osTargetDir, bRecursive,
+             &NormalizeDirSeparatorForDstFilename]()
         {
+            auto oAccumulator = oTargetListingErrors.InstallForCurrentScope();
+            CPL_IGNORE_RET_VAL(oAccumulator);
+            auto poTargetDir = std::unique_ptr<VSIDIR>(VSIOpenDir(
+                osTargetDir.c_str(), bRecursive ? -1 : 0, nullptr));
+            if (!poTargetDir)
+                return;
+            bTargetDirListed = true;
             while (true)
             {
                 const auto entry = VSIGetNextDirEntry(poTargetDir.get());
@@ -4319,21 +4525,24 @@ bool IVSIS3LikeFSHandler::Sync(const char *pszSource, const char *pszTarget,
                         std::make_pair(std::move(osDstName), *entry));
                 }
             }
-            poTargetDir.reset();
+        };
+
+        // When source and target are on different file systems, list the
+        // target in a separate thread while the source is being listed.
+        std::thread oTargetListingThread;
+        if (nRequestedThreads > 1 && VSIFileManager::GetHandler(pszTarget) !=
+                                         VSIFileManager::GetHandler(pszSource))
+        {
+            oTargetListingThread = std::thread(ListTargetDir);
         }
         else
         {
-            VSIStatBufL sTarget;
-            if (VSIStatL(osTargetDir.c_str(), &sTarget) < 0 &&
-                VSIMkdirRecursive(osTargetDir.c_str(), 0755) < 0)
-            {
-                CPLError(CE_Failure, CPLE_FileIO, "Cannot create directory %s",
-                         osTargetDir.c_str());
-                return false;
-            }
+            ListTargetDir();
         }
 
         // Enumerate source files and directories
+        std::vector<std::string> aosSourceSubdirs;
+        bool bTooSmallChunkSize = false;
         while (true)
         {
             const auto entry = VSIGetNextDirEntry(poSourceDir.get());
@@ -4341,15 +4550,8 @@ bool IVSIS3LikeFSHandler::Sync(const char *pszSource, const char *pszTarget,
                 break;
             if (VSI_ISDIR(entry->nMode))
             {
-                const auto osDstName =
-                    NormalizeDirSeparatorForDstFilename(entry->pszName);
-                if (oSetTargetSubdirs.find(osDstName) ==
-                    oSetTargetSubdirs.end())
-                {
-                    std::string osTargetSubdir(CPLFormFilenameSafe(
-                        osTargetDir.c_str(), osDstName.c_str(), nullptr));
-                    aoSetDirsToCreate.insert(std::move(osTargetSubdir));
-                }
+                aosSourceSubdirs.push_back(
+                    NormalizeDirSeparatorForDstFilename(entry->pszName));
             }
             else
             {
@@ -4361,9 +4563,8 @@ bool IVSIS3LikeFSHandler::Sync(const char *pszSource, const char *pszTarget,
                 if (nChunksLarge >
                     1000)  // must also be below knMAX_PART_NUMBER for upload
                 {
-                    CPLError(CE_Failure, CPLE_AppDefined,
-                             "Too small CHUNK_SIZE w.r.t file size");
-                    return false;
+                    bTooSmallChunkSize = true;
+                    break;
                 }
                 ChunkToCopy chunk;
                 chunk.osSrcFilename = entry->pszName;
@@ -4389,6 +4590,37 @@ bool IVSIS3LikeFSHandler::Sync(const char *pszSource, const char *pszTarget,
             }
         }
         poSourceDir.reset();
+        if (oTargetListingThread.joinable())
+            oTargetListingThread.join();
+        oTargetListingErrors.ReplayErrors();
+
+        if (bTooSmallChunkSize)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Too small CHUNK_SIZE w.r.t file size");
+            return false;
+        }
+
+        if (!bTargetDirListed)
+        {
+            VSIStatBufL sTarget;
+            if (VSIStatL(osTargetDir.c_str(), &sTarget) < 0 &&
+                VSIMkdirRecursive(osTargetDir.c_str(), 0755) < 0)
+            {
+                CPLError(CE_Failure, CPLE_FileIO, "Cannot create directory %s",
+                         osTargetDir.c_str());
+                return false;
+            }
+        }
+
+        for (const auto &osDstName : aosSourceSubdirs)
+        {
+            if (oSetTargetSubdirs.find(osDstName) == oSetTargetSubdirs.end())
+            {
+                aoSetDirsToCreate.insert(CPLFormFilenameSafe(
+                    osTargetDir.c_str(), osDstName.c_str(), nullptr));
+            }
+        }
 
         // Create missing target directories, sorted in lexicographic order
         // so that upper-level directories are listed before subdirectories.
@@ -4406,13 +4638,10 @@ bool IVSIS3LikeFSHandler::Sync(const char *pszSource, const char *pszTarget,
             }
         }
 
-        // Collect source files to copy
-        const size_t nChunkCount = aoChunksToCopy.size();
-        for (size_t iChunk = 0; iChunk < nChunkCount; ++iChunk)
+        // Determine whether a file can be skipped because the target is
+        // already up-to-date.
+        const auto CanSkipFile = [&](const ChunkToCopy &chunk)
         {
-            const auto &chunk = aoChunksToCopy[iChunk];
-            if (chunk.nStartOffset != 0)
-                continue;
             const std::string osSubSource(
                 CPLFormFilenameSafe(osSourceWithoutSlash.c_str(),
                                     chunk.osSrcFilename.c_str(), nullptr));
@@ -4471,9 +4700,48 @@ bool IVSIS3LikeFSHandler::Sync(const char *pszSource, const char *pszTarget,
                     }
                 }
             }
+            return bSkip;
+        };
+
+        // With the ETAG strategy, deciding requires computing the MD5 of
+        // local files, so do it in parallel.
+        const size_t nChunkCount = aoChunksToCopy.size();
+        std::vector<char> abCanSkip;
+        if (eSyncStrategy == SyncStrategy::ETAG && nRequestedThreads > 1 &&
+            (bDownloadFromNetworkToLocal || bUploadFromLocalToNetwork))
+        {
+            CPLWorkerThreadPool oPool;
+            if (oPool.Setup(std::min(nRequestedThreads, CPLGetNumCPUs()),
+                            nullptr, nullptr))
+            {
+                abCanSkip.resize(nChunkCount);
+                for (size_t iChunk = 0; iChunk < nChunkCount; ++iChunk)
+                {
+                    if (aoChunksToCopy[iChunk].nStartOffset != 0)
+                        continue;
+                    oPool.SubmitJob(
+                        [&CanSkipFile, &abCanSkip, &aoChunksToCopy, iChunk]()
+                        {
+                            abCanSkip[iChunk] =
+                                CanSkipFile(aoChunksToCopy[iChunk]);
+                        });
+                }
+                oPool.WaitCompletion();
+            }
+        }
 
+        // Collect source files to copy
+        for (size_t iChunk = 0; iChunk < nChunkCount; ++iChunk)
+        {
+            const auto &chunk = aoChunksToCopy[iChunk];
+            if (chunk.nStartOffset != 0)
+                continue;
+            const bool bSkip = abCanSkip.empty() ? CanSkipFile(chunk)
+                                                 : abCanSkip[iChunk] != 0;
             if (!bSkip)
             {
+                const std::string osSubTarget(CPLFormFilenameSafe(
+                    osTargetDir.c_str(), chunk.osDstFilename.c_str(), nullptr));
                 anIndexToCopy.push_back(iChunk);
                 nTotalSize += chunk.nTotalSize;
                 if (chunk.nSize < chunk.nTotalSize)
@@ -4767,6 +5035,7 @@ bool IVSIS3LikeFSHandler::Sync(const char *pszSource, const char *pszTarget,
         std::string osTarget{};
         std::mutex sMutex{};
         uint64_t nTotalCopied = 0;
+        int nFilesCopied = 0;
         bool bSupportsParallelMultipartUpload = false;
         size_t nMaxChunkSize = 0;
         const CPLHTTPRetryParameters &oRetryParameters;
@@ -4914,6 +5183,11 @@ bool IVSIS3LikeFSHandler::Sync(const char *pszSource, const char *pszTarget,
                 if (bSuccess)
                 {
                     ProgressData::progressFunc(1.0, "", &progressData);
+                    if (chunk.nStartOffset + chunk.nSize >= chunk.nTotalSize)
+                    {
+                        std::lock_guard<std::mutex> lock(queue->sMutex);
+                        queue->nFilesCopied++;
+                    }
                 }
                 else
                 {
@@ -4933,6 +5207,11 @@ bool IVSIS3LikeFSHandler::Sync(const char *pszSource, const char *pszTarget,
                     queue->ret = false;
                     queue->stop = true;
                 }
+                else
+                {
+                    std::lock_guard<std::mutex> lock(queue->sMutex);
+                    queue->nFilesCopied++;
+                }
             }
         }
     };
@@ -4960,14 +5239,28 @@ bool IVSIS3LikeFSHandler::Sync(const char *pszSource, const char *pszTarget,
         if (pProgressFunc)
         {
             const uint64_t nTotalSizeDenom = std::max<uint64_t>(1, nTotalSize);
+            const int nFilesToCopy = static_cast<int>(std::count_if(
+                anIndexToCopy.begin(), anIndexToCopy.end(),
+                [&aoChunksToCopy](size_t iChunk)
+                { return aoChunksToCopy[iChunk].nStartOffset == 0; }));
+            const auto oStartTime = std::chrono::steady_clock::now();
             while (!sJobQueue.stop)
             {
                 CPLSleep(0.1);
                 sJobQueue.sMutex.lock();
                 const auto nTotalCopied = sJobQueue.nTotalCopied;
+                const int nFilesCopied = sJobQueue.nFilesCopied;
                 sJobQueue.sMutex.unlock();
-                if (!pProgressFunc(double(nTotalCopied) / nTotalSizeDenom, "",
-                                   pProgressData))
+                const double dfElapsed =
+                    std::chrono::duration<double>(
+                        std::chrono::steady_clock::now() - oStartTime)
+                        .count();
+                const std::string osMsg(CPLSPrintf(
+                    "%d/%d files, %.1f MB/s", nFilesCopied, nFilesToCopy,
+                    dfElapsed > 0 ? double(nTotalCopied) / 1e6 / dfElapsed
+                                  : 0.0));
+                if (!pProgressFunc(double(nTotalCopied) / nTotalSizeDenom,
+                                   osMsg.c_str(), pProgressData))
                 {
                     sJobQueue.ret = false;
                     sJobQueue.stop = true;
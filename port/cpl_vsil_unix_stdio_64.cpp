@@ -73,8 +73,18 @@
 #include <limits.h>
 #endif
 
+#include <algorithm>
+#include <deque>
 #include <limits>
+#include <memory>
 #include <new>
+#include <vector>
+
+#ifdef HAVE_IO_URING
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#endif
 
 #include "cpl_config.h"
 #include "cpl_conv.h"
@@ -139,6 +149,352 @@ static_assert(sizeof(VSIStatBufL::st_size) == sizeof(vsi_l_offset),
               "add the -DBUILD_WITHOUT_64BIT_OFFSET define");
 #endif
 
+#ifdef HAVE_IO_URING
+
+/************************************************************************/
+/* ==================================================================== */
+/*                            VSIIOURing                                */
+/* ==================================================================== */
+/************************************************************************/
+
+namespace
+{
+
+// Minimal io_uring wrapper, directly issuing the system calls, so as not to
+// depend on liburing. One instance is created per thread, which allows
+// several threads to issue ReadMultiRange() requests on the same file handle
+// without any locking.
+class VSIIOURing
+{
+    CPL_DISALLOW_COPY_ASSIGN(VSIIOURing)
+
+    int m_fd = -1;
+    unsigned m_nEntries = 0;
+    bool m_bBroken = false;
+    // Set when reads could still be in flight while the ring is destroyed
+    bool m_bLeaked = false;
+
+    void *m_pSQRing = MAP_FAILED;
+    size_t m_nSQRingSize = 0;
+    void *m_pCQRing = MAP_FAILED;
+    size_t m_nCQRingSize = 0;
+    void *m_pSQEs = MAP_FAILED;
+    size_t m_nSQEsSize = 0;
+
+    unsigned *m_pnSQTail = nullptr;
+    unsigned m_nSQMask = 0;
+    unsigned *m_panSQArray = nullptr;
+    struct io_uring_sqe *m_pasSQEs = nullptr;
+    unsigned *m_pnCQHead = nullptr;
+    unsigned *m_pnCQTail = nullptr;
+    unsigned m_nCQMask = 0;
+    struct io_uring_cqe *m_pasCQEs = nullptr;
+
+    bool Init(unsigned nEntries);
+
+  public:
+    VSIIOURing() = default;
+    ~VSIIOURing();
+
+    static VSIIOURing *GetForCurrentThread();
+
+    bool ReadMultiRange(int fd, int nRanges, void **ppData,
+                        const vsi_l_offset *panOffsets,
+                        const size_t *panSizes);
+};
+
+/************************************************************************/
+/*                            ~VSIIOURing()                             */
+/************************************************************************/
+
+VSIIOURing::~VSIIOURing()
+{
+    // The kernel may still complete reads in the user buffers and post
+    // their completions in the rings, so keep everything alive.
+    if (m_bLeaked)
+        return;
+    if (m_pSQEs != MAP_FAILED)
+        munmap(m_pSQEs, m_nSQEsSize);
+    if (m_pCQRing != MAP_FAILED && m_pCQRing != m_pSQRing)
+        munmap(m_pCQRing, m_nCQRingSize);
+    if (m_pSQRing != MAP_FAILED)
+        munmap(m_pSQRing, m_nSQRingSize);
+    if (m_fd >= 0)
+        close(m_fd);
+}
+
+/************************************************************************/
+/*                                Init()                                */
+/************************************************************************/
+
+bool VSIIOURing::Init(unsigned nEntries)
+{
+    struct io_uring_params sParams;
+    memset(&sParams, 0, sizeof(sParams));
+    m_fd = static_cast<int>(syscall(__NR_io_uring_setup, nEntries, &sParams));
+    if (m_fd < 0)
+    {
+        CPLDebug("VSI", "io_uring_setup() failed: %s", strerror(errno));
+        return false;
+    }
+    m_nEntries = sParams.sq_entries;
+
+    m_nSQRingSize =
+        sParams.sq_off.array + sParams.sq_entries * sizeof(unsigned);
+    m_nCQRingSize =
+        sParams.cq_off.cqes + sParams.cq_entries * sizeof(struct io_uring_cqe);
+    const bool bSingleMMap = (sParams.features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if (bSingleMMap)
+    {
+        m_nSQRingSize = std::max(m_nSQRingSize, m_nCQRingSize);
+        m_nCQRingSize = m_nSQRingSize;
+    }
+
+    m_pSQRing = mmap(nullptr, m_nSQRingSize, PROT_READ | PROT_WRITE,
+                     MAP_SHARED | MAP_POPULATE, m_fd, IORING_OFF_SQ_RING);
+    if (m_pSQRing == MAP_FAILED)
+        return false;
+    if (bSingleMMap)
+    {
+        m_pCQRing = m_pSQRing;
+    }
+    else
+    {
+        m_pCQRing = mmap(nullptr, m_nCQRingSize, PROT_READ | PROT_WRITE,
+                         MAP_SHARED | MAP_POPULATE, m_fd, IORING_OFF_CQ_RING);
+        if (m_pCQRing == MAP_FAILED)
+            return false;
+    }
+    m_nSQEsSize = sParams.sq_entries * sizeof(struct io_uring_sqe);
+    m_pSQEs = mmap(nullptr, m_nSQEsSize, PROT_READ | PROT_WRITE,
+                   MAP_SHARED | MAP_POPULATE, m_fd, IORING_OFF_SQES);
+    if (m_pSQEs == MAP_FAILED)
+        return false;
+
+    GByte *pabySQRing = static_cast<GByte *>(m_pSQRing);
+    m_pnSQTail = reinterpret_cast<unsigned *>(pabySQRing + sParams.sq_off.tail);
+    m_nSQMask =
+        *reinterpret_cast<unsigned *>(pabySQRing + sParams.sq_off.ring_mask);
+    m_panSQArray =
+        reinterpret_cast<unsigned *>(pabySQRing + sParams.sq_off.array);
+    m_pasSQEs = static_cast<struct io_uring_sqe *>(m_pSQEs);
+
+    GByte *pabyCQRing = static_cast<GByte *>(m_pCQRing);
+    m_pnCQHead = reinterpret_cast<unsigned *>(pabyCQRing + sParams.cq_off.head);
+    m_pnCQTail = reinterpret_cast<unsigned *>(pabyCQRing + sParams.cq_off.tail);
+    m_nCQMask =
+        *reinterpret_cast<unsigned *>(pabyCQRing + sParams.cq_off.ring_mask);
+    m_pasCQEs = reinterpret_cast<struct io_uring_cqe *>(pabyCQRing +
+                                                        sParams.cq_off.cqes);
+
+    return true;
+}
+
+/************************************************************************/
+/*                        GetForCurrentThread()                         */
+/************************************************************************/
+
+/** Return the io_uring instance of the current thread, or nullptr if
+ * io_uring is not available (old kernel, seccomp filtering, etc.)
+ */
+VSIIOURing *VSIIOURing::GetForCurrentThread()
+{
+    static thread_local std::unique_ptr<VSIIOURing> tlsRing;
+    static thread_local bool tlsbInitDone = false;
+    if (!tlsbInitDone)
+    {
+        tlsbInitDone = true;
+        auto poRing = std::make_unique<VSIIOURing>();
+        constexpr unsigned QUEUE_DEPTH = 64;
+        if (poRing->Init(QUEUE_DEPTH))
+            tlsRing = std::move(poRing);
+    }
+    else if (tlsRing && tlsRing->m_bBroken)
+    {
+        tlsRing.reset();
+    }
+    return tlsRing.get();
+}
+
+/************************************************************************/
+/*                          ReadMultiRange()                            */
+/************************************************************************/
+
+/** Read all ranges, keeping up to m_nEntries reads in flight.
+ *
+ * Returns false if any range could not be entirely read, in which case
+ * the caller should fall back to synchronous reads.
+ */
+bool VSIIOURing::ReadMultiRange(int fd, int nRanges, void **ppData,
+                                const vsi_l_offset *panOffsets,
+                                const size_t *panSizes)
+{
+    if (nRanges <= 0)
+        return true;
+
+    // The result of a read is returned as a 32-bit signed integer
+    constexpr size_t MAX_READ_SIZE = 1U << 30;
+
+    // Maximum number of times a read may be resubmitted after a short read or
+    // an interruption, and of consecutive io_uring_enter() calls that may be
+    // interrupted, before giving up.
+    constexpr int MAX_RETRIES = 100;
+
+    // Maximum number of failed io_uring_enter() calls while waiting for the
+    // in-flight reads after the ring has been marked as broken, each one
+    // being followed by a short sleep, before giving up.
+    constexpr int MAX_DRAIN_FAILURES = 100;
+
+    // One iovec per range, as there is at most one read in flight per range
+    std::vector<struct iovec> asIOVec(nRanges);
+    std::vector<size_t> anDone(nRanges);
+    std::vector<int> anRetries(nRanges);
+    int nEnterRetries = 0;
+    int nDrainFailures = 0;
+    std::deque<int> oQueue;
+    for (int i = 0; i < nRanges; ++i)
+    {
+        if (panSizes[i] > 0)
+            oQueue.push_back(i);
+    }
+
+    bool bOK = true;
+    unsigned nToSubmit = 0;
+    unsigned nInFlight = 0;
+    while (true)
+    {
+        while (bOK && !oQueue.empty() && nInFlight + nToSubmit < m_nEntries)
+        {
+            const int i = oQueue.front();
+            oQueue.pop_front();
+
+            asIOVec[i].iov_base = static_cast<GByte *>(ppData[i]) + anDone[i];
+            asIOVec[i].iov_len =
+                std::min(panSizes[i] - anDone[i], MAX_READ_SIZE);
+
+            // We are the only producer, so no need for an atomic load
+            const unsigned nTail = *m_pnSQTail;
+            const unsigned nIdx = nTail & m_nSQMask;
+            struct io_uring_sqe *psSQE = &m_pasSQEs[nIdx];
+            memset(psSQE, 0, sizeof(*psSQE));
+            psSQE->opcode = IORING_OP_READV;
+            psSQE->fd = fd;
+            psSQE->off = panOffsets[i] + anDone[i];
+            psSQE->addr = reinterpret_cast<uintptr_t>(&asIOVec[i]);
+            psSQE->len = 1;
+            psSQE->user_data = static_cast<uint64_t>(i);
+            m_panSQArray[nIdx] = nIdx;
+            __atomic_store_n(m_pnSQTail, nTail + 1, __ATOMIC_RELEASE);
+            ++nToSubmit;
+        }
+
+        if (nInFlight == 0 && nToSubmit == 0)
+            break;
+
+        const int nRet = static_cast<int>(
+            syscall(__NR_io_uring_enter, m_fd, m_bBroken ? 0 : nToSubmit, 1,
+                    IORING_ENTER_GETEVENTS, nullptr, 0));
+        if (nRet >= 0)
+        {
+            nToSubmit -= static_cast<unsigned>(nRet);
+            nInFlight += static_cast<unsigned>(nRet);
+            nEnterRetries = 0;
+        }
+        else if (m_bBroken)
+        {
+            // Already waiting for the in-flight reads: back off instead of
+            // busy-spinning, as completions may only be flushed by a
+            // successful io_uring_enter() (e.g. on CQ overflow).
+            if (++nDrainFailures > MAX_DRAIN_FAILURES)
+            {
+                CPLError(CE_Warning, CPLE_FileIO,
+                         "io_uring_enter() failed: %s. Giving up waiting "
+                         "for %u in-flight reads",
+                         strerror(errno), nInFlight);
+                // Never release the ring, nor reuse it
+                m_bLeaked = true;
+                break;
+            }
+            CPLSleep(0.01);
+        }
+        else if ((errno != EINTR && errno != EAGAIN && errno != EBUSY) ||
+                 ++nEnterRetries > MAX_RETRIES)
+        {
+            CPLDebug("VSI", "io_uring_enter() failed: %s", strerror(errno));
+            // Entries that have not been submitted are left in the ring, so
+            // it can no longer be used. Wait for the in-flight reads to
+            // complete, since they target the user buffers.
+            m_bBroken = true;
+            bOK = false;
+            nToSubmit = 0;
+        }
+
+        // We are the only consumer, so no need for an atomic load
+        unsigned nHead = *m_pnCQHead;
+        const unsigned nCQTail = __atomic_load_n(m_pnCQTail, __ATOMIC_ACQUIRE);
+        while (nHead != nCQTail)
+        {
+            const struct io_uring_cqe *psCQE = &m_pasCQEs[nHead & m_nCQMask];
+            const int i = static_cast<int>(psCQE->user_data);
+            const int nRes = psCQE->res;
+            ++nHead;
+            --nInFlight;
+            bool bRetry = false;
+            if (nRes > 0)
+            {
+                anDone[i] += static_cast<size_t>(nRes);
+                // Short read: request the remaining bytes
+                bRetry = anDone[i] < panSizes[i];
+            }
+            else if (nRes == -EINTR || nRes == -EAGAIN)
+            {
+                bRetry = true;
+            }
+            else
+            {
+                // nRes == 0 means end of file
+                if (nRes < 0)
+                    CPLDebug("VSI", "io_uring read failed: %s",
+                             strerror(-nRes));
+                bOK = false;
+            }
+            if (bRetry)
+            {
+                if (++anRetries[i] > MAX_RETRIES)
+                {
+                    CPLDebug("VSI", "io_uring read: too many retries");
+                    bOK = false;
+                }
+                else
+                {
+                    oQueue.push_back(i);
+                }
+            }
+        }
+        __atomic_store_n(m_pnCQHead, nHead, __ATOMIC_RELEASE);
+    }
+
+    return bOK;
+}
+
+}  // namespace
+
+#endif  // HAVE_IO_URING
+
+/************************************************************************/
+/*                       VSIUnixStdioUseIOURing()                       */
+/************************************************************************/
+
+static bool VSIUnixStdioUseIOURing()
+{
+#ifdef HAVE_IO_URING
+    return CPLTestBool(CPLGetConfigOption("CPL_VSIL_USE_IO_URING", "NO")) &&
+           VSIIOURing::GetForCurrentThread() != nullptr;
+#else
+    return false;
+#endif
+}
+
 /************************************************************************/
 /* ==================================================================== */
 /*                       VSIUnixStdioFilesystemHandler                  */
@@ -182,6 +538,11 @@ class VSIUnixStdioFilesystemHandler final : public VSIFilesystemHandler
     bool SupportsRandomWrite(const char *pszPath,
                              bool /* bAllowLocalTempFile */) override;
 
+    int HasOptimizedReadMultiRange(const char * /* pszPath */) override
+    {
+        return VSIUnixStdioUseIOURing();
+    }
+
     VSIDIR *OpenDir(const char *pszPath, int nRecurseDepth,
                     const char *const *papszOptions) override;
 
@@ -251,6 +612,11 @@ class VSIUnixStdioHandle final : public VSIVirtualHandle
     bool HasPRead() const override;
     size_t PRead(void * /*pBuffer*/, size_t /* nSize */,
                  vsi_l_offset /*nOffset*/) const override;
+    int ReadMultiRange(int nRanges, void **ppData,
+                       const vsi_l_offset *panOffsets,
+                       const size_t *panSizes) override;
+    void AdviseRead(int nRanges, const vsi_l_offset *panOffsets,
+                    const size_t *panSizes) override;
 #endif
 };
 
@@ -686,6 +1052,87 @@ size_t VSIUnixStdioHandle::PRead(void *pBuffer, size_t nSize,
     return pread(fileno(fp), pBuffer, nSize, static_cast<off_t>(nOffset));
 #endif
 }
+
+/************************************************************************/
+/*                          ReadMultiRange()                            */
+/************************************************************************/
+
+int VSIUnixStdioHandle::ReadMultiRange(int nRanges, void **ppData,
+                                       const vsi_l_offset *panOffsets,
+                                       const size_t *panSizes)
+{
+    // pread() would not see data pending in the FILE* buffer
+    if (!bReadOnly)
+        return VSIVirtualHandle::ReadMultiRange(nRanges, ppData, panOffsets,
+                                                panSizes);
+
+#ifdef HAVE_IO_URING
+    if (VSIUnixStdioUseIOURing() &&
+        VSIIOURing::GetForCurrentThread()->ReadMultiRange(
+            fileno(fp), nRanges, ppData, panOffsets, panSizes))
+    {
+        return 0;
+    }
+#endif
+
+    // Contrary to the default implementation, do not alter the file
+    // position, and by-pass the FILE* buffer.
+    for (int i = 0; i < nRanges; ++i)
+    {
+        GByte *pabyData = static_cast<GByte *>(ppData[i]);
+        size_t nDone = 0;
+        while (nDone < panSizes[i])
+        {
+            const size_t nRead =
+                PRead(pabyData + nDone, panSizes[i] - nDone,
+                      panOffsets[i] + nDone);
+            if (nRead == 0 || nRead == static_cast<size_t>(-1))
+            {
+                if (nRead == static_cast<size_t>(-1) && errno == EINTR)
+                    continue;
+                return -1;
+            }
+            nDone += nRead;
+        }
+    }
+    return 0;
+}
+
+/************************************************************************/
+/*                            AdviseRead()                              */
+/************************************************************************/
+
+void VSIUnixStdioHandle::AdviseRead(
+#ifdef POSIX_FADV_WILLNEED
+    int nRanges, const vsi_l_offset *panOffsets, const size_t *panSizes
+#else
+    int /* nRanges */, const vsi_l_offset * /* panOffsets */,
+    const size_t * /* panSizes */
+#endif
+)
+{
+#ifdef POSIX_FADV_WILLNEED
+    // Let the kernel start fetching the ranges in the page cache, so that
+    // the subsequent reads do not block on I/O
+    const int fd = fileno(fp);
+    for (int i = 0; i < nRanges; ++i)
+    {
+#ifdef HAVE_PREAD64
+        const int nRet = posix_fadvise64(
+            fd, static_cast<off64_t>(panOffsets[i]),
+            static_cast<off64_t>(panSizes[i]), POSIX_FADV_WILLNEED);
+#else
+        const int nRet =
+            posix_fadvise(fd, static_cast<off_t>(panOffsets[i]),
+                          static_cast<off_t>(panSizes[i]), POSIX_FADV_WILLNEED);
+#endif
+        if (nRet != 0)
+        {
+            CPLDebug("VSI", "posix_fadvise() failed: %s", strerror(nRet));
+        }
+    }
+#endif
+}
 #endif
 
 /************************************************************************/
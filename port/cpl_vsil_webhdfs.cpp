@@ -1162,8 +1162,10 @@ retry:
     oFileProp.eExists = EXIST_YES;
     poFS->SetCachedFileProp(m_pszURL, oFileProp);
 
+    // Response headers are not collected: no validator to check
     DownloadRegionPostProcess(startOffset, nBlocks, sWriteFuncData.pBuffer,
-                              sWriteFuncData.nSize);
+                              sWriteFuncData.nSize,
+                              CanStoreInPersistentCache(nullptr, oFileProp));
 
     std::string osRet;
     osRet.assign(sWriteFuncData.pBuffer, sWriteFuncData.nSize);